@@ -583,6 +583,68 @@ static uint32_t usage_fault(const z_arch_esf_t *esf)
 	return reason;
 }
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+/**
+ *
+ * @brief Handle an FP access trap of the deferred FP context switching
+ *
+ * With deferred FP context switching, CP10/CP11 access is disabled while
+ * the FP unit still holds the context of another thread. The first FP
+ * instruction of the current context then faults (as a UsageFault, or a
+ * HardFault if the UsageFault exception is not separately enabled) and is
+ * handled here: the owner's callee-saved registers are moved into its
+ * thread struct, which also flushes any pending lazy stacking of the
+ * owner's s0-s15 into the owner's exception stack frame, and FP access
+ * is re-enabled before retrying the instruction.
+ *
+ * @return true if the fault was an FP access trap and has been handled
+ */
+static bool fpu_access_trap(void)
+{
+	struct k_thread *owner;
+	unsigned int key;
+
+	if (((SCB->CFSR & SCB_CFSR_NOCP_Msk) == 0) ||
+	    ((SCB->CPACR & CPACR_CP10_Msk) != 0)) {
+		/* Not a trap of the deferred FP context switching */
+		return false;
+	}
+
+	/* Clear the sticky NOCP bit, and the escalation flag in case the
+	 * trap was taken as a HardFault.
+	 */
+	SCB->CFSR |= SCB_CFSR_NOCP_Msk;
+	SCB->HFSR |= SCB_HFSR_FORCED_Msk;
+
+#if defined(CONFIG_USERSPACE)
+	SCB->CPACR |= CPACR_CP10_FULL_ACCESS | CPACR_CP11_FULL_ACCESS;
+#else
+	SCB->CPACR |= CPACR_CP10_PRIV_ACCESS | CPACR_CP11_PRIV_ACCESS;
+#endif /* CONFIG_USERSPACE */
+	__DSB();
+	__ISB();
+
+	key = arch_irq_lock();
+
+	owner = _kernel.cpus[0].fpu_owner;
+	if (owner != NULL) {
+		__asm__ volatile (
+			"vstmia %0, {s16-s31};\n"
+			: : "r" (&owner->arch.preempt_float)
+			: "memory"
+			);
+		_kernel.cpus[0].fpu_owner = NULL;
+	}
+
+	/* The faulting context starts off with a clean FP state */
+	__set_FPSCR(0);
+
+	arch_irq_unlock(key);
+
+	return true;
+}
+#endif /* CONFIG_FPU_SHARING_LAZY */
+
 #if defined(CONFIG_ARM_SECURE_FIRMWARE)
 /**
  *
@@ -1046,6 +1108,16 @@ void z_arm_fault(uint32_t msp, uint32_t psp, uint32_t exc_return,
 	 */
 	z_arch_esf_t esf_copy;
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+	/* A first FP instruction executed while CP10/CP11 access is
+	 * disabled hands the FP unit over to the faulting context; this
+	 * is not an error condition and the instruction is retried.
+	 */
+	if (fpu_access_trap()) {
+		return;
+	}
+#endif /* CONFIG_FPU_SHARING_LAZY */
+
 	/* Force unlock interrupts */
 	arch_irq_unlock(0);
 
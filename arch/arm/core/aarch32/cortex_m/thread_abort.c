@@ -24,8 +24,50 @@
 #include <zephyr/wait_q.h>
 #include <zephyr/sys/__assert.h>
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+/* Release the FP unit if its deferred context belongs to the aborted
+ * thread: once the thread is gone its stack may be reclaimed, so neither
+ * the pending lazy stacking nor the owner pointer may keep referencing it.
+ */
+static void fpu_disown(k_tid_t thread)
+{
+	unsigned int key = arch_irq_lock();
+
+	if (_kernel.cpus[0].fpu_owner == thread) {
+		FPU->FPCCR &= ~FPU_FPCCR_LSPACT_Msk;
+		_kernel.cpus[0].fpu_owner = NULL;
+	}
+
+	if (_current == thread) {
+		if (arch_is_in_isr()) {
+			if (_kernel.cpus[0].fpu_owner == NULL) {
+				/* The thread is switched out for the last
+				 * time on the way out of this handler. With
+				 * no other deferred owner, any lazy stacking
+				 * still pending targets the dying thread's
+				 * own exception frame; discard it.
+				 */
+				FPU->FPCCR &= ~FPU_FPCCR_LSPACT_Msk;
+			}
+		} else {
+			/* Deactivate the FP context so that the final
+			 * context switch does not take ownership for the
+			 * dying thread.
+			 */
+			__set_CONTROL(__get_CONTROL() & ~CONTROL_FPCA_Msk);
+		}
+	}
+
+	arch_irq_unlock(key);
+}
+#endif /* CONFIG_FPU_SHARING_LAZY */
+
 void z_impl_k_thread_abort(k_tid_t thread)
 {
+#if defined(CONFIG_FPU_SHARING_LAZY)
+	fpu_disown(thread);
+#endif
+
 	if (_current == thread) {
 		if (arch_is_in_isr()) {
 			/* ARM is unlike most arches in that this is true
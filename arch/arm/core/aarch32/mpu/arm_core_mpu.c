@@ -164,6 +164,62 @@ void z_arm_configure_static_mpu_regions(void)
 #endif /* CONFIG_MPU_REQUIRES_NON_OVERLAPPING_REGIONS */
 }
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+/* Generation counter for the partition sets of all memory domains. Every
+ * partition addition or removal bumps it, invalidating the per-thread MPU
+ * register images that were captured against an older partition layout.
+ */
+static uint32_t dyn_regions_generation;
+
+/* Re-program the dynamic MPU regions directly from the thread's cached
+ * register image, provided the image is still valid, i.e. none of the
+ * inputs it was computed from has changed in the meantime.
+ *
+ * Returns true if the cached image has been programmed, false if the
+ * dynamic regions need to be recomputed.
+ */
+static bool dyn_region_cache_load(struct k_thread *thread, uint32_t guard_size)
+{
+	if (!thread->arch.mpu_cache.valid ||
+	    (thread->arch.mpu_cache.generation != dyn_regions_generation) ||
+	    (thread->arch.mpu_cache.guard_size != guard_size) ||
+	    (thread->arch.mpu_cache.priv_stack_start !=
+	     thread->arch.priv_stack_start)) {
+		return false;
+	}
+
+	arm_core_mpu_load_dyn_region_image(thread->arch.mpu_cache.regions,
+					   thread->arch.mpu_cache.num_regions);
+
+	return true;
+}
+
+/* Capture the register image of the dynamic MPU regions that have just
+ * been programmed for the thread, stamping it with the inputs it has been
+ * computed from.
+ */
+static void dyn_region_cache_save(struct k_thread *thread, uint32_t guard_size)
+{
+	int num_regions;
+
+	num_regions = arm_core_mpu_save_dyn_region_image(
+		thread->arch.mpu_cache.regions,
+		ARRAY_SIZE(thread->arch.mpu_cache.regions));
+
+	if (num_regions < 0) {
+		thread->arch.mpu_cache.valid = false;
+		return;
+	}
+
+	thread->arch.mpu_cache.generation = dyn_regions_generation;
+	thread->arch.mpu_cache.guard_size = guard_size;
+	thread->arch.mpu_cache.priv_stack_start =
+		thread->arch.priv_stack_start;
+	thread->arch.mpu_cache.num_regions = num_regions;
+	thread->arch.mpu_cache.valid = true;
+}
+#endif /* CONFIG_MPU_DYNAMIC_REGION_CACHE */
+
 /**
  * @brief Use the HW-specific MPU driver to program
  *        the dynamic MPU regions.
@@ -206,6 +262,36 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 
 	uint8_t region_num = 0U;
 
+#if defined(CONFIG_MPU_STACK_GUARD)
+	/* Privileged stack guard */
+	uintptr_t guard_start;
+	size_t guard_size = MPU_GUARD_ALIGN_AND_SIZE;
+
+#if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
+	/* Compute the guard size and update the FP state of the thread
+	 * up-front: the guard width is an input to the region cache
+	 * validity check (below), and the FP book-keeping must run on
+	 * every context switch, regardless of how the dynamic regions
+	 * end up being programmed.
+	 */
+	guard_size = z_arm_mpu_stack_guard_and_fpu_adjust(thread);
+#endif
+#elif defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+	/* Without a stack guard the guard width does not participate in
+	 * the region cache validity check.
+	 */
+	const size_t guard_size = 0U;
+#endif
+
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+	if (dyn_region_cache_load(thread, guard_size)) {
+		/* The thread's cached register image was still valid and
+		 * has been programmed directly; nothing to recompute.
+		 */
+		return;
+	}
+#endif
+
 #if defined(CONFIG_USERSPACE)
 	/* Memory domain */
 	LOG_DBG("configure thread %p's domain", thread);
@@ -268,14 +354,6 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 	 * being mapped.
 	 */
 
-	/* Privileged stack guard */
-	uintptr_t guard_start;
-	size_t guard_size = MPU_GUARD_ALIGN_AND_SIZE;
-
-#if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
-	guard_size = z_arm_mpu_stack_guard_and_fpu_adjust(thread);
-#endif
-
 #if defined(CONFIG_USERSPACE)
 	if (thread->arch.priv_stack_start) {
 		/* A K_USER thread has the stack guard protecting the privilege
@@ -320,6 +398,10 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 #ifdef CONFIG_AARCH32_ARMV8_R
 	arm_core_mpu_enable();
 #endif
+
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+	dyn_region_cache_save(thread, guard_size);
+#endif
 }
 
 #if defined(CONFIG_USERSPACE)
@@ -343,4 +425,46 @@ int arch_buffer_validate(void *addr, size_t size, int write)
 	return arm_core_mpu_buffer_validate(addr, size, write);
 }
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+/* The MPU regions of a thread are (re-)programmed during context switch,
+ * so no hardware state needs to be modified synchronously, here; the hooks
+ * only invalidate the cached register images affected by the update.
+ */
+int arch_mem_domain_partition_add(struct k_mem_domain *domain,
+				  uint32_t partition_id)
+{
+	ARG_UNUSED(domain);
+	ARG_UNUSED(partition_id);
+
+	dyn_regions_generation++;
+
+	return 0;
+}
+
+int arch_mem_domain_partition_remove(struct k_mem_domain *domain,
+				     uint32_t partition_id)
+{
+	ARG_UNUSED(domain);
+	ARG_UNUSED(partition_id);
+
+	dyn_regions_generation++;
+
+	return 0;
+}
+
+int arch_mem_domain_thread_add(struct k_thread *thread)
+{
+	thread->arch.mpu_cache.valid = false;
+
+	return 0;
+}
+
+int arch_mem_domain_thread_remove(struct k_thread *thread)
+{
+	thread->arch.mpu_cache.valid = false;
+
+	return 0;
+}
+#endif /* CONFIG_MPU_DYNAMIC_REGION_CACHE */
+
 #endif /* CONFIG_USERSPACE */
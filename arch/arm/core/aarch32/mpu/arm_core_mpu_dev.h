@@ -188,6 +188,40 @@ void arm_core_mpu_configure_dynamic_mpu_regions(
 	const struct z_arm_mpu_partition *dynamic_regions,
 	uint8_t regions_num);
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+/**
+ * @brief save the register image of the programmed dynamic MPU regions
+ *
+ * Internal API function to capture the register values of the dynamic MPU
+ * regions that are currently programmed, so that the same configuration
+ * can later be re-programmed directly via
+ * arm_core_mpu_load_dyn_region_image(), without recomputing the region
+ * attributes.
+ *
+ * @param regions an array to receive the per-region register image
+ * @param max_regions the capacity of the supplied array
+ *
+ * @return the number of dynamic MPU regions captured on success;
+ *         -EINVAL, if the supplied array cannot hold all of them.
+ */
+int arm_core_mpu_save_dyn_region_image(struct _mpu_dyn_region regions[],
+	uint8_t max_regions);
+
+/**
+ * @brief re-program the dynamic MPU regions from a saved register image
+ *
+ * Internal API function to program a set of dynamic MPU regions directly
+ * from a register image captured earlier by
+ * arm_core_mpu_save_dyn_region_image(). Any remaining HW MPU regions
+ * are disabled.
+ *
+ * @param regions an array holding the per-region register image
+ * @param regions_num the number of regions held in the array
+ */
+void arm_core_mpu_load_dyn_region_image(
+	const struct _mpu_dyn_region regions[], uint8_t regions_num);
+#endif /* CONFIG_MPU_DYNAMIC_REGION_CACHE */
+
 #if defined(CONFIG_USERSPACE)
 /**
  * @brief update configuration of an active memory partition
@@ -315,6 +315,26 @@ void arm_core_mpu_configure_dynamic_mpu_regions(const struct z_arm_mpu_partition
 	}
 }
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+/**
+ * @brief save the register image of the programmed dynamic MPU regions.
+ */
+int arm_core_mpu_save_dyn_region_image(struct _mpu_dyn_region regions[],
+	uint8_t max_regions)
+{
+	return mpu_save_dyn_region_image(regions, max_regions);
+}
+
+/**
+ * @brief re-program the dynamic MPU regions from a saved register image.
+ */
+void arm_core_mpu_load_dyn_region_image(
+	const struct _mpu_dyn_region regions[], uint8_t regions_num)
+{
+	mpu_load_dyn_region_image(regions, regions_num);
+}
+#endif /* CONFIG_MPU_DYNAMIC_REGION_CACHE */
+
 /* ARM MPU Driver Initial Setup */
 
 /*
@@ -269,4 +269,64 @@ static int mpu_configure_dynamic_mpu_regions(const struct z_arm_mpu_partition
 	return mpu_reg_index;
 }
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+/* This internal function captures the register image of the dynamic MPU
+ * regions currently programmed, so that it can later be replayed by
+ * mpu_load_dyn_region_image() without recomputing the region attributes.
+ *
+ * It returns the number of dynamic MPU regions captured, or -EINVAL, if
+ * the supplied array cannot hold all of them.
+ */
+static int mpu_save_dyn_region_image(struct _mpu_dyn_region regions[],
+	uint8_t max_regions)
+{
+	uint8_t num = 0U;
+	unsigned int key = irq_lock();
+
+	for (int i = static_regions_num; i < get_num_regions(); i++) {
+		uint32_t rasr;
+
+		set_region_number(i);
+		rasr = MPU->RASR;
+		if ((rasr & MPU_RASR_ENABLE_Msk) == 0U) {
+			/* Dynamic regions are programmed in consecutive MPU
+			 * region indices; the first disabled region marks
+			 * the end of the set.
+			 */
+			break;
+		}
+		if (num == max_regions) {
+			irq_unlock(key);
+			return -EINVAL;
+		}
+		regions[num].rbar = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+		regions[num].rasr = rasr;
+		num++;
+	}
+
+	irq_unlock(key);
+
+	return num;
+}
+
+/* This internal function re-programs the dynamic MPU regions from a
+ * register image previously captured by mpu_save_dyn_region_image().
+ */
+static void mpu_load_dyn_region_image(const struct _mpu_dyn_region regions[],
+	uint8_t regions_num)
+{
+	int index = static_regions_num;
+
+	for (uint8_t i = 0U; i < regions_num; i++, index++) {
+		MPU->RBAR = regions[i].rbar | MPU_RBAR_VALID_Msk | index;
+		MPU->RASR = regions[i].rasr;
+	}
+
+	/* Disable the non-programmed MPU regions. */
+	for (; index < get_num_regions(); index++) {
+		ARM_MPU_ClrRegion(index);
+	}
+}
+#endif /* CONFIG_MPU_DYNAMIC_REGION_CACHE */
+
 #endif	/* ZEPHYR_ARCH_ARM_CORE_AARCH32_MPU_ARM_MPU_V7_INTERNAL_H_ */
@@ -479,6 +479,14 @@ int arch_float_disable(struct k_thread *thread)
 
 #if defined(CONFIG_CPU_CORTEX_M)
 	__set_CONTROL(__get_CONTROL() & (~CONTROL_FPCA_Msk));
+#if defined(CONFIG_FPU_SHARING_LAZY)
+	/* Release the FP unit so that the deactivated context is not
+	 * saved on the thread's behalf at a later hand-over.
+	 */
+	if (_kernel.cpus[0].fpu_owner == thread) {
+		_kernel.cpus[0].fpu_owner = NULL;
+	}
+#endif /* CONFIG_FPU_SHARING_LAZY */
 #else
 	__set_FPEXC(0);
 #endif
@@ -79,6 +79,27 @@ void arch_sched_ipi(void)
 	arch_irq_unlock(key);
 }
 
+void arch_sched_directed_ipi(uint32_t cpu_mask)
+{
+	unsigned int key;
+	uint32_t i;
+	uint8_t id;
+
+	key = arch_irq_lock();
+
+	id = _current_cpu->id;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (i = 0U; i < num_cpus; i++) {
+		if ((i != id) && ((cpu_mask & BIT(i)) != 0U)) {
+			volatile uint32_t *r = (uint32_t *)get_hart_msip(i);
+			*r = 1U;
+		}
+	}
+
+	arch_irq_unlock(key);
+}
+
 static void sched_ipi_handler(const void *unused)
 {
 	ARG_UNUSED(unused);
@@ -962,6 +962,119 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
 	return old_val;
 }
 
+#ifdef CONFIG_X86_BIGPAGE_MAP
+/* Bookkeeping for PDEs that were overwritten with bigpage mappings,
+ * recording the child page table each one displaced so that the
+ * mapping can be split back into 4K pages if it is later unmapped or
+ * updated at page granularity.  Protected by x86_mmu_lock; a NULL pde
+ * marks a free slot.
+ */
+struct bigpage_record {
+	pentry_t *pde;
+	pentry_t child;
+};
+
+static struct bigpage_record bigpage_records[CONFIG_X86_BIGPAGE_MAP_COUNT];
+
+__pinned_func
+static struct bigpage_record *bigpage_record_find(pentry_t *pde)
+{
+	for (int i = 0; i < CONFIG_X86_BIGPAGE_MAP_COUNT; i++) {
+		if (bigpage_records[i].pde == pde) {
+			return &bigpage_records[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Program one PDE-level bigpage entry for the provided virtual
+ * address.  The caller has verified alignment and size; entry_val
+ * must include MMU_PS.
+ *
+ * @retval 0 on success
+ * @retval -ENOSPC if the record table is full (caller falls back to
+ *         4K pages)
+ * @retval -EFAULT on missing/unsplittable intermediate levels
+ */
+__pinned_func
+static int big_page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
+			    uint32_t options)
+{
+	pentry_t *table = ptables;
+	struct bigpage_record *rec;
+	pentry_t *pde;
+
+	for (int level = 0; level < PDE_LEVEL; level++) {
+		pentry_t *entryp = get_entry_ptr(table, virt, level);
+
+		CHECKIF(!((*entryp & MMU_PS) == 0U)) {
+			return -EFAULT;
+		}
+
+		table = next_table(*entryp, level);
+		CHECKIF(!(table != NULL)) {
+			return -EFAULT;
+		}
+	}
+
+	pde = get_entry_ptr(table, virt, PDE_LEVEL);
+
+	if ((*pde & MMU_PS) == 0U) {
+		/* Displacing a child page table: remember it */
+		rec = bigpage_record_find(NULL);
+		if (rec == NULL) {
+			return -ENOSPC;
+		}
+		rec->pde = pde;
+		rec->child = *pde;
+	}
+
+	*pde = entry_val;
+
+	if ((options & OPTION_FLUSH) != 0U) {
+		tlb_flush_page(virt);
+	}
+
+	return 0;
+}
+
+/* Split a promoted bigpage PDE back into 4K pages: rebuild the
+ * displaced child table to express the same mapping, then swing the
+ * PDE back to it.  Fails for bigpages we did not create (e.g. ones
+ * set up by gen_mmu.py), preserving the historical -EFAULT behavior
+ * for those.
+ */
+__pinned_func
+static int big_page_demote(pentry_t *pde)
+{
+	struct bigpage_record *rec = bigpage_record_find(pde);
+	pentry_t big = *pde;
+	pentry_t *child;
+	uintptr_t phys;
+	pentry_t flags;
+
+	if (rec == NULL) {
+		return -EFAULT;
+	}
+
+	child = next_table(rec->child, PDE_LEVEL);
+	phys = get_entry_phys(big, PDE_LEVEL);
+	flags = big & ~(paging_levels[PDE_LEVEL].mask | MMU_PS);
+
+	for (size_t i = 0; i < get_num_entries(PTE_LEVEL); i++) {
+		child[i] = (pentry_t)(phys + (i * CONFIG_MMU_PAGE_SIZE)) |
+			   flags;
+	}
+	*pde = rec->child;
+
+	rec->pde = NULL;
+	rec->child = 0;
+
+	return 0;
+}
+#endif /* CONFIG_X86_BIGPAGE_MAP */
+
 /**
  * Low level page table update function for a virtual page
  *
@@ -1018,6 +1131,19 @@ static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
 			break;
 		}
 
+#ifdef CONFIG_X86_BIGPAGE_MAP
+		if ((level == PDE_LEVEL) && ((*entryp & MMU_PS) != 0U)) {
+			/* Bigpages established by arch_mem_map() are
+			 * split back into 4K pages when touched at page
+			 * granularity; on success *entryp points at the
+			 * restored child table and the walk proceeds
+			 * normally. Demotion fails for bigpages set up
+			 * at build time, which fall through to the
+			 * error below.
+			 */
+			(void)big_page_demote(entryp);
+		}
+#endif
 		/* We bail out early here due to no support for
 		 * splitting existing bigpage mappings.
 		 * If the PS bit is not supported at some level (like
@@ -1118,6 +1244,26 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 			entry_val = (pentry_t)(phys + offset) | entry_flags;
 		}
 
+#ifdef CONFIG_X86_BIGPAGE_MAP
+		/* Opportunistically promote to a PDE-level bigpage when
+		 * establishing a fresh mapping (MASK_ALL) and alignment
+		 * and remaining size allow; anything that fails here
+		 * simply gets mapped with 4K pages below.
+		 */
+		if (!zero_entry && (mask == MASK_ALL)) {
+			size_t scope = get_entry_scope(PDE_LEVEL);
+
+			if ((((uintptr_t)dest_virt | (phys + offset)) %
+			     scope == 0U) &&
+			    ((size - offset) >= scope) &&
+			    (big_page_map_set(ptables, dest_virt,
+					      entry_val | MMU_PS,
+					      options) == 0)) {
+				offset += scope - CONFIG_MMU_PAGE_SIZE;
+				continue;
+			}
+		}
+#endif
 		ret2 = page_map_set(ptables, dest_virt, entry_val, NULL, mask,
 				   options);
 		ARG_UNUSED(ret2);
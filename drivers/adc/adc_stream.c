@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Continuous ADC sampling streamed through RTIO
+ *
+ * Buffers are submitted to the stream as RTIO read requests. Each one
+ * is filled with a whole sampling sequence before its completion is
+ * produced, so thread level work is done once per buffer instead of
+ * once per sample.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(adc_stream, CONFIG_ADC_LOG_LEVEL);
+
+static void adc_stream_next(struct k_work *work)
+{
+	struct adc_stream *stream = CONTAINER_OF(work, struct adc_stream, work);
+	struct rtio_iodev_sqe *iodev_sqe;
+	int ret;
+
+	if (stream->current != NULL) {
+		/* A buffer is being filled; its completion resubmits
+		 * this work item.
+		 */
+		return;
+	}
+
+	iodev_sqe = rtio_spsc_consume(stream->iodev.iodev_sq);
+	if (iodev_sqe == NULL) {
+		return;
+	}
+
+	stream->current = iodev_sqe;
+	stream->sequence.buffer = iodev_sqe->sqe->buf;
+	stream->sequence.buffer_size = iodev_sqe->sqe->buf_len;
+
+	ret = adc_read_async(stream->dev, &stream->sequence, NULL);
+	if (ret < 0) {
+		LOG_ERR("%s: failed to start sampling (%d)",
+			stream->dev->name, ret);
+		stream->current = NULL;
+		rtio_sqe_err(iodev_sqe->r, iodev_sqe->sqe, ret);
+		rtio_spsc_release(stream->iodev.iodev_sq);
+		k_work_submit(&stream->work);
+	}
+}
+
+static enum adc_action adc_stream_sampling_done(const struct device *dev,
+						const struct adc_sequence *sequence,
+						uint16_t sampling_index)
+{
+	struct adc_stream *stream = sequence->options->user_data;
+	struct rtio_iodev_sqe *iodev_sqe = stream->current;
+
+	ARG_UNUSED(dev);
+
+	if (sampling_index < stream->options.extra_samplings) {
+		return ADC_ACTION_CONTINUE;
+	}
+
+	/* The buffer is full; hand it to the application and start the
+	 * next one from the work queue, as the driver context is still
+	 * in use until the sequence completes.
+	 */
+	stream->current = NULL;
+	rtio_sqe_ok(iodev_sqe->r, iodev_sqe->sqe, 0);
+	rtio_spsc_release(stream->iodev.iodev_sq);
+	k_work_submit(&stream->work);
+
+	return ADC_ACTION_CONTINUE;
+}
+
+static void adc_stream_iodev_submit(const struct rtio_sqe *sqe, struct rtio *r)
+{
+	struct adc_stream *stream = (struct adc_stream *)sqe->iodev;
+	struct rtio_iodev_sqe *iodev_sqe;
+
+	if (sqe->op != RTIO_OP_RX) {
+		rtio_sqe_err(r, sqe, -EINVAL);
+		return;
+	}
+
+	iodev_sqe = rtio_spsc_acquire(stream->iodev.iodev_sq);
+	if (iodev_sqe == NULL) {
+		rtio_sqe_err(r, sqe, -EWOULDBLOCK);
+		return;
+	}
+
+	iodev_sqe->sqe = sqe;
+	iodev_sqe->r = r;
+	rtio_spsc_produce(stream->iodev.iodev_sq);
+
+	k_work_submit(&stream->work);
+}
+
+const struct rtio_iodev_api adc_stream_iodev_api = {
+	.submit = adc_stream_iodev_submit,
+};
+
+int adc_stream_init(struct adc_stream *stream, const struct device *dev,
+		    const struct adc_sequence *sequence)
+{
+	if (sequence->options == NULL) {
+		return -EINVAL;
+	}
+
+	stream->dev = dev;
+	stream->sequence = *sequence;
+	stream->options = *sequence->options;
+	stream->options.callback = adc_stream_sampling_done;
+	stream->options.user_data = stream;
+	stream->sequence.options = &stream->options;
+	stream->current = NULL;
+
+	k_work_init(&stream->work, adc_stream_next);
+
+	return 0;
+}
@@ -0,0 +1,546 @@
+/* h4_async.c - H:4 UART based Bluetooth driver using the asynchronous API */
+
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stddef.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/arch/cpu.h>
+
+#include <zephyr/init.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/uart_async_rx.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/drivers/bluetooth/hci_driver.h>
+
+#define LOG_LEVEL CONFIG_BT_HCI_DRIVER_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bt_driver);
+
+#include "common/bt_str.h"
+
+#include "../util.h"
+
+#define H4_NONE 0x00
+#define H4_CMD  0x01
+#define H4_ACL  0x02
+#define H4_SCO  0x03
+#define H4_EVT  0x04
+#define H4_ISO  0x05
+
+#define RX_BUF_SIZE (CONFIG_BT_H4_ASYNC_RX_BUF_SIZE + \
+		     offsetof(struct uart_async_rx_buf, buffer))
+
+static K_KERNEL_STACK_DEFINE(rx_thread_stack, CONFIG_BT_RX_STACK_SIZE);
+static struct k_thread rx_thread_data;
+
+static uint8_t rx_buffer[CONFIG_BT_H4_ASYNC_RX_BUF_COUNT * RX_BUF_SIZE];
+
+static struct {
+	struct uart_async_rx async_rx;
+
+	/* Signalled when new data is received or reception stops. */
+	struct k_sem sem;
+
+	/* Set when the driver ran out of buffers and reception must be
+	 * restarted once one is released.
+	 */
+	atomic_t stopped;
+
+	struct net_buf *buf;
+
+	uint16_t    remaining;
+	uint16_t    discard;
+
+	bool     have_hdr;
+	bool     discardable;
+
+	uint8_t     hdr_len;
+
+	uint8_t     type;
+	union {
+		struct bt_hci_evt_hdr evt;
+		struct bt_hci_acl_hdr acl;
+		struct bt_hci_iso_hdr iso;
+		uint8_t hdr[4];
+	};
+} rx;
+
+/* TX is serialized; one packet is in flight at a time. */
+static K_SEM_DEFINE(tx_lock, 1, 1);
+static K_SEM_DEFINE(tx_done, 0, 1);
+
+static const struct device *const h4_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_bt_uart));
+
+static void h4_get_type(uint8_t type)
+{
+	rx.type = type;
+
+	switch (rx.type) {
+	case H4_EVT:
+		rx.remaining = sizeof(rx.evt);
+		rx.hdr_len = rx.remaining;
+		break;
+	case H4_ACL:
+		rx.remaining = sizeof(rx.acl);
+		rx.hdr_len = rx.remaining;
+		break;
+	case H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			rx.remaining = sizeof(rx.iso);
+			rx.hdr_len = rx.remaining;
+			break;
+		}
+		__fallthrough;
+	default:
+		LOG_ERR("Unknown H:4 type 0x%02x", rx.type);
+		rx.type = H4_NONE;
+	}
+}
+
+static void h4_hdr_done(void)
+{
+	if (rx.type == H4_EVT) {
+		struct bt_hci_evt_hdr *hdr = &rx.evt;
+
+		if (rx.hdr_len == sizeof(*hdr)) {
+			switch (rx.evt.evt) {
+			case BT_HCI_EVT_LE_META_EVENT:
+				/* The subevent code is needed to tell
+				 * discardable advertising reports apart.
+				 */
+				rx.remaining++;
+				rx.hdr_len++;
+				return;
+#if defined(CONFIG_BT_BREDR)
+			case BT_HCI_EVT_INQUIRY_RESULT_WITH_RSSI:
+			case BT_HCI_EVT_EXTENDED_INQUIRY_RESULT:
+				rx.discardable = true;
+				break;
+#endif
+			}
+		}
+
+		if (rx.evt.evt == BT_HCI_EVT_LE_META_EVENT &&
+		    (rx.hdr[sizeof(*hdr)] == BT_HCI_EVT_LE_ADVERTISING_REPORT)) {
+			LOG_DBG("Marking adv report as discardable");
+			rx.discardable = true;
+		}
+
+		rx.remaining = hdr->len - (rx.hdr_len - sizeof(*hdr));
+		LOG_DBG("Got event header. Payload %u bytes", hdr->len);
+	} else if (rx.type == H4_ACL) {
+		rx.remaining = sys_le16_to_cpu(rx.acl.len);
+		LOG_DBG("Got ACL header. Payload %u bytes", rx.remaining);
+	} else {
+		rx.remaining = bt_iso_hdr_len(sys_le16_to_cpu(rx.iso.len));
+		LOG_DBG("Got ISO header. Payload %u bytes", rx.remaining);
+	}
+
+	rx.have_hdr = true;
+}
+
+static inline void copy_hdr(struct net_buf *buf)
+{
+	net_buf_add_mem(buf, rx.hdr, rx.hdr_len);
+}
+
+static void reset_rx(void)
+{
+	rx.type = H4_NONE;
+	rx.remaining = 0U;
+	rx.have_hdr = false;
+	rx.hdr_len = 0U;
+	rx.discardable = false;
+}
+
+static struct net_buf *get_rx(k_timeout_t timeout)
+{
+	LOG_DBG("type 0x%02x, evt 0x%02x", rx.type, rx.evt.evt);
+
+	switch (rx.type) {
+	case H4_EVT:
+		return bt_buf_get_evt(rx.evt.evt, rx.discardable, timeout);
+	case H4_ACL:
+		return bt_buf_get_rx(BT_BUF_ACL_IN, timeout);
+	case H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			return bt_buf_get_rx(BT_BUF_ISO_IN, timeout);
+		}
+	}
+
+	return NULL;
+}
+
+static size_t read_header(const uint8_t *data, size_t len)
+{
+	size_t consumed = 0U;
+
+	if (rx.type == H4_NONE) {
+		h4_get_type(data[consumed++]);
+		if (rx.type == H4_NONE) {
+			/* Unknown packet type, drop the byte */
+			return consumed;
+		}
+	}
+
+	while (rx.remaining && (consumed < len)) {
+		size_t copy = MIN(rx.remaining, len - consumed);
+
+		memcpy(&rx.hdr[rx.hdr_len - rx.remaining], &data[consumed],
+		       copy);
+		rx.remaining -= copy;
+		consumed += copy;
+
+		if (!rx.remaining) {
+			h4_hdr_done();
+		}
+	}
+
+	return consumed;
+}
+
+static size_t read_payload(const uint8_t *data, size_t len)
+{
+	struct net_buf *buf;
+	uint8_t evt_flags;
+	size_t copy;
+
+	if (!rx.buf) {
+		size_t buf_tailroom;
+
+		rx.buf = get_rx(K_NO_WAIT);
+		if (!rx.buf) {
+			if (rx.discardable) {
+				LOG_WRN("Discarding event 0x%02x", rx.evt.evt);
+				rx.discard = rx.remaining;
+				reset_rx();
+				return 0;
+			}
+
+			/* Blocking here applies backpressure: reception
+			 * continues into the remaining buffers and stops
+			 * once the driver runs out of them.
+			 */
+			rx.buf = get_rx(K_FOREVER);
+		}
+
+		LOG_DBG("Allocated rx.buf %p", rx.buf);
+
+		buf_tailroom = net_buf_tailroom(rx.buf);
+		if (buf_tailroom < rx.remaining) {
+			LOG_ERR("Not enough space in buffer %u/%zu",
+				rx.remaining, buf_tailroom);
+			net_buf_unref(rx.buf);
+			rx.buf = NULL;
+			rx.discard = rx.remaining;
+			reset_rx();
+			return 0;
+		}
+
+		copy_hdr(rx.buf);
+	}
+
+	copy = MIN(rx.remaining, len);
+	net_buf_add_mem(rx.buf, data, copy);
+	rx.remaining -= copy;
+
+	LOG_DBG("got %zu bytes, remaining %u", copy, rx.remaining);
+
+	if (rx.remaining) {
+		return copy;
+	}
+
+	LOG_DBG("Payload (len %u): %s", rx.buf->len,
+		bt_hex(rx.buf->data, rx.buf->len));
+
+	buf = rx.buf;
+	rx.buf = NULL;
+
+	if (rx.type == H4_EVT) {
+		evt_flags = bt_hci_evt_get_flags(rx.evt.evt);
+		bt_buf_set_type(buf, BT_BUF_EVT);
+	} else {
+		evt_flags = BT_HCI_EVT_FLAG_RECV;
+	}
+
+	reset_rx();
+
+	if (IS_ENABLED(CONFIG_BT_RECV_BLOCKING) &&
+	    (evt_flags & BT_HCI_EVT_FLAG_RECV_PRIO)) {
+		LOG_DBG("Calling bt_recv_prio(%p)", buf);
+		bt_recv_prio(buf);
+	}
+
+	if (evt_flags & BT_HCI_EVT_FLAG_RECV) {
+		LOG_DBG("Calling bt_recv(%p)", buf);
+		bt_recv(buf);
+	}
+
+	return copy;
+}
+
+static size_t rx_process(const uint8_t *data, size_t len)
+{
+	size_t consumed;
+
+	if (rx.discard) {
+		consumed = MIN(rx.discard, len);
+		rx.discard -= consumed;
+		return consumed;
+	}
+
+	if (!rx.have_hdr) {
+		consumed = read_header(data, len);
+		if (!rx.have_hdr) {
+			return consumed;
+		}
+
+		/* Process the remainder of the slice and complete packets
+		 * with no payload.
+		 */
+		return consumed + read_payload(&data[consumed],
+					       len - consumed);
+	}
+
+	return read_payload(data, len);
+}
+
+static void rx_resume(void)
+{
+	uint8_t *buf;
+	int err;
+
+	buf = uart_async_rx_buf_req(&rx.async_rx);
+	__ASSERT_NO_MSG(buf);
+
+	err = uart_rx_enable(h4_dev, buf,
+			     uart_async_rx_get_buf_len(&rx.async_rx),
+			     CONFIG_BT_H4_ASYNC_RX_TIMEOUT);
+	if (err < 0) {
+		LOG_ERR("Failed to enable RX (err %d)", err);
+	}
+}
+
+static void rx_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	LOG_DBG("started");
+
+	while (1) {
+		uint8_t *data;
+		size_t len;
+
+		k_sem_take(&rx.sem, K_FOREVER);
+
+		while ((len = uart_async_rx_data_claim(&rx.async_rx, &data,
+						       SIZE_MAX)) > 0) {
+			size_t processed = 0U;
+			bool released;
+
+			while (processed < len) {
+				processed += rx_process(&data[processed],
+							len - processed);
+			}
+
+			released = uart_async_rx_data_consumed(&rx.async_rx,
+							       processed);
+			if (released && atomic_cas(&rx.stopped, 1, 0)) {
+				rx_resume();
+			}
+		}
+	}
+}
+
+static void uart_cb(const struct device *dev, struct uart_event *evt,
+		    void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		k_sem_give(&tx_done);
+		break;
+	case UART_RX_RDY:
+		uart_async_rx_on_rdy(&rx.async_rx, evt->data.rx.buf,
+				     evt->data.rx.len);
+		k_sem_give(&rx.sem);
+		break;
+	case UART_RX_BUF_REQUEST: {
+		uint8_t *buf = uart_async_rx_buf_req(&rx.async_rx);
+
+		if (buf) {
+			uart_rx_buf_rsp(dev, buf,
+					uart_async_rx_get_buf_len(&rx.async_rx));
+		}
+		break;
+	}
+	case UART_RX_BUF_RELEASED:
+		uart_async_rx_on_buf_rel(&rx.async_rx, evt->data.rx_buf.buf);
+		break;
+	case UART_RX_DISABLED:
+		/* All buffers are held by the RX thread. Reception is
+		 * restarted once a buffer is consumed.
+		 */
+		atomic_set(&rx.stopped, 1);
+		k_sem_give(&rx.sem);
+		break;
+	case UART_RX_STOPPED:
+		LOG_ERR("RX error %d", evt->data.rx_stop.reason);
+		break;
+	default:
+		break;
+	}
+}
+
+static int h4_send(struct net_buf *buf)
+{
+	int err;
+
+	LOG_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
+
+	switch (bt_buf_get_type(buf)) {
+	case BT_BUF_ACL_OUT:
+		net_buf_push_u8(buf, H4_ACL);
+		break;
+	case BT_BUF_CMD:
+		net_buf_push_u8(buf, H4_CMD);
+		break;
+	case BT_BUF_ISO_OUT:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			net_buf_push_u8(buf, H4_ISO);
+			break;
+		}
+		__fallthrough;
+	default:
+		LOG_ERR("Unknown buffer type");
+		return -EINVAL;
+	}
+
+	k_sem_take(&tx_lock, K_FOREVER);
+
+	/* The packet is transferred directly out of the net_buf */
+	err = uart_tx(h4_dev, buf->data, buf->len, SYS_FOREVER_US);
+	if (!err) {
+		k_sem_take(&tx_done, K_FOREVER);
+	}
+
+	k_sem_give(&tx_lock);
+
+	if (err < 0) {
+		LOG_ERR("Unable to write to UART (err %d)", err);
+		return err;
+	}
+
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+/** Setup the HCI transport, which usually means to reset the Bluetooth IC
+  *
+  * @param dev The device structure for the bus connecting to the IC
+  *
+  * @return 0 on success, negative error value on failure
+  */
+int __weak bt_hci_transport_setup(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static int h4_open(void)
+{
+	static const struct uart_async_rx_config rx_config = {
+		.buffer = rx_buffer,
+		.length = sizeof(rx_buffer),
+		.buf_cnt = CONFIG_BT_H4_ASYNC_RX_BUF_COUNT,
+	};
+	k_tid_t tid;
+	int err;
+
+	LOG_DBG("");
+
+	err = bt_hci_transport_setup(h4_dev);
+	if (err < 0) {
+		return -EIO;
+	}
+
+	err = uart_async_rx_init(&rx.async_rx, &rx_config);
+	if (err < 0) {
+		return err;
+	}
+
+	k_sem_init(&rx.sem, 0, 1);
+
+	err = uart_callback_set(h4_dev, uart_cb, NULL);
+	if (err < 0) {
+		return err;
+	}
+
+	tid = k_thread_create(&rx_thread_data, rx_thread_stack,
+			      K_KERNEL_STACK_SIZEOF(rx_thread_stack),
+			      rx_thread, NULL, NULL, NULL,
+			      K_PRIO_COOP(CONFIG_BT_RX_PRIO),
+			      0, K_NO_WAIT);
+	k_thread_name_set(tid, "bt_rx_thread");
+
+	rx_resume();
+
+	return 0;
+}
+
+#if defined(CONFIG_BT_HCI_SETUP)
+static int h4_setup(void)
+{
+	/* Extern bt_h4_vnd_setup function.
+	 * This function executes vendor-specific commands sequence to
+	 * initialize BT Controller before BT Host executes Reset sequence.
+	 * bt_h4_vnd_setup function must be implemented in vendor-specific HCI
+	 * extansion module if CONFIG_BT_HCI_SETUP is enabled.
+	 */
+	extern int bt_h4_vnd_setup(const struct device *dev);
+
+	return bt_h4_vnd_setup(h4_dev);
+}
+#endif
+
+static const struct bt_hci_driver drv = {
+	.name		= "H:4",
+	.bus		= BT_HCI_DRIVER_BUS_UART,
+	.open		= h4_open,
+	.send		= h4_send,
+#if defined(CONFIG_BT_HCI_SETUP)
+	.setup		= h4_setup
+#endif
+};
+
+static int bt_uart_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	if (!device_is_ready(h4_dev)) {
+		return -ENODEV;
+	}
+
+	bt_hci_driver_register(&drv);
+
+	return 0;
+}
+
+SYS_INIT(bt_uart_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE);
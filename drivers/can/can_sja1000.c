@@ -11,6 +11,7 @@
 #include <zephyr/drivers/can.h>
 #include <zephyr/drivers/can/transceiver.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/math_extras.h>
 
 LOG_MODULE_REGISTER(can_sja1000, CONFIG_CAN_LOG_LEVEL);
 
@@ -442,6 +443,9 @@ int can_sja1000_add_rx_filter(const struct device *dev, can_rx_callback_t callba
 		data->filters[filter_id].filter = *filter;
 		data->filters[filter_id].user_data = user_data;
 		data->filters[filter_id].callback = callback;
+#ifdef CONFIG_CAN_RX_FILTER_INDEX
+		can_filter_index_add(&data->filter_index, filter_id, filter);
+#endif /* CONFIG_CAN_RX_FILTER_INDEX */
 	}
 
 	return filter_id;
@@ -457,6 +461,9 @@ void can_sja1000_remove_rx_filter(const struct device *dev, int filter_id)
 	}
 
 	if (atomic_test_and_clear_bit(data->rx_allocs, filter_id)) {
+#ifdef CONFIG_CAN_RX_FILTER_INDEX
+		can_filter_index_remove(&data->filter_index, filter_id);
+#endif /* CONFIG_CAN_RX_FILTER_INDEX */
 		data->filters[filter_id].callback = NULL;
 		data->filters[filter_id].user_data = NULL;
 		data->filters[filter_id].filter = (struct can_filter){0};
@@ -562,12 +569,34 @@ static void can_sja1000_handle_receive_irq(const struct device *dev)
 	struct can_sja1000_data *data = dev->data;
 	struct can_frame frame;
 	can_rx_callback_t callback;
+#ifdef CONFIG_CAN_RX_FILTER_INDEX
+	uint32_t candidates;
+#endif /* CONFIG_CAN_RX_FILTER_INDEX */
 	uint8_t sr;
 	int i;
 
 	do {
 		can_sja1000_read_frame(dev, &frame);
 
+#ifdef CONFIG_CAN_RX_FILTER_INDEX
+		candidates = can_filter_index_candidates(&data->filter_index, &frame);
+
+		while (candidates != 0U) {
+			i = u32_count_trailing_zeros(candidates);
+			candidates &= ~BIT(i);
+
+			if (!atomic_test_bit(data->rx_allocs, i)) {
+				continue;
+			}
+
+			if (can_utils_filter_match(&frame, &data->filters[i].filter)) {
+				callback = data->filters[i].callback;
+				if (callback != NULL) {
+					callback(dev, &frame, data->filters[i].user_data);
+				}
+			}
+		}
+#else /* CONFIG_CAN_RX_FILTER_INDEX */
 		for (i = 0; i < ARRAY_SIZE(data->filters); i++) {
 			if (!atomic_test_bit(data->rx_allocs, i)) {
 				continue;
@@ -580,6 +609,7 @@ static void can_sja1000_handle_receive_irq(const struct device *dev)
 				}
 			}
 		}
+#endif /* !CONFIG_CAN_RX_FILTER_INDEX */
 
 		can_sja1000_write_reg(dev, CAN_SJA1000_CMR, CAN_SJA1000_CMR_RRB);
 		sr = can_sja1000_read_reg(dev, CAN_SJA1000_SR);
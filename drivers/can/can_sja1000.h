@@ -9,6 +9,8 @@
 
 #include <zephyr/drivers/can.h>
 
+#include "can_utils.h"
+
 /* Output Control Register (OCR) bits */
 #define CAN_SJA1000_OCR_OCMODE_MASK    GENMASK(1, 0)
 #define CAN_SJA1000_OCR_OCPOL0	       BIT(2)
@@ -100,6 +102,9 @@ struct can_sja1000_rx_filter {
 struct can_sja1000_data {
 	ATOMIC_DEFINE(rx_allocs, CONFIG_CAN_MAX_FILTER);
 	struct can_sja1000_rx_filter filters[CONFIG_CAN_MAX_FILTER];
+#ifdef CONFIG_CAN_RX_FILTER_INDEX
+	struct can_filter_index filter_index;
+#endif /* CONFIG_CAN_RX_FILTER_INDEX */
 	struct k_mutex mod_lock;
 	bool started;
 	can_mode_t mode;
@@ -44,4 +44,80 @@ static inline bool can_utils_filter_match(const struct can_frame *frame,
 	return true;
 }
 
+#ifdef CONFIG_CAN_RX_FILTER_INDEX
+
+/** Number of index buckets, keyed by the low bits of the CAN ID */
+#define CAN_FILTER_INDEX_BUCKETS 16U
+
+BUILD_ASSERT(CONFIG_CAN_MAX_FILTER <= 32,
+	     "CAN RX filter index needs the filter IDs to fit into one bitmap word");
+
+/**
+ * @brief Bitmap index over the attached CAN RX filters
+ *
+ * Each bucket holds a bitmap of the filters that can match CAN IDs
+ * whose low bits equal the bucket number, so the RX dispatch path
+ * only runs the full match against the filters in one bucket instead
+ * of scanning all of them. Filters whose mask ignores the low ID bits
+ * land in several buckets.
+ */
+struct can_filter_index {
+	uint32_t buckets[CAN_FILTER_INDEX_BUCKETS];
+};
+
+/**
+ * @brief Add a filter to the index
+ *
+ * @param index     Filter index.
+ * @param filter_id ID (bit position) of the filter.
+ * @param filter    CAN filter being attached.
+ */
+static inline void can_filter_index_add(struct can_filter_index *index,
+					int filter_id,
+					const struct can_filter *filter)
+{
+	uint32_t relevant = filter->mask & (CAN_FILTER_INDEX_BUCKETS - 1U);
+	uint32_t bucket;
+
+	for (bucket = 0; bucket < CAN_FILTER_INDEX_BUCKETS; bucket++) {
+		if (((bucket ^ filter->id) & relevant) == 0U) {
+			index->buckets[bucket] |= BIT(filter_id);
+		}
+	}
+}
+
+/**
+ * @brief Remove a filter from the index
+ *
+ * @param index     Filter index.
+ * @param filter_id ID (bit position) of the filter.
+ */
+static inline void can_filter_index_remove(struct can_filter_index *index,
+					   int filter_id)
+{
+	uint32_t bucket;
+
+	for (bucket = 0; bucket < CAN_FILTER_INDEX_BUCKETS; bucket++) {
+		index->buckets[bucket] &= ~BIT(filter_id);
+	}
+}
+
+/**
+ * @brief Get the filters that can match a received CAN frame
+ *
+ * The result is a superset of the matching filters; each candidate
+ * still needs the full can_utils_filter_match() check.
+ *
+ * @param index Filter index.
+ * @param frame Received CAN frame.
+ * @return bitmap of candidate filter IDs
+ */
+static inline uint32_t can_filter_index_candidates(const struct can_filter_index *index,
+						   const struct can_frame *frame)
+{
+	return index->buckets[frame->id & (CAN_FILTER_INDEX_BUCKETS - 1U)];
+}
+
+#endif /* CONFIG_CAN_RX_FILTER_INDEX */
+
 #endif /* ZEPHYR_DRIVERS_CAN_CAN_UTILS_H_ */
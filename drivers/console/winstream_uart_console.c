@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/winstream.h>
+
+static const struct device *const uart_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_console));
+
+static uint8_t stream_buf[CONFIG_WINSTREAM_UART_CONSOLE_BUF_SIZE];
+static struct sys_winstream_mp stream;
+
+/* Writers only touch the winstream: no locks, no UART register access.
+ * Output from ISRs and from multiple CPUs interleaves bytewise at
+ * worst, it never spins on another writer.
+ */
+static int console_out(int c)
+{
+	char buf[2] = { '\r', (char)c };
+
+	if (c == '\n') {
+		sys_winstream_mp_write(&stream, buf, 2);
+	} else {
+		sys_winstream_mp_write(&stream, &buf[1], 1);
+	}
+
+	return c;
+}
+
+#ifdef CONFIG_UART_ASYNC_API
+static K_SEM_DEFINE(tx_done_sem, 0, 1);
+static bool use_async;
+
+static void uart_cb(const struct device *dev, struct uart_event *evt,
+		    void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	if (evt->type == UART_TX_DONE || evt->type == UART_TX_ABORTED) {
+		k_sem_give(&tx_done_sem);
+	}
+}
+#endif
+
+static void uart_write(const char *buf, uint32_t len)
+{
+#ifdef CONFIG_UART_ASYNC_API
+	if (use_async) {
+		if (uart_tx(uart_dev, (const uint8_t *)buf, len,
+			    SYS_FOREVER_US) == 0) {
+			k_sem_take(&tx_done_sem, K_FOREVER);
+			return;
+		}
+
+		/* Driver without DMA support, fall back for good */
+		use_async = false;
+	}
+#endif
+	for (uint32_t i = 0; i < len; i++) {
+		uart_poll_out(uart_dev, buf[i]);
+	}
+}
+
+static void drain_thread(void *p1, void *p2, void *p3)
+{
+	char chunk[64];
+	uint32_t seq = 0;
+	uint32_t got;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Static threads can outrun a failed init */
+	while (stream.ws == NULL) {
+		k_sleep(K_MSEC(10));
+	}
+
+	for (;;) {
+		sys_winstream_mp_flush(&stream);
+		got = sys_winstream_read(stream.ws, &seq, chunk, sizeof(chunk));
+		if (got == 0) {
+			k_sleep(K_MSEC(CONFIG_WINSTREAM_UART_CONSOLE_DRAIN_INTERVAL_MS));
+			continue;
+		}
+
+		uart_write(chunk, got);
+	}
+}
+
+K_THREAD_DEFINE(winstream_uart_drain, 1024, drain_thread, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+#if defined(CONFIG_STDOUT_CONSOLE)
+extern void __stdout_hook_install(int (*hook)(int c));
+#endif
+
+#if defined(CONFIG_PRINTK)
+extern void __printk_hook_install(int (*fn)(int c));
+#endif
+
+static int winstream_uart_console_init(const struct device *arg)
+{
+	ARG_UNUSED(arg);
+
+	if (!device_is_ready(uart_dev)) {
+		return -ENODEV;
+	}
+
+	sys_winstream_mp_init(&stream, stream_buf, sizeof(stream_buf));
+
+#ifdef CONFIG_UART_ASYNC_API
+	use_async = uart_callback_set(uart_dev, uart_cb, NULL) == 0;
+#endif
+
+#if defined(CONFIG_STDOUT_CONSOLE)
+	__stdout_hook_install(console_out);
+#endif
+#if defined(CONFIG_PRINTK)
+	__printk_hook_install(console_out);
+#endif
+
+	return 0;
+}
+
+/* Same init point as the plain UART console; output emitted before the
+ * drain thread first runs is buffered in the stream, not lost.
+ */
+SYS_INIT(winstream_uart_console_init,
+#if defined(CONFIG_EARLY_CONSOLE)
+	 PRE_KERNEL_1,
+#else
+	 POST_KERNEL,
+#endif
+	 CONFIG_CONSOLE_INIT_PRIORITY);
@@ -440,6 +440,58 @@ cleanup:
 	return ret;
 }
 
+static int dma_mcux_edma_append(const struct device *dev, uint32_t channel,
+				struct dma_block_config *block)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+
+	/* Lock the channel configuration */
+	const unsigned int key = irq_lock();
+	int ret = 0;
+
+	if (!data->transfer_settings.valid) {
+		LOG_ERR("Invalid EDMA settings on initial config. Configure DMA before append.");
+		ret = -EFAULT;
+		goto cleanup;
+	}
+
+	/* Appending to a running channel needs the TCD pool, which is only
+	 * installed for scatter/gather configurations.
+	 */
+	if (data->busy && data->edma_handle.tcdPool == NULL) {
+		LOG_ERR("EDMA busy. Appending needs a scatter/gather configuration.");
+		ret = -EBUSY;
+		goto cleanup;
+	}
+
+	while (block != NULL) {
+		EDMA_PrepareTransfer(
+			&(data->transferConfig),
+			(void *)block->source_address,
+			data->transfer_settings.source_data_size,
+			(void *)block->dest_address,
+			data->transfer_settings.dest_data_size,
+			data->transfer_settings.source_burst_length,
+			block->block_size,
+			data->transfer_settings.transfer_type);
+
+		const status_t submit_status =
+			EDMA_SubmitTransfer(DEV_EDMA_HANDLE(dev, channel),
+					    &(data->transferConfig));
+
+		if (submit_status != kStatus_Success) {
+			LOG_ERR("Error submitting EDMA Transfer: 0x%x", submit_status);
+			ret = -EFAULT;
+			goto cleanup;
+		}
+		block = block->next_block;
+	}
+
+cleanup:
+	irq_unlock(key);
+	return ret;
+}
+
 static int dma_mcux_edma_get_status(const struct device *dev, uint32_t channel,
 				    struct dma_status *status)
 {
@@ -481,6 +533,7 @@ static bool dma_mcux_edma_channel_filter(const struct device *dev,
 
 static const struct dma_driver_api dma_mcux_edma_api = {
 	.reload = dma_mcux_edma_reload,
+	.append = dma_mcux_edma_append,
 	.config = dma_mcux_edma_configure,
 	.start = dma_mcux_edma_start,
 	.stop = dma_mcux_edma_stop,
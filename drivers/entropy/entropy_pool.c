@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Background-refilled entropy pool
+ *
+ * A low-priority thread keeps a pool of random bytes topped up from
+ * the system entropy device, so that entropy_pool_get() can serve
+ * consumers, including ISRs, without ever waiting for the peripheral.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(entropy_pool, CONFIG_ENTROPY_LOG_LEVEL);
+
+#define POOL_SIZE	   CONFIG_ENTROPY_POOL_SIZE
+#define POOL_LOW_WATERMARK (POOL_SIZE / 2U)
+#define POOL_REFILL_CHUNK  32U
+
+static const struct device *const entropy_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+static uint8_t pool_buf[POOL_SIZE];
+static uint16_t pool_get_idx;
+static uint16_t pool_count;
+static struct k_spinlock pool_lock;
+static K_SEM_DEFINE(pool_refill_sem, 0, 1);
+
+int entropy_pool_get(uint8_t *buffer, size_t length)
+{
+	k_spinlock_key_t key;
+	size_t taken = 0U;
+	bool refill;
+
+	key = k_spin_lock(&pool_lock);
+
+	while (taken < length && pool_count > 0U) {
+		buffer[taken++] = pool_buf[pool_get_idx];
+		/* Never hand out the same bytes twice */
+		pool_buf[pool_get_idx] = 0U;
+		pool_get_idx = (pool_get_idx + 1U) % POOL_SIZE;
+		pool_count--;
+	}
+
+	refill = pool_count < POOL_LOW_WATERMARK;
+
+	k_spin_unlock(&pool_lock, key);
+
+	if (refill) {
+		k_sem_give(&pool_refill_sem);
+	}
+
+	return taken;
+}
+
+static void entropy_pool_thread(void *p1, void *p2, void *p3)
+{
+	uint8_t chunk[POOL_REFILL_CHUNK];
+	k_spinlock_key_t key;
+	size_t space;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!device_is_ready(entropy_dev)) {
+		k_sleep(K_MSEC(100));
+	}
+
+	for (;;) {
+		key = k_spin_lock(&pool_lock);
+		space = POOL_SIZE - pool_count;
+		k_spin_unlock(&pool_lock, key);
+
+		if (space == 0U) {
+			k_sem_take(&pool_refill_sem, K_FOREVER);
+			continue;
+		}
+
+		space = MIN(space, sizeof(chunk));
+
+		ret = entropy_get_entropy(entropy_dev, chunk, space);
+		if (ret < 0) {
+			LOG_DBG("entropy device error %d, retrying", ret);
+			k_sleep(K_MSEC(100));
+			continue;
+		}
+
+		key = k_spin_lock(&pool_lock);
+		for (size_t i = 0; i < space && pool_count < POOL_SIZE; i++) {
+			pool_buf[(pool_get_idx + pool_count) % POOL_SIZE] =
+				chunk[i];
+			pool_count++;
+		}
+		k_spin_unlock(&pool_lock, key);
+
+		memset(chunk, 0, sizeof(chunk));
+	}
+}
+
+K_THREAD_DEFINE(entropy_pool, CONFIG_ENTROPY_POOL_STACK_SIZE,
+		entropy_pool_thread, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
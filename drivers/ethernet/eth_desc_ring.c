@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(eth_desc_ring, CONFIG_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "eth_desc_ring.h"
+
+static struct net_buf *desc_ring_alloc(struct eth_desc_ring *ring)
+{
+	struct net_buf *buf;
+
+	buf = net_buf_alloc(ring->pool, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	if (ring->align > 0U &&
+	    ((uintptr_t)buf->data % ring->align) != 0U) {
+		LOG_ERR("Buffer %p does not satisfy %u byte alignment",
+			(void *)buf->data, ring->align);
+		net_buf_unref(buf);
+		return NULL;
+	}
+
+	return buf;
+}
+
+int eth_desc_ring_rx_init(struct eth_desc_ring *ring,
+			  struct net_buf_pool *pool,
+			  struct net_buf **bufs,
+			  uint16_t count,
+			  uint16_t align)
+{
+	uint16_t i;
+
+	ring->pool = pool;
+	ring->bufs = bufs;
+	ring->count = count;
+	ring->align = align;
+
+	for (i = 0U; i < count; i++) {
+		ring->bufs[i] = desc_ring_alloc(ring);
+		if (!ring->bufs[i]) {
+			eth_desc_ring_flush(ring);
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+void eth_desc_ring_tx_init(struct eth_desc_ring *ring,
+			   struct net_buf **bufs,
+			   uint16_t count)
+{
+	ring->pool = NULL;
+	ring->bufs = bufs;
+	ring->count = count;
+	ring->align = 0U;
+
+	(void)memset(bufs, 0, count * sizeof(struct net_buf *));
+}
+
+struct net_buf *eth_desc_ring_rx_swap(struct eth_desc_ring *ring,
+				      uint16_t idx,
+				      uint16_t len)
+{
+	struct net_buf *fresh;
+	struct net_buf *filled;
+
+	/* Replenish first so that the slot is never left without a
+	 * buffer; if the pool is empty, the frame is dropped and the
+	 * old buffer stays mapped.
+	 */
+	fresh = desc_ring_alloc(ring);
+	if (!fresh) {
+		return NULL;
+	}
+
+	filled = ring->bufs[idx];
+	ring->bufs[idx] = fresh;
+
+	net_buf_add(filled, len);
+
+	return filled;
+}
+
+int eth_desc_ring_tx_map(struct eth_desc_ring *ring, uint16_t idx,
+			 struct net_buf *frag)
+{
+	if (ring->bufs[idx]) {
+		return -EBUSY;
+	}
+
+	if (ring->align > 0U &&
+	    ((uintptr_t)frag->data % ring->align) != 0U) {
+		return -EINVAL;
+	}
+
+	ring->bufs[idx] = net_buf_ref(frag);
+
+	return 0;
+}
+
+void eth_desc_ring_tx_unmap(struct eth_desc_ring *ring, uint16_t idx)
+{
+	if (ring->bufs[idx]) {
+		net_buf_unref(ring->bufs[idx]);
+		ring->bufs[idx] = NULL;
+	}
+}
+
+void eth_desc_ring_flush(struct eth_desc_ring *ring)
+{
+	uint16_t i;
+
+	for (i = 0U; i < ring->count; i++) {
+		if (ring->bufs[i]) {
+			net_buf_unref(ring->bufs[i]);
+			ring->bufs[i] = NULL;
+		}
+	}
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Descriptor ring helper for Ethernet drivers.
+ *
+ * Keeps a net_buf mapped into every hardware descriptor slot so that
+ * the MAC DMAs frames directly into (or out of) network buffers and
+ * the driver does not need to copy frames between dedicated DMA
+ * buffers and the network stack.
+ *
+ * The driver supplies the buffer pool and owns the actual hardware
+ * descriptors; the helper only tracks which buffer backs which slot.
+ * The buffers in the pool must be DMA-safe for the controller (size,
+ * alignment and memory placement), which the driver states with the
+ * align parameter at init time.
+ *
+ * Receive flow: init fills every slot, the driver programs the data
+ * pointers into its descriptors. When a frame is complete, the driver
+ * calls eth_desc_ring_rx_swap() which hands back the filled buffer
+ * and maps a fresh one into the slot. If the pool is empty the swap
+ * fails and the driver is expected to drop the frame and reuse the
+ * slot, so the ring never starves.
+ *
+ * Transmit flow: the driver maps the fragments of an outgoing packet
+ * with eth_desc_ring_tx_map(), which takes a reference so the data
+ * stays alive while the hardware owns it, and unmaps them from the
+ * transmit completion path.
+ */
+
+#ifndef ZEPHYR_DRIVERS_ETHERNET_ETH_DESC_RING_H_
+#define ZEPHYR_DRIVERS_ETHERNET_ETH_DESC_RING_H_
+
+#include <zephyr/net/buf.h>
+
+struct eth_desc_ring {
+	/** Pool the buffers are allocated from */
+	struct net_buf_pool *pool;
+
+	/** Buffer currently mapped into each descriptor slot */
+	struct net_buf **bufs;
+
+	/** Number of descriptor slots */
+	uint16_t count;
+
+	/** Buffer alignment required by the controller, in bytes */
+	uint16_t align;
+};
+
+/**
+ * @brief Initialize a receive descriptor ring.
+ *
+ * Allocates a buffer for every slot. The driver is expected to program
+ * the eth_desc_ring_data() pointer of each slot into the corresponding
+ * hardware descriptor afterwards.
+ *
+ * @param ring Descriptor ring
+ * @param pool Buffer pool to allocate from, must hold at least count
+ *             buffers that are DMA-safe for the controller
+ * @param bufs Backing array for the per-slot buffer pointers
+ * @param count Number of descriptor slots
+ * @param align Buffer alignment required by the controller
+ *
+ * @return 0 if ok, -ENOMEM if the pool ran out of buffers, -EINVAL if
+ *         a buffer does not satisfy the alignment.
+ */
+int eth_desc_ring_rx_init(struct eth_desc_ring *ring,
+			  struct net_buf_pool *pool,
+			  struct net_buf **bufs,
+			  uint16_t count,
+			  uint16_t align);
+
+/**
+ * @brief Initialize a transmit descriptor ring.
+ *
+ * All slots start empty; buffers are attached with
+ * eth_desc_ring_tx_map().
+ *
+ * @param ring Descriptor ring
+ * @param bufs Backing array for the per-slot buffer pointers
+ * @param count Number of descriptor slots
+ */
+void eth_desc_ring_tx_init(struct eth_desc_ring *ring,
+			   struct net_buf **bufs,
+			   uint16_t count);
+
+/**
+ * @brief Get the data pointer of the buffer mapped into a slot.
+ *
+ * @param ring Descriptor ring
+ * @param idx Descriptor slot
+ *
+ * @return Pointer to program into the hardware descriptor, or NULL if
+ *         the slot is empty.
+ */
+static inline uint8_t *eth_desc_ring_data(struct eth_desc_ring *ring,
+					  uint16_t idx)
+{
+	return ring->bufs[idx] ? ring->bufs[idx]->data : NULL;
+}
+
+/**
+ * @brief Get the number of bytes a slot buffer can hold.
+ *
+ * @param ring Descriptor ring
+ * @param idx Descriptor slot
+ *
+ * @return Size of the mapped buffer in bytes, 0 if the slot is empty.
+ */
+static inline uint16_t eth_desc_ring_buf_size(struct eth_desc_ring *ring,
+					      uint16_t idx)
+{
+	return ring->bufs[idx] ? ring->bufs[idx]->size : 0;
+}
+
+/**
+ * @brief Take the received frame out of a slot and remap it.
+ *
+ * Marks len bytes of the mapped buffer as used and replaces it with a
+ * freshly allocated one so that the slot can be handed back to the
+ * hardware. The returned buffer is owned by the caller, who typically
+ * attaches it to a net_pkt without copying the data.
+ *
+ * @param ring Descriptor ring
+ * @param idx Descriptor slot the hardware completed
+ * @param len Number of bytes the hardware wrote into the buffer
+ *
+ * @return The filled buffer, or NULL if no replacement buffer was
+ *         available, in which case the slot keeps its buffer and the
+ *         caller should drop the frame.
+ */
+struct net_buf *eth_desc_ring_rx_swap(struct eth_desc_ring *ring,
+				      uint16_t idx,
+				      uint16_t len);
+
+/**
+ * @brief Map an outgoing fragment into a transmit slot.
+ *
+ * Takes a reference on the fragment so the data stays valid while the
+ * hardware owns the descriptor. The driver programs frag->data and
+ * frag->len into the hardware descriptor itself.
+ *
+ * @param ring Descriptor ring
+ * @param idx Descriptor slot
+ * @param frag Fragment about to be transmitted
+ *
+ * @return 0 if ok, -EBUSY if the slot still holds a fragment, -EINVAL
+ *         if the fragment data does not satisfy the alignment.
+ */
+int eth_desc_ring_tx_map(struct eth_desc_ring *ring, uint16_t idx,
+			 struct net_buf *frag);
+
+/**
+ * @brief Release the fragment mapped into a transmit slot.
+ *
+ * Called from the transmit completion path once the hardware no longer
+ * owns the descriptor.
+ *
+ * @param ring Descriptor ring
+ * @param idx Descriptor slot
+ */
+void eth_desc_ring_tx_unmap(struct eth_desc_ring *ring, uint16_t idx);
+
+/**
+ * @brief Release every buffer mapped into the ring.
+ *
+ * Used when the interface goes down and the descriptors are torn down.
+ *
+ * @param ring Descriptor ring
+ */
+void eth_desc_ring_flush(struct eth_desc_ring *ring);
+
+#endif /* ZEPHYR_DRIVERS_ETHERNET_ETH_DESC_RING_H_ */
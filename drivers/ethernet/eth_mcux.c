@@ -817,6 +817,16 @@ static int eth_rx(struct eth_context *context)
 
 	k_mutex_unlock(&context->rx_frame_buf_mutex);
 
+#if defined(CONFIG_ETH_MCUX_HW_ACCELERATION)
+	/* With the receive accelerator functions enabled, the MAC drops
+	 * IP frames with an invalid IP header or protocol checksum before
+	 * they reach the driver, so any frame delivered up the stack has
+	 * already been verified.
+	 */
+	net_pkt_set_ip_chksum_offloaded(pkt, true);
+	net_pkt_set_l4_chksum_offloaded(pkt, true);
+#endif
+
 #if defined(CONFIG_NET_VLAN)
 	{
 		struct net_eth_hdr *hdr = NET_ETH_HDR(pkt);
@@ -1256,6 +1266,37 @@ static int eth_mcux_set_config(const struct device *dev,
 	return -ENOTSUP;
 }
 
+static int eth_mcux_get_config(const struct device *dev,
+			       enum ethernet_config_type type,
+			       struct ethernet_config *config)
+{
+	ARG_UNUSED(dev);
+
+	switch (type) {
+	case ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT:
+	case ETHERNET_CONFIG_TYPE_RX_CHECKSUM_SUPPORT:
+#if defined(CONFIG_ETH_MCUX_HW_ACCELERATION)
+		/* The ENET accelerator functions insert/verify the IPv4
+		 * header checksum and the protocol (TCP/UDP/ICMP) checksum
+		 * of both IPv4 and IPv6 frames.
+		 */
+		config->chksum_support =
+			ETHERNET_CHECKSUM_SUPPORT_IPV4_HEADER |
+			ETHERNET_CHECKSUM_SUPPORT_IPV4_ICMP |
+			ETHERNET_CHECKSUM_SUPPORT_IPV6_ICMP |
+			ETHERNET_CHECKSUM_SUPPORT_TCP |
+			ETHERNET_CHECKSUM_SUPPORT_UDP;
+		return 0;
+#else
+		break;
+#endif
+	default:
+		break;
+	}
+
+	return -ENOTSUP;
+}
+
 #if defined(CONFIG_PTP_CLOCK_MCUX)
 static const struct device *eth_mcux_get_ptp_clock(const struct device *dev)
 {
@@ -1272,6 +1313,7 @@ static const struct ethernet_api api_funcs = {
 #endif
 	.get_capabilities	= eth_mcux_get_capabilities,
 	.set_config		= eth_mcux_set_config,
+	.get_config		= eth_mcux_get_config,
 #if defined(CONFIG_NET_DSA)
 	.send                   = dsa_tx,
 #else
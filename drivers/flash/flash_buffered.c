@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Write-combining layer on top of a flash device
+ *
+ * Collects small sequential writes in a RAM buffer and programs them
+ * in one operation, cutting the number of program cycles for callers
+ * that issue many small writes.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(flash_buffered, CONFIG_FLASH_LOG_LEVEL);
+
+int flash_buffered_init(struct flash_buffered *fb, const struct device *dev,
+			uint8_t *buf, size_t buf_size)
+{
+	if (buf_size == 0U ||
+	    (buf_size % flash_get_write_block_size(dev)) != 0U) {
+		return -EINVAL;
+	}
+
+	fb->dev = dev;
+	fb->buf = buf;
+	fb->buf_size = buf_size;
+	fb->offset = 0;
+	fb->len = 0U;
+
+	return 0;
+}
+
+int flash_buffered_flush(struct flash_buffered *fb)
+{
+	size_t fill_length;
+	uint8_t filler;
+	int rc;
+
+	if (fb->len == 0U) {
+		return 0;
+	}
+
+	fill_length = flash_get_write_block_size(fb->dev);
+	if (fb->len % fill_length) {
+		fill_length -= fb->len % fill_length;
+		filler = flash_get_parameters(fb->dev)->erase_value;
+
+		memset(&fb->buf[fb->len], filler, fill_length);
+	} else {
+		fill_length = 0U;
+	}
+
+	rc = flash_write(fb->dev, fb->offset, fb->buf, fb->len + fill_length);
+	if (rc != 0) {
+		LOG_ERR("flash_write error %d offset=0x%08lx", rc,
+			(long)fb->offset);
+		return rc;
+	}
+
+	fb->len = 0U;
+
+	return 0;
+}
+
+int flash_buffered_write(struct flash_buffered *fb, off_t offset,
+			 const void *data, size_t len)
+{
+	const uint8_t *src = data;
+	size_t space;
+	size_t chunk;
+	int rc;
+
+	while (len > 0U) {
+		if (fb->len != 0U && offset != fb->offset + (off_t)fb->len) {
+			/* Not adjacent to the buffered data */
+			rc = flash_buffered_flush(fb);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+
+		if (fb->len == 0U) {
+			/* Start a new buffer, aligned down to the write
+			 * block size. The head padding is the erase value,
+			 * which leaves the flash cells it is programmed
+			 * over unchanged.
+			 */
+			size_t head = (size_t)offset %
+				      flash_get_write_block_size(fb->dev);
+
+			fb->offset = offset - (off_t)head;
+			memset(fb->buf,
+			       flash_get_parameters(fb->dev)->erase_value,
+			       head);
+			fb->len = head;
+		}
+
+		space = fb->buf_size - fb->len;
+		if (space == 0U) {
+			rc = flash_buffered_flush(fb);
+			if (rc != 0) {
+				return rc;
+			}
+			continue;
+		}
+
+		chunk = MIN(len, space);
+		memcpy(&fb->buf[fb->len], src, chunk);
+		fb->len += chunk;
+		offset += (off_t)chunk;
+		src += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+int flash_buffered_read(struct flash_buffered *fb, off_t offset,
+			void *data, size_t len)
+{
+	uint8_t *dst = data;
+	off_t start;
+	off_t end;
+	int rc;
+
+	rc = flash_read(fb->dev, offset, data, len);
+	if (rc != 0) {
+		return rc;
+	}
+
+	if (fb->len == 0U) {
+		return 0;
+	}
+
+	/* Overlay the part of the requested range that is still
+	 * sitting in the write buffer.
+	 */
+	start = MAX(offset, fb->offset);
+	end = MIN(offset + (off_t)len, fb->offset + (off_t)fb->len);
+	if (start < end) {
+		memcpy(&dst[start - offset], &fb->buf[start - fb->offset],
+		       (size_t)(end - start));
+	}
+
+	return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Queued submission of asynchronous I2C transactions
+ *
+ * Queued transactions are chained from the driver completion context
+ * so that back-to-back transfers start without a thread round trip in
+ * between.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+
+static void i2c_transaction_complete(const struct device *dev,
+				     int result,
+				     void *userdata)
+{
+	struct i2c_transaction_queue *queue = userdata;
+	struct i2c_transaction *done;
+	struct i2c_transaction *next;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	int ret;
+
+	do {
+		key = k_spin_lock(&queue->lock);
+
+		done = queue->current;
+
+		node = sys_slist_get(&queue->pending);
+		next = (node == NULL) ? NULL :
+			CONTAINER_OF(node, struct i2c_transaction, node);
+		queue->current = next;
+
+		k_spin_unlock(&queue->lock, key);
+
+		/* Start the next transfer before running the completion
+		 * callback so that the bus does not idle in between.
+		 */
+		ret = 0;
+		if (next != NULL) {
+			ret = i2c_transfer_cb(dev, next->msgs,
+					      next->num_msgs, next->addr,
+					      i2c_transaction_complete,
+					      queue);
+		}
+
+		if (done->callback != NULL) {
+			done->callback(dev, result, done->userdata);
+		}
+
+		/* If the driver refused the next transfer, complete it
+		 * with the error and move on to the one after it.
+		 */
+		result = ret;
+	} while (next != NULL && ret < 0);
+}
+
+void i2c_transaction_queue_init(struct i2c_transaction_queue *queue,
+				const struct device *dev)
+{
+	queue->dev = dev;
+	queue->current = NULL;
+	sys_slist_init(&queue->pending);
+}
+
+int i2c_transaction_submit(struct i2c_transaction_queue *queue,
+			   struct i2c_transaction *txn)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	key = k_spin_lock(&queue->lock);
+
+	if (queue->current != NULL) {
+		/* Busy; the transaction is started from the completion
+		 * of the previous one.
+		 */
+		sys_slist_append(&queue->pending, &txn->node);
+		k_spin_unlock(&queue->lock, key);
+		return 0;
+	}
+
+	queue->current = txn;
+
+	k_spin_unlock(&queue->lock, key);
+
+	ret = i2c_transfer_cb(queue->dev, txn->msgs, txn->num_msgs,
+			      txn->addr, i2c_transaction_complete, queue);
+	if (ret < 0) {
+		/* Deliver the error through the completion path so that
+		 * transactions submitted meanwhile still get started.
+		 */
+		i2c_transaction_complete(queue->dev, ret, queue);
+	}
+
+	return 0;
+}
@@ -19,6 +19,12 @@
 
 #define _SCS_MPU_CTRL (_SCS_BASE_ADDR + 0xd94)
 
+/* CPACR defines */
+#define _SCS_CPACR (_SCS_BASE_ADDR + 0xd88)
+#define _SCS_CPACR_CP10_CP11_Msk (0xf << 20)
+#define _SCS_CPACR_CP10_CP11_FULL_ACCESS (0xf << 20)
+#define _SCS_CPACR_CP10_CP11_PRIV_ACCESS (0x5 << 20)
+
 /* CONTROL defines */
 #define _CONTROL_FPCA_Msk (1 << 2)
 
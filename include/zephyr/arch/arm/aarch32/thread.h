@@ -57,6 +57,24 @@ struct _preempt_float {
 };
 #endif
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+/* Maximum number of dynamic MPU regions that may be programmed for a
+ * single thread: the memory domain partitions, the user thread stack,
+ * and, if enabled, the MPU stack guard.
+ */
+#if defined(CONFIG_MPU_STACK_GUARD)
+#define Z_ARM_MPU_DYN_REGIONS_MAX (CONFIG_MAX_DOMAIN_PARTITIONS + 2)
+#else
+#define Z_ARM_MPU_DYN_REGIONS_MAX (CONFIG_MAX_DOMAIN_PARTITIONS + 1)
+#endif
+
+/* Register image of a single programmed MPU region (ARMv6-M/ARMv7-M). */
+struct _mpu_dyn_region {
+	uint32_t rbar;
+	uint32_t rasr;
+};
+#endif
+
 struct _thread_arch {
 
 	/* interrupt locking key */
@@ -127,6 +145,22 @@ struct _thread_arch {
 #endif
 #endif
 #endif
+
+#if defined(CONFIG_MPU_DYNAMIC_REGION_CACHE)
+	/*
+	 * Snapshot of the dynamic MPU regions last programmed for the
+	 * thread, together with the inputs it was computed from; replayed
+	 * at context switch while it remains valid (see arm_core_mpu.c).
+	 */
+	struct {
+		uint32_t generation;
+		uint32_t guard_size;
+		uint32_t priv_stack_start;
+		uint8_t num_regions;
+		bool valid;
+		struct _mpu_dyn_region regions[Z_ARM_MPU_DYN_REGIONS_MAX];
+	} mpu_cache;
+#endif
 };
 
 #if defined(CONFIG_FPU_SHARING) && defined(CONFIG_MPU_STACK_GUARD)
@@ -1972,6 +1972,65 @@ void bt_le_scan_cb_register(struct bt_le_scan_cb *cb);
  */
 void bt_le_scan_cb_unregister(struct bt_le_scan_cb *cb);
 
+#if defined(CONFIG_BT_SCAN_REPORT_BATCHING)
+/** Batched scan report entry. */
+struct bt_le_scan_batch_report {
+	/** Resolved advertiser address. */
+	bt_addr_le_t addr;
+
+	/** Advertiser packet information. Its @c addr field points to the
+	 *  @c addr member of this entry.
+	 */
+	struct bt_le_scan_recv_info info;
+
+	/** Length of the advertising data. Data longer than
+	 *  CONFIG_BT_SCAN_REPORT_BATCH_DATA_MAX is truncated.
+	 */
+	uint8_t len;
+
+	/** Advertising data. */
+	uint8_t data[CONFIG_BT_SCAN_REPORT_BATCH_DATA_MAX];
+};
+
+/** Listener context for batched (LE) scan report delivery. */
+struct bt_le_scan_batch_cb {
+	/**
+	 * @brief Batch of advertisement packets received callback.
+	 *
+	 * Called from the system work queue with an array of scan reports
+	 * accumulated since the previous call. A batch is delivered when
+	 * CONFIG_BT_SCAN_REPORT_BATCH_COUNT reports have accumulated or
+	 * CONFIG_BT_SCAN_REPORT_BATCH_TIMEOUT_MS has passed since the first
+	 * report in the batch, whichever comes first.
+	 *
+	 * @param reports Array of scan reports.
+	 * @param count   Number of reports in the array.
+	 */
+	void (*reports)(const struct bt_le_scan_batch_report *reports,
+			size_t count);
+
+	sys_snode_t node;
+};
+
+/**
+ * @brief Register batched scanner report callbacks.
+ *
+ * Adds the callback structure to the list of callback structures that
+ * receive scan reports in batches. Batched delivery runs alongside the
+ * per-report callbacks registered with bt_le_scan_cb_register().
+ *
+ * @param cb Callback struct. Must point to memory that remains valid.
+ */
+void bt_le_scan_batch_cb_register(struct bt_le_scan_batch_cb *cb);
+
+/**
+ * @brief Unregister batched scanner report callbacks.
+ *
+ * @param cb Callback struct. Must point to memory that remains valid.
+ */
+void bt_le_scan_batch_cb_unregister(struct bt_le_scan_batch_cb *cb);
+#endif /* CONFIG_BT_SCAN_REPORT_BATCHING */
+
 /**
  * @brief Add device (LE) to filter accept list.
  *
@@ -181,6 +181,9 @@ struct bt_l2cap_le_chan {
 	/** Segment SDU packet from upper layer */
 	struct net_buf			*_sdu;
 	uint16_t			_sdu_len;
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+	uint16_t			_sdu_seg;
+#endif
 
 	struct k_work			rx_work;
 	struct k_fifo			rx_queue;
@@ -321,6 +324,28 @@ struct bt_l2cap_chan_ops {
 	 */
 	int (*recv)(struct bt_l2cap_chan *chan, struct net_buf *buf);
 
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+	/** @brief Channel receive SDU as fragment chain callback
+	 *
+	 *  If this callback is provided, SDUs received on a credit-based
+	 *  channel are delivered as a chain of net_buf fragments, one
+	 *  fragment per received segment, without copying the payload into
+	 *  a contiguous buffer. Takes precedence over alloc_buf based
+	 *  reassembly. Use net_buf_frags_len() for the SDU length and walk
+	 *  the frags list (or net_buf_linearize()) to access the payload.
+	 *
+	 *  @param chan The channel receiving data.
+	 *  @param buf Buffer chain containing the incoming SDU.
+	 *
+	 *  @return 0 in case of success or negative value in case of error.
+	 *  @return -EINPROGRESS in case where user has to confirm once the
+	 *                       data has been processed by calling
+	 *                       @ref bt_l2cap_chan_recv_complete passing back
+	 *                       the buffer received.
+	 */
+	int (*recv_frags)(struct bt_l2cap_chan *chan, struct net_buf *buf);
+#endif /* CONFIG_BT_L2CAP_RX_FRAGS */
+
 	/** @brief Channel sent callback
 	 *
 	 *  If this callback is provided it will be called whenever a SDU has
@@ -412,6 +412,10 @@ struct isotp_recv_ctx {
 	sys_snode_t alloc_node;
 	uint32_t length;
 	int error_nr;
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+	/* completed buffers in the fifo not yet read by the application */
+	atomic_t backlog;
+#endif
 	struct k_work work;
 	struct _timeout timeout;
 	struct k_fifo fifo;
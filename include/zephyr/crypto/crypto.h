@@ -487,6 +487,82 @@ static inline int hash_update(struct hash_ctx *ctx, struct hash_pkt *pkt)
 	return ctx->hash_hndlr(ctx, pkt, false);
 }
 
+/**
+ * @brief Hash scattered input within a multipart operation.
+ *
+ * Feeds an array of non-contiguous input fragments to the session, in
+ * array order, as if they were one buffer. Equivalent to calling
+ * @c hash_update() once per fragment. The hash is calculated with a
+ * later call to @c hash_compute() or @c hash_compute_iov().
+ *
+ * @param  ctx       Pointer to the hash context of this op.
+ * @param  iov       Array of input fragments.
+ * @param  iov_count Number of fragments in the array.
+
+ * @return 0 on success, negative errno code on fail.
+ */
+static inline int hash_update_iov(struct hash_ctx *ctx,
+				  const struct hash_iovec *iov,
+				  size_t iov_count)
+{
+	struct hash_pkt pkt = {
+		.ctx = ctx,
+	};
+	int ret;
+
+	for (size_t i = 0; i < iov_count; i++) {
+		pkt.in_buf = iov[i].buf;
+		pkt.in_len = iov[i].len;
+
+		ret = ctx->hash_hndlr(ctx, &pkt, false);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Compute the hash of scattered input.
+ *
+ * Feeds an array of non-contiguous input fragments to the session and
+ * finishes the operation, writing the hash to @p out_buf. Any input
+ * previously passed with @c hash_update() or @c hash_update_iov() is
+ * included in the calculation.
+ *
+ * @param  ctx       Pointer to the hash context of this op.
+ * @param  iov       Array of input fragments.
+ * @param  iov_count Number of fragments in the array.
+ * @param  out_buf   Output buffer for the hash, allocated by the
+ *			application.
+
+ * @return 0 on success, negative errno code on fail.
+ */
+static inline int hash_compute_iov(struct hash_ctx *ctx,
+				   const struct hash_iovec *iov,
+				   size_t iov_count,
+				   uint8_t *out_buf)
+{
+	struct hash_pkt pkt = {
+		.out_buf = out_buf,
+		.ctx = ctx,
+	};
+	int ret;
+
+	if (iov_count > 0) {
+		ret = hash_update_iov(ctx, iov, iov_count - 1);
+		if (ret != 0) {
+			return ret;
+		}
+
+		pkt.in_buf = iov[iov_count - 1].buf;
+		pkt.in_len = iov[iov_count - 1].len;
+	}
+
+	return ctx->hash_hndlr(ctx, &pkt, true);
+}
+
 /**
  * @}
  */
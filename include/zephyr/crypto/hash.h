@@ -107,6 +107,20 @@ struct hash_pkt {
 	struct hash_ctx *ctx;
 };
 
+/**
+ * One element of scattered hash input.
+ *
+ * An array of these describes input spread over non-contiguous
+ * buffers, to be consumed in array order within one session.
+ */
+struct hash_iovec {
+	/** Start address of this input fragment */
+	uint8_t *buf;
+
+	/** Length of this input fragment in bytes */
+	size_t len;
+};
+
 /* Prototype for the application function to be invoked by the crypto driver
  * on completion of an async request. The app may get the session context
  * via the pkt->ctx field.
@@ -758,6 +758,105 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+/**
+ * @brief Incremental (SAX-style) JSON tokenizer state
+ *
+ * Unlike json_obj_parse(), which needs the whole document in a
+ * writable buffer, the stream tokenizer consumes the document chunk by
+ * chunk (e.g. as it arrives from a socket) and yields tokens with
+ * string views pointing into the caller's chunk, copying nothing.
+ * Memory use is one byte per nesting level plus this structure.
+ *
+ * All fields are internal.
+ */
+struct json_stream {
+	const char *pos;	/* Cursor within the current chunk */
+	const char *end;	/* End of the current chunk */
+	uint8_t *stack;		/* Container type per nesting level */
+	size_t stack_size;
+	size_t depth;
+	uint8_t expect;		/* Next expected construct */
+	uint8_t mode;		/* Lexing mode for straddled tokens */
+	uint8_t literal;	/* Which of true/false/null is being lexed */
+	uint8_t literal_idx;	/* Progress within true/false/null */
+};
+
+/**
+ * @brief Token produced by the stream tokenizer
+ *
+ * String and number tokens are delivered as one or more fragments:
+ * every fragment but the last has @a partial set, and a fragment may
+ * be empty (e.g. when a token ends exactly at a chunk boundary).  The
+ * views point into the chunk passed to json_stream_feed() and are
+ * only valid until the next chunk is fed; string fragments contain
+ * the raw text between the quotes, with escape sequences undecoded.
+ * JSON_TOK_TRUE, JSON_TOK_FALSE and JSON_TOK_NULL carry no view.
+ */
+struct json_stream_token {
+	enum json_tokens type;
+	const char *start;
+	size_t length;
+	/** More fragments of this token follow */
+	bool partial;
+	/** Token is an object member name rather than a value */
+	bool is_key;
+};
+
+/**
+ * @brief Initialize a stream tokenizer
+ *
+ * @param js Tokenizer to initialize
+ * @param stack Storage for container types, one byte per nesting
+ * level; documents nesting deeper than @a stack_size are rejected
+ * with -ENOMEM
+ * @param stack_size Size of @a stack in bytes
+ */
+void json_stream_init(struct json_stream *js, uint8_t *stack,
+		      size_t stack_size);
+
+/**
+ * @brief Provide the next chunk of the document
+ *
+ * Any undelivered data from the previous chunk has already been
+ * yielded (possibly as partial fragments) when json_stream_next()
+ * returned -EAGAIN, so chunks may be fed back to back from a
+ * reused buffer.
+ *
+ * @param js Tokenizer
+ * @param data Chunk of JSON text; must stay valid until the chunk is
+ * exhausted
+ * @param len Number of bytes in @a data
+ */
+void json_stream_feed(struct json_stream *js, const char *data, size_t len);
+
+/**
+ * @brief Yield the next token from the current chunk
+ *
+ * @param js Tokenizer
+ * @param tok Filled with the next token or token fragment
+ *
+ * @retval 0 Token produced
+ * @retval -EAGAIN Chunk exhausted; feed the next chunk
+ * @retval -ENOMEM Document nesting exceeds the provided stack
+ * @retval -EINVAL Malformed document
+ */
+int json_stream_next(struct json_stream *js, struct json_stream_token *tok);
+
+/**
+ * @brief Signal the end of the document
+ *
+ * Terminates a trailing top-level number, which is otherwise
+ * unbounded, and verifies that the document is complete.
+ *
+ * @param js Tokenizer
+ * @param tok Filled with the final number fragment if one was
+ * pending, JSON_TOK_EOF otherwise
+ *
+ * @retval 0 Document complete
+ * @retval -EINVAL Document truncated or malformed
+ */
+int json_stream_finish(struct json_stream *js, struct json_stream_token *tok);
+
 #ifdef __cplusplus
 }
 #endif
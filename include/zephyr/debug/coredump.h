@@ -109,6 +109,11 @@ struct coredump_cmd_copy_arg {
 
 #define COREDUMP_HDR_VER		1
 
+/* Coredump header flag: all data after the header is
+ * LZ4 block compressed.
+ */
+#define COREDUMP_HDR_FLAG_LZ4		0x1
+
 #define	COREDUMP_ARCH_HDR_ID		'A'
 
 #define	COREDUMP_MEM_HDR_ID		'M'
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+#define ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup profiler Sampling profiler
+ *  @brief Statistical sampling profiler
+ *
+ *  This module periodically samples the program counter and current
+ *  thread of the interrupted context into a per-CPU ring buffer so
+ *  that hot paths can be found without instrumenting the profiled
+ *  code.
+ *  @{
+ */
+
+/** @brief Profiler sample callback function
+ *
+ *  Callback function called for every drained sample.
+ *
+ *  @param cpu CPU the sample was taken on.
+ *  @param pc Sampled program counter, 0 if not supported on this
+ *            architecture.
+ *  @param tid Thread that was running when the sample was taken.
+ *  @param user_data User data given to profiler_samples_drain().
+ */
+typedef void (*profiler_sample_cb)(uint8_t cpu, uintptr_t pc, k_tid_t tid,
+				   void *user_data);
+
+/** @brief Start the sampling profiler.
+ *
+ *  Discards previously collected samples and starts the sampling
+ *  timer with the period given by PROFILER_SAMPLE_PERIOD_US.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY if the profiler is already running.
+ */
+int profiler_start(void);
+
+/** @brief Stop the sampling profiler.
+ *
+ *  Collected samples are kept and can be drained with
+ *  profiler_samples_drain().
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY if the profiler is not running.
+ */
+int profiler_stop(void);
+
+/** @brief Drain the collected samples.
+ *
+ *  Calls the given callback for every collected sample and removes
+ *  the samples from the ring buffers.
+ *
+ *  @param cb The callback function handler.
+ *  @param user_data User data passed to the callback.
+ *
+ *  @return Number of samples that were dropped because the sample
+ *          buffer was full while the profiler was running.
+ */
+uint32_t profiler_samples_drain(profiler_sample_cb cb, void *user_data);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_PROFILER_H_ */
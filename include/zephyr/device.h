@@ -362,6 +362,24 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_HANDLES_CACHE) || defined(__DOXYGEN__)
+	/**
+	 * Cached lengths of the regions in the device handles array (only
+	 * available if @kconfig{CONFIG_DEVICE_HANDLES_CACHE} is enabled).
+	 *
+	 * The region boundaries are fixed at link time; the lengths are
+	 * derived once during early boot so that the handle accessors do
+	 * not have to scan for the region separators on every call.
+	 */
+	uint16_t required_cnt;
+
+	/** See @ref required_cnt. */
+	uint16_t injected_cnt;
+
+	/** See @ref required_cnt. */
+	uint16_t supported_cnt;
+#endif
 };
 
 struct pm_device;
@@ -495,6 +513,9 @@ device_required_handles_get(const struct device *dev, size_t *count)
 	const device_handle_t *rv = dev->handles;
 
 	if (rv != NULL) {
+#ifdef CONFIG_DEVICE_HANDLES_CACHE
+		*count = dev->state->required_cnt;
+#else
 		size_t i = 0;
 
 		while ((rv[i] != DEVICE_HANDLE_ENDS) &&
@@ -502,6 +523,7 @@ device_required_handles_get(const struct device *dev, size_t *count)
 			++i;
 		}
 		*count = i;
+#endif
 	}
 
 	return rv;
@@ -529,10 +551,16 @@ static inline const device_handle_t *
 device_injected_handles_get(const struct device *dev, size_t *count)
 {
 	const device_handle_t *rv = dev->handles;
+#ifndef CONFIG_DEVICE_HANDLES_CACHE
 	size_t region = 0;
 	size_t i = 0;
+#endif
 
 	if (rv != NULL) {
+#ifdef CONFIG_DEVICE_HANDLES_CACHE
+		rv += dev->state->required_cnt + 1;
+		*count = dev->state->injected_cnt;
+#else
 		/* Fast forward to injected devices */
 		while (region != 1) {
 			if (*rv == DEVICE_HANDLE_SEP) {
@@ -545,6 +573,7 @@ device_injected_handles_get(const struct device *dev, size_t *count)
 			++i;
 		}
 		*count = i;
+#endif
 	}
 
 	return rv;
@@ -573,10 +602,16 @@ static inline const device_handle_t *
 device_supported_handles_get(const struct device *dev, size_t *count)
 {
 	const device_handle_t *rv = dev->handles;
+#ifndef CONFIG_DEVICE_HANDLES_CACHE
 	size_t region = 0;
 	size_t i = 0;
+#endif
 
 	if (rv != NULL) {
+#ifdef CONFIG_DEVICE_HANDLES_CACHE
+		rv += dev->state->required_cnt + dev->state->injected_cnt + 2;
+		*count = dev->state->supported_cnt;
+#else
 		/* Fast forward to supporting devices */
 		while (region != 2) {
 			if (*rv == DEVICE_HANDLE_SEP) {
@@ -589,6 +624,7 @@ device_supported_handles_get(const struct device *dev, size_t *count)
 			++i;
 		}
 		*count = i;
+#endif
 	}
 
 	return rv;
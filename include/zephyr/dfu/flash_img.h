@@ -110,6 +110,32 @@ int flash_img_check(struct flash_img_context *ctx,
 		    const struct flash_img_check *fic,
 		    uint8_t area_id);
 
+/**
+ * @brief  Verify flash memory length bytes integrity from a flash area,
+ * pipelining flash reads against a crypto device.
+ *
+ * The image is read in chunks, double-buffered in the context buffer,
+ * and each chunk is hashed through the crypto API from the system work
+ * queue while the next chunk is read from flash. With a DMA capable
+ * flash driver and a hardware hash engine, I/O and hashing overlap and
+ * verification takes roughly half the sequential time.
+ *
+ * The function is enabled via CONFIG_IMG_ENABLE_IMAGE_CHECK_PIPELINED
+ * Kconfig option.
+ *
+ * @param[in] ctx context.
+ * @param[in] fic flash img check data.
+ * @param[in] area_id flash area id of partition where the image should be
+ * verified.
+ * @param[in] crypto_dev crypto device implementing SHA-256 hash sessions.
+ *
+ * @return  0 on success, negative errno code on fail
+ */
+int flash_img_check_pipelined(struct flash_img_context *ctx,
+			      const struct flash_img_check *fic,
+			      uint8_t area_id,
+			      const struct device *crypto_dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,10 @@
 #include <zephyr/dt-bindings/adc/adc.h>
 #include <zephyr/kernel.h>
 
+#ifdef CONFIG_ADC_STREAM
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -832,6 +836,75 @@ static inline int adc_sequence_init_dt(const struct adc_dt_spec *spec,
 	return 0;
 }
 
+#ifdef CONFIG_ADC_STREAM
+
+/**
+ * @brief Continuous ADC sampling streamed through RTIO.
+ *
+ * The stream is an RTIO IO device that accepts read requests. Each
+ * submitted buffer is filled with one whole sampling sequence (1 +
+ * adc_sequence_options::extra_samplings samplings) before its
+ * completion is produced, so the application is involved once per
+ * buffer instead of once per sample. Keeping at least two buffers
+ * submitted lets sampling continue while a filled buffer is being
+ * processed.
+ *
+ * All fields are internal, use ADC_STREAM_DEFINE() and
+ * adc_stream_init().
+ */
+struct adc_stream {
+	/** IO device, must be first so that pointers can be aliased */
+	struct rtio_iodev iodev;
+
+	const struct device *dev;
+	struct adc_sequence sequence;
+	struct adc_sequence_options options;
+	struct rtio_iodev_sqe *current;
+	struct k_work work;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api adc_stream_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Statically define and initialize an ADC stream.
+ *
+ * @param name Name of the stream.
+ * @param qsize Size of the buffer submission queue, power of 2 required.
+ */
+#define ADC_STREAM_DEFINE(name, qsize)                                                             \
+	static RTIO_IODEV_SQ_DEFINE(_adc_stream_sq_##name, qsize);                                 \
+	struct adc_stream name = {                                                                 \
+		.iodev = {                                                                         \
+			.api = &adc_stream_iodev_api,                                              \
+			.iodev_sq = (struct rtio_iodev_sq *const)&_adc_stream_sq_##name,           \
+		},                                                                                 \
+	}
+
+/**
+ * @brief Initialize an ADC stream.
+ *
+ * The channels, resolution and other sampling parameters are taken
+ * from the provided sequence, which must include options. The number
+ * of samplings per buffer is 1 + adc_sequence_options::extra_samplings
+ * and the sampling interval is adc_sequence_options::interval_us,
+ * which particular drivers may realize with a dedicated hardware
+ * timer. The buffer and the callback of the sequence are managed by
+ * the stream and need not be set.
+ *
+ * @param stream Stream defined with ADC_STREAM_DEFINE().
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param sequence Sequence to run for each submitted buffer.
+ *
+ * @retval 0       On success.
+ * @retval -EINVAL If the sequence has no options.
+ */
+int adc_stream_init(struct adc_stream *stream, const struct device *dev,
+		    const struct adc_sequence *sequence);
+
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @}
  */
@@ -273,6 +273,9 @@ typedef int (*dma_api_reload)(const struct device *dev, uint32_t channel,
 			      uint32_t src, uint32_t dst, size_t size);
 #endif
 
+typedef int (*dma_api_append)(const struct device *dev, uint32_t channel,
+			      struct dma_block_config *block);
+
 typedef int (*dma_api_start)(const struct device *dev, uint32_t channel);
 
 typedef int (*dma_api_stop)(const struct device *dev, uint32_t channel);
@@ -305,6 +308,7 @@ typedef bool (*dma_api_chan_filter)(const struct device *dev,
 __subsystem struct dma_driver_api {
 	dma_api_config config;
 	dma_api_reload reload;
+	dma_api_append append;
 	dma_api_start start;
 	dma_api_stop stop;
 	dma_api_suspend suspend;
@@ -368,6 +372,40 @@ static inline int dma_reload(const struct device *dev, uint32_t channel,
 	return -ENOSYS;
 }
 
+/**
+ * @brief Append transfer blocks to a configured DMA channel
+ *
+ * Appends a linked list of transfer blocks, followed through
+ * dma_block_config::next_block, to the chain of blocks the channel was
+ * configured with. Depending on the driver the blocks may be appended
+ * while the channel is running, extending an ongoing transfer without
+ * stopping it; drivers that cannot do this return -EBUSY for a running
+ * channel.
+ *
+ * The transfer parameters (data sizes, burst lengths, direction) of
+ * the original configuration apply to the appended blocks.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to append to
+ * @param block   First block of the chain to append
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if not implemented by the driver.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_append(const struct device *dev, uint32_t channel,
+			     struct dma_block_config *block)
+{
+	const struct dma_driver_api *api =
+		(const struct dma_driver_api *)dev->api;
+
+	if (api->append) {
+		return api->append(dev, channel, block);
+	}
+
+	return -ENOSYS;
+}
+
 /**
  * @brief Enables DMA channel and starts the transfer, the channel must be
  *        configured beforehand.
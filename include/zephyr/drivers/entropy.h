@@ -107,6 +107,23 @@ static inline int entropy_get_entropy_isr(const struct device *dev,
 	return api->get_entropy_isr(dev, buffer, length, flags);
 }
 
+#ifdef CONFIG_ENTROPY_POOL
+
+/**
+ * @brief Fills a buffer with entropy from the background-refilled pool.
+ *
+ * Serves entropy gathered from the system entropy device by a
+ * low-priority background thread, so the caller never waits for the
+ * peripheral. Never blocks and is callable from ISRs; when the pool
+ * does not hold enough bytes the buffer is filled partially.
+ *
+ * @param buffer Buffer to fill with entropy.
+ * @param length Buffer length.
+ * @retval number of bytes filled with entropy, 0 to length.
+ */
+int entropy_pool_get(uint8_t *buffer, size_t length);
+
+#endif /* CONFIG_ENTROPY_POOL */
 
 #ifdef __cplusplus
 }
@@ -422,6 +422,92 @@ static inline const struct flash_parameters *z_impl_flash_get_parameters(const s
 	return api->get_parameters(dev);
 }
 
+#ifdef CONFIG_FLASH_BUFFERED
+
+/**
+ * @brief Write-combining layer on top of a flash device.
+ *
+ * Small sequential writes are collected in a caller provided buffer
+ * and programmed in one operation when the buffer fills up, when a
+ * non-adjacent offset is written, or when flash_buffered_flush() is
+ * called. Partial write blocks are padded with the erase value of the
+ * device, so coalescing is transparent for flash that is written in
+ * erased state.
+ *
+ * All fields are internal, use flash_buffered_init().
+ */
+struct flash_buffered {
+	const struct device *dev;
+	uint8_t *buf;
+	size_t buf_size;
+	off_t offset;
+	size_t len;
+};
+
+/**
+ * @brief Initialize a write-combining buffer for a flash device.
+ *
+ * @param fb Buffer state to initialize.
+ * @param dev Flash device to write to.
+ * @param buf Write buffer, ideally the program page size of the device.
+ * @param buf_size Size of the write buffer in bytes. Must be a multiple
+ *                 of the write block size of the device.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the buffer size is not a multiple of the write
+ *         block size.
+ */
+int flash_buffered_init(struct flash_buffered *fb, const struct device *dev,
+			uint8_t *buf, size_t buf_size);
+
+/**
+ * @brief Write data through the write-combining buffer.
+ *
+ * Data adjacent to what is already buffered is coalesced; anything
+ * else causes the buffered data to be programmed first. The data only
+ * reaches the device once the buffer fills up or is flushed, so a
+ * final flash_buffered_flush() is required.
+ *
+ * @param fb Buffer state.
+ * @param offset Offset in the flash device to write to.
+ * @param data Data to write.
+ * @param len Number of bytes to write.
+ *
+ * @retval 0 on success.
+ * @retval Negative errno code from the underlying flash write on failure.
+ */
+int flash_buffered_write(struct flash_buffered *fb, off_t offset,
+			 const void *data, size_t len);
+
+/**
+ * @brief Read data, taking buffered writes into account.
+ *
+ * Behaves as flash_read(), except that data still sitting in the
+ * write buffer is returned in place of the device contents.
+ *
+ * @param fb Buffer state.
+ * @param offset Offset in the flash device to read from.
+ * @param data Destination buffer.
+ * @param len Number of bytes to read.
+ *
+ * @retval 0 on success.
+ * @retval Negative errno code from the underlying flash read on failure.
+ */
+int flash_buffered_read(struct flash_buffered *fb, off_t offset,
+			void *data, size_t len);
+
+/**
+ * @brief Program any buffered data to the flash device.
+ *
+ * @param fb Buffer state.
+ *
+ * @retval 0 on success, also when there was nothing to flush.
+ * @retval Negative errno code from the underlying flash write on failure.
+ */
+int flash_buffered_flush(struct flash_buffered *fb);
+
+#endif /* CONFIG_FLASH_BUFFERED */
+
 #ifdef __cplusplus
 }
 #endif
@@ -845,6 +845,83 @@ static inline int i2c_transfer_signal(const struct device *dev,
 
 #endif /* CONFIG_POLL */
 
+#ifdef CONFIG_I2C_TRANSACTION_QUEUE
+
+/**
+ * @brief I2C transaction for queued submission
+ *
+ * Describes one asynchronous transfer request. The structure and the
+ * message array must stay valid and unmodified until the completion
+ * callback has been called.
+ */
+struct i2c_transaction {
+	/** Used internally for queuing */
+	sys_snode_t node;
+
+	/** Array of messages to transfer */
+	struct i2c_msg *msgs;
+
+	/** Number of messages to transfer */
+	uint8_t num_msgs;
+
+	/** Address of the I2C target device */
+	uint16_t addr;
+
+	/** Completion callback, or NULL. Called from the same context
+	 * as the driver completion, usually interrupt context.
+	 */
+	i2c_callback_t callback;
+
+	/** Userdata passed to the callback */
+	void *userdata;
+};
+
+/**
+ * @brief I2C transaction submission queue
+ *
+ * All fields are internal, use i2c_transaction_queue_init() to
+ * initialize the queue.
+ */
+struct i2c_transaction_queue {
+	const struct device *dev;
+	struct k_spinlock lock;
+	sys_slist_t pending;
+	struct i2c_transaction *current;
+};
+
+/**
+ * @brief Initialize an I2C transaction submission queue.
+ *
+ * @param queue Submission queue
+ * @param dev Pointer to the device structure for an I2C controller
+ *            driver configured in controller mode.
+ */
+void i2c_transaction_queue_init(struct i2c_transaction_queue *queue,
+				const struct device *dev);
+
+/**
+ * @brief Submit a transaction for execution.
+ *
+ * If the queue is idle the transfer is started immediately, otherwise
+ * it is started directly from the completion context of the previous
+ * transaction, without a thread round trip in between. Completion and
+ * errors are reported through the transaction callback.
+ *
+ * @note For the chaining to work, the driver asynchronous transfer
+ * entry point must be callable from its own completion context.
+ *
+ * @funcprop \isr_ok
+ *
+ * @param queue Submission queue
+ * @param txn Transaction to execute
+ *
+ * @retval 0 If the transaction was submitted.
+ */
+int i2c_transaction_submit(struct i2c_transaction_queue *queue,
+			   struct i2c_transaction *txn);
+
+#endif /* CONFIG_I2C_TRANSACTION_QUEUE */
+
 #endif /* CONFIG_I2C_CALLBACK */
 
 /**
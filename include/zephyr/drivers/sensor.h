@@ -393,6 +393,26 @@ typedef int (*sensor_sample_fetch_t)(const struct device *dev,
 typedef int (*sensor_channel_get_t)(const struct device *dev,
 				    enum sensor_channel chan,
 				    struct sensor_value *val);
+/**
+ * @typedef sensor_batch_fetch_t
+ * @brief Callback API for draining multiple raw frames from a sensor
+ *
+ * See sensor_batch_fetch() for argument description
+ */
+typedef int (*sensor_batch_fetch_t)(const struct device *dev,
+				    enum sensor_channel chan,
+				    void *buf, size_t buf_size,
+				    uint16_t *frame_count);
+/**
+ * @typedef sensor_batch_decode_t
+ * @brief Callback API for decoding one frame of a raw batch
+ *
+ * See sensor_batch_decode() for argument description
+ */
+typedef int (*sensor_batch_decode_t)(const struct device *dev,
+				     enum sensor_channel chan,
+				     const void *buf, uint16_t frame,
+				     struct sensor_value *val);
 
 __subsystem struct sensor_driver_api {
 	sensor_attr_set_t attr_set;
@@ -400,6 +420,8 @@ __subsystem struct sensor_driver_api {
 	sensor_trigger_set_t trigger_set;
 	sensor_sample_fetch_t sample_fetch;
 	sensor_channel_get_t channel_get;
+	sensor_batch_fetch_t batch_fetch;
+	sensor_batch_decode_t batch_decode;
 };
 
 /**
@@ -589,6 +611,72 @@ static inline int z_impl_sensor_channel_get(const struct device *dev,
 	return api->channel_get(dev, chan, val);
 }
 
+/**
+ * @brief Drain multiple raw frames from a sensor in one bus transaction
+ *
+ * Reads as many frames as the hardware has ready and the buffer can
+ * hold, e.g. the contents of a hardware FIFO, without converting them.
+ * The buffer layout is driver specific and only meaningful to
+ * @ref sensor_batch_decode, which converts individual frames on
+ * demand; separating the transfer from the conversion keeps the bus
+ * transaction count independent of the number of samples.
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to read, or SENSOR_CHAN_ALL
+ * @param buf Buffer to read raw frames into
+ * @param buf_size Size of the buffer in bytes
+ * @param frame_count Where to store the number of frames read
+ *
+ * @return 0 if successful, -ENOSYS if the driver has no batch support,
+ * negative errno code on other failure.
+ */
+static inline int sensor_batch_fetch(const struct device *dev,
+				     enum sensor_channel chan,
+				     void *buf, size_t buf_size,
+				     uint16_t *frame_count)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->batch_fetch == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->batch_fetch(dev, chan, buf, buf_size, frame_count);
+}
+
+/**
+ * @brief Decode one frame of a raw batch
+ *
+ * Converts a single frame of a buffer filled by
+ * @ref sensor_batch_fetch into sensor values, following the same
+ * channel conventions as @ref sensor_channel_get. No bus access is
+ * performed.
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to decode
+ * @param buf Buffer filled by sensor_batch_fetch()
+ * @param frame Index of the frame to decode, 0 based
+ * @param val Where to store the value
+ *
+ * @return 0 if successful, -ENOSYS if the driver has no batch support,
+ * negative errno code on other failure.
+ */
+static inline int sensor_batch_decode(const struct device *dev,
+				      enum sensor_channel chan,
+				      const void *buf, uint16_t frame,
+				      struct sensor_value *val)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->batch_decode == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->batch_decode(dev, chan, buf, frame, val);
+}
+
 /**
  * @brief The value of gravitational constant in micro m/s^2.
  */
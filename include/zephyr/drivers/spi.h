@@ -725,6 +725,82 @@ static inline int spi_transceive_cb(const struct device *dev,
 	return api->transceive_async(dev, config, tx_bufs, rx_bufs, callback, userdata);
 }
 
+#ifdef CONFIG_SPI_TRANSACTION_QUEUE
+
+/**
+ * @brief SPI transaction for queued submission
+ *
+ * Describes one asynchronous transfer request. The structure must stay
+ * valid and unmodified until the completion callback has been called.
+ */
+struct spi_transaction {
+	/** Used internally for queuing */
+	sys_snode_t node;
+
+	/** Configuration to apply for this transfer. The chip select
+	 * behavior between the transfers is controlled per transaction
+	 * with the usual operation flags (e.g. SPI_HOLD_ON_CS).
+	 */
+	const struct spi_config *config;
+
+	/** Buffer array where data to be sent originates from, or NULL */
+	const struct spi_buf_set *tx_bufs;
+
+	/** Buffer array where data to be read will be written to, or NULL */
+	const struct spi_buf_set *rx_bufs;
+
+	/** Completion callback, or NULL. Called from the same context
+	 * as the driver completion, usually interrupt context.
+	 */
+	spi_callback_t callback;
+
+	/** Userdata passed to the callback */
+	void *userdata;
+};
+
+/**
+ * @brief SPI transaction submission queue
+ *
+ * All fields are internal, use spi_transaction_queue_init() to
+ * initialize the queue.
+ */
+struct spi_transaction_queue {
+	const struct device *dev;
+	struct k_spinlock lock;
+	sys_slist_t pending;
+	struct spi_transaction *current;
+};
+
+/**
+ * @brief Initialize a SPI transaction submission queue.
+ *
+ * @param queue Submission queue
+ * @param dev Pointer to the device structure for the driver instance
+ */
+void spi_transaction_queue_init(struct spi_transaction_queue *queue,
+				const struct device *dev);
+
+/**
+ * @brief Submit a transaction for execution.
+ *
+ * If the queue is idle the transfer is started immediately, otherwise
+ * it is started directly from the completion context of the previous
+ * transaction, without a thread round trip in between. Completion and
+ * errors are reported through the transaction callback.
+ *
+ * @note For the chaining to work, the driver asynchronous transfer
+ * entry point must be callable from its own completion context.
+ *
+ * @param queue Submission queue
+ * @param txn Transaction to execute
+ *
+ * @retval 0 If the transaction was submitted.
+ */
+int spi_transaction_submit(struct spi_transaction_queue *queue,
+			   struct spi_transaction *txn);
+
+#endif /* CONFIG_SPI_TRANSACTION_QUEUE */
+
 #ifdef CONFIG_POLL
 
 /** @cond INTERNAL_HIDDEN */
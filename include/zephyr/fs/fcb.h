@@ -179,6 +179,45 @@ int fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *loc);
  */
 int fcb_append_finish(struct fcb *fcb, struct fcb_entry *append_loc);
 
+/**
+ * @brief Scatter/gather element describing one chunk of entry data.
+ */
+struct fcb_iovec {
+	const void *iov_base; /**< Data chunk */
+	uint16_t iov_len;     /**< Length of the chunk */
+};
+
+/**
+ * @brief One entry of an append batch, assembled from iov_cnt chunks.
+ */
+struct fcb_batch_entry {
+	const struct fcb_iovec *iov; /**< Array of data chunks */
+	int iov_cnt;                 /**< Number of chunks */
+};
+
+/**
+ * Appends several entries to the circular buffer in one operation.
+ *
+ * The entries, including their length headers and CRCs, are staged in RAM
+ * and written out in as few contiguous flash writes as the staging buffer
+ * (@kconfig{CONFIG_FCB_APPEND_BATCH_BUF_SIZE}) allows, with the CRCs
+ * computed in the same pass. Entry data may be scattered over several
+ * chunks, so records do not have to be pre-assembled. The entries are
+ * complete once the call returns; fcb_append_finish() must not be called.
+ *
+ * The whole batch is placed in one sector and therefore must fit into an
+ * empty sector.
+ *
+ * @param[in] fcb FCB instance structure.
+ * @param[in] entries Array of entries to append.
+ * @param[in] cnt Number of entries.
+ * @param[out] locs Entry location information for each entry, may be NULL.
+ *
+ * @return 0 on success, non-zero on failure.
+ */
+int fcb_append_batch(struct fcb *fcb, const struct fcb_batch_entry *entries,
+		     int cnt, struct fcb_entry *locs);
+
 /**
  * FCB Walk callback function type.
  *
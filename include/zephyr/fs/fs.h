@@ -273,6 +273,36 @@ static inline void fs_dir_t_init(struct fs_dir_t *zdp)
  */
 int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags);
 
+/**
+ * @brief Open or create file relative to an open directory
+ *
+ * Opens or possibly creates a file identified by a path relative to a
+ * directory previously opened with fs_opendir(). The mount point is taken
+ * from the directory handle, so no mount point resolution is performed.
+ *
+ * The function is only available when @kconfig{CONFIG_FILE_SYSTEM_OPEN_AT}
+ * is enabled, and the combined path must fit in
+ * @kconfig{CONFIG_FILE_SYSTEM_OPEN_AT_PATH_MAX} bytes.
+ *
+ * @param zfp Pointer to a file object
+ * @param zdp Pointer to a directory object the path is relative to
+ * @param name The name of a file to open, relative to the directory;
+ *	  must not start with a directory separator
+ * @param flags The mode flags, as for fs_open()
+ *
+ * @retval 0 on success;
+ * @retval -EBUSY when zfp is already used;
+ * @retval -EINVAL when a bad file name or directory handle is given, or
+ *	   when the combined path does not fit in the path buffer;
+ * @retval -EROFS when opening read-only file for write, or attempting to
+ *	   create a file on a system that has been mounted with the
+ *	   FS_MOUNT_FLAG_READ_ONLY flag;
+ * @retval -ENOTSUP when not implemented by underlying file system driver;
+ * @retval <0 an other negative errno code, depending on a file system back-end.
+ */
+int fs_open_at(struct fs_file_t *zfp, const struct fs_dir_t *zdp,
+	       const char *name, fs_mode_t flags);
+
 /**
  * @brief Close file
  *
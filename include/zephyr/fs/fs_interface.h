@@ -67,6 +67,10 @@ struct fs_file_t {
 struct fs_dir_t {
 	void *dirp;
 	const struct fs_mount_t *mp;
+#ifdef CONFIG_FILE_SYSTEM_OPEN_AT
+	/** Path the directory was opened with, for fs_open_at() */
+	char open_path[CONFIG_FILE_SYSTEM_OPEN_AT_PATH_MAX];
+#endif
 };
 
 /**
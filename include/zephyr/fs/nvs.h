@@ -31,6 +31,23 @@ extern "C" {
  * @{
  */
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE_FULL)
+/**
+ * @brief Non-volatile Storage lookup cache entry
+ *
+ * @param data_addr Address of the most recent data for the ID. Addresses are
+ * stored as uint32_t: high 2 bytes correspond to the sector, low 2 bytes are
+ * the offset in the sector
+ * @param id ID the entry belongs to
+ * @param len Data length in bytes
+ */
+struct nvs_lookup_cache_entry {
+	uint32_t data_addr;
+	uint16_t id;
+	uint16_t len;
+};
+#endif
+
 /**
  * @brief Non-volatile Storage File system structure
  *
@@ -55,7 +72,12 @@ struct nvs_fs {
 	struct k_mutex nvs_lock;
 	const struct device *flash_device;
 	const struct flash_parameters *flash_parameters;
-#if CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	struct k_work gc_work;
+#endif
+#if defined(CONFIG_NVS_LOOKUP_CACHE_FULL)
+	struct nvs_lookup_cache_entry lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#elif CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
 };
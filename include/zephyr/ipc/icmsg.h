@@ -42,11 +42,16 @@ struct icmsg_data_t {
 	struct k_work_delayable notify_work;
 	struct k_work mbox_work;
 	atomic_t state;
-	uint8_t rx_buffer[CONFIG_IPC_SERVICE_ICMSG_CB_BUF_SIZE] __aligned(4);
 
-	/* No-copy */
+	/* No-copy rx: the packet claimed from the rx packet buffer is passed
+	 * to the receive callback directly, without the intermediate buffer.
+	 */
 #ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	atomic_ptr_t rx_claimed_buf;
+	uint16_t rx_claimed_len;
 	atomic_t rx_buffer_held;
+#else
+	uint8_t rx_buffer[CONFIG_IPC_SERVICE_ICMSG_CB_BUF_SIZE] __aligned(4);
 #endif
 };
 
@@ -320,6 +320,98 @@ __syscall k_tid_t k_thread_create(struct k_thread *new_thread,
 				  void *p1, void *p2, void *p3,
 				  int prio, uint32_t options, k_timeout_t delay);
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+struct k_thread_pool;
+
+struct k_thread_pool_entry {
+	sys_snode_t node;
+	struct k_thread_pool *pool;
+	k_thread_entry_t entry;
+	void *p1;
+	void *p2;
+	void *p3;
+	k_thread_stack_t *stack;
+	bool used;
+	struct k_thread thread;
+};
+
+struct k_thread_pool {
+	struct k_thread_pool_entry *entries;
+	size_t stack_size;
+	uint16_t num_entries;
+	bool initialized;
+	sys_slist_t free;
+	struct k_spinlock lock;
+};
+
+#define Z_THREAD_POOL_ENTRY_INIT(i, _stacks) \
+	{ .stack = (_stacks)[i], }
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define a pool of recyclable threads
+ *
+ * This defines @a pool_size thread objects, each with an attached
+ * kernel stack of @a stack_size bytes, for use with
+ * k_thread_create_from_pool().  The stacks are defined with
+ * K_KERNEL_STACK_ARRAY_DEFINE() and may not host user mode threads.
+ *
+ * @param name Name of the thread pool
+ * @param pool_size Number of threads in the pool
+ * @param stack_size Stack size of each pooled thread, in bytes
+ */
+#define K_THREAD_POOL_DEFINE(name, pool_size, stack_size)		    \
+	static K_KERNEL_STACK_ARRAY_DEFINE(name##_pool_stacks,		    \
+					   pool_size, stack_size);	    \
+	static struct k_thread_pool_entry name##_pool_entries[] = {	    \
+		LISTIFY(pool_size, Z_THREAD_POOL_ENTRY_INIT, (,),	    \
+			name##_pool_stacks)				    \
+	};								    \
+	struct k_thread_pool name = {					    \
+		.entries = name##_pool_entries,				    \
+		.stack_size = K_KERNEL_STACK_SIZEOF(name##_pool_stacks[0]), \
+		.num_entries = (pool_size),				    \
+	}
+
+/**
+ * @brief Create a thread from a pool
+ *
+ * Spawns a thread using a pre-allocated thread object and stack taken
+ * from @a pool, which must have been defined with
+ * K_THREAD_POOL_DEFINE().  This behaves like k_thread_create() except
+ * that no stack setup cost beyond context initialization is paid on
+ * the hot path, making it suitable for frequently spawned short-lived
+ * workers.
+ *
+ * The thread object and stack are automatically returned to the pool
+ * when the thread returns from its entry point.  A pooled thread that
+ * is instead aborted externally (or aborts itself) never returns its
+ * entry to the pool; pooled threads must terminate by returning.
+ *
+ * Pooled threads run in supervisor mode and must not be given the
+ * K_USER option.
+ *
+ * @param pool Thread pool to draw the thread object and stack from
+ * @param entry Thread entry function.
+ * @param p1 1st entry point parameter.
+ * @param p2 2nd entry point parameter.
+ * @param p3 3rd entry point parameter.
+ * @param prio Thread priority.
+ * @param options Thread options.
+ * @param delay Scheduling delay, or K_NO_WAIT (for no delay).
+ *
+ * @return ID of new thread, or NULL if the pool is exhausted.
+ */
+k_tid_t k_thread_create_from_pool(struct k_thread_pool *pool,
+				  k_thread_entry_t entry,
+				  void *p1, void *p2, void *p3,
+				  int prio, uint32_t options,
+				  k_timeout_t delay);
+
 /**
  * @brief Drop a thread's privileges permanently to user mode
  *
@@ -361,6 +453,23 @@ extern FUNC_NORETURN void k_thread_user_mode_enter(k_thread_entry_t entry,
 #define k_thread_access_grant(thread, ...) \
 	FOR_EACH_FIXED_ARG(k_object_access_grant, (;), thread, __VA_ARGS__)
 
+/**
+ * @brief Grant a thread access to a pre-defined list of kernel objects
+ *
+ * Like k_thread_access_grant(), but takes an object list defined with
+ * K_OBJECT_ACCESS_LIST_DEFINE() and applies it with a single
+ * k_object_access_grant_list() call, making it the preferred way to equip
+ * threads that need the same (possibly large) set of object permissions
+ * every time one is spawned. To attach the permissions before a new
+ * thread executes its first instruction, create the thread with a delay
+ * of K_FOREVER, apply the list, and then call k_thread_start().
+ *
+ * @param thread Thread to grant access to objects
+ * @param list Object list defined with K_OBJECT_ACCESS_LIST_DEFINE()
+ */
+#define k_thread_access_grant_list(thread, list) \
+	k_object_access_grant_list(list, ARRAY_SIZE(list), thread)
+
 /**
  * @brief Assign a resource memory pool to a thread
  *
@@ -3192,6 +3301,51 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 extern int k_work_submit(struct k_work *work);
 
+/** @brief Submit an array of work items to a queue.
+ *
+ * This enqueues every item in @p works under a single lock acquisition
+ * with at most one wake of the queue thread, which is substantially
+ * cheaper than one k_work_submit_to_queue() call per item on hot paths
+ * that fan out many items at once.
+ *
+ * Items are submitted in array order with the semantics of
+ * k_work_submit_to_queue(); an item whose submission is rejected (e.g.
+ * it is cancelling, or the queue is draining) is skipped and does not
+ * affect the remaining items.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the items should run.
+ * If NULL each item's most recent queue will be used.
+ *
+ * @param works array of pointers to work items.
+ *
+ * @param count number of entries in @p works.
+ *
+ * @return the number of items newly or already queued (i.e. those for
+ * which k_work_submit_to_queue() would have returned a non-negative
+ * value).
+ */
+int k_work_submit_batch(struct k_work_q *queue, struct k_work **works,
+			size_t count);
+
+/** @brief Wait for all previously submitted work on a queue to complete.
+ *
+ * This appends an internal flusher item behind everything currently
+ * pending on @p queue (including work submitted with
+ * k_work_submit_batch()) and blocks until it has run.  Work submitted
+ * after this call returns may not have completed.
+ *
+ * @note Can be called by plain threads only, not from ISRs or the
+ * queue's own thread.
+ *
+ * @param queue pointer to the work queue.
+ *
+ * @retval 0 once all previously submitted work has completed
+ * @retval -ENODEV if @p queue has not been started.
+ */
+int k_work_queue_flush_batch(struct k_work_q *queue);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4265,6 +4419,15 @@ struct k_msgq {
 
 	_POLL_EVENT;
 
+#ifdef CONFIG_MSGQ_MPSC
+	/** MPSC mode: producer slot reservation counter */
+	atomic_t mpsc_wr;
+	/** MPSC mode: consumer position, owned by the consumer */
+	uint32_t mpsc_rd;
+	/** MPSC mode: consumer has advertised it is about to sleep */
+	atomic_t mpsc_waiting;
+#endif
+
 	/** Message queue */
 	uint8_t flags;
 
@@ -4294,6 +4457,23 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_MPSC	BIT(1)
+
+/**
+ * @brief Per-message buffer overhead of an MPSC message queue.
+ *
+ * MPSC queues prefix every message slot with a sequence word, so their
+ * ring buffer must be sized with K_MSGQ_MPSC_BUF_SIZE() rather than
+ * msg_size * max_msgs.
+ */
+#define K_MSGQ_MPSC_SLOT_SIZE(msg_size) \
+	(sizeof(atomic_t) + ROUND_UP(msg_size, sizeof(atomic_t)))
+
+/**
+ * @brief Required ring buffer size for an MPSC message queue.
+ */
+#define K_MSGQ_MPSC_BUF_SIZE(msg_size, max_msgs) \
+	((max_msgs) * K_MSGQ_MPSC_SLOT_SIZE(msg_size))
 
 /**
  * @brief Message Queue Attributes
@@ -4354,6 +4534,32 @@ struct k_msgq_attrs {
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs);
 
+#ifdef CONFIG_MSGQ_MPSC
+/**
+ * @brief Initialize a message queue in lock-free MPSC mode.
+ *
+ * This routine initializes a message queue for use by multiple
+ * producers (typically ISRs) and a single consumer thread.  Producers
+ * reserve and publish slots with atomic operations only and never
+ * contend on the queue spinlock, so a put from an ISR cannot spin
+ * against the consumer.
+ *
+ * MPSC queues carry a per-slot sequence word, so @a buffer must be
+ * K_MSGQ_MPSC_BUF_SIZE(msg_size, max_msgs) bytes and aligned to
+ * sizeof(atomic_t).  In this mode k_msgq_put() never blocks (a full
+ * queue fails with -ENOMSG regardless of timeout), k_msgq_get() and
+ * k_msgq_peek() may only be called from the single consumer, and
+ * k_msgq_num_used_get() is a snapshot that may lag the producers.
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued.
+ */
+void k_msgq_init_mpsc(struct k_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs);
+#endif /* CONFIG_MSGQ_MPSC */
+
 /**
  * @brief Initialize a message queue.
  *
@@ -4869,6 +5075,77 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  */
 __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 
+/**
+ * @brief Claim a contiguous region of the pipe buffer for writing.
+ *
+ * This routine exposes up to @a size bytes of free, contiguous pipe
+ * buffer space so data can be produced directly in place (e.g. by a
+ * driver or DMA engine) without an intermediate copy.  The claim must
+ * be committed with k_pipe_write_finish() before readers can see the
+ * data.  A region smaller than @a size (possibly zero) is returned
+ * when less contiguous space is available; claiming again after the
+ * next finish yields the space beyond the wrap point.
+ *
+ * Zero-copy access is only possible from kernel mode, and the caller
+ * is responsible for ensuring no other writer touches the pipe while
+ * a claim is outstanding.
+ *
+ * @param pipe Address of the pipe.
+ * @param data [out] Points to the start of the claimed region.
+ * @param size Requested region size in bytes.
+ *
+ * @return Number of bytes claimed, which may be zero.
+ */
+size_t k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Commit bytes produced into a claimed write region.
+ *
+ * Makes @a size bytes previously claimed with k_pipe_write_claim()
+ * visible to readers, waking any that are blocked.  @a size may be
+ * less than the claimed amount to commit a short write.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes to commit.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a size exceeds the claimable space
+ */
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim a contiguous region of buffered pipe data for reading.
+ *
+ * This routine exposes up to @a size bytes of buffered, contiguous
+ * pipe data for in-place consumption without copying it out.  The
+ * region must be released with k_pipe_read_finish().  As with
+ * k_pipe_write_claim(), a short (possibly zero length) region
+ * indicates a wrap point or an empty pipe, and the caller must ensure
+ * no other reader runs while a claim is outstanding.
+ *
+ * @param pipe Address of the pipe.
+ * @param data [out] Points to the start of the claimed data.
+ * @param size Requested region size in bytes.
+ *
+ * @return Number of bytes claimed, which may be zero.
+ */
+size_t k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Release bytes consumed from a claimed read region.
+ *
+ * Frees @a size bytes previously claimed with k_pipe_read_claim(),
+ * allowing blocked writers to refill the buffer.  @a size may be less
+ * than the claimed amount to release a partial read.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes to release.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a size exceeds the buffered data
+ */
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -4887,6 +5164,16 @@ struct k_mem_slab {
 	uint32_t max_used;
 #endif
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	/** Per-CPU block magazines, see k_mem_slab_cache_enable() */
+	struct {
+		char *free_list;
+		uint16_t count;
+	} cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/** Magazine capacity; 0 when caching is disabled */
+	uint16_t cache_depth;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 };
 
@@ -4990,6 +5277,31 @@ struct k_mem_slab {
 extern int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 			   size_t block_size, uint32_t num_blocks);
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+/**
+ * @brief Enable per-CPU block caching for a memory slab.
+ *
+ * Attaches a CPU-local magazine of up to @a depth blocks to each CPU.
+ * Subsequent k_mem_slab_alloc()/k_mem_slab_free() calls are served
+ * from the local magazine without touching the slab spinlock, with
+ * blocks moved to and from the shared free list in bulk when a
+ * magazine runs empty or full.
+ *
+ * Blocks parked in a magazine are reported as in-use by
+ * k_mem_slab_num_used_get() and the runtime statistics, and a free
+ * that lands in a magazine does not wake blocked allocators until the
+ * shared free list is touched again, so caching is best suited to
+ * slabs used with K_NO_WAIT allocations on hot paths.
+ *
+ * @param slab Address of the memory slab.
+ * @param depth Magazine capacity per CPU, in blocks.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a depth is zero or exceeds the slab block count
+ */
+int k_mem_slab_cache_enable(struct k_mem_slab *slab, uint16_t depth);
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 /**
  * @brief Allocate memory from a memory slab.
  *
@@ -5116,6 +5428,9 @@ struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KHEAP_DEFERRED_FREE
+	atomic_ptr_t defer_list;
+#endif
 };
 
 /**
@@ -5191,6 +5506,27 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes,
  */
 void k_heap_free(struct k_heap *h, void *mem);
 
+/**
+ * @brief Return deferred frees to the heap
+ *
+ * When CONFIG_KHEAP_DEFERRED_FREE is enabled, blocks passed to
+ * k_heap_free() are collected on a constant-time list and only merged
+ * back into the heap on the next allocation.  This call performs that
+ * merge work eagerly, bounding the latency of a subsequent
+ * k_heap_alloc().  It is a no-op when deferred free is disabled, and
+ * there is never a requirement to call it for correctness.
+ *
+ * @param h Heap to reclaim deferred frees on
+ */
+#ifdef CONFIG_KHEAP_DEFERRED_FREE
+void k_heap_reclaim(struct k_heap *h);
+#else
+static inline void k_heap_reclaim(struct k_heap *h)
+{
+	ARG_UNUSED(h);
+}
+#endif
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
@@ -5585,6 +5921,86 @@ extern void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Persistent set of registered poll events
+ *
+ * A poll set keeps its events registered with their objects across wait
+ * calls, so waking up and waiting again costs O(ready) instead of the
+ * O(num_events) re-registration performed by every k_poll() invocation.
+ * Useful for dispatch loops polling a large, mostly-idle event array.
+ *
+ * All fields are kernel-internal; initialize with k_poll_set_init().
+ */
+struct k_poll_set {
+	/** events whose condition was met, pending delivery */
+	sys_dlist_t ready;
+	/** threads blocked in k_poll_set_wait() */
+	_wait_q_t wait_q;
+	/** shared poller linking registered events back to this set */
+	struct z_poller poller;
+};
+
+/**
+ * @brief Initialize a poll set
+ *
+ * This API is only usable from supervisor mode.
+ *
+ * @param set The poll set to initialize.
+ *
+ * @retval 0 Success.
+ */
+int k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Register an event with a poll set
+ *
+ * The event stays registered with the polled object until removed with
+ * k_poll_set_remove(); it must not be passed to k_poll() or added to
+ * another set while registered. If the event's condition is already met
+ * it is queued for delivery immediately.
+ *
+ * @param set The poll set.
+ * @param event An initialized event (see k_poll_event_init()).
+ *
+ * @retval 0 Success.
+ * @retval -EBUSY The event is already registered.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set
+ *
+ * @param set The poll set.
+ * @param event The event to deregister.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL The event is not registered with this set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events registered with a poll set
+ *
+ * Blocks until at least one registered event becomes ready, then stores
+ * up to @a max_ready pointers to ready events in @a ready. As with
+ * k_poll(), readiness only signals that the condition held; the caller
+ * still acquires objects through their regular APIs, and should reset
+ * each delivered event's state field to K_POLL_STATE_NOT_READY once the
+ * state change has been consumed. Events whose condition still holds are
+ * delivered again by subsequent calls.
+ *
+ * @param set The poll set.
+ * @param ready Output array of ready event pointers.
+ * @param max_ready Capacity of the output array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval n The number of ready events stored, on success.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_ready, k_timeout_t timeout);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -35,7 +35,7 @@ struct k_thread *z_priq_dumb_best(sys_dlist_t *pq);
 void z_priq_dumb_remove(sys_dlist_t *pq, struct k_thread *thread);
 
 struct _priq_rb {
-	struct rbtree tree;
+	struct rbtree_cached tree;
 	int next_order_key;
 };
 
@@ -8,6 +8,9 @@
 #define ZEPHYR_INCLUDE_KERNEL_STATS_H_
 
 #include <stdint.h>
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+#include <zephyr/sys/atomic.h>
+#endif
 
 /*
  * [k_cycle_stats] is used to track internal statistics about both thread
@@ -20,6 +23,9 @@ struct k_cycle_stats {
 	uint64_t  current;      /* # of cycles in current usage window */
 	uint64_t  longest;      /* # of cycles in longest usage window */
 	uint32_t  num_windows;  /* # of usage windows */
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+	atomic_t  seq;          /* seqlock counter; odd while updating */
 #endif
 	bool      track_usage;  /* true if gathering usage stats */
 };
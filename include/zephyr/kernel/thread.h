@@ -123,6 +123,11 @@ struct _thread_base {
 	uint8_t cpu_mask;
 #endif
 
+#ifdef CONFIG_SCHED_PER_CPU_QUEUES
+	/* CPU whose run queue currently holds this thread */
+	uint8_t runq_cpu;
+#endif
+
 	/* data returned by APIs */
 	void *swap_data;
 
@@ -110,7 +110,8 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || \
+	defined(CONFIG_SCHED_PER_CPU_QUEUES)
 	struct _ready_q ready_q;
 #endif
 
@@ -130,6 +131,11 @@ struct _cpu {
 	void *fp_ctx;
 #endif
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+	/* thread whose FP register context is live in the FP unit */
+	struct k_thread *fpu_owner;
+#endif
+
 #ifdef CONFIG_SMP
 	/* True when _current is allowed to context switch */
 	uint8_t swap_ok;
@@ -166,7 +172,8 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && \
+	!defined(CONFIG_SCHED_PER_CPU_QUEUES)
 	struct _ready_q ready_q;
 #endif
 
@@ -189,9 +196,14 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+#ifdef CONFIG_SCHED_IPI_TARGETED
+	/* CPUs needing an IPI at the next scheduling point, by bit */
+	atomic_t pending_ipi_mask;
+#else
 	/* Need to signal an IPI at the next scheduling point */
 	bool pending_ipi;
 #endif
+#endif
 };
 
 typedef struct z_kernel _kernel_t;
@@ -224,7 +236,7 @@ typedef struct {
 
 extern bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 
-#define Z_WAIT_Q_INIT(wait_q) { { { .lessthan_fn = z_priq_rb_lessthan } } }
+#define Z_WAIT_Q_INIT(wait_q) { { { { .lessthan_fn = z_priq_rb_lessthan } } } }
 
 #else
 
@@ -63,6 +63,10 @@ struct log_backend_api {
 	void (*process)(const struct log_backend *const backend,
 			union log_msg_generic *msg);
 
+	/* Optional, messages are passed one by one to process when NULL. */
+	void (*process_batch)(const struct log_backend *const backend,
+			      union log_msg_generic *msgs[], uint32_t cnt);
+
 	void (*dropped)(const struct log_backend *const backend, uint32_t cnt);
 	void (*panic)(const struct log_backend *const backend);
 	void (*init)(const struct log_backend *const backend);
@@ -179,6 +183,32 @@ static inline void log_backend_msg_process(const struct log_backend *const backe
 	backend->api->process(backend, msg);
 }
 
+/**
+ * @brief Process a batch of messages.
+ *
+ * Batch handler is optional. When a backend does not provide it, messages
+ * are passed one by one to the standard process handler.
+ *
+ * @param[in] backend  Pointer to the backend instance.
+ * @param[in] msgs     Array of messages with log entries.
+ * @param[in] cnt      Number of messages in the array.
+ */
+static inline void log_backend_msg_process_batch(const struct log_backend *const backend,
+						 union log_msg_generic *msgs[],
+						 uint32_t cnt)
+{
+	__ASSERT_NO_MSG(backend != NULL);
+
+	if (backend->api->process_batch != NULL) {
+		backend->api->process_batch(backend, msgs, cnt);
+		return;
+	}
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		log_backend_msg_process(backend, msgs[i]);
+	}
+}
+
 /**
  * @brief Notify backend about dropped log messages.
  *
@@ -119,6 +119,14 @@ void z_log_msg_commit(struct log_msg *msg);
  */
 union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff);
 
+#ifdef CONFIG_LOG_TRANSIENT_STR_POOL
+/** @brief Release transient string pool slots referenced by a message.
+ *
+ * @param msg Message.
+ */
+void z_log_msg_str_pool_release(struct log_msg *msg);
+#endif
+
 /** @brief Free message.
  *
  * @param msg Message.
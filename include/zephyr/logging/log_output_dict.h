@@ -23,6 +23,28 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+
+	/* Compressed message: type byte, one byte with domain (3 bits) and
+	 * level (3 bits), then LEB128 varints for source ID, zigzag encoded
+	 * timestamp delta, package length and data length, followed by the
+	 * package encoded as LEB128 varints per 32-bit word (plus trailing
+	 * bytes verbatim) and the data verbatim.
+	 * Emitted when CONFIG_LOG_DICTIONARY_COMPRESS is enabled.
+	 */
+	MSG_NORMAL_COMPRESSED = 2,
+
+	/* Previous message repeated: type byte followed by a LEB128 varint
+	 * with the zigzag encoded timestamp delta.
+	 */
+	MSG_REPEAT = 3,
+
+	/* Same layout as MSG_NORMAL_COMPRESSED, except that package words
+	 * listed in the read-only string location array hold offsets into
+	 * the log strings section instead of string addresses. Emitted when
+	 * CONFIG_LOG_DICTIONARY_STR_ID is enabled and all read-only string
+	 * arguments of a message reside in that section.
+	 */
+	MSG_NORMAL_STR_ID = 4,
 };
 
 /**
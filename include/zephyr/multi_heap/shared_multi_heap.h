@@ -72,6 +72,12 @@ enum smh_reg_attr {
 	/** non-cacheable */
 	SMH_REG_ATTR_NON_CACHEABLE,
 
+	/** high-bandwidth / low-latency on-chip memory (e.g. TCM) */
+	SMH_REG_ATTR_FAST,
+
+	/** bulk external memory (e.g. SDRAM) */
+	SMH_REG_ATTR_BULK,
+
 	/** must be the last item */
 	SMH_REG_ATTR_NUM,
 };
@@ -143,6 +149,88 @@ void *shared_multi_heap_alloc(unsigned int attr, size_t bytes);
  */
 void *shared_multi_heap_aligned_alloc(unsigned int attr, size_t align, size_t bytes);
 
+/**
+ * @brief Allocate memory with an ordered list of preferred attributes
+ *
+ * Like @ref shared_multi_heap_alloc, but instead of a single attribute
+ * the caller passes an ordered list of acceptable attributes.  The
+ * regions carrying the first attribute are tried first, falling back to
+ * the next attribute in the list when they cannot satisfy the request.
+ *
+ * This makes placement policies explicit without hand-placed addresses,
+ * for example DMA descriptors preferring fast on-chip memory:
+ *
+ *     unsigned int attrs[] = { SMH_REG_ATTR_FAST, SMH_REG_ATTR_BULK };
+ *
+ *     desc = shared_multi_heap_alloc_prefer(attrs, ARRAY_SIZE(attrs), size);
+ *
+ * @param attrs		ordered list of acceptable attributes, most
+ *			preferred first.
+ * @param n_attr	number of entries in @p attrs.
+ * @param bytes		requested size of the allocation in bytes.
+ *
+ * @retval ptr		a valid pointer to heap memory.
+ * @retval err		NULL if no memory is available.
+ */
+void *shared_multi_heap_alloc_prefer(const unsigned int *attrs, size_t n_attr,
+				     size_t bytes);
+
+/**
+ * @brief Allocate aligned memory with an ordered list of preferred attributes
+ *
+ * As for @ref shared_multi_heap_alloc_prefer, with an additional
+ * parameter specifying a power of two alignment in bytes.
+ *
+ * @param attrs		ordered list of acceptable attributes, most
+ *			preferred first.
+ * @param n_attr	number of entries in @p attrs.
+ * @param align		power of two alignment for the returned pointer, in bytes.
+ * @param bytes		requested size of the allocation in bytes.
+ *
+ * @retval ptr		a valid pointer to heap memory.
+ * @retval err		NULL if no memory is available.
+ */
+void *shared_multi_heap_aligned_alloc_prefer(const unsigned int *attrs,
+					     size_t n_attr, size_t align,
+					     size_t bytes);
+
+/**
+ * @brief Per-region statistics
+ *
+ * Snapshot of the statistics kept for one region when
+ * CONFIG_SHARED_MULTI_HEAP_STATS is enabled.
+ */
+struct shared_multi_heap_stats {
+	/** Allocations served by this region */
+	uint32_t hits;
+
+	/** Allocation attempts this region could not satisfy */
+	uint32_t misses;
+
+	/** Bytes currently allocated from this region */
+	size_t allocated_bytes;
+
+	/** High watermark of bytes allocated from this region */
+	size_t max_allocated_bytes;
+};
+
+/**
+ * @brief Retrieve statistics for one region
+ *
+ * Regions sharing an attribute are indexed in the order they were added
+ * with @ref shared_multi_heap_add.
+ *
+ * @param attr		attribute of the region.
+ * @param idx		index of the region within the attribute.
+ * @param stats		filled with the region's statistics.
+ *
+ * @retval 0		on success.
+ * @retval -EINVAL	when the attribute or index is out-of-bound.
+ * @retval -ENOSYS	when CONFIG_SHARED_MULTI_HEAP_STATS is disabled.
+ */
+int shared_multi_heap_stats_get(unsigned int attr, unsigned int idx,
+				struct shared_multi_heap_stats *stats);
+
 /**
  * @brief Free memory from the shared multi-heap pool
  *
@@ -1140,6 +1140,56 @@ extern const struct net_buf_data_cb net_buf_fixed_cb;
 extern const struct net_buf_data_cb net_buf_var_cb;
 /** @endcond */
 
+/** @cond INTERNAL_HIDDEN */
+extern const struct net_buf_data_cb net_buf_slab_cb;
+/** @endcond */
+
+/**
+ *
+ * @brief Define a new pool for buffers with contiguous block payloads
+ *
+ * Defines a net_buf_pool struct and the necessary memory storage (array of
+ * structs) for the needed amount of buffers. After this, the buffers can be
+ * accessed from the pool through net_buf_alloc. The pool is defined as a
+ * static variable, so if it needs to be exported outside the current module
+ * this needs to happen with the help of a separate pointer rather than an
+ * extern declaration.
+ *
+ * The data payload of the buffers will be allocated from a memory slab of
+ * @p _data_count blocks of @p _data_size bytes each. Every allocation is
+ * handed out as one contiguous block, so a pool sized for the link MTU
+ * yields single-fragment packets suitable for DMA engines that cannot
+ * scatter-gather, without the deterministic allocation time of a slab
+ * being lost to heap fragmentation. Unlike the heap based pools, blocking
+ * on the data allocation is supported, so the timeout passed to
+ * net_buf_alloc is honoured.
+ *
+ * If provided with a custom destroy callback, this callback is
+ * responsible for eventually calling net_buf_destroy() to complete the
+ * process of returning the buffer to the pool.
+ *
+ * @param _name       Name of the pool variable.
+ * @param _count      Number of buffers in the pool.
+ * @param _data_count Number of data blocks in the pool.
+ * @param _data_size  Maximum data payload per buffer.
+ * @param _ud_size    User data space to reserve per buffer.
+ * @param _destroy    Optional destroy callback when buffer is freed.
+ */
+#define NET_BUF_POOL_SLAB_DEFINE(_name, _count, _data_count, _data_size,       \
+				 _ud_size, _destroy)                           \
+	_NET_BUF_ARRAY_DEFINE(_name, _count, _ud_size);                        \
+	K_MEM_SLAB_DEFINE_STATIC(net_buf_slab_##_name,                         \
+				 sizeof(void *) + (_data_size), _data_count,   \
+				 sizeof(void *));                              \
+	static const struct net_buf_data_alloc net_buf_slab_alloc_##_name = {  \
+		.cb = &net_buf_slab_cb,                                        \
+		.alloc_data = &net_buf_slab_##_name,                           \
+	};                                                                     \
+	static STRUCT_SECTION_ITERABLE(net_buf_pool, _name) =                  \
+		NET_BUF_POOL_INITIALIZER(_name, &net_buf_slab_alloc_##_name,   \
+					 _net_buf_##_name, _count, _ud_size,   \
+					 _destroy)
+
 /**
  *
  * @brief Define a new pool for buffers with variable size payloads
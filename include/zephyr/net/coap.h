@@ -680,6 +680,129 @@ int coap_next_block_for_option(const struct coap_packet *cpkt,
 size_t coap_next_block(const struct coap_packet *cpkt,
 		       struct coap_block_context *ctx);
 
+#if defined(CONFIG_COAP_BLOCK_WINDOW) || defined(__DOXYGEN__)
+
+/**
+ * @brief Represents a windowed (pipelined) block-wise transfer.
+ *
+ * Instead of requesting one block per round-trip, up to
+ * CONFIG_COAP_BLOCK_WINDOW_SIZE blocks are kept in flight, each
+ * tracked by its own #coap_pending entry so that individual blocks
+ * can be retransmitted independently.
+ */
+struct coap_block_window {
+	/** Transfer-wide block context */
+	struct coap_block_context ctx;
+	/** Per-block retransmission state */
+	struct coap_pending pendings[CONFIG_COAP_BLOCK_WINDOW_SIZE];
+	/** Byte offset of the block tracked by each pending entry */
+	size_t offsets[CONFIG_COAP_BLOCK_WINDOW_SIZE];
+	/** Offset of the next block not yet requested */
+	size_t next;
+	/** Number of bytes confirmed so far */
+	size_t received;
+	/** Block option the window operates on (BLOCK1 or BLOCK2) */
+	uint16_t option;
+};
+
+/**
+ * @brief Initializes a windowed block-wise transfer.
+ *
+ * @param window The window to be initialized
+ * @param option COAP_OPTION_BLOCK1 for uploads or COAP_OPTION_BLOCK2
+ * for downloads
+ * @param block_size The size of the block
+ * @param total_size The total size of the transfer, if known
+ *
+ * @return 0 in case of success or negative in case of error.
+ */
+int coap_block_window_init(struct coap_block_window *window,
+			   enum coap_option_num option,
+			   enum coap_block_size block_size,
+			   size_t total_size);
+
+/**
+ * @brief Get the block context for the next block to request.
+ *
+ * On success @a block_ctx can be passed to
+ * coap_append_block1_option() or coap_append_block2_option() to build
+ * the request for the next block that is not yet in flight. Call this
+ * repeatedly to fill the window.
+ *
+ * @param window Transfer window
+ * @param block_ctx Block context to be filled
+ *
+ * @return 0 in case of success, -EAGAIN if the window is full,
+ * -ENOENT if there are no more blocks to request.
+ */
+int coap_block_window_next(struct coap_block_window *window,
+			   struct coap_block_context *block_ctx);
+
+/**
+ * @brief Track a sent block request in the window.
+ *
+ * The block number is read from the block option in @a request. As
+ * with coap_pending_init(), the data of @a request must remain valid
+ * until the block is confirmed, and the caller is expected to call
+ * coap_pending_cycle() on the returned entry before sending.
+ *
+ * @param window Transfer window
+ * @param request Request that carries the block option
+ * @param addr Address of the remote device
+ * @param retries Maximum number of retransmissions of the block
+ *
+ * @return pointer to the #coap_pending entry tracking the block,
+ * NULL in case of error.
+ */
+struct coap_pending *coap_block_window_register(
+	struct coap_block_window *window,
+	const struct coap_packet *request,
+	const struct sockaddr *addr,
+	uint8_t retries);
+
+/**
+ * @brief Handle the response for one in-flight block.
+ *
+ * Matches @a response against the in-flight blocks, releases the
+ * matching #coap_pending entry and updates the transfer state (total
+ * size and amount of data confirmed).
+ *
+ * @param window Transfer window
+ * @param response Response received from the remote device
+ * @param offset Byte offset of the confirmed block in the transfer
+ *
+ * @return 0 in case of success, -ENOENT if the response does not
+ * match any block in flight.
+ */
+int coap_block_window_received(struct coap_block_window *window,
+			       const struct coap_packet *response,
+			       size_t *offset);
+
+/**
+ * @brief Retrieves the next in-flight block about to expire.
+ *
+ * The returned entry can be retransmitted with coap_pending_cycle()
+ * like any other pending request.
+ *
+ * @param window Transfer window
+ *
+ * @return The next #coap_pending to expire, NULL if no block is in
+ * flight.
+ */
+struct coap_pending *coap_block_window_next_to_expire(
+	struct coap_block_window *window);
+
+/**
+ * @brief Check whether all blocks of the transfer are confirmed.
+ *
+ * @param window Transfer window
+ *
+ * @return true if the whole transfer is confirmed, false otherwise.
+ */
+bool coap_block_window_is_complete(struct coap_block_window *window);
+
+#endif /* CONFIG_COAP_BLOCK_WINDOW */
+
 /**
  * @brief Indicates that the remote device referenced by @a addr, with
  * @a request, wants to observe a resource.
@@ -116,10 +116,22 @@ struct net_eth_addr {
 
 /** Ethernet hardware capabilities */
 enum ethernet_hw_caps {
-	/** TX Checksum offloading supported for all of IPv4, UDP, TCP */
+	/** TX Checksum offloading supported.
+	 *
+	 * The device is expected to support checksum calculation for all
+	 * of IPv4, UDP and TCP, unless it reports a more fine-grained set
+	 * of supported checksums via the
+	 * ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT configuration.
+	 */
 	ETHERNET_HW_TX_CHKSUM_OFFLOAD	= BIT(0),
 
-	/** RX Checksum offloading supported for all of IPv4, UDP, TCP */
+	/** RX Checksum offloading supported.
+	 *
+	 * The device is expected to support checksum verification for all
+	 * of IPv4, UDP and TCP, unless it reports a more fine-grained set
+	 * of supported checksums via the
+	 * ETHERNET_CONFIG_TYPE_RX_CHECKSUM_SUPPORT configuration.
+	 */
 	ETHERNET_HW_RX_CHKSUM_OFFLOAD	= BIT(1),
 
 	/** VLAN supported */
@@ -175,6 +187,29 @@ enum ethernet_hw_caps {
 	ETHERNET_TXTIME			= BIT(19),
 };
 
+/** Types of checksum for which the Ethernet device may offer support.
+ *
+ * Queried from the driver via the
+ * ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT and
+ * ETHERNET_CONFIG_TYPE_RX_CHECKSUM_SUPPORT configurations, to refine the
+ * coarse ETHERNET_HW_TX_CHKSUM_OFFLOAD and ETHERNET_HW_RX_CHKSUM_OFFLOAD
+ * capabilities on a per-protocol basis.
+ */
+enum ethernet_checksum_support {
+	/** No checksum support */
+	ETHERNET_CHECKSUM_SUPPORT_NONE		= 0,
+	/** IPv4 header checksum */
+	ETHERNET_CHECKSUM_SUPPORT_IPV4_HEADER	= BIT(0),
+	/** ICMPv4 checksum */
+	ETHERNET_CHECKSUM_SUPPORT_IPV4_ICMP	= BIT(1),
+	/** ICMPv6 checksum */
+	ETHERNET_CHECKSUM_SUPPORT_IPV6_ICMP	= BIT(2),
+	/** TCP checksum */
+	ETHERNET_CHECKSUM_SUPPORT_TCP		= BIT(3),
+	/** UDP checksum */
+	ETHERNET_CHECKSUM_SUPPORT_UDP		= BIT(4),
+};
+
 /** @cond INTERNAL_HIDDEN */
 
 enum ethernet_config_type {
@@ -190,6 +225,8 @@ enum ethernet_config_type {
 	ETHERNET_CONFIG_TYPE_PRIORITY_QUEUES_NUM,
 	ETHERNET_CONFIG_TYPE_FILTER,
 	ETHERNET_CONFIG_TYPE_PORTS_NUM,
+	ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT,
+	ETHERNET_CONFIG_TYPE_RX_CHECKSUM_SUPPORT,
 };
 
 enum ethernet_qav_param_type {
@@ -396,6 +433,8 @@ struct ethernet_config {
 		int priority_queues_num;
 		int ports_num;
 
+		enum ethernet_checksum_support chksum_support;
+
 		struct ethernet_filter filter;
 	};
 };
@@ -452,6 +491,18 @@ struct ethernet_api {
 
 	/** Send a network packet */
 	int (*send)(const struct device *dev, struct net_pkt *pkt);
+
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	/** Send a batch of network packets in one go so that the driver
+	 * can amortize descriptor ring doorbells and locking over the
+	 * whole batch. Returns the number of packets accepted for
+	 * transmission, or a negative error code if none were accepted.
+	 * This is optional, drivers not setting this are handed one
+	 * packet at a time via send.
+	 */
+	int (*send_batch)(const struct device *dev, struct net_pkt **pkts,
+			  int count);
+#endif /* CONFIG_NET_TC_TX_BATCH */
 };
 
 /* Make sure that the network interface API is properly setup inside
@@ -936,6 +987,103 @@ void net_eth_carrier_off(struct net_if *iface);
  */
 int net_eth_promisc_mode(struct net_if *iface, bool enable);
 
+/**
+ * @brief Send a batch of network packets to the Ethernet driver.
+ *
+ * Each packet gets its link layer header set up individually and the
+ * resulting frames are then offered to the driver with a single
+ * send_batch call.
+ *
+ * @param iface Network interface, must be the TX interface of every
+ * packet in the batch
+ * @param pkts Array of packets to send
+ * @param status Output array, filled with the number of bytes sent or
+ * a negative error code for each packet
+ * @param count Number of packets in the batch, at most
+ * CONFIG_NET_TC_TX_BATCH_SIZE
+ *
+ * @return 0 if the batch was processed (see the status array for
+ * individual results), -ENOTSUP if the driver does not implement
+ * send_batch.
+ */
+#if defined(CONFIG_NET_TC_TX_BATCH)
+int net_eth_send_batch(struct net_if *iface, struct net_pkt **pkts,
+		       int *status, int count);
+#endif
+
+#if defined(CONFIG_NET_ETHERNET_RX_POLL) || defined(__DOXYGEN__)
+/**
+ * @typedef net_eth_rx_poll_cb_t
+ * @brief Callback used by the RX poller to receive pending frames.
+ *
+ * The driver should pass at most budget frames to the network stack
+ * and return the number of frames it processed. Returning less than
+ * budget tells the poller that the RX queue is empty.
+ *
+ * @param iface Network interface the poller was registered for
+ * @param budget Maximum number of frames to process in this pass
+ *
+ * @return Number of frames processed
+ */
+typedef int (*net_eth_rx_poll_cb_t)(struct net_if *iface, int budget);
+
+/**
+ * @typedef net_eth_rx_irq_enable_cb_t
+ * @brief Callback used by the RX poller to re-enable RX interrupts
+ * once the receive queue has been drained.
+ *
+ * @param iface Network interface the poller was registered for
+ */
+typedef void (*net_eth_rx_irq_enable_cb_t)(struct net_if *iface);
+
+/** RX poller for interrupt mitigation, see net_eth_rx_poller_init() */
+struct net_eth_rx_poller {
+	/** Work item used to run the polling pass */
+	struct k_work work;
+
+	/** Network interface being polled */
+	struct net_if *iface;
+
+	/** Driver callback that receives pending frames */
+	net_eth_rx_poll_cb_t poll;
+
+	/** Driver callback that re-enables RX interrupts */
+	net_eth_rx_irq_enable_cb_t irq_enable;
+};
+
+/**
+ * @brief Initialize a RX poller for a network interface.
+ *
+ * Instead of handing every received frame to the network stack from
+ * the ISR, a driver using polled RX masks its RX interrupt in the ISR
+ * and calls net_eth_rx_schedule(). The poller then invokes the poll
+ * callback from a dedicated thread, processing bursts of frames up to
+ * CONFIG_NET_ETHERNET_RX_POLL_BUDGET per pass, and calls the
+ * irq_enable callback once the receive queue is empty.
+ *
+ * This is typically called from the driver init function.
+ *
+ * @param poller Poller to initialize
+ * @param iface Network interface to poll
+ * @param poll Callback that receives pending frames
+ * @param irq_enable Callback that re-enables RX interrupts
+ */
+void net_eth_rx_poller_init(struct net_eth_rx_poller *poller,
+			    struct net_if *iface,
+			    net_eth_rx_poll_cb_t poll,
+			    net_eth_rx_irq_enable_cb_t irq_enable);
+
+/**
+ * @brief Schedule a RX polling pass.
+ *
+ * Safe to call from interrupt context. The driver must mask its RX
+ * interrupt before calling this.
+ *
+ * @param poller Poller to schedule
+ */
+void net_eth_rx_schedule(struct net_eth_rx_poller *poller);
+#endif /* CONFIG_NET_ETHERNET_RX_POLL */
+
 /**
  * @brief Return PTP clock that is tied to this ethernet network interface.
  *
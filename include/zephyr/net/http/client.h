@@ -22,6 +22,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/net/tls_credentials.h>
 #include <zephyr/net/http/parser.h>
 
 #ifdef __cplusplus
@@ -330,6 +331,56 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+#if defined(CONFIG_HTTP_CLIENT_CONNECTION_POOL) || defined(__DOXYGEN__)
+/**
+ * TLS configuration for a pooled connection. Passed to
+ * http_client_pool_req() when the connection to the server should use TLS.
+ */
+struct http_pool_sec_config {
+	/** Security tags to use for the TLS connection. */
+	const sec_tag_t *sec_tag_list;
+
+	/** Number of security tags in the list. */
+	size_t sec_tag_count;
+
+	/** Hostname used to verify the server certificate. If NULL, the
+	 * host field of the request is used.
+	 */
+	const char *hostname;
+};
+
+/**
+ * @brief Do a HTTP request over a pooled connection. This works like
+ * http_client_req() except that the connection to the server is created
+ * by the library and kept open after the response, so that following
+ * requests to the same host and port reuse it instead of paying the
+ * TCP (and TLS) connection setup again. A connection is dropped from
+ * the pool when the server closes it, when a request on it fails or
+ * when it has been idle for longer than
+ * CONFIG_HTTP_CLIENT_CONNECTION_POOL_IDLE_TIMEOUT seconds.
+ *
+ * The host and port fields of the request select the connection.
+ *
+ * @param req HTTP request information
+ * @param sec TLS configuration, NULL for a plain TCP connection
+ * @param timeout Max timeout to wait for the data. The timeout value cannot be
+ *        0 as there would be no time to receive the data.
+ *        The timeout value is in milliseconds.
+ * @param user_data User specified data that is passed to the callback.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req(struct http_request *req,
+			 const struct http_pool_sec_config *sec,
+			 int32_t timeout, void *user_data);
+
+/**
+ * @brief Close all pooled connections that are not currently used by
+ * a request.
+ */
+void http_client_pool_purge(void);
+#endif /* CONFIG_HTTP_CLIENT_CONNECTION_POOL */
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,10 +7,14 @@
 #ifndef ZEPHYR_INCLUDE_NET_CONN_MGR_H_
 #define ZEPHYR_INCLUDE_NET_CONN_MGR_H_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+struct net_if;
+
 #if defined(CONFIG_NET_CONNECTION_MANAGER)
 
 void net_conn_mgr_resend_status(void);
@@ -21,6 +25,29 @@ void net_conn_mgr_resend_status(void);
 
 #endif /* CONFIG_NET_CONNECTION_MANAGER */
 
+#if defined(CONFIG_NET_CONNECTION_MANAGER_EPOCH)
+
+/**
+ * @brief Get the connectivity epoch of an interface.
+ *
+ * The epoch is incremented every time the interface connects with
+ * different addressing than in its previous connected period. A
+ * consumer that stored the epoch together with its sessions can
+ * compare it after NET_EVENT_L4_CONNECTED to tell a resume on the
+ * same network from a move to a new one.
+ *
+ * @param iface Network interface.
+ *
+ * @return Current epoch, 0 if the interface never connected.
+ */
+uint32_t net_conn_mgr_if_epoch(struct net_if *iface);
+
+#else
+
+#define net_conn_mgr_if_epoch(...) 0
+
+#endif /* CONFIG_NET_CONNECTION_MANAGER_EPOCH */
+
 #ifdef __cplusplus
 }
 #endif
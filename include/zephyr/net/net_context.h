@@ -115,6 +115,28 @@ typedef void (*net_context_send_cb_t)(struct net_context *context,
 				      int status,
 				      void *user_data);
 
+/**
+ * @typedef net_context_tx_zc_cb_t
+ * @brief Zero-copy transmit completion callback.
+ *
+ * @details The completion callback is called when the network stack no
+ * longer references an application buffer that was queued for zero-copy
+ * transmission. For TCP this happens once the data has been acknowledged
+ * by the peer, or when the connection is torn down before that. The
+ * buffer may be reused or freed after this callback has been called, but
+ * not before. This callback is called by TX or RX thread so keep
+ * processing in the callback minimal.
+ *
+ * @param context The context to use.
+ * @param buf Start of the application buffer that was released.
+ * @param len Length of the application buffer.
+ * @param user_data The user data given in net_context_setup_tx_zc() call.
+ */
+typedef void (*net_context_tx_zc_cb_t)(struct net_context *context,
+				       const void *buf,
+				       size_t len,
+				       void *user_data);
+
 /**
  * @typedef net_tcp_accept_cb_t
  * @brief Accept callback
@@ -214,6 +236,13 @@ __net_socket struct net_context {
 	 */
 	struct k_mutex lock;
 
+#if defined(CONFIG_NET_CONTEXT_RECV_LOCK)
+	/** Separate lock for the receive path so that transmit and receive
+	 * on the same context do not serialize each other.
+	 */
+	struct k_mutex recv_lock;
+#endif
+
 	/** Local endpoint address. Note that the values are in network byte
 	 * order.
 	 */
@@ -252,6 +281,17 @@ __net_socket struct net_context {
 	net_pkt_get_pool_func_t data_pool;
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 
+#if defined(CONFIG_NET_CONTEXT_TX_ZEROCOPY)
+	/** Completion callback to be called when a zero-copy transmit
+	 * buffer is released by the stack.
+	 */
+	net_context_tx_zc_cb_t tx_zc_cb;
+
+	/** User data for the zero-copy completion callback.
+	 */
+	void *tx_zc_user_data;
+#endif /* CONFIG_NET_CONTEXT_TX_ZEROCOPY */
+
 #if defined(CONFIG_NET_TCP)
 	/** TCP connection information */
 	void *tcp;
@@ -321,6 +361,10 @@ __net_socket struct net_context {
 #endif
 #if defined(CONFIG_NET_CONTEXT_DSCP_ECN)
 		uint8_t dscp_ecn;
+#endif
+#if defined(CONFIG_NET_CONTEXT_BUSY_POLL)
+		/** Receive busy polling window in microseconds */
+		uint32_t busy_poll;
 #endif
 	} options;
 
@@ -1072,6 +1116,7 @@ enum net_context_option {
 	NET_OPT_RCVBUF		= 6,
 	NET_OPT_SNDBUF		= 7,
 	NET_OPT_DSCP_ECN	= 8,
+	NET_OPT_BUSY_POLL	= 9,
 };
 
 /**
@@ -1154,6 +1199,34 @@ static inline void net_context_setup_pools(struct net_context *context,
 #define net_context_setup_pools(context, tx_pool, data_pool)
 #endif
 
+/**
+ * @brief Setup zero-copy transmit completion callback for this context.
+ *
+ * @details This needs to be called before data is sent with the
+ * MSG_ZEROCOPY flag. Buffers queued for zero-copy transmission are
+ * referenced directly by the transmit queue instead of being copied
+ * into net_buf fragments, and must stay intact until the completion
+ * callback reports them as released.
+ *
+ * @param context Context that will use zero-copy transmission.
+ * @param cb Completion callback called when the stack releases a
+ * zero-copy buffer.
+ * @param user_data User data passed to the completion callback.
+ */
+#if defined(CONFIG_NET_CONTEXT_TX_ZEROCOPY)
+static inline void net_context_setup_tx_zc(struct net_context *context,
+					   net_context_tx_zc_cb_t cb,
+					   void *user_data)
+{
+	NET_ASSERT(context);
+
+	context->tx_zc_cb = cb;
+	context->tx_zc_user_data = user_data;
+}
+#else
+#define net_context_setup_tx_zc(context, cb, user_data)
+#endif
+
 /**
  * @brief Check if a port is in use (bound)
  *
@@ -198,6 +198,7 @@ enum net_event_l4_cmd {
 	NET_EVENT_L4_CMD_DISCONNECTED,
 	NET_EVENT_L4_CMD_DNS_SERVER_ADD,
 	NET_EVENT_L4_CMD_DNS_SERVER_DEL,
+	NET_EVENT_L4_CMD_RESUMED,
 };
 
 #define NET_EVENT_L4_CONNECTED				\
@@ -212,6 +213,9 @@ enum net_event_l4_cmd {
 #define NET_EVENT_DNS_SERVER_DEL			\
 	(_NET_EVENT_L4_BASE | NET_EVENT_L4_CMD_DNS_SERVER_DEL)
 
+#define NET_EVENT_L4_RESUMED				\
+	(_NET_EVENT_L4_BASE | NET_EVENT_L4_CMD_RESUMED)
+
 /** @endcond */
 
 #ifdef CONFIG_NET_MGMT_EVENT_INFO
@@ -257,6 +261,22 @@ struct net_event_ipv6_route {
 	uint8_t prefix_len;
 };
 
+/**
+ * @brief Network Management event information structure
+ * Used to pass information on network events like
+ *   NET_EVENT_L4_RESUMED
+ * when CONFIG_NET_MGMT_EVENT_INFO enabled and event generator pass the
+ * information.
+ */
+struct net_event_l4_connectivity {
+	/** Connectivity epoch, incremented when the addressing changed */
+	uint32_t epoch;
+	/** Global IPv6 address, unspecified when there is none */
+	struct in6_addr ipv6;
+	/** Global IPv4 address, unspecified when there is none */
+	struct in_addr ipv4;
+};
+
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
 #ifdef __cplusplus
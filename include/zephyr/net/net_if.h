@@ -41,6 +41,9 @@
 extern "C" {
 #endif
 
+struct k_mem_slab;
+struct net_buf_pool;
+
 /**
  * @brief Network Interface unicast IP addresses
  *
@@ -332,6 +335,17 @@ struct net_if_dhcpv4 {
 
 	/** Number of attempts made for REQUEST and RENEWAL messages */
 	uint8_t attempts;
+
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	/** Leased IP address loaded from persistent storage */
+	struct in_addr cached_ip;
+
+	/** Is the cached_ip field holding a usable lease */
+	uint8_t lease_cached : 1;
+
+	/** Is the client requesting the cached lease (INIT-REBOOT) */
+	uint8_t init_reboot : 1;
+#endif
 };
 #endif /* CONFIG_NET_DHCPV4 */
 
@@ -513,6 +527,24 @@ struct net_if {
 	/** Network interface instance configuration */
 	struct net_if_config config;
 
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	/** Get TX packet slab for this interface. The function pointer
+	 * types are spelled out instead of using the
+	 * net_pkt_get_slab_func_t / net_pkt_get_pool_func_t typedefs
+	 * from net_context.h in order to avoid a circular dependency.
+	 */
+	struct k_mem_slab *(*tx_slab)(void);
+
+	/** Get RX packet slab for this interface */
+	struct k_mem_slab *(*rx_slab)(void);
+
+	/** Get TX DATA net_buf pool for this interface */
+	struct net_buf_pool *(*tx_pool)(void);
+
+	/** Get RX DATA net_buf pool for this interface */
+	struct net_buf_pool *(*rx_pool)(void);
+#endif /* CONFIG_NET_IFACE_NET_PKT_POOL */
+
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
 	/** Keep track of packets pending in traffic queues. This is
 	 * needed to avoid putting network device driver to sleep if
@@ -522,6 +554,41 @@ struct net_if {
 #endif
 };
 
+/**
+ * @brief Assign dedicated packet slabs and data pools to an interface.
+ *
+ * By default all interfaces allocate packets from the global TX/RX
+ * slabs and data pools, so a fast interface can starve a slow one
+ * under load. This ties interface specific pools, defined with
+ * NET_PKT_SLAB_DEFINE() and NET_PKT_DATA_POOL_DEFINE(), to one
+ * interface so that its traffic no longer competes with the other
+ * interfaces for packet memory. Any getter may be NULL, in which case
+ * the corresponding global slab or pool is used for this interface.
+ *
+ * @param iface Pointer to network interface
+ * @param tx_slab Function returning the TX packet slab, or NULL
+ * @param rx_slab Function returning the RX packet slab, or NULL
+ * @param tx_pool Function returning the TX DATA pool, or NULL
+ * @param rx_pool Function returning the RX DATA pool, or NULL
+ */
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+static inline void net_if_setup_pools(struct net_if *iface,
+				      struct k_mem_slab *(*tx_slab)(void),
+				      struct k_mem_slab *(*rx_slab)(void),
+				      struct net_buf_pool *(*tx_pool)(void),
+				      struct net_buf_pool *(*rx_pool)(void))
+{
+	NET_ASSERT(iface);
+
+	iface->tx_slab = tx_slab;
+	iface->rx_slab = rx_slab;
+	iface->tx_pool = tx_pool;
+	iface->rx_pool = rx_pool;
+}
+#else
+#define net_if_setup_pools(iface, tx_slab, rx_slab, tx_pool, rx_pool)
+#endif /* CONFIG_NET_IFACE_NET_PKT_POOL */
+
 /**
  * @brief Set a value in network interface flags
  *
@@ -2077,16 +2144,34 @@ void net_if_unregister_link_cb(struct net_if_link_cb *link);
 void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 			 int status);
 
+/** @brief Protocol checksum types, distinguishing the individual checksums
+ * a device may be able to offload.
+ */
+enum net_if_checksum_type {
+	/** IPv4 header checksum */
+	NET_IF_CHECKSUM_IPV4_HEADER,
+	/** ICMPv4 checksum */
+	NET_IF_CHECKSUM_IPV4_ICMP,
+	/** ICMPv6 checksum */
+	NET_IF_CHECKSUM_IPV6_ICMP,
+	/** TCP checksum */
+	NET_IF_CHECKSUM_TCP,
+	/** UDP checksum */
+	NET_IF_CHECKSUM_UDP,
+};
+
 /**
  * @brief Check if received network packet checksum calculation can be avoided
  * or not. For example many ethernet devices support network packet offloading
  * in which case the IP stack does not need to calculate the checksum.
  *
  * @param iface Network interface
+ * @param chksum_type Protocol whose checksum would be verified
  *
  * @return True if checksum needs to be calculated, false otherwise.
  */
-bool net_if_need_calc_rx_checksum(struct net_if *iface);
+bool net_if_need_calc_rx_checksum(struct net_if *iface,
+				  enum net_if_checksum_type chksum_type);
 
 /**
  * @brief Check if network packet checksum calculation can be avoided or not
@@ -2095,10 +2180,12 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface);
  * checksum.
  *
  * @param iface Network interface
+ * @param chksum_type Protocol whose checksum would be calculated
  *
  * @return True if checksum needs to be calculated, false otherwise.
  */
-bool net_if_need_calc_tx_checksum(struct net_if *iface);
+bool net_if_need_calc_tx_checksum(struct net_if *iface,
+				  enum net_if_checksum_type chksum_type);
 
 /**
  * @brief Get interface according to index
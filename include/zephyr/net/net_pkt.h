@@ -193,6 +193,17 @@ struct net_pkt {
 
 	/* bitfield byte alignment boundary */
 
+	uint8_t ip_chksum_offloaded : 1; /* For outgoing packet: the IP
+					  * header checksum is left for
+					  * the device to compute.
+					  * For incoming packet: the IP
+					  * header checksum has already
+					  * been verified by the device.
+					  */
+	uint8_t l4_chksum_offloaded : 1; /* As above, but for the upper
+					  * layer (TCP/UDP/ICMP) checksum.
+					  */
+
 #if defined(CONFIG_NET_IP)
 	union {
 		/* IPv6 hop limit or IPv4 ttl for this network packet.
@@ -392,6 +403,28 @@ static inline void net_pkt_set_l2_processed(struct net_pkt *pkt,
 	pkt->l2_processed = is_l2_processed;
 }
 
+static inline bool net_pkt_is_ip_chksum_offloaded(struct net_pkt *pkt)
+{
+	return !!(pkt->ip_chksum_offloaded);
+}
+
+static inline void net_pkt_set_ip_chksum_offloaded(struct net_pkt *pkt,
+						   bool is_offloaded)
+{
+	pkt->ip_chksum_offloaded = is_offloaded;
+}
+
+static inline bool net_pkt_is_l4_chksum_offloaded(struct net_pkt *pkt)
+{
+	return !!(pkt->l4_chksum_offloaded);
+}
+
+static inline void net_pkt_set_l4_chksum_offloaded(struct net_pkt *pkt,
+						   bool is_offloaded)
+{
+	pkt->l4_chksum_offloaded = is_offloaded;
+}
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
@@ -1280,7 +1313,8 @@ static inline bool net_pkt_filter_recv_ok(struct net_pkt *pkt)
  * (:c:macro:`NET_PKT_DATA_POOL_DEFINE`) used to store the actual
  * packet data. The macro can be used by an application to define
  * additional custom per-context TX packet slabs (see
- * :c:func:`net_context_setup_pools`).
+ * :c:func:`net_context_setup_pools`) or per-interface packet slabs
+ * (see :c:func:`net_if_setup_pools`).
  *
  * @param name Name of the slab.
  * @param count Number of net_pkt in this slab.
@@ -1299,7 +1333,8 @@ static inline bool net_pkt_filter_recv_ok(struct net_pkt *pkt)
  * (:c:macro:`NET_PKT_SLAB_DEFINE`) used to store the packet
  * meta-information. The macro can be used by an application to
  * define additional custom per-context TX packet pools (see
- * :c:func:`net_context_setup_pools`).
+ * :c:func:`net_context_setup_pools`) or per-interface data pools
+ * (see :c:func:`net_if_setup_pools`).
  *
  * @param name Name of the pool.
  * @param count Number of net_buf in this pool.
@@ -63,6 +63,11 @@ struct zsock_pollfd {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_sendmsg: transmit directly from the application buffer instead of
+ *  copying it, pinning the buffer until the stack releases it (see
+ *  CONFIG_NET_CONTEXT_TX_ZEROCOPY)
+ */
+#define ZSOCK_MSG_ZEROCOPY 0x4000000
 
 /* Well-known values, e.g. from Linux man 2 shutdown:
  * "The constants SHUT_RD, SHUT_WR, SHUT_RDWR have the value 0, 1, 2,
@@ -163,6 +168,16 @@ struct zsock_pollfd {
  *  This option accepts any value.
  */
 #define TLS_SESSION_CACHE_PURGE 13
+/** Socket option to coalesce small writes on a TLS socket. While the
+ *  option is enabled, consecutive sends are packed into a buffer of
+ *  CONFIG_NET_SOCKETS_TLS_CORK_BUFFER_SIZE bytes and encrypted as one
+ *  TLS record once the buffer fills up or the option is disabled,
+ *  instead of producing one record (and its padding, MAC and header
+ *  overhead) per write. Only valid for stream sockets. Accepted values:
+ *  - 0 - Disabled (flushes any pending data).
+ *  - 1 - Enabled.
+ */
+#define TLS_SEND_CORK 14
 
 /** @} */
 
@@ -467,6 +482,99 @@ __syscall int zsock_fcntl(int sock, int cmd, int flags);
  */
 __syscall int zsock_poll(struct zsock_pollfd *fds, int nfds, int timeout);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL) || defined(__DOXYGEN__)
+
+/** zsock_epoll_ctl() operation: register a socket */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl() operation: unregister a socket */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** zsock_epoll_ctl() operation: change the registration of a socket */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** epoll event: there is data to read */
+#define ZSOCK_EPOLLIN ZSOCK_POLLIN
+/** epoll event: writing is now possible */
+#define ZSOCK_EPOLLOUT ZSOCK_POLLOUT
+/** epoll event: error condition, reported regardless of requested events */
+#define ZSOCK_EPOLLERR ZSOCK_POLLERR
+/** epoll event: peer closed, reported regardless of requested events */
+#define ZSOCK_EPOLLHUP ZSOCK_POLLHUP
+
+/** User data attached to a registered socket, returned verbatim with
+ * each reported event.
+ */
+union zsock_epoll_data {
+	/** Arbitrary pointer */
+	void *ptr;
+	/** File descriptor */
+	int fd;
+	/** 32-bit integer */
+	uint32_t u32;
+};
+
+/** Event reported by zsock_epoll_wait() */
+struct zsock_epoll_event {
+	/** Requested events (zsock_epoll_ctl) or reported events
+	 * (zsock_epoll_wait), a combination of ZSOCK_EPOLL* flags
+	 */
+	uint32_t events;
+	/** User data given when the socket was registered */
+	union zsock_epoll_data data;
+};
+
+/**
+ * @brief Create an epoll instance
+ *
+ * Unlike zsock_poll(), which registers every socket with the kernel
+ * poll mechanism again on each call, an epoll instance keeps the
+ * registrations between calls so that waiting cost does not grow with
+ * the number of idle sockets. This matches the Linux epoll API,
+ * with the following restrictions: all events are level-triggered,
+ * offloaded sockets are not supported, and a socket must be removed
+ * from the instance before it is closed.
+ *
+ * @param size Must be greater than zero, otherwise ignored (as on Linux)
+ *
+ * @return File descriptor for the instance, or -1 with errno set.
+ *         The descriptor is released with close().
+ */
+int zsock_epoll_create(int size);
+
+/**
+ * @brief Register, unregister or modify a socket in an epoll instance
+ *
+ * @param epfd Epoll instance file descriptor
+ * @param op One of ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_DEL or
+ *           ZSOCK_EPOLL_CTL_MOD
+ * @param fd Socket to operate on
+ * @param event Requested events and user data, ignored for
+ *              ZSOCK_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, or -1 with errno set.
+ */
+int zsock_epoll_ctl(int epfd, int op, int fd, struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on the registered sockets
+ *
+ * An epoll instance is meant to be driven from a single event loop
+ * thread: zsock_epoll_ctl() blocks while another thread is waiting on
+ * the same instance.
+ *
+ * @param epfd Epoll instance file descriptor
+ * @param events Output array for the reported events
+ * @param maxevents Capacity of the output array, must be greater
+ *                  than zero
+ * @param timeout Timeout in milliseconds, -1 to wait indefinitely
+ *
+ * @return Number of reported events, 0 on timeout, or -1 with errno
+ *         set.
+ */
+int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+		     int maxevents, int timeout);
+
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
 /**
  * @brief Get various socket options
  *
@@ -619,6 +727,92 @@ int zsock_getaddrinfo(const char *host, const char *service,
 		      const struct zsock_addrinfo *hints,
 		      struct zsock_addrinfo **res);
 
+#if defined(CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC) || defined(__DOXYGEN__)
+
+struct zsock_addrinfo_async;
+
+/** @cond INTERNAL_HIDDEN */
+struct zsock_addrinfo_async_query {
+	struct zsock_addrinfo_async *req;
+	uint16_t dns_id;
+	int16_t status;
+};
+/** @endcond */
+
+/**
+ * @brief Asynchronous name resolution request
+ *
+ * All fields except @c fd are internal to the resolver.
+ */
+struct zsock_addrinfo_async {
+	/** Pollable file descriptor. @c ZSOCK_POLLIN is reported on it when
+	 * the resolution has completed and the results can be collected
+	 * with zsock_getaddrinfo_async_finish().
+	 */
+	int fd;
+
+/** @cond INTERNAL_HIDDEN */
+	const struct zsock_addrinfo *hints;
+	struct zsock_addrinfo *ai_arr;
+	struct zsock_addrinfo_async_query queries[2];
+	struct k_spinlock lock;
+	atomic_t pending;
+	uint16_t port;
+	uint16_t idx;
+/** @endcond */
+};
+
+/**
+ * @brief Start resolving a domain name without blocking
+ *
+ * Behaves like zsock_getaddrinfo() but returns as soon as the queries are
+ * sent. IPv4 and IPv6 queries are sent in parallel and multiple requests
+ * can be in flight at the same time, each with its own request object.
+ * Completion is signalled by @c ZSOCK_POLLIN on the eventfd in @c req->fd,
+ * after which zsock_getaddrinfo_async_finish() must be called to collect
+ * the results (or zsock_getaddrinfo_async_cancel() to abandon them).
+ *
+ * The @p host string must stay valid until the request is finished or
+ * canceled. This function is not available from user mode threads.
+ *
+ * @param host Host name to resolve.
+ * @param service Service (port number) string.
+ * @param hints Hints for the resolution, may be NULL.
+ * @param req Request object, valid until finished or canceled.
+ *
+ * @return 0 when the request was started, DNS_EAI_* error otherwise.
+ */
+int zsock_getaddrinfo_async(const char *host, const char *service,
+			    const struct zsock_addrinfo *hints,
+			    struct zsock_addrinfo_async *req);
+
+/**
+ * @brief Collect results of an asynchronous resolution request
+ *
+ * Must be called once after the request eventfd signalled completion.
+ * Closes the eventfd. Results returned in @p res are freed with
+ * zsock_freeaddrinfo().
+ *
+ * @param req Request previously started with zsock_getaddrinfo_async().
+ * @param res Destination for the resolved address list.
+ *
+ * @return 0 on success, DNS_EAI_* error otherwise.
+ */
+int zsock_getaddrinfo_async_finish(struct zsock_addrinfo_async *req,
+				   struct zsock_addrinfo **res);
+
+/**
+ * @brief Cancel an asynchronous resolution request
+ *
+ * Cancels any pending queries, closes the request eventfd and releases
+ * the resources of the request.
+ *
+ * @param req Request previously started with zsock_getaddrinfo_async().
+ */
+void zsock_getaddrinfo_async_cancel(struct zsock_addrinfo_async *req);
+
+#endif /* CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC */
+
 /**
  * @brief Free results returned by zsock_getaddrinfo()
  *
@@ -880,6 +1074,49 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 /** POSIX wrapper for @ref ZSOCK_POLLNVAL */
 #define POLLNVAL ZSOCK_POLLNVAL
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+/** POSIX wrapper for @ref ZSOCK_EPOLL_CTL_ADD */
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+/** POSIX wrapper for @ref ZSOCK_EPOLL_CTL_DEL */
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+/** POSIX wrapper for @ref ZSOCK_EPOLL_CTL_MOD */
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+
+/** POSIX wrapper for @ref ZSOCK_EPOLLIN */
+#define EPOLLIN ZSOCK_EPOLLIN
+/** POSIX wrapper for @ref ZSOCK_EPOLLOUT */
+#define EPOLLOUT ZSOCK_EPOLLOUT
+/** POSIX wrapper for @ref ZSOCK_EPOLLERR */
+#define EPOLLERR ZSOCK_EPOLLERR
+/** POSIX wrapper for @ref ZSOCK_EPOLLHUP */
+#define EPOLLHUP ZSOCK_EPOLLHUP
+
+/** POSIX wrapper for @ref zsock_epoll_data */
+#define epoll_data zsock_epoll_data
+/** POSIX wrapper for @ref zsock_epoll_event */
+#define epoll_event zsock_epoll_event
+
+/** POSIX wrapper for @ref zsock_epoll_create */
+static inline int epoll_create(int size)
+{
+	return zsock_epoll_create(size);
+}
+
+/** POSIX wrapper for @ref zsock_epoll_ctl */
+static inline int epoll_ctl(int epfd, int op, int fd,
+			    struct zsock_epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+/** POSIX wrapper for @ref zsock_epoll_wait */
+static inline int epoll_wait(int epfd, struct zsock_epoll_event *events,
+			     int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
 /** POSIX wrapper for @ref ZSOCK_MSG_PEEK */
 #define MSG_PEEK ZSOCK_MSG_PEEK
 /** POSIX wrapper for @ref ZSOCK_MSG_TRUNC */
@@ -888,6 +1125,8 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 /** POSIX wrapper for @ref ZSOCK_MSG_WAITALL */
 #define MSG_WAITALL ZSOCK_MSG_WAITALL
+/** POSIX wrapper for @ref ZSOCK_MSG_ZEROCOPY */
+#define MSG_ZEROCOPY ZSOCK_MSG_ZEROCOPY
 
 /** POSIX wrapper for @ref ZSOCK_SHUT_RD */
 #define SHUT_RD ZSOCK_SHUT_RD
@@ -977,6 +1216,14 @@ struct ifreq {
 /** sockopt: Domain used with SOCKET (ignored, for compatibility) */
 #define SO_DOMAIN 39
 
+/**
+ * sockopt: Busy poll the receive queue (in microseconds)
+ * Blocking receive calls spin on the socket receive queue for at most
+ * this long before going to sleep, trading CPU time for the scheduler
+ * wakeup latency when data arrives back-to-back.
+ */
+#define SO_BUSY_POLL 46
+
 /** End Socket options for SOL_SOCKET level */
 
 /* Socket options for IPPROTO_TCP level */
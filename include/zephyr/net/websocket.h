@@ -133,7 +133,10 @@ int websocket_connect(int http_sock, struct websocket_request *req,
  * message.
  *
  * @param ws_sock Websocket id returned by websocket_connect().
- * @param payload Websocket data to send.
+ * @param payload Websocket data to send. If the data is masked and
+ *        CONFIG_WEBSOCKET_SEND_MASK_IN_PLACE is enabled, then the buffer
+ *        must be writable as the mask is applied in place. The buffer is
+ *        restored to its original content before the call returns.
  * @param payload_len Length of the data to be sent.
  * @param opcode Operation code (text, binary, ping, pong, close)
  * @param mask Mask the data, see RFC 6455 for details
@@ -36,6 +36,10 @@ struct zperf_upload_params {
 	uint16_t packet_size;
 	struct {
 		uint8_t tos;
+		/** Number of parallel streams to run, 0 or 1 runs a single
+		 * stream. Limited by CONFIG_NET_ZPERF_MAX_STREAMS.
+		 */
+		uint8_t num_streams;
 	} options;
 };
 
@@ -54,6 +58,13 @@ struct zperf_results {
 	uint32_t client_time_in_us;
 	uint32_t packet_size;
 	uint32_t nb_packets_errors;
+	/** Latency percentiles of the received packets, relative to the
+	 * fastest packet of the session. Only filled for received sessions
+	 * when CONFIG_NET_ZPERF_LATENCY_HISTOGRAM is enabled, zero otherwise.
+	 */
+	uint32_t latency_p50_us;
+	uint32_t latency_p99_us;
+	uint32_t latency_p999_us;
 };
 
 /**
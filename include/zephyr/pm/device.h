@@ -130,6 +130,8 @@ struct pm_device {
 	uint32_t usage;
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+	/** Delay in milliseconds before an unused device is suspended */
+	uint32_t autosuspend_delay;
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 	/** Power Domain it belongs */
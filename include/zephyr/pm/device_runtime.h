@@ -129,6 +129,38 @@ int pm_device_runtime_put(const struct device *dev);
  */
 int pm_device_runtime_put_async(const struct device *dev);
 
+/**
+ * @brief Set the autosuspend delay of a device.
+ *
+ * When a non-zero delay is configured, the device is no longer suspended as
+ * soon as its usage count reaches zero. Instead, the suspend operation is
+ * scheduled to happen @p delay_ms milliseconds later, and a call to
+ * pm_device_runtime_get() in the meantime cancels it without paying the
+ * suspend/resume cost. This benefits devices with an expensive resume
+ * operation that are accessed in bursts, at the cost of staying powered during
+ * the delay period.
+ *
+ * Note that with a non-zero delay pm_device_runtime_put() no longer suspends
+ * the device synchronously: as with pm_device_runtime_put_async(), the suspend
+ * is performed from the work queue.
+ *
+ * The new delay applies the next time the device becomes unused. Setting the
+ * delay to zero restores the default behavior of suspending the device
+ * immediately.
+ *
+ * @funcprops \pre_kernel_ok
+ *
+ * @param dev Device instance.
+ * @param delay_ms Delay in milliseconds before an unused device is suspended.
+ *
+ * @retval 0 If the delay has been set successfully.
+ * @retval -ENOTSUP If the device does not support PM.
+ *
+ * @see pm_device_runtime_put()
+ */
+int pm_device_runtime_autosuspend_delay_set(const struct device *dev,
+					    uint32_t delay_ms);
+
 /**
  * @brief Check if device runtime is enabled for a given device.
  *
@@ -175,6 +207,14 @@ static inline int pm_device_runtime_put_async(const struct device *dev)
 	return 0;
 }
 
+static inline int pm_device_runtime_autosuspend_delay_set(
+	const struct device *dev, uint32_t delay_ms)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(delay_ms);
+	return 0;
+}
+
 static inline bool pm_device_runtime_is_enabled(const struct device *dev)
 {
 	ARG_UNUSED(dev);
@@ -200,6 +200,29 @@ static inline void pm_policy_latency_request_remove(
 }
 #endif /* CONFIG_PM */
 
+#if defined(CONFIG_PM_POLICY_RESIDENCY_PREDICTOR) || defined(__DOXYGEN__)
+/**
+ * @brief Record the observed residency of the last sleep period.
+ *
+ * The default policy keeps an exponentially weighted moving average of the
+ * observed residencies and uses it, in addition to the next scheduled timeout,
+ * to suppress power states whose minimum residency is unlikely to be met.
+ *
+ * This function is called by the power subsystem on wakeup, it is not meant
+ * to be used by applications.
+ *
+ * @param cpu CPU index.
+ * @param ticks Number of ticks the CPU actually stayed in the power state.
+ */
+void pm_policy_residency_record(uint8_t cpu, uint32_t ticks);
+#else
+static inline void pm_policy_residency_record(uint8_t cpu, uint32_t ticks)
+{
+	ARG_UNUSED(cpu);
+	ARG_UNUSED(ticks);
+}
+#endif /* CONFIG_PM_POLICY_RESIDENCY_PREDICTOR */
+
 /**
  * @}
  */
@@ -99,6 +99,28 @@ struct rtio_iodev;
  */
 #define RTIO_SQE_CHAINED BIT(0)
 
+/**
+ * @brief The request is resubmitted to its iodev on each completion
+ * until cancelled, producing one completion queue event per completion.
+ *
+ * Must not be combined with RTIO_SQE_CHAINED. A multishot submission
+ * occupies its spot in the submission queue until it is cancelled with
+ * rtio_sqe_cancel() and its final completion is produced, which also
+ * delays the release of any submissions queued after it.
+ *
+ * Honored by the concurrent executor; the simple executor completes
+ * such submissions once.
+ */
+#define RTIO_SQE_MULTISHOT BIT(1)
+
+/**
+ * @brief The request is cancelled
+ *
+ * Set by rtio_sqe_cancel() to stop a multishot submission from being
+ * re-armed.
+ */
+#define RTIO_SQE_CANCELED BIT(2)
+
 /**
  * @}
  */
@@ -271,6 +293,17 @@ struct rtio_iodev_api {
 	void (*submit)(const struct rtio_sqe *sqe,
 		       struct rtio *r);
 
+	/**
+	 * @brief Optional operation to advance in-flight requests by polling
+	 *
+	 * When provided, the iodev can run without interrupts: each call
+	 * checks the hardware status, e.g. a DMA transfer status register,
+	 * and reports any finished request with `rtio_sqe_ok` or
+	 * `rtio_sqe_err`. Called from busy-wait loops such as
+	 * rtio_cqe_poll(), so it must not block.
+	 */
+	void (*poll)(const struct rtio_iodev *iodev);
+
 	/**
 	 * TODO some form of transactional piece is missing here
 	 * where we wish to "transact" on an iodev with multiple requests
@@ -459,6 +492,21 @@ static inline void rtio_iodev_submit(const struct rtio_sqe *sqe, struct rtio *r)
 	sqe->iodev->api->submit(sqe, r);
 }
 
+/**
+ * @brief Cancel a multishot submission
+ *
+ * Marks the submission so the executor stops re-arming it. The executor
+ * produces the completion queue event for the completion that is in
+ * flight when the cancellation is observed and then releases the
+ * submission.
+ *
+ * @param sqe Multishot submission to cancel
+ */
+static inline void rtio_sqe_cancel(struct rtio_sqe *sqe)
+{
+	sqe->flags |= RTIO_SQE_CANCELED;
+}
+
 /**
  * @brief Count of acquirable submission queue events
  *
@@ -555,6 +603,67 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 	return cqe;
 }
 
+/**
+ * @brief Drive all polled iodevs
+ *
+ * Calls the poll operation of every registered iodev that provides one,
+ * giving doorbell-less hardware a chance to report finished requests.
+ */
+static inline void rtio_iodev_poll_all(void)
+{
+	STRUCT_SECTION_FOREACH(rtio_iodev, iodev) {
+		if (iodev->api->poll != NULL) {
+			iodev->api->poll(iodev);
+		}
+	}
+}
+
+/**
+ * @brief Busy-poll for and consume a single completion queue event
+ *
+ * Spins on the completion queue, driving polled iodevs between checks,
+ * without any interrupt or scheduler involvement. Intended for latency
+ * critical paths on a core dedicated to I/O, where the ISR and context
+ * switch costs of the blocking consume are unwanted.
+ *
+ * With RTIO_POLL_BACKOFF enabled the spin progressively backs off with
+ * busy waits of exponentially increasing length while the queue stays
+ * empty; the backoff restarts on every call.
+ *
+ * If a completion queue event is returned rtio_cq_release(r) must be
+ * called at some point to release the cqe spot for the cqe producer.
+ *
+ * @param r RTIO context
+ *
+ * @retval cqe A valid completion queue event consumed from the completion queue
+ */
+static inline struct rtio_cqe *rtio_cqe_poll(struct rtio *r)
+{
+	struct rtio_cqe *cqe;
+#ifdef CONFIG_RTIO_POLL_BACKOFF
+	uint32_t backoff_us = 0;
+#endif
+
+	for (;;) {
+		rtio_iodev_poll_all();
+
+		cqe = rtio_spsc_consume(r->cq);
+		if (cqe != NULL) {
+			return cqe;
+		}
+
+#ifdef CONFIG_RTIO_POLL_BACKOFF
+		if (backoff_us > 0) {
+			k_busy_wait(backoff_us);
+			backoff_us = MIN(backoff_us * 2,
+					 (uint32_t)CONFIG_RTIO_POLL_BACKOFF_MAX_US);
+		} else {
+			backoff_us = 1;
+		}
+#endif
+	}
+}
+
 /**
  * @brief Release all consumed completion queue events
  *
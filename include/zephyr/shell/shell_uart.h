@@ -25,12 +25,16 @@ struct shell_uart_ctrl_blk {
 	void *context;
 	atomic_t tx_busy;
 	bool blocking_tx;
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+	uint8_t rx_buf_idx;
+#endif
 #ifdef CONFIG_MCUMGR_TRANSPORT_SHELL
 	struct smp_shell_data smp;
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 };
 
-#ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
+#if defined(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) || \
+	defined(CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API)
 #define Z_UART_SHELL_TX_RINGBUF_DECLARE(_name, _size) \
 	RING_BUF_DECLARE(_name##_tx_ringbuf, _size)
 
@@ -39,12 +43,24 @@ struct shell_uart_ctrl_blk {
 
 #define Z_UART_SHELL_RX_TIMER_PTR(_name) NULL
 
-#else /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
+#else
 #define Z_UART_SHELL_TX_RINGBUF_DECLARE(_name, _size) /* Empty */
 #define Z_UART_SHELL_RX_TIMER_DECLARE(_name) static struct k_timer _name##_timer
 #define Z_UART_SHELL_TX_RINGBUF_PTR(_name) NULL
 #define Z_UART_SHELL_RX_TIMER_PTR(_name) (&_name##_timer)
-#endif /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
+#endif
+
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+/* Two receive buffers rotated through the asynchronous API. */
+#define Z_UART_SHELL_ASYNC_RX_BUFS_DECLARE(_name) \
+	static uint8_t _name##_rx_bufs[2] \
+		[CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE]
+#define Z_UART_SHELL_ASYNC_RX_BUFS_INIT(_name) \
+	.rx_bufs = { &_name##_rx_bufs[0][0], &_name##_rx_bufs[1][0] },
+#else
+#define Z_UART_SHELL_ASYNC_RX_BUFS_DECLARE(_name) /* Empty */
+#define Z_UART_SHELL_ASYNC_RX_BUFS_INIT(_name) /* Empty */
+#endif
 
 /** @brief Shell UART transport instance structure. */
 struct shell_uart {
@@ -52,6 +68,9 @@ struct shell_uart {
 	struct k_timer *timer;
 	struct ring_buf *tx_ringbuf;
 	struct ring_buf *rx_ringbuf;
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+	uint8_t *rx_bufs[2];
+#endif
 };
 
 /** @brief Macro for creating shell UART transport instance. */
@@ -59,12 +78,14 @@ struct shell_uart {
 	static struct shell_uart_ctrl_blk _name##_ctrl_blk;		\
 	Z_UART_SHELL_RX_TIMER_DECLARE(_name);				\
 	Z_UART_SHELL_TX_RINGBUF_DECLARE(_name, _tx_ringbuf_size);	\
+	Z_UART_SHELL_ASYNC_RX_BUFS_DECLARE(_name);			\
 	RING_BUF_DECLARE(_name##_rx_ringbuf, _rx_ringbuf_size);		\
 	static const struct shell_uart _name##_shell_uart = {		\
 		.ctrl_blk = &_name##_ctrl_blk,				\
 		.timer = Z_UART_SHELL_RX_TIMER_PTR(_name),		\
 		.tx_ringbuf = Z_UART_SHELL_TX_RINGBUF_PTR(_name),	\
 		.rx_ringbuf = &_name##_rx_ringbuf,			\
+		Z_UART_SHELL_ASYNC_RX_BUFS_INIT(_name)			\
 	};								\
 	struct shell_transport _name = {				\
 		.api = &shell_uart_transport_api,			\
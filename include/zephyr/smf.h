@@ -26,6 +26,34 @@
 	.parent = _parent \
 }
 
+#ifdef CONFIG_SMF_STATE_CHAINS
+/**
+ * @brief Macro to create a hierarchical state with a precomputed
+ *        ancestor chain.
+ *
+ * The variable arguments list the states on the path from the topmost
+ * ancestor down to and including the state being defined. Transitions
+ * involving such states walk this const table instead of searching the
+ * parent pointers for common ancestors.
+ *
+ * @param _entry  State entry function
+ * @param _run    State run function
+ * @param _exit   State exit function
+ * @param _parent State parent object or NULL
+ * @param ...     Chain of state objects, topmost ancestor first and the
+ *                state itself last
+ */
+#define SMF_CREATE_STATE_CHAINED(_entry, _run, _exit, _parent, ...) \
+{ \
+	.entry  = _entry, \
+	.run    = _run,   \
+	.exit   = _exit,  \
+	.parent = _parent, \
+	.chain  = (const struct smf_state *const []){__VA_ARGS__}, \
+	.depth  = NUM_VA_ARGS_LESS_1(__VA_ARGS__) + 1 \
+}
+#endif /* CONFIG_SMF_STATE_CHAINS */
+
 #else
 
 /**
@@ -87,6 +115,16 @@ struct smf_state {
 	 *	that parent's exit and entry functions do not execute.
 	 */
 	const struct smf_state *parent;
+
+#ifdef CONFIG_SMF_STATE_CHAINS
+	/**
+	 * Optional ancestor chain from the topmost ancestor down to and
+	 * including this state, see SMF_CREATE_STATE_CHAINED.
+	 */
+	const struct smf_state *const *chain;
+	/** Number of states in the chain, including this state */
+	uint8_t depth;
+#endif
 };
 
 /** Defines the current context of the state machine. */
@@ -92,6 +92,64 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+/* Contention profiling hooks, see subsys/debug/spinlock_profile.c.
+ * Both are called with interrupts masked on the current CPU; the
+ * unlock hook is called while the lock is still held.
+ */
+void z_spin_lock_profile(struct k_spinlock *l, uint32_t spin_cycles);
+void z_spin_unlock_profile(struct k_spinlock *l);
+
+/**
+ * @brief Snapshot of profiling data for one lock on one CPU
+ *
+ * Cycle counts are in sys_clock_cycle_get_32() units.
+ */
+struct k_spin_lock_profile_stats {
+	/** Address of the profiled lock */
+	struct k_spinlock *lock;
+	/** Number of times the lock was taken on this CPU */
+	uint64_t acquisitions;
+	/** Total cycles spent waiting for the lock on this CPU */
+	uint64_t spin_cycles;
+	/** Longest single hold of the lock by this CPU, in cycles */
+	uint32_t max_hold_cycles;
+};
+
+/**
+ * @brief Callback for k_spin_lock_profile_foreach()
+ *
+ * @param cpu CPU the statistics were collected on
+ * @param stats Statistics for one lock on that CPU
+ * @param user_data Pointer passed to k_spin_lock_profile_foreach()
+ */
+typedef void (*k_spin_lock_profile_cb_t)(
+	int cpu, const struct k_spin_lock_profile_stats *stats,
+	void *user_data);
+
+/**
+ * @brief Iterate over collected spinlock contention statistics
+ *
+ * Invokes @a cb once per (CPU, lock) pair that has recorded at least
+ * one acquisition.  Collection continues while iterating, so the
+ * reported numbers are a best-effort snapshot.
+ *
+ * @param cb Callback invoked for each entry
+ * @param user_data Opaque pointer passed to the callback
+ */
+void k_spin_lock_profile_foreach(k_spin_lock_profile_cb_t cb,
+				 void *user_data);
+
+/**
+ * @brief Reset collected spinlock contention statistics
+ *
+ * Zeroes the counters on all CPUs.  Resetting concurrently with
+ * collection may lose individual samples, which is harmless for
+ * profiling purposes.
+ */
+void k_spin_lock_profile_reset(void);
+#endif /* CONFIG_SPIN_LOCK_PROFILE */
+
 /**
  * @brief Spinlock key type
  *
@@ -151,11 +209,19 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 # endif
 #endif
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	uint32_t profile_start = sys_clock_cycle_get_32();
+#endif
+
 #ifdef CONFIG_SMP
 	while (!atomic_cas(&l->locked, 0, 1)) {
 	}
 #endif
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	z_spin_lock_profile(l, sys_clock_cycle_get_32() - profile_start);
+#endif
+
 #ifdef CONFIG_SPIN_VALIDATE
 	z_spin_lock_set_owner(l);
 #if defined(CONFIG_SPIN_LOCK_TIME_LIMIT) && (CONFIG_SPIN_LOCK_TIME_LIMIT != 0)
@@ -202,6 +268,10 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	z_spin_unlock_profile(l);
+#endif
+
 #ifdef CONFIG_SMP
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -224,6 +294,9 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	z_spin_unlock_profile(l);
+#endif
 #ifdef CONFIG_SMP
 	atomic_clear(&l->locked);
 #endif
@@ -54,6 +54,10 @@
 #include <stddef.h>
 #include <zephyr/types.h>
 
+#ifdef CONFIG_STATS_PER_CPU
+#include <zephyr/kernel.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -86,13 +90,45 @@ struct stats_hdr {
 /**
  * @brief Ends a stats group struct definition.
  */
+#if defined(CONFIG_STATS) && defined(CONFIG_STATS_PER_CPU)
+/* The entry block is repeated once per CPU.  Copy [0] immediately
+ * follows the header, so entry offsets match the single copy layout.
+ */
+#define STATS_SECT_END } s_cpu[CONFIG_MP_NUM_CPUS]; }
+#else
 #define STATS_SECT_END }
+#endif
 
 /* The following macros depend on whether CONFIG_STATS is defined.  If it is
  * not defined, then invocations of these macros get compiled out.
  */
 #ifdef CONFIG_STATS
 
+#ifdef CONFIG_STATS_PER_CPU
+
+/* Index of the entry copy updated by the local CPU.  Reading the CPU id
+ * without locking is fine for statistics: if the thread migrates in the
+ * middle of an update the increment lands on the wrong copy or, worst
+ * case, is lost, which aggregated totals can tolerate.
+ */
+#if defined(CONFIG_SMP)
+#define Z_STATS_CPU_IDX() (arch_curr_cpu()->id)
+#else
+#define Z_STATS_CPU_IDX() 0
+#endif
+
+/**
+ * @brief Begins a stats group struct definition.
+ *
+ * @param group__               The stats group struct name.
+ */
+#define STATS_SECT_START(group__)  \
+	STATS_SECT_DECL(group__) { \
+		struct stats_hdr s_hdr; \
+		struct {
+
+#else /* CONFIG_STATS_PER_CPU */
+
 /**
  * @brief Begins a stats group struct definition.
  *
@@ -102,6 +138,8 @@ struct stats_hdr {
 	STATS_SECT_DECL(group__) { \
 		struct stats_hdr s_hdr;
 
+#endif /* !CONFIG_STATS_PER_CPU */
+
 /**
  * @brief Declares a 32-bit stat entry inside a group struct.
  *
@@ -140,8 +178,13 @@ struct stats_hdr {
  * @param var__                 The statistic entry to increase.
  * @param n__                   The amount to increase the statistic entry by.
  */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_INCN(group__, var__, n__)	\
+	((group__).s_cpu[Z_STATS_CPU_IDX()].var__ += (n__))
+#else
 #define STATS_INCN(group__, var__, n__)	\
 	((group__).var__ += (n__))
+#endif
 
 /**
  * @brief Increments a statistic entry.
@@ -165,8 +208,17 @@ struct stats_hdr {
  * @param var__                 The statistic entry to increase.
  * @param n__                   The amount to set the statistic entry to.
  */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_SET(group__, var__, n__) do {				      \
+	for (unsigned int _s_i = 1; _s_i < CONFIG_MP_NUM_CPUS; _s_i++) {      \
+		(group__).s_cpu[_s_i].var__ = 0;			      \
+	}								      \
+	(group__).s_cpu[0].var__ = (n__);				      \
+} while (0)
+#else
 #define STATS_SET(group__, var__, n__)	\
 	((group__).var__ = (n__))
+#endif
 
 /**
  * @brief Sets a statistic entry to zero.
@@ -177,16 +229,36 @@ struct stats_hdr {
  * @param group__               The group containing the entry to clear.
  * @param var__                 The statistic entry to clear.
  */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_CLEAR(group__, var__) do {				      \
+	for (unsigned int _s_i = 0; _s_i < CONFIG_MP_NUM_CPUS; _s_i++) {      \
+		(group__).s_cpu[_s_i].var__ = 0;			      \
+	}								      \
+} while (0)
+#else
 #define STATS_CLEAR(group__, var__) \
 	((group__).var__ = 0)
+#endif
 
 #define STATS_SIZE_16 (sizeof(uint16_t))
 #define STATS_SIZE_32 (sizeof(uint32_t))
 #define STATS_SIZE_64 (sizeof(uint64_t))
 
+/* Number of logical entries in a group; the per-CPU copies of an entry
+ * count as one.
+ */
+#ifdef CONFIG_STATS_PER_CPU
+#define Z_STATS_SECT_CNT(group__, size__)			   \
+	(((sizeof(group__)) - sizeof(struct stats_hdr)) / (size__) \
+	 / CONFIG_MP_NUM_CPUS)
+#else
+#define Z_STATS_SECT_CNT(group__, size__) \
+	(((sizeof(group__)) - sizeof(struct stats_hdr)) / (size__))
+#endif
+
 #define STATS_SIZE_INIT_PARMS(group__, size__) \
 	(size__),			       \
-	((sizeof(group__)) - sizeof(struct stats_hdr)) / (size__)
+	Z_STATS_SECT_CNT(group__, size__)
 
 /**
  * @brief Initializes and registers a statistics group.
@@ -206,7 +278,7 @@ struct stats_hdr {
 	stats_init_and_reg(						 \
 		&(group__).s_hdr,					 \
 		(size__),						 \
-		(sizeof(group__) - sizeof(struct stats_hdr)) / (size__), \
+		Z_STATS_SECT_CNT(group__, size__),			 \
 		STATS_NAME_INIT_PARMS(group__),				 \
 		(name__))
 
@@ -279,6 +351,20 @@ int stats_init_and_reg(struct stats_hdr *hdr, uint8_t size, uint16_t cnt,
  */
 void stats_reset(struct stats_hdr *shdr);
 
+/**
+ * @brief Reads the value of a statistic entry.
+ *
+ * Reads the entry at the given offset, as reported to a stats_walk_fn.
+ * When STATS_PER_CPU is enabled this sums the per-CPU copies of the
+ * entry; otherwise it is a plain read.
+ *
+ * @param hdr                   The group containing the entry to read.
+ * @param off                   The offset of the entry, from `hdr`.
+ *
+ * @return                      The (aggregated) value of the entry.
+ */
+uint64_t stats_entry_get(const struct stats_hdr *hdr, uint16_t off);
+
 /** @typedef stats_walk_fn
  * @brief Function that gets applied to every stat entry during a walk.
  *
@@ -375,8 +461,13 @@ struct stats_hdr *stats_group_find(const char *name);
 #define STATS_NAME_START(sectname__) \
 	static const struct stats_name_map STATS_NAME_MAP_NAME(sectname__)[] = {
 
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_NAME(sectname__, entry__)	\
+	{ offsetof(STATS_SECT_DECL(sectname__), s_cpu[0].entry__), #entry__ },
+#else
 #define STATS_NAME(sectname__, entry__)	\
 	{ offsetof(STATS_SECT_DECL(sectname__), entry__), #entry__ },
+#endif
 
 #define STATS_NAME_END(sectname__) }
 
@@ -255,6 +255,26 @@ const struct device *flash_area_get_device(const struct flash_area *fa);
  */
 uint8_t flash_area_erased_val(const struct flash_area *fa);
 
+/**
+ * Get a pointer for reading flash area contents directly.
+ *
+ * When the backing flash is memory mapped, returns a pointer through
+ * which the given range can be read without copying it into RAM. The
+ * range stays readable for the lifetime of the flash area; no unmap
+ * call is needed. Callers must fall back to flash_area_read() when
+ * -ENOTSUP is returned.
+ *
+ * @param[in]  fa  Flash area
+ * @param[in]  off Offset relative from beginning of flash area
+ * @param[in]  len Number of bytes the pointer will be used to read
+ * @param[out] ptr Directly readable pointer to the range
+ *
+ * @return 0 on success, -EINVAL if the range is out of bounds,
+ * -ENOTSUP if the backing flash is not memory mapped.
+ */
+int flash_area_get_pointer(const struct flash_area *fa, off_t off, size_t len,
+			   const void **ptr);
+
 #define FLASH_AREA_LABEL_EXISTS(label) __DEPRECATED_MACRO \
 	DT_HAS_FIXED_PARTITION_LABEL(label)
 
@@ -22,6 +22,7 @@
  */
 
 #include <stdbool.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 
 #ifdef __cplusplus
@@ -63,6 +64,23 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	off_t erased_until; /* End of the contiguously erased region */
+	off_t erase_from; /* Write address the worker erases ahead of */
+	int erase_rc; /* Result of the last erase-ahead run */
+	bool erase_pending; /* Erase handed over but not yet joined */
+	struct k_work erase_work; /* Work item erasing ahead of writes */
+	struct k_sem erase_done; /* Signalled when erase-ahead completes */
+#endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *wr_buf; /* Buffer half handed over for writing */
+	size_t wr_bytes; /* Number of payload bytes in wr_buf */
+	size_t wr_addr; /* Flash address wr_buf is written to */
+	int wr_rc; /* Result of the last write */
+	bool wr_pending; /* Write handed over but not yet joined */
+	struct k_work wr_work; /* Work item performing the write */
+	struct k_sem wr_done; /* Signalled when the write completes */
+#endif
 };
 
 /**
@@ -72,7 +90,10 @@ struct stream_flash_ctx {
  * @param fdev Flash device to operate on
  * @param buf Write buffer
  * @param buf_len Length of write buffer. Can not be larger than the page size.
- *                Must be multiple of the flash device write-block-size.
+ *                Must be multiple of the flash device write-block-size. When
+ *                @kconfig{CONFIG_STREAM_FLASH_DOUBLE_BUFFER} is enabled the
+ *                buffer is split into two halves, each of which must also be
+ *                a multiple of the write-block-size.
  * @param offset Offset within flash device to start writing to
  * @param size Number of bytes available for performing buffered write.
  *             If this is '0', the size will be set to the total size
@@ -460,6 +460,19 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+#ifdef CONFIG_SCHED_DIRECTED_IPI_SUPPORTED
+/**
+ * Interrupt a specific set of CPUs
+ *
+ * This will invoke z_sched_ipi() on the CPUs whose bit is set in
+ * @a cpu_mask (bit n corresponds to CPU n). The current CPU is
+ * ignored if its bit happens to be set.
+ *
+ * @param cpu_mask Bitmask of CPUs to interrupt
+ */
+void arch_sched_directed_ipi(uint32_t cpu_mask);
+#endif /* CONFIG_SCHED_DIRECTED_IPI_SUPPORTED */
+
 #endif /* CONFIG_SMP */
 
 /**
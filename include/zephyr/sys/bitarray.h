@@ -26,6 +26,14 @@ struct sys_bitarray {
 	/* Bundle of bits */
 	uint32_t *bundles;
 
+	/* Summary bitmap with one bit per bundle, set when the
+	 * corresponding bundle is fully set.  Lets the allocator skip
+	 * over fully allocated bundles a word at a time.  May be NULL
+	 * for manually constructed bit arrays, in which case bundles
+	 * are scanned directly.
+	 */
+	uint32_t *summary;
+
 	/* Spinlock guarding access to this bit array */
 	struct k_spinlock lock;
 };
@@ -43,12 +51,16 @@ typedef struct sys_bitarray sys_bitarray_t;
 	sba_mod uint32_t _sys_bitarray_bundles_##name			\
 		[(((total_bits + 8 - 1) / 8) + sizeof(uint32_t) - 1)	\
 		 / sizeof(uint32_t)] = {0};				\
+	sba_mod uint32_t _sys_bitarray_summary_##name			\
+		[((((total_bits + 8 - 1) / 8) + sizeof(uint32_t) - 1)	\
+		  / sizeof(uint32_t) + 31) / 32] = {0};			\
 	sba_mod sys_bitarray_t name = {					\
 		.num_bits = total_bits,					\
 		.num_bundles = (((total_bits + 8 - 1) / 8)		\
 				+ sizeof(uint32_t) - 1)			\
 			       / sizeof(uint32_t),			\
 		.bundles = _sys_bitarray_bundles_##name,		\
+		.summary = _sys_bitarray_summary_##name,		\
 	}
 
 /**
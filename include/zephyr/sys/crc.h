@@ -277,6 +277,46 @@ uint8_t crc8_ccitt(uint8_t initial_value, const void *buf, size_t len);
  */
 uint8_t crc7_be(uint8_t seed, const uint8_t *src, size_t len);
 
+#if defined(CONFIG_CRC_HW_DISPATCH) || defined(__DOXYGEN__)
+/**
+ * @brief Hardware CRC operations
+ *
+ * Operations a CRC peripheral driver can register to take over the
+ * corresponding software routines.  Each operation must implement
+ * exactly the semantics documented for its software counterpart and be
+ * callable from every context the software routine may be called from;
+ * an operation left NULL keeps the software implementation.
+ */
+struct crc_hw_ops {
+	/** Hardware implementation of crc32_ieee_update() */
+	uint32_t (*crc32_ieee_update)(uint32_t crc, const uint8_t *data,
+				      size_t len);
+	/** Hardware implementation of crc16_ccitt() */
+	uint16_t (*crc16_ccitt)(uint16_t seed, const uint8_t *src, size_t len);
+};
+
+/**
+ * @brief Route CRC computation through a hardware peripheral
+ *
+ * Registers @p ops so that subsequent calls to the corresponding CRC
+ * routines are served by the hardware.  Only one set of operations can
+ * be registered at a time; registering a new set replaces the previous
+ * one.  The pointed-to structure must remain valid while registered.
+ *
+ * @param ops Hardware operations to register
+ */
+void crc_hw_register(const struct crc_hw_ops *ops);
+
+/**
+ * @brief Revert CRC computation to the software implementations
+ */
+void crc_hw_unregister(void);
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct crc_hw_ops *z_crc_hw_ops;
+/** @endcond */
+#endif /* CONFIG_CRC_HW_DISPATCH */
+
 /**
  * @brief Compute a CRC checksum, in a generic way.
  *
@@ -107,6 +107,42 @@ void *z_get_fd_obj(int fd, const struct fd_op_vtable *vtable, int err);
 void *z_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable,
 			      struct k_mutex **lock);
 
+/**
+ * @brief Look up a file descriptor without taking any lock.
+ *
+ * Atomically takes a reference on the descriptor entry, so the
+ * underlying object cannot be torn down by a concurrent close() until
+ * the reference is dropped with z_release_fd().  This is the preferred
+ * resolution path for read-mostly hot paths (e.g. socket send/recv),
+ * where the per-descriptor mutex returned by z_get_fd_obj_and_vtable()
+ * is not otherwise needed.
+ *
+ * On failure no reference is held, @p vtable is set to NULL and errno
+ * is set to EBADF.  Note that the returned object pointer may
+ * legitimately be NULL for some descriptors (e.g. stdio); use the
+ * vtable output to detect failure.
+ *
+ * @param fd File descriptor previously returned by z_reserve_fd()
+ * @param vtable A pointer to a pointer variable to store the vtable,
+ *        set to NULL if the descriptor is invalid
+ *
+ * @return Object pointer, or NULL with errno set if fd is invalid
+ */
+void *z_acquire_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable);
+
+/**
+ * @brief Drop a reference taken by z_acquire_fd_obj_and_vtable().
+ *
+ * Must be called exactly once for every successful acquire.  If the
+ * descriptor was closed while the reference was held, the last
+ * reference runs the deferred close vmethod and releases the table
+ * entry; close() itself only marks the entry and drops its own
+ * reference in that case.
+ *
+ * @param fd File descriptor previously acquired
+ */
+void z_release_fd(int fd);
+
 /**
  * @brief Call ioctl vmethod on an object using varargs.
  *
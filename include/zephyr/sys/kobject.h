@@ -148,6 +148,42 @@ void z_object_init(const void *obj);
 __syscall void k_object_access_grant(const void *object,
 				     struct k_thread *thread);
 
+/**
+ * @brief Define a list of kernel objects for bulk permission grants
+ *
+ * Defines a constant array of kernel object addresses suitable for passing
+ * to k_object_access_grant_list(). A list defined once may be applied to
+ * any number of threads, serving as a re-usable permission template, e.g.
+ * for equipping every instance of a worker thread with the same set of
+ * object permissions when it is spawned.
+ *
+ * The definition may be prefixed with 'static' to give the array internal
+ * linkage.
+ *
+ * @param name Name of the object list
+ * @param ... List of kernel object pointers
+ */
+#define K_OBJECT_ACCESS_LIST_DEFINE(name, ...) \
+	const void *const name[] = { __VA_ARGS__ }
+
+/**
+ * Grant a thread access to a list of kernel objects
+ *
+ * Behaves like k_object_access_grant() invoked on every object in the
+ * supplied array, but resolves and grants the whole list in a single pass,
+ * avoiding one system call round-trip per object when invoked from user
+ * mode. The same permission rules apply: the caller must either be in
+ * supervisor mode, or have permissions on the target thread and on every
+ * object in the list.
+ *
+ * @param objects Array of kernel object addresses
+ * @param num_objects Number of objects in the array
+ * @param thread Thread to grant access to the objects
+ */
+__syscall void k_object_access_grant_list(const void *const *objects,
+					  size_t num_objects,
+					  struct k_thread *thread);
+
 /**
  * Revoke a thread's access to a kernel object
  *
@@ -194,6 +230,9 @@ void k_object_access_all_grant(const void *object);
 /* LCOV_EXCL_START */
 #define K_THREAD_ACCESS_GRANT(thread, ...)
 
+#define K_OBJECT_ACCESS_LIST_DEFINE(name, ...) \
+	const void *const name[] = { __VA_ARGS__ }
+
 /**
  * @internal
  */
@@ -212,6 +251,18 @@ static inline void z_impl_k_object_access_grant(const void *object,
 	ARG_UNUSED(thread);
 }
 
+/**
+ * @internal
+ */
+static inline void z_impl_k_object_access_grant_list(const void *const *objects,
+						     size_t num_objects,
+						     struct k_thread *thread)
+{
+	ARG_UNUSED(objects);
+	ARG_UNUSED(num_objects);
+	ARG_UNUSED(thread);
+}
+
 /**
  * @internal
  */
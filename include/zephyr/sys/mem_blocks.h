@@ -203,6 +203,12 @@ struct sys_multi_mem_blocks {
  * Allocate multiple memory blocks, and place their pointers into
  * the output array.
  *
+ * A contiguous run of @p count blocks is reserved in a single bitmap
+ * transaction when one is available, falling back to gathering
+ * scattered blocks one at a time when the allocator is fragmented.
+ * Callers must not rely on the returned blocks being contiguous; use
+ * sys_mem_blocks_alloc_contiguous() when contiguity is required.
+ *
  * @param[in]  mem_block  Pointer to memory block object.
  * @param[in]  count      Number of blocks to allocate.
  * @param[out] out_blocks Output array to be populated by pointers to
@@ -412,6 +412,24 @@ int k_mem_page_out(void *addr, size_t size);
  */
 void k_mem_page_in(void *addr, size_t size);
 
+/**
+ * Queue a virtual data region to be loaded into memory asynchronously
+ *
+ * This requests the same operation as k_mem_page_in(), but performed from
+ * the system work queue rather than in the calling context. It is intended
+ * for prefetching a region ahead of a known code or data path, instead of
+ * taking page faults one page at a time once execution gets there.
+ *
+ * There is no completion notification; pages appear as they are loaded
+ * and, as with k_mem_page_in(), are not guaranteed to stay resident.
+ *
+ * @param addr Base page-aligned virtual address
+ * @param size Page-aligned data region size
+ * @retval 0 Success, the request is queued
+ * @retval -EAGAIN Too many outstanding prefetch requests
+ */
+int k_mem_page_in_async(void *addr, size_t size);
+
 /**
  * Pin an aligned virtual data region, paging in as necessary
  *
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_MPMC_RING_H_
+#define ZEPHYR_INCLUDE_SYS_MPMC_RING_H_
+
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Multi producer, multi consumer lockless ring buffer API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/* Alignment/padding unit used to keep the producer position, consumer
+ * position and the rest of the control data on separate cache lines,
+ * so producer and consumer cores do not false-share.
+ */
+#if CONFIG_DCACHE_LINE_SIZE != 0
+#define Z_MPMC_RING_CACHE_LINE CONFIG_DCACHE_LINE_SIZE
+#else
+#define Z_MPMC_RING_CACHE_LINE 64
+#endif
+
+/**
+ * @brief Multi producer, multi consumer ring buffer
+ *
+ * A bounded queue of fixed-size items over caller-provided storage.
+ * Any number of producers and consumers on any cores (including ISRs)
+ * may operate on it concurrently without external locking: slots are
+ * claimed with a single compare-and-set on the respective position
+ * counter and published by bumping the slot's sequence stamp, so no
+ * side ever spins on a lock.  Producers and consumers advance
+ * independent, cache-line-padded counters and therefore do not
+ * false-share.
+ *
+ * Unlike struct ring_buf this is not a byte stream; it trades
+ * variable-length access for lock-free multi-access.  All fields are
+ * internal.
+ */
+struct mpmc_ring {
+	uint8_t *data;		/* Item storage, item_count * item_size */
+	atomic_val_t *seq;	/* Per-slot sequence stamps, item_count */
+	uint32_t mask;		/* item_count - 1 */
+	uint32_t item_size;
+	uint8_t _pad0[Z_MPMC_RING_CACHE_LINE];
+	atomic_t enq_pos;	/* Next position to produce into */
+	uint8_t _pad1[Z_MPMC_RING_CACHE_LINE];
+	atomic_t deq_pos;	/* Next position to consume from */
+};
+
+/**
+ * @brief Initialize a multi producer, multi consumer ring buffer.
+ *
+ * @param ring Address of the ring buffer.
+ * @param data Item storage, at least @a item_count * @a item_size bytes.
+ * @param seq Sequence stamp storage, @a item_count entries.
+ * @param item_count Number of item slots. Must be a power of two.
+ * @param item_size Size of one item in bytes.
+ *
+ * @retval 0 Successful initialization.
+ * @retval -EINVAL If @a item_count is not a power of two.
+ */
+int mpmc_ring_init(struct mpmc_ring *ring, void *data, atomic_val_t *seq,
+		   uint32_t item_count, uint32_t item_size);
+
+/**
+ * @brief Claim a slot for writing one item.
+ *
+ * On success the returned pointer addresses @c item_size bytes of
+ * storage owned exclusively by the caller.  The slot's contents are
+ * not visible to consumers until it is published with
+ * @ref mpmc_ring_put_finish.  Slots are published independently, so a
+ * slow producer does not block other producers from claiming, though
+ * consumers see items in claim order.
+ *
+ * @param ring Address of the ring buffer.
+ *
+ * @return Pointer to the claimed slot, or NULL if the ring is full.
+ */
+void *mpmc_ring_put_claim(struct mpmc_ring *ring);
+
+/**
+ * @brief Publish a slot claimed with mpmc_ring_put_claim().
+ *
+ * After this call the slot may be read and recycled at any time and
+ * must not be accessed by the producer again.
+ *
+ * @param ring Address of the ring buffer.
+ * @param slot Pointer returned by @ref mpmc_ring_put_claim.
+ */
+void mpmc_ring_put_finish(struct mpmc_ring *ring, void *slot);
+
+/**
+ * @brief Claim the oldest published item for reading.
+ *
+ * On success the returned pointer addresses the item's storage, owned
+ * exclusively by the caller until released with
+ * @ref mpmc_ring_get_finish.
+ *
+ * @param ring Address of the ring buffer.
+ *
+ * @return Pointer to the claimed item, or NULL if no published item
+ *	   is available.
+ */
+void *mpmc_ring_get_claim(struct mpmc_ring *ring);
+
+/**
+ * @brief Release a slot claimed with mpmc_ring_get_claim().
+ *
+ * Returns the slot to the pool of free slots available to producers.
+ * The item's storage must not be accessed after this call.
+ *
+ * @param ring Address of the ring buffer.
+ * @param slot Pointer returned by @ref mpmc_ring_get_claim.
+ */
+void mpmc_ring_get_finish(struct mpmc_ring *ring, void *slot);
+
+/**
+ * @brief Write (copy) one item into the ring buffer.
+ *
+ * Combines @ref mpmc_ring_put_claim and @ref mpmc_ring_put_finish
+ * with a copy of @c item_size bytes from @a item.
+ *
+ * @param ring Address of the ring buffer.
+ * @param item Address of the item to copy in.
+ *
+ * @retval 0 Item was written.
+ * @retval -ENOMEM Ring buffer is full.
+ */
+int mpmc_ring_put(struct mpmc_ring *ring, const void *item);
+
+/**
+ * @brief Read (copy) one item out of the ring buffer.
+ *
+ * Combines @ref mpmc_ring_get_claim and @ref mpmc_ring_get_finish
+ * with a copy of @c item_size bytes to @a item.
+ *
+ * @param ring Address of the ring buffer.
+ * @param item Address to copy the item to.
+ *
+ * @retval 0 Item was read.
+ * @retval -EAGAIN Ring buffer is empty.
+ */
+int mpmc_ring_get(struct mpmc_ring *ring, void *item);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_MPMC_RING_H_ */
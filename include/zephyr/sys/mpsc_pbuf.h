@@ -180,6 +180,55 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 			union mpsc_pbuf_generic *packet);
 
+/** @brief Allocate multiple packets in one locking round.
+ *
+ * Equivalent to calling @ref mpsc_pbuf_alloc with K_NO_WAIT once per
+ * packet, but the whole batch is carved out under a single lock
+ * acquisition, which reduces lock traffic when a producer writes a
+ * burst of messages (e.g. many log messages from one interrupt
+ * window).
+ *
+ * The batch path never pends nor drops old packets. If the buffer
+ * fills up mid-batch the function stops early and returns the number
+ * of packets that were allocated; remaining packets can be allocated
+ * with @ref mpsc_pbuf_alloc which retains the full dropping/pending
+ * logic.
+ *
+ * Each allocated packet must be committed, either individually with
+ * @ref mpsc_pbuf_commit or together with @ref mpsc_pbuf_commit_batch.
+ *
+ * @param buffer Buffer.
+ *
+ * @param wlen Array of packet sizes in words, one per packet.
+ *
+ * @param cnt Number of packets to allocate.
+ *
+ * @param[out] packets Filled with a pointer to the allocated space for
+ * each packet.
+ *
+ * @return Number of packets allocated, which is less than @p cnt if
+ * the buffer ran out of space.
+ */
+size_t mpsc_pbuf_alloc_batch(struct mpsc_pbuf_buffer *buffer,
+			     const size_t *wlen, size_t cnt,
+			     union mpsc_pbuf_generic **packets);
+
+/** @brief Commit multiple packets in one locking round.
+ *
+ * Equivalent to calling @ref mpsc_pbuf_commit once per packet, under a
+ * single lock acquisition.
+ *
+ * @param buffer Buffer.
+ *
+ * @param packets Array of packets allocated by @ref mpsc_pbuf_alloc or
+ * @ref mpsc_pbuf_alloc_batch.
+ *
+ * @param cnt Number of packets to commit.
+ */
+void mpsc_pbuf_commit_batch(struct mpsc_pbuf_buffer *buffer,
+			    union mpsc_pbuf_generic *const *packets,
+			    size_t cnt);
+
 /** @brief Put single word packet into a buffer.
  *
  * Function is optimized for storing a packet which fit into a single word.
@@ -46,6 +46,12 @@ struct k_p4wq_work {
 #define K_P4WQ_DELAYED_START		BIT(1)
 #define K_P4WQ_USER_CPU_MASK		BIT(2)
 
+/* Let idle threads pull work from sibling queues in the same pool.
+ * Requires CONFIG_P4WQ_WORK_STEALING, only meaningful together with
+ * K_P4WQ_QUEUE_PER_THREAD (i.e. K_P4WQ_ARRAY_DEFINE pools).
+ */
+#define K_P4WQ_WORK_STEALING		BIT(3)
+
 /**
  * @brief P4 Queue
  *
@@ -73,6 +79,13 @@ struct k_p4wq {
 
 	/* K_P4WQ_* flags above */
 	uint32_t flags;
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	/* Next queue in the pool's work stealing ring, NULL when the
+	 * queue is not part of a K_P4WQ_WORK_STEALING group
+	 */
+	struct k_p4wq *steal_next;
+#endif
 };
 
 struct k_p4wq_initparam {
@@ -44,6 +44,7 @@
 #define ZEPHYR_INCLUDE_SYS_RB_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 struct rbnode {
@@ -125,6 +126,55 @@ static inline struct rbnode *rb_get_max(struct rbtree *tree)
 	return z_rb_get_minmax(tree, 1U);
 }
 
+/**
+ * @brief Red/black tree with cached leftmost node
+ *
+ * Augments struct rbtree with a pointer to the lowest-sorted node,
+ * maintained across modifications, so that rb_cached_get_min() is O(1)
+ * instead of a walk from the root.  Useful where the minimum element is
+ * queried repeatedly, e.g. priority queues.  Modifications must go
+ * through rb_cached_insert()/rb_cached_remove() to keep the cache
+ * coherent; read-only APIs (rb_contains(), RB_FOR_EACH, etc.) can be
+ * applied to the contained tree directly.
+ */
+struct rbtree_cached {
+	struct rbtree tree;
+	struct rbnode *leftmost;
+};
+
+/**
+ * @brief Insert node into cached tree
+ */
+static inline void rb_cached_insert(struct rbtree_cached *tree,
+				    struct rbnode *node)
+{
+	if ((tree->leftmost == NULL) ||
+	    tree->tree.lessthan_fn(node, tree->leftmost)) {
+		tree->leftmost = node;
+	}
+	rb_insert(&tree->tree, node);
+}
+
+/**
+ * @brief Remove node from cached tree
+ */
+static inline void rb_cached_remove(struct rbtree_cached *tree,
+				    struct rbnode *node)
+{
+	rb_remove(&tree->tree, node);
+	if (node == tree->leftmost) {
+		tree->leftmost = z_rb_get_minmax(&tree->tree, 0U);
+	}
+}
+
+/**
+ * @brief Returns the lowest-sorted member of the cached tree in O(1)
+ */
+static inline struct rbnode *rb_cached_get_min(struct rbtree_cached *tree)
+{
+	return tree->leftmost;
+}
+
 /**
  * @brief Returns true if the given node is part of the tree
  *
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_SYS_ARENA_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Arena (region) allocator.
+ *
+ * An arena is a contiguous region of memory, carved either from a
+ * sys_heap or provided by the caller, from which allocations are made
+ * by bumping a pointer.  There is no per-allocation free; the whole
+ * arena is recycled at once with sys_arena_reset(), which is O(1).
+ *
+ * This is intended for groups of allocations with a common lifetime
+ * (e.g. scratch memory for processing one request or one frame), where
+ * it replaces many sys_heap_alloc()/sys_heap_free() pairs with a
+ * pointer increment and a single reset.
+ *
+ * Like sys_heap, the arena is not internally synchronized.  All
+ * locking must be provided by the user; the expected usage is one
+ * arena per thread or per request, which needs none.
+ */
+struct sys_arena {
+	uint8_t *base;
+	size_t size;
+	size_t offset;
+	struct sys_heap *backing; /* Heap the arena was carved from, or NULL */
+};
+
+/** @brief Initialize an arena over caller-provided memory
+ *
+ * Initializes a sys_arena to allocate from the specified buffer.  The
+ * buffer is not touched until memory is allocated from the arena, and
+ * remains owned by the caller.
+ *
+ * @param arena Arena to initialize
+ * @param mem Untyped pointer to unused memory
+ * @param bytes Size of region pointed to by @a mem
+ */
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes);
+
+/** @brief Initialize an arena carved from a sys_heap
+ *
+ * Allocates @a bytes from @a heap and initializes the arena over the
+ * resulting block.  The block is returned to the heap by
+ * sys_arena_destroy().
+ *
+ * @param arena Arena to initialize
+ * @param heap Heap from which to carve the arena region
+ * @param bytes Size of the arena region
+ * @return 0 on success, -ENOMEM if the heap allocation failed
+ */
+int sys_arena_init_heap(struct sys_arena *arena, struct sys_heap *heap,
+			size_t bytes);
+
+/** @brief Allocate memory from an arena
+ *
+ * Returns a pointer to a block of unused memory in the arena, or NULL
+ * if insufficient space remains.  The memory is guaranteed to have a
+ * starting address which is a multiple of sizeof(void *).  There is no
+ * matching free; the memory is reclaimed by sys_arena_reset() or
+ * sys_arena_destroy(), after which the pointer must not be used.
+ *
+ * @param arena Arena from which to allocate
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_arena_alloc(struct sys_arena *arena, size_t bytes);
+
+/** @brief Allocate aligned memory from an arena
+ *
+ * Behaves in all ways like sys_arena_alloc(), except that the returned
+ * memory (if available) will have a starting address in memory which
+ * is a multiple of the specified power-of-two alignment value in
+ * bytes.  With align=0 this behaves exactly like sys_arena_alloc().
+ *
+ * @param arena Arena from which to allocate
+ * @param align Alignment in bytes, must be a power of two
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align,
+			      size_t bytes);
+
+/** @brief Reset an arena
+ *
+ * Reclaims all memory allocated from the arena in constant time.  All
+ * pointers previously returned by sys_arena_alloc() become invalid.
+ * The arena region itself is retained and can immediately serve new
+ * allocations.
+ *
+ * @param arena Arena to reset
+ */
+void sys_arena_reset(struct sys_arena *arena);
+
+/** @brief Destroy an arena
+ *
+ * Invalidates all allocations as per sys_arena_reset() and, if the
+ * arena was created with sys_arena_init_heap(), returns its region to
+ * the backing heap.  The arena must be re-initialized before reuse.
+ *
+ * @param arena Arena to destroy
+ */
+void sys_arena_destroy(struct sys_arena *arena);
+
+#ifdef CONFIG_SYS_ARENA_THREAD
+
+/** @brief Set the calling thread's arena
+ *
+ * Associates @a arena with the calling thread, where it can later be
+ * retrieved with sys_arena_thread_get().  This lets deeply nested code
+ * allocate request-scoped memory without threading an arena pointer
+ * through every call.  Pass NULL to clear the association.
+ *
+ * @param arena Arena to associate with the calling thread, or NULL
+ */
+void sys_arena_thread_set(struct sys_arena *arena);
+
+/** @brief Get the calling thread's arena
+ *
+ * @return The arena set by sys_arena_thread_set(), or NULL if none
+ */
+struct sys_arena *sys_arena_thread_get(void);
+
+#endif /* CONFIG_SYS_ARENA_THREAD */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYS_ARENA_H_ */
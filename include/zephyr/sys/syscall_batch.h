@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <zephyr/types.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis System call batching APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/** Maximum number of entries accepted by one k_syscall_batch() call */
+#define K_SYSCALL_BATCH_MAX 16
+
+/**
+ * @brief One system call invocation within a batch
+ *
+ * The syscall ID is the generated K_SYSCALL_xxx value from
+ * syscall_list.h for the call to be made, e.g. K_SYSCALL_K_MUTEX_LOCK
+ * for k_mutex_lock(). Arguments are passed exactly as the call's
+ * handler function expects them, cast to uintptr_t; unused argument
+ * slots are ignored. System calls with more than six arguments pass a
+ * pointer to a struct holding the remainder in args[5], per the usual
+ * system call convention.
+ */
+struct k_syscall_batch_entry {
+	/** K_SYSCALL_xxx ID of the call to invoke */
+	uint32_t id;
+	/** Arguments, as the call's handler function expects them */
+	uintptr_t args[6];
+	/** Return value of the call, written by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Invoke multiple system calls with a single privilege transition
+ *
+ * This routine traps to the kernel once and dispatches every entry in
+ * @a entries in order through the regular system call handlers, storing
+ * each call's return value in its entry. It is intended for user
+ * threads making clusters of small system calls, where the
+ * per-transition overhead of the architecture trap path dominates the
+ * work done by the calls themselves.
+ *
+ * Every entry is verified exactly as if it had been invoked as an
+ * individual system call; a bad argument faults the calling thread the
+ * same way the individual call would. Entries are not transactional:
+ * calls before a faulting entry have taken effect. Batches may not be
+ * nested.
+ *
+ * Invoking this from supervisor mode returns -ENOSYS; kernel threads
+ * can simply make the calls directly.
+ *
+ * @param entries Array of system call descriptors, updated in place.
+ * @param num_entries Number of entries, at most K_SYSCALL_BATCH_MAX.
+ *
+ * @retval 0 All entries were dispatched.
+ * @retval -EINVAL Bad number of entries or bad syscall ID.
+ * @retval -ENOMEM Thread resource pool insufficient memory.
+ * @retval -ENOSYS Called from supervisor mode.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      uint32_t num_entries);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Helper module for receiving using the UART asynchronous API.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_UART_ASYNC_RX_H_
+#define ZEPHYR_INCLUDE_SYS_UART_ASYNC_RX_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Helper module for receiving using the UART asynchronous API
+ * @defgroup uart_async_rx UART asynchronous RX helper
+ * @ingroup uart_interface
+ *
+ * The module handles the buffer management required by the UART
+ * asynchronous API (providing new buffers to the driver before the
+ * current one is filled, releasing them once consumed) and exposes the
+ * received data through claim/consume calls which return pointers
+ * directly into the DMA buffers, so no copying takes place.
+ *
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Receive buffer header, prepended to each buffer in the user-provided
+ * memory area.
+ */
+struct uart_async_rx_buf {
+	/* Write index, updated when the driver reports received data. */
+	uint8_t wr_idx;
+
+	/* Set when the driver has released the buffer. No more data will
+	 * be written to it.
+	 */
+	uint8_t completed;
+
+	/* Data. */
+	uint8_t buffer[];
+};
+
+/** @endcond */
+
+/** @brief UART asynchronous RX helper instance. */
+struct uart_async_rx {
+	/** Memory area for the receive buffers. */
+	uint8_t *buf;
+
+	/** Length of a single buffer, including the header. */
+	size_t buf_len;
+
+	/** Number of buffers in the memory area. */
+	uint8_t buf_cnt;
+
+	/** Index of the next buffer to be provided to the driver. */
+	uint8_t drv_idx;
+
+	/** Index of the buffer data is consumed from. */
+	uint8_t rd_idx;
+
+	/** Read offset within the buffer data is consumed from. */
+	uint8_t rd_off;
+
+	/** Number of buffers not owned by the driver. */
+	atomic_t free_cnt;
+
+	/** Number of received but not yet consumed bytes. */
+	atomic_t pending_bytes;
+};
+
+/** @brief UART asynchronous RX helper configuration. */
+struct uart_async_rx_config {
+	/** Memory area for the receive buffers. */
+	uint8_t *buffer;
+
+	/** Size of the memory area. */
+	size_t length;
+
+	/** Number of buffers the memory area is split into. At least two
+	 * buffers are needed for continuous reception.
+	 */
+	uint8_t buf_cnt;
+};
+
+/** @brief Initialize the helper instance.
+ *
+ * @param rx     Helper instance.
+ * @param config Configuration. Must persist while the helper is in use.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the configuration is invalid.
+ */
+int uart_async_rx_init(struct uart_async_rx *rx,
+		       const struct uart_async_rx_config *config);
+
+/** @brief Get a buffer for the driver.
+ *
+ * Called to get the initial buffer for uart_rx_enable() and on the
+ * #UART_RX_BUF_REQUEST event to get the buffer for uart_rx_buf_rsp().
+ * If no buffer is available the application shall provide one once
+ * uart_async_rx_data_consumed() reports that a buffer was released.
+ *
+ * @param rx Helper instance.
+ *
+ * @return Pointer to the buffer or NULL if no buffer is available.
+ */
+uint8_t *uart_async_rx_buf_req(struct uart_async_rx *rx);
+
+/** @brief Get the length of the buffers handed to the driver.
+ *
+ * @param rx Helper instance.
+ *
+ * @return Buffer length in bytes.
+ */
+static inline size_t uart_async_rx_get_buf_len(struct uart_async_rx *rx)
+{
+	return rx->buf_len - offsetof(struct uart_async_rx_buf, buffer);
+}
+
+/** @brief Report received data.
+ *
+ * Called on the #UART_RX_RDY event.
+ *
+ * @param rx     Helper instance.
+ * @param buffer Buffer from the event.
+ * @param length Number of received bytes from the event.
+ */
+void uart_async_rx_on_rdy(struct uart_async_rx *rx, uint8_t *buffer, size_t length);
+
+/** @brief Report a buffer released by the driver.
+ *
+ * Called on the #UART_RX_BUF_RELEASED event.
+ *
+ * @param rx     Helper instance.
+ * @param buffer Buffer from the event.
+ */
+void uart_async_rx_on_buf_rel(struct uart_async_rx *rx, uint8_t *buffer);
+
+/** @brief Claim received data.
+ *
+ * Returns a pointer to a contiguous chunk of received data. The data
+ * stays in the receive buffer until uart_async_rx_data_consumed() is
+ * called, so no copying is involved. Since buffers are not contiguous,
+ * less data than is pending may be claimed; the call shall be repeated
+ * until it returns 0.
+ *
+ * @param rx     Helper instance.
+ * @param data   Location where the pointer to the data is written.
+ * @param length Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, 0 if no data is available.
+ */
+size_t uart_async_rx_data_claim(struct uart_async_rx *rx, uint8_t **data, size_t length);
+
+/** @brief Consume claimed data.
+ *
+ * @param rx     Helper instance.
+ * @param length Number of bytes to consume. Must not exceed the amount
+ *		 claimed.
+ *
+ * @return true if a buffer was released and the driver may be provided
+ *	   with a new one (see uart_async_rx_buf_req()), false otherwise.
+ */
+bool uart_async_rx_data_consumed(struct uart_async_rx *rx, size_t length);
+
+/** @brief Reset the helper instance.
+ *
+ * Called after the receiver is stopped and all buffers are released by
+ * the driver. Pending data is dropped.
+ *
+ * @param rx Helper instance.
+ */
+void uart_async_rx_reset(struct uart_async_rx *rx);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_UART_ASYNC_RX_H_ */
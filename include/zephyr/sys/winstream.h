@@ -92,4 +92,74 @@ void sys_winstream_write(struct sys_winstream *ws,
 uint32_t sys_winstream_read(struct sys_winstream *ws,
 			    uint32_t *seq, char *buf, uint32_t buflen);
 
+#ifdef CONFIG_WINSTREAM_MULTIPRODUCER
+
+#include <zephyr/sys/atomic.h>
+
+/** @brief Multi-producer write state for a sys_winstream
+ *
+ * Producer-side coordination state for writing one stream from
+ * multiple CPUs and interrupt contexts.  It lives outside the shared
+ * window, so the read side of the protocol (and a reader on another
+ * CPU that only understands struct sys_winstream) is unchanged.
+ */
+struct sys_winstream_mp {
+	struct sys_winstream *ws; /* Shared window, read side unchanged */
+	atomic_t claim;           /* Cumulative bytes reserved by writers */
+	atomic_t done;            /* Cumulative bytes finished copying */
+	atomic_t publishing;      /* A writer is updating the header */
+};
+
+/** @brief Construct a sys_winstream_mp over a region of memory
+ *
+ * Initializes the embedded sys_winstream in the given buffer (see
+ * sys_winstream_init() for the constraints on it) and resets the
+ * producer coordination state.
+ *
+ * @param mp Multi-producer state to initialize
+ * @param buf Pointer to a region of memory to contain the stream
+ * @param buflen Length of the buffer
+ */
+static inline void sys_winstream_mp_init(struct sys_winstream_mp *mp,
+					 void *buf, int buflen)
+{
+	mp->ws = sys_winstream_init(buf, buflen);
+	mp->claim = ATOMIC_INIT(0);
+	mp->done = ATOMIC_INIT(0);
+	mp->publishing = ATOMIC_INIT(0);
+}
+
+/** @brief Write bytes to a sys_winstream from multiple producers
+ *
+ * Like sys_winstream_write(), but safe to call concurrently from any
+ * number of CPUs and ISRs.  Space is reserved with a single atomic
+ * addition; no caller ever blocks or spins.  The stream header is only
+ * advanced when no write is in flight, so bytes written while another
+ * writer is still copying become visible to the reader with the next
+ * write or with sys_winstream_mp_flush().  Reads are performed with
+ * sys_winstream_read() on the embedded stream.  Note that an overflow
+ * concurrent with a read can hand the reader bytes that are being
+ * overwritten; as with the single-producer write, the stream is lossy
+ * and the reader detects the gap via the sequence number.
+ *
+ * @param mp A sys_winstream_mp to which to write
+ * @param data Pointer to bytes to be written
+ * @param len Number of bytes to write
+ */
+void sys_winstream_mp_write(struct sys_winstream_mp *mp,
+			    const char *data, uint32_t len);
+
+/** @brief Publish fully-written bytes to the reader
+ *
+ * Advances the stream header over any bytes whose writes have
+ * completed but were not yet published because another write was in
+ * flight at the time.  Intended to be called from the read side before
+ * sys_winstream_read() to pick up the tail of a write burst.
+ *
+ * @param mp A sys_winstream_mp to publish
+ */
+void sys_winstream_mp_flush(struct sys_winstream_mp *mp);
+
+#endif /* CONFIG_WINSTREAM_MULTIPRODUCER */
+
 #endif /* ZEPHYR_INCLUDE_SYS_WINSTREAM_H_ */
@@ -14,6 +14,8 @@
 extern "C" {
 #endif
 
+struct device;
+
 void soc_timing_init(void);
 void soc_timing_start(void);
 void soc_timing_stop(void);
@@ -173,6 +175,44 @@ static inline uint32_t timing_freq_get_mhz(void)
 #endif
 }
 
+#if defined(CONFIG_TIMING_CORRELATION) || defined(__DOXYGEN__)
+
+/**
+ * @brief Calibrate the timestamp correlation of the current CPU.
+ *
+ * Captures the timing counter together with the system uptime and,
+ * if @p ptp_clock is not NULL, the PTP time. A second calibration
+ * additionally refines the counter rate from the elapsed uptime, which
+ * absorbs counter drift. Timestamps must be converted on the CPU they
+ * were calibrated on.
+ *
+ * @param ptp_clock PTP clock device to correlate against, or NULL.
+ * @retval 0 on success.
+ * @retval Negative error code if reading the PTP clock failed; the
+ *         counter and uptime calibration is performed regardless.
+ */
+int timing_correlation_calibrate(const struct device *ptp_clock);
+
+/**
+ * @brief Convert a timing counter value to system uptime.
+ *
+ * @param ts Counter value obtained with timing_counter_get().
+ * @return Uptime in nanoseconds corresponding to @p ts.
+ */
+uint64_t timing_counter_to_uptime_ns(timing_t ts);
+
+/**
+ * @brief Convert a timing counter value to PTP time.
+ *
+ * @param ts Counter value obtained with timing_counter_get().
+ * @param ptp_ns PTP time in nanoseconds corresponding to @p ts.
+ * @retval 0 on success.
+ * @retval -EAGAIN if no PTP calibration has been performed.
+ */
+int timing_counter_to_ptp_ns(timing_t ts, uint64_t *ptp_ns);
+
+#endif /* CONFIG_TIMING_CORRELATION */
+
 #endif /* CONFIG_TIMING_FUNCTIONS */
 
 /**
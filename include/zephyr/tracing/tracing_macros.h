@@ -173,6 +173,77 @@
 	#define sys_port_trace_type_mask_k_event(trace_call)
 #endif
 
+/*
+ * Runtime filter of trace events. When enabled, every trace call site
+ * tests one bit of a bitmap owned by tracing_core.c before any argument
+ * is marshalled, so event classes can be turned on and off in the field.
+ */
+
+/* Runtime filter event classes, one bitmap bit per class. */
+#define SYS_PORT_TRACE_FILTER_THREAD		0
+#define SYS_PORT_TRACE_FILTER_WORK		1
+#define SYS_PORT_TRACE_FILTER_SEMAPHORE		2
+#define SYS_PORT_TRACE_FILTER_MUTEX		3
+#define SYS_PORT_TRACE_FILTER_CONDVAR		4
+#define SYS_PORT_TRACE_FILTER_QUEUE		5
+#define SYS_PORT_TRACE_FILTER_FIFO		6
+#define SYS_PORT_TRACE_FILTER_LIFO		7
+#define SYS_PORT_TRACE_FILTER_STACK		8
+#define SYS_PORT_TRACE_FILTER_MSGQ		9
+#define SYS_PORT_TRACE_FILTER_MBOX		10
+#define SYS_PORT_TRACE_FILTER_PIPE		11
+#define SYS_PORT_TRACE_FILTER_HEAP		12
+#define SYS_PORT_TRACE_FILTER_MEM_SLAB		13
+#define SYS_PORT_TRACE_FILTER_TIMER		14
+#define SYS_PORT_TRACE_FILTER_EVENT		15
+#define SYS_PORT_TRACE_FILTER_POLL		16
+#define SYS_PORT_TRACE_FILTER_PM		17
+#define SYS_PORT_TRACE_FILTER_COUNT		18
+
+#if defined(CONFIG_TRACING_RUNTIME_FILTER)
+
+extern uint32_t sys_port_trace_filter_mask;
+
+#define sys_port_trace_filter_bit_k_thread SYS_PORT_TRACE_FILTER_THREAD
+#define sys_port_trace_filter_bit_k_work SYS_PORT_TRACE_FILTER_WORK
+#define sys_port_trace_filter_bit_k_work_queue SYS_PORT_TRACE_FILTER_WORK
+#define sys_port_trace_filter_bit_k_work_delayable SYS_PORT_TRACE_FILTER_WORK
+#define sys_port_trace_filter_bit_k_work_poll SYS_PORT_TRACE_FILTER_WORK
+#define sys_port_trace_filter_bit_k_sem SYS_PORT_TRACE_FILTER_SEMAPHORE
+#define sys_port_trace_filter_bit_k_mutex SYS_PORT_TRACE_FILTER_MUTEX
+#define sys_port_trace_filter_bit_k_condvar SYS_PORT_TRACE_FILTER_CONDVAR
+#define sys_port_trace_filter_bit_k_queue SYS_PORT_TRACE_FILTER_QUEUE
+#define sys_port_trace_filter_bit_k_fifo SYS_PORT_TRACE_FILTER_FIFO
+#define sys_port_trace_filter_bit_k_lifo SYS_PORT_TRACE_FILTER_LIFO
+#define sys_port_trace_filter_bit_k_stack SYS_PORT_TRACE_FILTER_STACK
+#define sys_port_trace_filter_bit_k_msgq SYS_PORT_TRACE_FILTER_MSGQ
+#define sys_port_trace_filter_bit_k_mbox SYS_PORT_TRACE_FILTER_MBOX
+#define sys_port_trace_filter_bit_k_pipe SYS_PORT_TRACE_FILTER_PIPE
+#define sys_port_trace_filter_bit_k_heap SYS_PORT_TRACE_FILTER_HEAP
+#define sys_port_trace_filter_bit_k_heap_sys SYS_PORT_TRACE_FILTER_HEAP
+#define sys_port_trace_filter_bit_k_mem_slab SYS_PORT_TRACE_FILTER_MEM_SLAB
+#define sys_port_trace_filter_bit_k_timer SYS_PORT_TRACE_FILTER_TIMER
+#define sys_port_trace_filter_bit_k_event SYS_PORT_TRACE_FILTER_EVENT
+#define sys_port_trace_filter_bit_k_poll_api SYS_PORT_TRACE_FILTER_POLL
+#define sys_port_trace_filter_bit_pm SYS_PORT_TRACE_FILTER_PM
+
+#define _SYS_PORT_TRACE_FILTER_BIT(type) \
+	sys_port_trace_filter_bit_ ## type
+
+#define _SYS_PORT_TRACING_FILTERED(type, ...) \
+	do { \
+		if (sys_port_trace_filter_mask & \
+		    (1UL << _SYS_PORT_TRACE_FILTER_BIT(type))) { \
+			__VA_ARGS__; \
+		} \
+	} while (false)
+
+#else
+
+#define _SYS_PORT_TRACING_FILTERED(type, ...) __VA_ARGS__
+
+#endif /* CONFIG_TRACING_RUNTIME_FILTER */
+
 /** @endcond */
 
 /**
@@ -196,7 +267,8 @@
  */
 #define SYS_PORT_TRACING_FUNC(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, \
+			_SYS_PORT_TRACING_FUNC(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -211,7 +283,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_ENTER(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_ENTER(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, \
+			_SYS_PORT_TRACING_FUNC_ENTER(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -225,7 +298,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_BLOCKING(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_BLOCKING(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, \
+			_SYS_PORT_TRACING_FUNC_BLOCKING(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -240,7 +314,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_EXIT(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_EXIT(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTERED(type, \
+			_SYS_PORT_TRACING_FUNC_EXIT(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -251,8 +326,9 @@
  */
 #define SYS_PORT_TRACING_OBJ_INIT(obj_type, obj, ...) \
 	do { \
-		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__)); \
+		_SYS_PORT_TRACING_FILTERED(obj_type, \
+			SYS_PORT_TRACING_TYPE_MASK(obj_type, \
+				_SYS_PORT_TRACING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__))); \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
 			_SYS_PORT_TRACKING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__)); \
 	} while (false)
@@ -269,8 +345,9 @@
  */
 #define SYS_PORT_TRACING_OBJ_FUNC(obj_type, func, obj, ...) \
 	do { \
-		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__)); \
+		_SYS_PORT_TRACING_FILTERED(obj_type, \
+			SYS_PORT_TRACING_TYPE_MASK(obj_type, \
+				_SYS_PORT_TRACING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__))); \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
 			_SYS_PORT_TRACKING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__)); \
 	} while (false)
@@ -288,8 +365,10 @@
  */
 #define SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func, obj, ...) \
 	do { \
-		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func)(obj, ##__VA_ARGS__)); \
+		_SYS_PORT_TRACING_FILTERED(obj_type, \
+			SYS_PORT_TRACING_TYPE_MASK(obj_type, \
+				_SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func) \
+				(obj, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -305,9 +384,10 @@
  */
 #define SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func, obj, timeout, ...) \
 	do { \
-		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func) \
-			(obj, timeout, ##__VA_ARGS__)); \
+		_SYS_PORT_TRACING_FILTERED(obj_type, \
+			SYS_PORT_TRACING_TYPE_MASK(obj_type, \
+				_SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func) \
+				(obj, timeout, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -323,8 +403,10 @@
  */
 #define SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func, obj, ...) \
 	do { \
-		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func)(obj, ##__VA_ARGS__)); \
+		_SYS_PORT_TRACING_FILTERED(obj_type, \
+			SYS_PORT_TRACING_TYPE_MASK(obj_type, \
+				_SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func) \
+				(obj, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
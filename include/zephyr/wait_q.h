@@ -22,20 +22,22 @@ extern "C" {
 #ifdef CONFIG_WAITQ_SCALABLE
 
 #define _WAIT_Q_FOR_EACH(wq, thread_ptr) \
-	RB_FOR_EACH_CONTAINER(&(wq)->waitq.tree, thread_ptr, base.qnode_rb)
+	RB_FOR_EACH_CONTAINER(&(wq)->waitq.tree.tree, thread_ptr, base.qnode_rb)
 
 static inline void z_waitq_init(_wait_q_t *w)
 {
 	w->waitq = (struct _priq_rb) {
 		.tree = {
-			.lessthan_fn = z_priq_rb_lessthan
+			.tree = {
+				.lessthan_fn = z_priq_rb_lessthan
+			}
 		}
 	};
 }
 
 static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 {
-	return (struct k_thread *)rb_get_min(&w->waitq.tree);
+	return (struct k_thread *)rb_cached_get_min(&w->waitq.tree);
 }
 
 #else /* !CONFIG_WAITQ_SCALABLE: */
@@ -54,6 +54,14 @@ struct zbus_channel {
 	 * for accessing the channel.
 	 */
 	struct k_mutex *mutex;
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Publication sequence counter. When this field is not NULL the channel uses
+	 * single-writer lock-free publication: the counter is odd while a publication
+	 * is in progress and readers retry their copy instead of blocking the writer.
+	 * It is NULL for channels with the default mutex semantics.
+	 */
+	atomic_t *const seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
 #if (CONFIG_ZBUS_RUNTIME_OBSERVERS_POOL_SIZE > 0) || defined(__DOXYGEN__)
 	/** Dynamic channel observer list. Represents the channel's observers list, it can be empty
 	 * or have listeners and subscribers mixed in any sequence. It can be changed in runtime.
@@ -67,6 +75,49 @@ struct zbus_channel {
 	const struct zbus_observer *const *observers;
 };
 
+#if defined(CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY) || defined(__DOXYGEN__)
+/**
+ * @brief Subscriber delivery policy type.
+ *
+ * Defines how the event dispatcher delivers notifications to a subscriber. All the
+ * policies assume latest-value semantics: a subscriber reads the channel when it wakes,
+ * so skipped notifications are absorbed by the freshest message.
+ */
+enum zbus_delivery_policy_type {
+	/** Deliver every publication. Same behavior as a subscriber without policy. */
+	ZBUS_DELIVERY_IMMEDIATE = 0,
+	/** When the subscriber's queue is full, drop the oldest pending notification
+	 * instead of blocking the publisher, so the subscriber always wakes with the
+	 * freshest message.
+	 */
+	ZBUS_DELIVERY_COALESCE,
+	/** Deliver at most one notification per param milliseconds. */
+	ZBUS_DELIVERY_RATE_LIMIT,
+	/** Deliver one notification every param publications. */
+	ZBUS_DELIVERY_BATCH,
+};
+
+/**
+ * @brief Type used to represent a subscriber delivery policy.
+ *
+ * Carries the policy type, its parameter, and the mutable state the event dispatcher
+ * needs to enforce it.
+ */
+struct zbus_delivery_policy {
+	/** Policy type. */
+	const enum zbus_delivery_policy_type type;
+	/** Policy parameter. Minimum delivery interval in milliseconds for
+	 * ZBUS_DELIVERY_RATE_LIMIT, number of publications per delivery for
+	 * ZBUS_DELIVERY_BATCH, unused otherwise.
+	 */
+	const uint32_t param;
+	/** Tick of the last delivery. Internal use only. */
+	int64_t last_tick;
+	/** Publications since the last delivery. Internal use only. */
+	uint32_t count;
+};
+#endif /* CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY */
+
 /**
  * @brief Type used to represent an observer.
  *
@@ -92,6 +143,13 @@ struct zbus_observer {
 	/** Observer message queue. It turns the observer into a subscriber. */
 	struct k_msgq *const queue;
 
+#if defined(CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY) || defined(__DOXYGEN__)
+	/** Delivery policy. When NULL the subscriber is notified on every
+	 * publication.
+	 */
+	struct zbus_delivery_policy *const policy;
+#endif /* CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY */
+
 	/** Observer callback function. It turns the observer into a listener. */
 	void (*const callback)(const struct zbus_channel *chan);
 };
@@ -126,6 +184,10 @@ struct zbus_observer {
 #define _ZBUS_OBS_NAME(_obs) ""
 #endif
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+#define ZBUS_CHANNEL_SEQLOCK_INIT(_name) .seq = &_CONCAT(_zbus_seq_, _name),
+#endif
+
 #if CONFIG_ZBUS_RUNTIME_OBSERVERS_POOL_SIZE > 0
 #define ZBUS_RUNTIME_OBSERVERS_LIST_DECL(_slist_name) static sys_slist_t _slist_name
 #define ZBUS_RUNTIME_OBSERVERS_LIST_INIT(_slist_name) .runtime_observers = &_slist_name,
@@ -192,6 +254,45 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks);
  * @param _init_val The message initialization.
  */
 #define ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val)        \
+	_ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val,       \
+			  /* No sequence counter */)
+
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+/**
+ * @brief Zbus channel definition with lock-free publication.
+ *
+ * This macro defines a channel like ZBUS_CHAN_DEFINE does, but the channel's message is
+ * guarded by a sequence counter instead of the mutex. The publisher never blocks waiting
+ * for readers: it flags the publication in progress by making the counter odd, copies the
+ * message, and makes the counter even again. Readers copy the message and retry the copy
+ * while it races with a publication.
+ *
+ * @warning Channels defined with this macro must have a single publishing thread. The
+ * zbus_chan_pub and zbus_chan_notify functions must never be called concurrently for the
+ * same channel.
+ *
+ * @warning These channels cannot be claimed, so the message reference must not be
+ * accessed directly outside of listener callbacks.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ *
+ * @see struct zbus_channel
+ * @param _observers The observers list. The sequence indicates the priority of the
+ * observer. The first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_DEFINE_SEQLOCK(_name, _type, _validator, _user_data, _observers, _init_val)\
+	static atomic_t _CONCAT(_zbus_seq_, _name);                                          \
+	_ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val,       \
+			  ZBUS_CHANNEL_SEQLOCK_INIT(_name))
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
+/** @cond INTERNAL_HIDDEN */
+#define _ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val,       \
+			  _seq_init)                                                         \
 	static _type _CONCAT(_zbus_message_, _name) = _init_val;                             \
 	static K_MUTEX_DEFINE(_CONCAT(_zbus_mutex_, _name));                                 \
 	ZBUS_RUNTIME_OBSERVERS_LIST_DECL(_CONCAT(_runtime_observers_, _name));               \
@@ -205,9 +306,11 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks);
 		.message = &_CONCAT(_zbus_message_, _name),    /* Reference to the message */\
 		.validator = (_validator),		       /* Validator function */      \
 		.mutex = &_CONCAT(_zbus_mutex_, _name),	       /* Channel's Mutex */         \
+		_seq_init			               /* Sequence counter */        \
 		ZBUS_RUNTIME_OBSERVERS_LIST_INIT(                                            \
 			_CONCAT(_runtime_observers_, _name))   /* Runtime observer list */   \
 		.observers = _CONCAT(_zbus_observers_, _name)} /* Static observer list */
+/** @endcond */
 
 /**
  * @brief Initialize a message.
@@ -241,6 +344,34 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks);
 					       .enabled = true,                                    \
 				       .queue = &_zbus_observer_queue_##_name, .callback = NULL}
 
+#if defined(CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY) || defined(__DOXYGEN__)
+/**
+ * @brief Define and initialize a subscriber with a delivery policy.
+ *
+ * This macro defines an observer of subscriber type like ZBUS_SUBSCRIBER_DEFINE does, and
+ * attaches a delivery policy enforced by the event dispatcher. The policy lets the
+ * subscriber wake at its own cadence instead of once per publication.
+ *
+ * @param[in] _name The subscriber's name.
+ * @param[in] _queue_size The notification queue's size.
+ * @param[in] _policy_type The delivery policy type.
+ * @param[in] _param The delivery policy parameter.
+ *
+ * @see enum zbus_delivery_policy_type
+ */
+#define ZBUS_SUBSCRIBER_DEFINE_WITH_POLICY(_name, _queue_size, _policy_type, _param)               \
+	static struct zbus_delivery_policy _CONCAT(_zbus_policy_, _name) = {                       \
+		.type = (_policy_type), .param = (_param)};                                        \
+	K_MSGQ_DEFINE(_zbus_observer_queue_##_name, sizeof(const struct zbus_channel *),           \
+		      _queue_size, sizeof(const struct zbus_channel *));                           \
+	_ZBUS_STRUCT_DECLARE(zbus_observer,                                                        \
+			     _name) = {ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */             \
+						       .enabled = true,                            \
+					       .policy = &_CONCAT(_zbus_policy_, _name),           \
+					       .queue = &_zbus_observer_queue_##_name,             \
+					       .callback = NULL}
+#endif /* CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY */
+
 /**
  * @brief Define and initialize a listener.
  *
@@ -315,6 +446,7 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
  *                or one of the special values K_NO_WAIT and K_FOREVER.
  *
  * @retval 0 Channel claimed.
+ * @retval -ENOTSUP The channel uses lock-free publication and cannot be claimed.
  * @retval -EBUSY The channel is busy.
  * @retval -EAGAIN Waiting period timed out.
  * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
@@ -333,6 +465,7 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout);
  * @param chan The channel's reference.
  *
  * @retval 0 Channel finished.
+ * @retval -ENOTSUP The channel uses lock-free publication and cannot be claimed.
  * @retval -EPERM The channel was claimed by other thread.
  * @retval -EINVAL The channel's mutex is not locked.
  * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
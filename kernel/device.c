@@ -13,6 +13,89 @@
 extern const struct device __device_start[];
 extern const struct device __device_end[];
 
+#ifdef CONFIG_DEVICE_NAME_LOOKUP_INDEX
+/* Open-addressed hash index over the device names. Slots hold device
+ * handles; DEVICE_HANDLE_NULL marks an empty slot since valid handles
+ * start at 1.
+ */
+static device_handle_t name_index[CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE];
+static bool name_index_built;
+static bool name_index_overflow;
+
+/* FNV-1a */
+static uint32_t device_name_hash(const char *name)
+{
+	uint32_t hash = 0x811c9dc5;
+
+	while (*name != '\0') {
+		hash ^= (uint8_t)*name++;
+		hash *= 0x01000193;
+	}
+
+	return hash;
+}
+
+static void device_name_index_build(void)
+{
+	const struct device *dev;
+
+	for (dev = __device_start; dev < __device_end; dev++) {
+		uint32_t slot = device_name_hash(dev->name) % ARRAY_SIZE(name_index);
+		uint32_t probes;
+
+		for (probes = 0; probes < ARRAY_SIZE(name_index); probes++) {
+			if (name_index[slot] == DEVICE_HANDLE_NULL) {
+				name_index[slot] = device_handle_get(dev);
+				break;
+			}
+			slot = (slot + 1) % ARRAY_SIZE(name_index);
+		}
+
+		if (probes == ARRAY_SIZE(name_index)) {
+			/* Index full; lookups missing the index fall back to
+			 * the linear scan.
+			 */
+			name_index_overflow = true;
+		}
+	}
+
+	name_index_built = true;
+}
+#endif /* CONFIG_DEVICE_NAME_LOOKUP_INDEX */
+
+#ifdef CONFIG_DEVICE_HANDLES_CACHE
+/* Derive the region lengths of each device handles array once. The
+ * region boundaries are fixed at link time; runtime updates (dynamic
+ * power domain membership) only replace values within a region.
+ */
+static void device_handles_cache_build(void)
+{
+	const struct device *dev;
+
+	for (dev = __device_start; dev < __device_end; dev++) {
+		const device_handle_t *rv = dev->handles;
+		uint16_t cnt[3] = {0};
+		size_t region = 0;
+
+		if (rv == NULL) {
+			continue;
+		}
+
+		while (*rv != DEVICE_HANDLE_ENDS) {
+			if (*rv == DEVICE_HANDLE_SEP) {
+				region++;
+			} else {
+				cnt[region]++;
+			}
+			rv++;
+		}
+
+		dev->state->required_cnt = cnt[0];
+		dev->state->injected_cnt = cnt[1];
+		dev->state->supported_cnt = cnt[2];
+	}
+}
+#endif /* CONFIG_DEVICE_HANDLES_CACHE */
 
 /**
  * @brief Initialize state for all static devices.
@@ -28,6 +111,13 @@ void z_device_state_init(void)
 		z_object_init(dev);
 		++dev;
 	}
+
+#ifdef CONFIG_DEVICE_NAME_LOOKUP_INDEX
+	device_name_index_build();
+#endif
+#ifdef CONFIG_DEVICE_HANDLES_CACHE
+	device_handles_cache_build();
+#endif
 }
 
 const struct device *z_impl_device_get_binding(const char *name)
@@ -41,6 +131,35 @@ const struct device *z_impl_device_get_binding(const char *name)
 		return NULL;
 	}
 
+#ifdef CONFIG_DEVICE_NAME_LOOKUP_INDEX
+	if (name_index_built) {
+		uint32_t slot = device_name_hash(name) % ARRAY_SIZE(name_index);
+		uint32_t probes;
+
+		for (probes = 0; probes < ARRAY_SIZE(name_index); probes++) {
+			device_handle_t dh = name_index[slot];
+
+			if (dh == DEVICE_HANDLE_NULL) {
+				break;
+			}
+
+			dev = device_from_handle(dh);
+			if ((dev->name == name) || (strcmp(name, dev->name) == 0)) {
+				return z_device_is_ready(dev) ? dev : NULL;
+			}
+
+			slot = (slot + 1) % ARRAY_SIZE(name_index);
+		}
+
+		if (!name_index_overflow) {
+			/* All devices are in the index; no match means the
+			 * name does not identify a device.
+			 */
+			return NULL;
+		}
+	}
+#endif /* CONFIG_DEVICE_NAME_LOOKUP_INDEX */
+
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
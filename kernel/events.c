@@ -104,12 +104,12 @@ static void k_event_post_internal(struct k_event *event, uint32_t events,
 	/*
 	 * Posting an event has the potential to wake multiple pended threads.
 	 * It is desirable to unpend all affected threads simultaneously. To
-	 * do so, this must be done in three steps as it is unsafe to unpend
+	 * do so, this must be done in two steps as it is unsafe to unpend
 	 * threads from within the _WAIT_Q_FOR_EACH() loop.
 	 *
 	 * 1. Create a linked list of threads to unpend.
-	 * 2. Unpend each of the threads in the linked list
-	 * 3. Ready each of the threads in the linked list
+	 * 2. Unpend and ready the whole list in one pass under the
+	 *    scheduler lock, followed by a single reschedule.
 	 */
 
 	_WAIT_Q_FOR_EACH(&event->wait_q, thread) {
@@ -128,14 +128,7 @@ static void k_event_post_internal(struct k_event *event, uint32_t events,
 	}
 
 	if (head != NULL) {
-		thread = head;
-		do {
-			z_unpend_thread(thread);
-			arch_thread_return_value_set(thread, 0);
-			thread->events = events;
-			z_ready_thread(thread);
-			thread = thread->next_event_link;
-		} while (thread != NULL);
+		z_sched_wake_events(head, events);
 	}
 
 	z_reschedule(&event->lock, key);
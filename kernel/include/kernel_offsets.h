@@ -38,6 +38,10 @@ GEN_OFFSET_SYM(_kernel_t, cpus);
 GEN_OFFSET_SYM(_cpu_t, fp_ctx);
 #endif
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+GEN_OFFSET_SYM(_cpu_t, fpu_owner);
+#endif
+
 #if defined(CONFIG_THREAD_MONITOR)
 GEN_OFFSET_SYM(_kernel_t, threads);
 #endif
@@ -46,7 +50,8 @@ GEN_OFFSET_SYM(_kernel_t, threads);
 GEN_OFFSET_SYM(_kernel_t, idle);
 #endif
 
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && \
+	!defined(CONFIG_SCHED_PER_CPU_QUEUES)
 GEN_OFFSET_SYM(_kernel_t, ready_q);
 #endif
 
@@ -29,6 +29,11 @@
 #define _kernel_offset_to_fp_ctx \
 	(___cpu_t_fp_ctx_OFFSET)
 #endif /* CONFIG_FPU_SHARING */
+
+#if defined(CONFIG_FPU_SHARING_LAZY)
+#define _kernel_offset_to_fpu_owner \
+	(___cpu_t_fpu_owner_OFFSET)
+#endif /* CONFIG_FPU_SHARING_LAZY */
 #endif /* CONFIG_SMP */
 
 #define _kernel_offset_to_idle \
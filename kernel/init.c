@@ -216,6 +216,156 @@ extern volatile uintptr_t __stack_chk_guard;
 __pinned_bss
 bool z_sys_post_kernel;
 
+/**
+ * @brief Run a single init entry and record the result.
+ *
+ * @param entry init entry to run.
+ */
+static void z_sys_init_entry_run(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+	int rc = entry->init(dev);
+
+	if (dev != NULL) {
+		/* Mark device initialized.  If initialization
+		 * failed, record the error condition.
+		 */
+		if (rc != 0) {
+			if (rc < 0) {
+				rc = -rc;
+			}
+			if (rc > UINT8_MAX) {
+				rc = UINT8_MAX;
+			}
+			dev->state->init_res = rc;
+		}
+		dev->state->initialized = true;
+	}
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+static struct {
+	const struct init_entry *entries;
+	size_t count;
+	size_t next;
+	size_t completed;
+	bool sys_init_active;
+} init_parallel;
+
+static K_MUTEX_DEFINE(init_parallel_lock);
+static K_CONDVAR_DEFINE(init_parallel_done);
+
+static struct k_thread init_worker_threads[CONFIG_DEVICE_INIT_PARALLEL_WORKERS];
+static K_KERNEL_STACK_ARRAY_DEFINE(init_worker_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_WORKERS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+
+/* Check whether all devicetree dependencies of a device are initialized.
+ * Dependencies always precede their dependents in the init sequence, so
+ * an unsatisfied dependency is currently running on another worker and
+ * progress is guaranteed.
+ */
+static bool init_deps_ready(const struct device *dev)
+{
+	size_t count = 0;
+	const device_handle_t *handles = device_required_handles_get(dev, &count);
+
+	for (size_t i = 0; i < count; i++) {
+		const struct device *req = device_from_handle(handles[i]);
+
+		if ((req != NULL) && !req->state->initialized) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void init_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&init_parallel_lock, K_FOREVER);
+
+	while (init_parallel.next < init_parallel.count) {
+		const struct init_entry *entry = &init_parallel.entries[init_parallel.next];
+
+		if (init_parallel.sys_init_active) {
+			/* A SYS_INIT entry is running; hold back later
+			 * entries until it completes.
+			 */
+			k_condvar_wait(&init_parallel_done, &init_parallel_lock, K_FOREVER);
+			continue;
+		}
+
+		if (entry->dev == NULL) {
+			/* SYS_INIT entries keep their sequential ordering:
+			 * they run alone, after every earlier entry has
+			 * completed.
+			 */
+			if (init_parallel.completed < init_parallel.next) {
+				k_condvar_wait(&init_parallel_done, &init_parallel_lock,
+					       K_FOREVER);
+				continue;
+			}
+			init_parallel.sys_init_active = true;
+		} else if (!init_deps_ready(entry->dev)) {
+			k_condvar_wait(&init_parallel_done, &init_parallel_lock, K_FOREVER);
+			continue;
+		}
+
+		init_parallel.next++;
+		k_mutex_unlock(&init_parallel_lock);
+
+		z_sys_init_entry_run(entry);
+
+		k_mutex_lock(&init_parallel_lock, K_FOREVER);
+		if (entry->dev == NULL) {
+			init_parallel.sys_init_active = false;
+		}
+		init_parallel.completed++;
+		k_condvar_broadcast(&init_parallel_done);
+	}
+
+	k_mutex_unlock(&init_parallel_lock);
+}
+
+/**
+ * @brief Run an init level on a pool of worker threads.
+ *
+ * Device init functions run concurrently once their devicetree
+ * dependencies are initialized; ordering between devices that is not
+ * expressed in the devicetree is not honored.
+ *
+ * @param start first init entry of the level.
+ * @param end first init entry past the level.
+ */
+static void z_sys_init_run_level_parallel(const struct init_entry *start,
+					  const struct init_entry *end)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	init_parallel.entries = start;
+	init_parallel.count = end - start;
+	init_parallel.next = 0;
+	init_parallel.completed = 0;
+	init_parallel.sys_init_active = false;
+
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_WORKERS; i++) {
+		k_thread_create(&init_worker_threads[i], init_worker_stacks[i],
+				K_KERNEL_STACK_SIZEOF(init_worker_stacks[i]),
+				init_worker, NULL, NULL, NULL,
+				prio, 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_WORKERS; i++) {
+		(void)k_thread_join(&init_worker_threads[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -243,25 +393,15 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
-	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
-		int rc = entry->init(dev);
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if ((level == INIT_LEVEL_POST_KERNEL) || (level == INIT_LEVEL_APPLICATION)) {
+		z_sys_init_run_level_parallel(levels[level], levels[level+1]);
+		return;
+	}
+#endif
 
-		if (dev != NULL) {
-			/* Mark device initialized.  If initialization
-			 * failed, record the error condition.
-			 */
-			if (rc != 0) {
-				if (rc < 0) {
-					rc = -rc;
-				}
-				if (rc > UINT8_MAX) {
-					rc = UINT8_MAX;
-				}
-				dev->state->init_res = rc;
-			}
-			dev->state->initialized = true;
-		}
+	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+		z_sys_init_entry_run(entry);
 	}
 }
 
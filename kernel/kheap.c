@@ -14,10 +14,39 @@ void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
 	z_waitq_init(&h->wait_q);
 	sys_heap_init(&h->heap, mem, bytes);
+#ifdef CONFIG_KHEAP_DEFERRED_FREE
+	atomic_ptr_set(&h->defer_list, NULL);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, h);
 }
 
+#ifdef CONFIG_KHEAP_DEFERRED_FREE
+/* Return every block on the deferred free list to the underlying
+ * sys_heap.  Must be called with the heap lock held; the atomic swap
+ * means concurrent k_heap_free() calls simply start a new list.
+ */
+static void defer_list_drain(struct k_heap *h)
+{
+	void *mem = atomic_ptr_set(&h->defer_list, NULL);
+
+	while (mem != NULL) {
+		void *next = *(void **)mem;
+
+		sys_heap_free(&h->heap, mem);
+		mem = next;
+	}
+}
+
+void k_heap_reclaim(struct k_heap *h)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	defer_list_drain(h);
+	k_spin_unlock(&h->lock, key);
+}
+#endif /* CONFIG_KHEAP_DEFERRED_FREE */
+
 static int statics_init(const struct device *unused)
 {
 	ARG_UNUSED(unused);
@@ -78,6 +107,9 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 	bool blocked_alloc = false;
 
 	while (ret == NULL) {
+#ifdef CONFIG_KHEAP_DEFERRED_FREE
+		defer_list_drain(h);
+#endif
 		ret = sys_heap_aligned_alloc(&h->heap, align, bytes);
 
 		now = sys_clock_tick_get();
@@ -118,6 +150,43 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 	return ret;
 }
 
+#ifdef CONFIG_KHEAP_DEFERRED_FREE
+void k_heap_free(struct k_heap *h, void *mem)
+{
+	void *head;
+
+	if (mem == NULL) {
+		return;
+	}
+
+	/* Push onto the deferred list, reusing the block itself as the
+	 * link.  Every sys_heap allocation is at least one chunk unit,
+	 * which is large enough to hold a pointer (free chunks store
+	 * their list links in the same space).
+	 */
+	do {
+		head = atomic_ptr_get(&h->defer_list);
+		*(void **)mem = head;
+	} while (!atomic_ptr_cas(&h->defer_list, head, mem));
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, h);
+
+	/* The lock below only covers the wait queue, never the heap
+	 * itself, so this stays short and bounded (and is a no-op in
+	 * the common no-waiters case).  Blocked allocators drain the
+	 * deferred list themselves when they retry.
+	 */
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+		k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+		if (z_unpend_all(&h->wait_q) != 0) {
+			z_reschedule(&h->lock, key);
+		} else {
+			k_spin_unlock(&h->lock, key);
+		}
+	}
+}
+#else
 void k_heap_free(struct k_heap *h, void *mem)
 {
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
@@ -131,3 +200,4 @@ void k_heap_free(struct k_heap *h, void *mem)
 		k_spin_unlock(&h->lock, key);
 	}
 }
+#endif /* CONFIG_KHEAP_DEFERRED_FREE */
@@ -101,8 +101,145 @@ out:
 	return rc;
 }
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+
+int k_mem_slab_cache_enable(struct k_mem_slab *slab, uint16_t depth)
+{
+	CHECKIF((depth == 0U) || (depth > slab->num_blocks)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		slab->cpu_cache[i].free_list = NULL;
+		slab->cpu_cache[i].count = 0U;
+	}
+	slab->cache_depth = depth;
+
+	k_spin_unlock(&slab->lock, key);
+
+	return 0;
+}
+
+/* Move up to half a magazine of blocks from the shared free list into
+ * the local cache.  Called with local interrupts locked.
+ */
+static void cache_refill(struct k_mem_slab *slab,
+			 char **cache_list, uint16_t *cache_count)
+{
+	uint16_t batch = MAX(1U, slab->cache_depth / 2U);
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while ((batch > 0U) && (slab->free_list != NULL)) {
+		char *block = slab->free_list;
+
+		slab->free_list = *(char **)block;
+		*(char **)block = *cache_list;
+		*cache_list = block;
+		(*cache_count)++;
+		slab->num_used++;
+		batch--;
+	}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->max_used = MAX(slab->num_used, slab->max_used);
+#endif
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+/* Return half a magazine of blocks to the shared free list.  Called
+ * with local interrupts locked.
+ */
+static void cache_flush(struct k_mem_slab *slab,
+			char **cache_list, uint16_t *cache_count)
+{
+	uint16_t batch = MAX(1U, slab->cache_depth / 2U);
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while ((batch > 0U) && (*cache_list != NULL)) {
+		char *block = *cache_list;
+
+		*cache_list = *(char **)block;
+		*(char **)block = slab->free_list;
+		slab->free_list = block;
+		(*cache_count)--;
+		slab->num_used--;
+		batch--;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+/* Lock-free (with respect to other CPUs) allocation attempt.  Returns
+ * true with *mem set on success; on failure the caller falls back to
+ * the shared slow path.
+ */
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	bool hit = false;
+	unsigned int ik = arch_irq_lock();
+	int cpu = IS_ENABLED(CONFIG_SMP) ? _current_cpu->id : 0;
+	char **cache_list = &slab->cpu_cache[cpu].free_list;
+	uint16_t *cache_count = &slab->cpu_cache[cpu].count;
+
+	if (*cache_list == NULL) {
+		cache_refill(slab, cache_list, cache_count);
+	}
+
+	if (*cache_list != NULL) {
+		*mem = *cache_list;
+		*cache_list = **(char ***)cache_list;
+		(*cache_count)--;
+		hit = true;
+	}
+
+	arch_irq_unlock(ik);
+
+	return hit;
+}
+
+/* As above for the free path; fails when a blocked allocator needs
+ * the shared wakeup logic.
+ */
+static bool cache_free(struct k_mem_slab *slab, void **mem)
+{
+	bool hit = false;
+	unsigned int ik = arch_irq_lock();
+	int cpu = IS_ENABLED(CONFIG_SMP) ? _current_cpu->id : 0;
+	char **cache_list = &slab->cpu_cache[cpu].free_list;
+	uint16_t *cache_count = &slab->cpu_cache[cpu].count;
+
+	if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
+	    (z_waitq_head(&slab->wait_q) == NULL)) {
+		if (*cache_count >= slab->cache_depth) {
+			cache_flush(slab, cache_list, cache_count);
+		}
+
+		**(char ***)mem = *cache_list;
+		*cache_list = *(char **)mem;
+		(*cache_count)++;
+		hit = true;
+	}
+
+	arch_irq_unlock(ik);
+
+	return hit;
+}
+
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if ((slab->cache_depth > 0U) && cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
@@ -147,6 +284,14 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if ((slab->cache_depth > 0U) && cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
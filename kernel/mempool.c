@@ -40,6 +40,36 @@ static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size
 	return mem;
 }
 
+#ifdef CONFIG_HEAP_ALIGNED_ALLOC_POOLS
+/*
+ * Fixed-block pools for the exactly 32- and 64-byte aligned
+ * allocations DMA descriptors typically need. Each block reserves one
+ * alignment unit in front of the payload so the reference word
+ * k_free() expects is present at the usual spot; the slab address is
+ * stored there with its low bit set to tell it apart from a heap
+ * pointer, which is always at least pointer aligned.
+ */
+K_MEM_SLAB_DEFINE_STATIC(z_aligned_pool32, 2 * 32,
+			 CONFIG_HEAP_ALIGNED_ALLOC_POOL32_COUNT, 32);
+K_MEM_SLAB_DEFINE_STATIC(z_aligned_pool64, 2 * 64,
+			 CONFIG_HEAP_ALIGNED_ALLOC_POOL64_COUNT, 64);
+
+static void *z_aligned_pool_alloc(struct k_mem_slab *slab, size_t align)
+{
+	void *block;
+	uintptr_t *ref;
+
+	if (k_mem_slab_alloc(slab, &block, K_NO_WAIT) != 0) {
+		return NULL;
+	}
+
+	ref = (uintptr_t *)((uint8_t *)block + align);
+	ref[-1] = (uintptr_t)slab | 1UL;
+
+	return ref;
+}
+#endif /* CONFIG_HEAP_ALIGNED_ALLOC_POOLS */
+
 void k_free(void *ptr)
 {
 	struct k_heap **heap_ref;
@@ -48,6 +78,20 @@ void k_free(void *ptr)
 		heap_ref = ptr;
 		ptr = --heap_ref;
 
+#ifdef CONFIG_HEAP_ALIGNED_ALLOC_POOLS
+		uintptr_t ref = *(uintptr_t *)heap_ref;
+
+		if ((ref & 1UL) != 0) {
+			struct k_mem_slab *slab =
+				(struct k_mem_slab *)(ref & ~1UL);
+			void *block = (uint8_t *)(heap_ref + 1) -
+				      slab->block_size / 2;
+
+			k_mem_slab_free(slab, &block);
+			return;
+		}
+#endif /* CONFIG_HEAP_ALIGNED_ALLOC_POOLS */
+
 		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_free, *heap_ref, heap_ref);
 
 		k_heap_free(*heap_ref, ptr);
@@ -72,7 +116,20 @@ void *k_aligned_alloc(size_t align, size_t size)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
-	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+	void *ret = NULL;
+
+#ifdef CONFIG_HEAP_ALIGNED_ALLOC_POOLS
+	/* The payload area of a pool block is one alignment unit */
+	if (align == 32 && size <= 32) {
+		ret = z_aligned_pool_alloc(&z_aligned_pool32, 32);
+	} else if (align == 64 && size <= 64) {
+		ret = z_aligned_pool_alloc(&z_aligned_pool64, 64);
+	}
+#endif /* CONFIG_HEAP_ALIGNED_ALLOC_POOLS */
+
+	if (ret == NULL) {
+		ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
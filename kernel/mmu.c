@@ -1457,6 +1457,67 @@ void k_mem_page_in(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_page_in);
 }
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+/* Prefetch requests are queued in a small FIFO drained by a work item on
+ * the system work queue, which pages regions in with the ordinary
+ * synchronous machinery. The faulting work is thus charged to the system
+ * work queue thread, not the requester.
+ */
+struct prefetch_region {
+	void *addr;
+	size_t size;
+};
+
+static struct prefetch_region
+	prefetch_queue[CONFIG_DEMAND_PAGING_PREFETCH_QUEUE_SIZE];
+static int prefetch_head;
+static int prefetch_count;
+static struct k_spinlock prefetch_lock;
+
+static void prefetch_work_handler(struct k_work *work)
+{
+	struct prefetch_region region;
+	k_spinlock_key_t key = k_spin_lock(&prefetch_lock);
+
+	while (prefetch_count > 0) {
+		region = prefetch_queue[prefetch_head];
+		prefetch_head = (prefetch_head + 1) %
+				CONFIG_DEMAND_PAGING_PREFETCH_QUEUE_SIZE;
+		prefetch_count--;
+		k_spin_unlock(&prefetch_lock, key);
+
+		k_mem_page_in(region.addr, region.size);
+
+		key = k_spin_lock(&prefetch_lock);
+	}
+	k_spin_unlock(&prefetch_lock, key);
+}
+
+static K_WORK_DEFINE(prefetch_work, prefetch_work_handler);
+
+int k_mem_page_in_async(void *addr, size_t size)
+{
+	int slot;
+	k_spinlock_key_t key = k_spin_lock(&prefetch_lock);
+
+	if (prefetch_count == CONFIG_DEMAND_PAGING_PREFETCH_QUEUE_SIZE) {
+		k_spin_unlock(&prefetch_lock, key);
+		return -EAGAIN;
+	}
+
+	slot = (prefetch_head + prefetch_count) %
+	       CONFIG_DEMAND_PAGING_PREFETCH_QUEUE_SIZE;
+	prefetch_queue[slot].addr = addr;
+	prefetch_queue[slot].size = size;
+	prefetch_count++;
+	k_spin_unlock(&prefetch_lock, key);
+
+	k_work_submit(&prefetch_work);
+
+	return 0;
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
+
 static void do_mem_pin(void *addr)
 {
 	bool ret;
@@ -1474,9 +1535,69 @@ void k_mem_pin(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_mem_pin);
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+/* Detect sequential fault patterns and pull the pages following the
+ * faulting one in asynchronously through the prefetch queue. Pages the
+ * read-ahead wins never fault, so a streaming consumer faults up to
+ * CONFIG_DEMAND_PAGING_READAHEAD_PAGES ahead of its previous fault;
+ * any fault within that window keeps the pattern alive.
+ */
+#define READAHEAD_BYTES \
+	(CONFIG_DEMAND_PAGING_READAHEAD_PAGES * CONFIG_MMU_PAGE_SIZE)
+
+static uintptr_t readahead_last_fault;
+
+static void page_fault_readahead(void *addr)
+{
+	uintptr_t page = POINTER_TO_UINT(addr) & ~(CONFIG_MMU_PAGE_SIZE - 1);
+	uintptr_t prev = readahead_last_fault;
+	size_t size = 0U;
+	unsigned int key;
+
+	readahead_last_fault = page;
+
+	if ((page <= prev) || ((page - prev) > READAHEAD_BYTES)) {
+		return;
+	}
+
+	/* Extend the window only over pages that are mapped and
+	 * currently evicted; stop at the first resident or unmapped
+	 * page. This bounds the prefetch to useful work and keeps the
+	 * queued region valid for k_mem_page_in().
+	 */
+	key = irq_lock();
+	for (size_t i = 0; i < CONFIG_DEMAND_PAGING_READAHEAD_PAGES; i++) {
+		uintptr_t location;
+		void *pos = UINT_TO_POINTER(page +
+				(i + 1) * CONFIG_MMU_PAGE_SIZE);
+
+		if (arch_page_location_get(pos, &location) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+		size += CONFIG_MMU_PAGE_SIZE;
+	}
+	irq_unlock(key);
+
+	if (size > 0U) {
+		/* Best effort; a full queue simply skips the read-ahead */
+		(void)k_mem_page_in_async(
+			UINT_TO_POINTER(page + CONFIG_MMU_PAGE_SIZE), size);
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
+
 bool z_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	bool ret = do_page_fault(addr, false);
+
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+	if (ret) {
+		page_fault_readahead(addr);
+	}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
+
+	return ret;
 }
 
 static void do_mem_unpin(void *addr)
@@ -54,6 +54,140 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	z_object_init(msgq);
 }
 
+#ifdef CONFIG_MSGQ_MPSC
+
+/* Each MPSC slot is a sequence word followed by the (padded) message
+ * payload.  The sequence implements a bounded Vyukov-style queue:
+ * slot n is free for producer position p when seq == p, published
+ * when seq == p + 1, and recycled by the consumer to p + max_msgs.
+ */
+#define MPSC_STRIDE(msgq) \
+	(sizeof(atomic_t) + ROUND_UP((msgq)->msg_size, sizeof(atomic_t)))
+
+static inline atomic_t *mpsc_slot(struct k_msgq *msgq, uint32_t pos)
+{
+	return (atomic_t *)(msgq->buffer_start +
+			    (pos % msgq->max_msgs) * MPSC_STRIDE(msgq));
+}
+
+void k_msgq_init_mpsc(struct k_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs)
+{
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+	msgq->buffer_end = buffer + (max_msgs * MPSC_STRIDE(msgq));
+	msgq->flags = K_MSGQ_FLAG_MPSC;
+	msgq->mpsc_wr = ATOMIC_INIT(0);
+	msgq->mpsc_rd = 0;
+	msgq->mpsc_waiting = ATOMIC_INIT(0);
+
+	for (uint32_t i = 0; i < max_msgs; i++) {
+		atomic_set(mpsc_slot(msgq, i), (atomic_val_t)i);
+	}
+}
+
+static int mpsc_try_put(struct k_msgq *msgq, const void *data)
+{
+	uint32_t pos = (uint32_t)atomic_get(&msgq->mpsc_wr);
+
+	for (;;) {
+		atomic_t *slot = mpsc_slot(msgq, pos);
+		int32_t dif = (int32_t)((uint32_t)atomic_get(slot) - pos);
+
+		if (dif == 0) {
+			if (atomic_cas(&msgq->mpsc_wr, (atomic_val_t)pos,
+				       (atomic_val_t)(pos + 1U))) {
+				(void)memcpy((char *)&slot[1], data,
+					     msgq->msg_size);
+				atomic_set(slot, (atomic_val_t)(pos + 1U));
+				return 0;
+			}
+		} else if (dif < 0) {
+			return -ENOMSG;
+		}
+
+		pos = (uint32_t)atomic_get(&msgq->mpsc_wr);
+	}
+}
+
+/* Consumer side only */
+static int mpsc_try_get(struct k_msgq *msgq, void *data)
+{
+	atomic_t *slot = mpsc_slot(msgq, msgq->mpsc_rd);
+	int32_t dif = (int32_t)((uint32_t)atomic_get(slot) -
+				(msgq->mpsc_rd + 1U));
+
+	if (dif < 0) {
+		return -ENOMSG;
+	}
+
+	if (data != NULL) {
+		(void)memcpy(data, (const char *)&slot[1], msgq->msg_size);
+	}
+	atomic_set(slot, (atomic_val_t)(msgq->mpsc_rd + msgq->max_msgs));
+	msgq->mpsc_rd++;
+	msgq->used_msgs = (uint32_t)atomic_get(&msgq->mpsc_wr) - msgq->mpsc_rd;
+	return 0;
+}
+
+static int mpsc_put(struct k_msgq *msgq, const void *data)
+{
+	int result = mpsc_try_put(msgq, data);
+
+	if ((result == 0) && (atomic_get(&msgq->mpsc_waiting) != 0)) {
+		/* Serialize the wakeup with the consumer's pend: the
+		 * consumer rechecks the ring under this lock before it
+		 * goes to sleep, so by the time we own the lock it has
+		 * either consumed our message (and cleared the flag) or
+		 * it is on the wait queue and the wakeup cannot be lost.
+		 */
+		k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+		if (atomic_cas(&msgq->mpsc_waiting, 1, 0)) {
+			z_sched_wake(&msgq->wait_q, 0, NULL);
+		}
+
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+static int mpsc_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	int result;
+
+	for (;;) {
+		result = mpsc_try_get(msgq, data);
+		if ((result == 0) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return result;
+		}
+
+		atomic_set(&msgq->mpsc_waiting, 1);
+
+		k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+		/* Recheck under the lock after advertising the flag: a
+		 * producer that sees the flag takes the same lock before
+		 * consuming it, so a message published after this check
+		 * triggers the wakeup only once we are on the wait queue.
+		 */
+		result = mpsc_try_get(msgq, data);
+		if (result == 0) {
+			(void)atomic_clear(&msgq->mpsc_waiting);
+			k_spin_unlock(&msgq->lock, key);
+			return 0;
+		}
+
+		if (z_sched_wait(&msgq->lock, key, &msgq->wait_q,
+				 timeout, NULL) != 0) {
+			(void)atomic_clear(&msgq->mpsc_waiting);
+			return -EAGAIN;
+		}
+	}
+}
+
+#endif /* CONFIG_MSGQ_MPSC */
+
 int z_impl_k_msgq_alloc_init(struct k_msgq *msgq, size_t msg_size,
 			    uint32_t max_msgs)
 {
@@ -121,6 +255,15 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+		result = mpsc_put(msgq, data);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+		return result;
+	}
+#endif
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
@@ -211,6 +354,15 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	struct k_thread *pending_thread;
 	int result;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+		result = mpsc_get(msgq, data, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+		return result;
+	}
+#endif
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
@@ -286,6 +438,25 @@ int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0U) {
+		/* Consumer side only, like mpsc_get() */
+		atomic_t *slot = mpsc_slot(msgq, msgq->mpsc_rd);
+		int32_t dif = (int32_t)((uint32_t)atomic_get(slot) -
+					(msgq->mpsc_rd + 1U));
+
+		result = -ENOMSG;
+		if (dif >= 0) {
+			(void)memcpy(data, (const char *)&slot[1],
+				     msgq->msg_size);
+			result = 0;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, peek, msgq, result);
+		return result;
+	}
+#endif
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > 0U) {
@@ -320,6 +491,19 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	k_spinlock_key_t key;
 	struct k_thread *pending_thread;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0U) {
+		/* Consumer side only: drain published messages so the
+		 * slot sequence words stay coherent with producers.
+		 */
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
+
+		while (mpsc_try_get(msgq, NULL) == 0) {
+		}
+		return;
+	}
+#endif
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
@@ -348,6 +348,209 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+/**
+ * @brief Drain buffered data into any waiting readers' buffers
+ *
+ * Used by the zero-copy write commit path, which deposits data in the
+ * pipe buffer even when readers are pended.
+ *
+ * @return true if a satisfied reader was woken and a reschedule is needed
+ */
+static bool pipe_drain_to_readers(struct k_pipe *pipe)
+{
+	sys_dlist_t        dest_list;
+	struct _pipe_desc *dest;
+	bool               reschedule_needed = false;
+
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_waiter_list_populate(&dest_list, &pipe->wait_q.readers,
+					 pipe->bytes_used);
+
+	dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+	while ((dest != NULL) && (pipe->bytes_used > 0U)) {
+		size_t run = MIN(dest->bytes_to_xfer,
+				 MIN(pipe->bytes_used,
+				     pipe->size - pipe->read_index));
+
+		(void) memcpy(dest->buffer, &pipe->buffer[pipe->read_index],
+			      run);
+
+		dest->buffer        += run;
+		dest->bytes_to_xfer -= run;
+
+		pipe->bytes_used -= run;
+		pipe->read_index += run;
+		if (pipe->read_index >= pipe->size) {
+			pipe->read_index = 0U;
+		}
+
+		if (dest->bytes_to_xfer == 0U) {
+			(void) z_sched_wake(&pipe->wait_q.readers, 0, NULL);
+			reschedule_needed = true;
+			dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+		}
+	}
+
+	return reschedule_needed;
+}
+
+/**
+ * @brief Refill the pipe buffer from any waiting writers' buffers
+ *
+ * Used by the zero-copy read release path, which frees buffer space
+ * without going through pipe_get_internal().
+ *
+ * @return true if a satisfied writer was woken and a reschedule is needed
+ */
+static bool pipe_refill_from_writers(struct k_pipe *pipe)
+{
+	sys_dlist_t        src_list;
+	struct _pipe_desc *src;
+	bool               reschedule_needed = false;
+
+	sys_dlist_init(&src_list);
+
+	(void) pipe_waiter_list_populate(&src_list, &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+	while ((src != NULL) && (pipe->bytes_used < pipe->size)) {
+		size_t run = MIN(src->bytes_to_xfer,
+				 MIN(pipe->size - pipe->bytes_used,
+				     pipe->size - pipe->write_index));
+
+		(void) memcpy(&pipe->buffer[pipe->write_index], src->buffer,
+			      run);
+
+		src->buffer        += run;
+		src->bytes_to_xfer -= run;
+
+		pipe->bytes_used  += run;
+		pipe->write_index += run;
+		if (pipe->write_index >= pipe->size) {
+			pipe->write_index = 0U;
+		}
+
+		if (src->bytes_to_xfer == 0U) {
+			(void) z_sched_wake(&pipe->wait_q.writers, 0, NULL);
+			reschedule_needed = true;
+			src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+		}
+	}
+
+	return reschedule_needed;
+}
+
+size_t k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	size_t claimed = 0U;
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	if ((pipe->buffer != NULL) && (pipe->bytes_used < pipe->size)) {
+		size_t contig = (pipe->write_index >= pipe->read_index) ?
+				pipe->size - pipe->write_index :
+				pipe->read_index - pipe->write_index;
+
+		if ((pipe->write_index == pipe->read_index) &&
+		    (pipe->bytes_used != 0U)) {
+			contig = 0U;
+		}
+
+		claimed = MIN(size, contig);
+		*data = &pipe->buffer[pipe->write_index];
+	} else {
+		*data = NULL;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return claimed;
+}
+
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size)
+{
+	bool reschedule_needed;
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(size > pipe->size - pipe->bytes_used) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->bytes_used  += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	reschedule_needed = pipe_drain_to_readers(pipe);
+
+	if (pipe->bytes_used != 0U) {
+		handle_poll_events(pipe);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+size_t k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	size_t claimed = 0U;
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	if ((pipe->buffer != NULL) && (pipe->bytes_used != 0U)) {
+		size_t contig = (pipe->read_index < pipe->write_index) ?
+				pipe->write_index - pipe->read_index :
+				pipe->size - pipe->read_index;
+
+		claimed = MIN(size, contig);
+		*data = &pipe->buffer[pipe->read_index];
+	} else {
+		*data = NULL;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return claimed;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size)
+{
+	bool reschedule_needed;
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(size > pipe->bytes_used) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	reschedule_needed = pipe_refill_from_writers(pipe);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 		     size_t *bytes_written, size_t min_xfer,
 		      k_timeout_t timeout)
@@ -23,6 +23,7 @@
 #include <zephyr/sys/dlist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/check.h>
 #include <stdbool.h>
 
 /* Single subsystem lock.  Locking per-event would be better on highly
@@ -34,7 +35,7 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_REGISTERED };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
@@ -113,17 +114,23 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 {
 	struct k_poll_event *pending;
 
+	/* Poll set pollers are not backed by a thread, so they carry no
+	 * priority to order on: they go at the tail and are skipped when
+	 * ordering thread pollers.
+	 */
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || (poller->mode == MODE_REGISTERED) ||
+		((pending->poller->mode != MODE_REGISTERED) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if ((pending->poller->mode != MODE_REGISTERED) &&
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -440,6 +447,129 @@ oops_free:
 #include <syscalls/k_poll_mrsh.c>
 #endif
 
+int k_poll_set_init(struct k_poll_set *set)
+{
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_REGISTERED;
+
+	return 0;
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	CHECKIF(event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	if (is_condition_met(event, &state)) {
+		event->state |= state;
+		event->poller = &set->poller;
+		sys_dlist_append(&set->ready, &event->_node);
+		(void)z_sched_wake(&set->wait_q, 0, NULL);
+	} else {
+		register_event(event, &set->poller);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	CHECKIF(event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	/* Unlinks from either the object's poll_events list or the
+	 * set's ready list, whichever the event is on.
+	 */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_ready, k_timeout_t timeout)
+{
+	struct k_poll_event *event;
+	sys_dlist_t batch;
+	int n = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL output array\n");
+	__ASSERT(max_ready > 0, "output array cannot hold an event\n");
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		int swap_rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+
+		if (swap_rc != 0) {
+			return swap_rc;
+		}
+
+		/* Another waiter may have consumed the wakeup; recheck */
+		key = k_spin_lock(&lock);
+	}
+
+	/* Deliver from a snapshot so that an event whose condition still
+	 * holds can go straight back onto the ready list without being
+	 * handed out twice in this call.
+	 */
+	sys_dlist_init(&batch);
+	while ((event = (struct k_poll_event *)
+			sys_dlist_get(&set->ready)) != NULL) {
+		sys_dlist_append(&batch, &event->_node);
+	}
+
+	while ((event = (struct k_poll_event *)sys_dlist_get(&batch)) != NULL) {
+		uint32_t state;
+
+		if (n >= max_ready) {
+			/* No room left: keep it ready for the next call */
+			sys_dlist_append(&set->ready, &event->_node);
+			continue;
+		}
+
+		ready[n] = event;
+		n++;
+
+		/* Level-triggered: stay ready while the condition holds,
+		 * otherwise re-arm and wait for the object's next signal.
+		 */
+		if (is_condition_met(event, &state)) {
+			event->state |= state;
+			sys_dlist_append(&set->ready, &event->_node);
+		} else {
+			register_event(event, &set->poller);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return n;
+}
+
 /* must be called with interrupts locked */
 static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 {
@@ -451,6 +581,19 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_REGISTERED) {
+			struct k_poll_set *set =
+				CONTAINER_OF(poller, struct k_poll_set, poller);
+
+			/* The caller already unlinked the event from the
+			 * object's poll_events list; queue it for delivery
+			 * and wake a waiter, but keep the poller binding so
+			 * the event stays registered with the set.
+			 */
+			event->state |= state;
+			sys_dlist_append(&set->ready, &event->_node);
+			(void)z_sched_wake(&set->wait_q, 0, NULL);
+			return 0;
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -226,6 +226,153 @@ static ALWAYS_INLINE void *curr_cpu_runq(void)
 #endif
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_QUEUES
+
+static ALWAYS_INLINE void *cpu_runq(int cpu)
+{
+	return &_kernel.cpus[cpu].ready_q.runq;
+}
+
+/* May this thread run on the given CPU? */
+static ALWAYS_INLINE bool runq_cpu_ok(struct k_thread *thread, int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0U;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif
+}
+
+#ifdef CONFIG_SCHED_DEADLINE_PLACEMENT
+/* Amount of work standing between @thread and @cpu: the queued
+ * threads that would run ahead of it (the DUMB queue is sorted by
+ * effective priority, so that is its insertion offset) plus the
+ * thread currently executing there, if it also beats @thread.  The
+ * cpu->current read is racy by design; a stale value just skews a
+ * heuristic that work stealing corrects anyway.
+ */
+static ALWAYS_INLINE int edf_cpu_load(struct k_thread *thread, int cpu)
+{
+	sys_dlist_t *pq = cpu_runq(cpu);
+	struct k_thread *t;
+	int load = 0;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(pq, t, base.qnode_dlist) {
+		if (z_sched_prio_cmp(thread, t) > 0) {
+			break;
+		}
+		load++;
+	}
+
+	t = _kernel.cpus[cpu].current;
+	if ((t != NULL) && !z_is_idle_thread_object(t) &&
+	    (z_sched_prio_cmp(thread, t) <= 0)) {
+		load++;
+	}
+
+	return load;
+}
+
+/* Admission step for deadline threads: pick the permitted CPU with
+ * the most slack, i.e. the least work ahead of the thread.  Scanning
+ * starts from the waking CPU so ties keep locality.  Returns -1 when
+ * the thread has no permitted CPU, leaving the caller's fallback to
+ * deal with the empty mask.
+ */
+static ALWAYS_INLINE int edf_place(struct k_thread *thread, int this_cpu)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int best_cpu = -1;
+	int best_load = INT_MAX;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		int cpu = (int)(((unsigned int)this_cpu + i) % num_cpus);
+		int load;
+
+		if (!runq_cpu_ok(thread, cpu)) {
+			continue;
+		}
+
+		load = edf_cpu_load(thread, cpu);
+		if (load < best_load) {
+			best_load = load;
+			best_cpu = cpu;
+		}
+	}
+
+	return best_cpu;
+}
+#endif /* CONFIG_SCHED_DEADLINE_PLACEMENT */
+
+static ALWAYS_INLINE void runq_add(struct k_thread *thread)
+{
+	int cpu = _current_cpu->id;
+
+#ifdef CONFIG_SCHED_DEADLINE_PLACEMENT
+	int edf_cpu = (thread->base.prio_deadline != 0U) ?
+		edf_place(thread, cpu) : -1;
+
+	if (edf_cpu >= 0) {
+		cpu = edf_cpu;
+	} else
+#endif
+	/* Queue on the waking CPU for locality, falling back to the
+	 * lowest numbered allowed CPU when the mask excludes us.
+	 */
+	if (!runq_cpu_ok(thread, cpu)) {
+#ifdef CONFIG_SCHED_CPU_MASK
+		uint32_t m = thread->base.cpu_mask;
+
+		cpu = (m == 0U) ? 0 : (int)u32_count_trailing_zeros(m);
+#endif
+	}
+
+	thread->base.runq_cpu = (uint8_t)cpu;
+	_priq_run_add(cpu_runq(cpu), thread);
+}
+
+static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
+{
+	_priq_run_remove(cpu_runq(thread->base.runq_cpu), thread);
+}
+
+/* Return the highest priority runnable thread, stealing it from a
+ * peer CPU's queue when it beats everything queued locally.  Called
+ * with sched_spinlock held, so migrating the winner is safe.
+ */
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	int this_cpu = _current_cpu->id;
+	unsigned int num_cpus = arch_num_cpus();
+	struct k_thread *best = _priq_run_best(cpu_runq(this_cpu));
+
+	for (int cpu = 0; cpu < num_cpus; cpu++) {
+		struct k_thread *t;
+
+		if (cpu == this_cpu) {
+			continue;
+		}
+
+		t = _priq_run_best(cpu_runq(cpu));
+		if ((t != NULL) && runq_cpu_ok(t, this_cpu) &&
+		    ((best == NULL) || (z_sched_prio_cmp(t, best) > 0))) {
+			best = t;
+		}
+	}
+
+	if ((best != NULL) && (best->base.runq_cpu != this_cpu)) {
+		_priq_run_remove(cpu_runq(best->base.runq_cpu), best);
+		best->base.runq_cpu = (uint8_t)this_cpu;
+		_priq_run_add(cpu_runq(this_cpu), best);
+	}
+
+	return best;
+}
+
+#else /* !CONFIG_SCHED_PER_CPU_QUEUES */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	_priq_run_add(thread_runq(thread), thread);
@@ -241,6 +388,8 @@ static ALWAYS_INLINE struct k_thread *runq_best(void)
 	return _priq_run_best(curr_cpu_runq());
 }
 
+#endif /* CONFIG_SCHED_PER_CPU_QUEUES */
+
 /* _current is never in the run queue until context switch on
  * SMP configurations, see z_requeue_current()
  */
@@ -281,12 +430,24 @@ static void signal_pending_ipi(void)
 	 * this code.
 	 */
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+#ifdef CONFIG_SCHED_IPI_TARGETED
+	uint32_t ipi_mask = (uint32_t)atomic_clear(&_kernel.pending_ipi_mask);
+
+	if (ipi_mask != 0U) {
+#ifdef CONFIG_SCHED_DIRECTED_IPI_SUPPORTED
+		arch_sched_directed_ipi(ipi_mask);
+#else
+		arch_sched_ipi();
+#endif
+	}
+#else
 	if (arch_num_cpus() > 1) {
 		if (_kernel.pending_ipi) {
 			_kernel.pending_ipi = false;
 			arch_sched_ipi();
 		}
 	}
+#endif /* CONFIG_SCHED_IPI_TARGETED */
 #endif
 }
 
@@ -607,12 +768,50 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	return false;
 }
 
-static void flag_ipi(void)
+static void flag_ipi(struct k_thread *thread)
 {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+#ifdef CONFIG_SCHED_IPI_TARGETED
+	uint32_t ipi_mask = 0U;
+	unsigned int num_cpus = arch_num_cpus();
+
+	/* Only CPUs executing a thread the readied one beats (and that
+	 * it is allowed to run on) need to reschedule. Reading
+	 * cpu->current without the remote CPU's cooperation is racy,
+	 * but a CPU switching away concurrently picks its next thread
+	 * with this one already queued, so a missed mark is harmless.
+	 */
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+
+		if (cpu == _current_cpu) {
+			/* This CPU reschedules on its own */
+			continue;
+		}
+
+		if ((cpu->current == NULL) ||
+		    (z_sched_prio_cmp(thread, cpu->current) > 0)) {
+			ipi_mask |= BIT(i);
+		}
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	ipi_mask &= thread->base.cpu_mask;
+#endif
+
+	if (ipi_mask != 0U) {
+		(void)atomic_or(&_kernel.pending_ipi_mask,
+				(atomic_val_t)ipi_mask);
+	}
+#else
+	ARG_UNUSED(thread);
+
 	if (arch_num_cpus() > 1) {
 		_kernel.pending_ipi = true;
 	}
+#endif /* CONFIG_SCHED_IPI_TARGETED */
+#else
+	ARG_UNUSED(thread);
 #endif
 }
 
@@ -630,7 +829,7 @@ static void ready_thread(struct k_thread *thread)
 
 		queue_thread(thread);
 		update_cache(0);
-		flag_ipi();
+		flag_ipi(thread);
 	}
 }
 
@@ -898,6 +1097,29 @@ void z_unpend_thread(struct k_thread *thread)
 	(void)z_abort_thread_timeout(thread);
 }
 
+#ifdef CONFIG_EVENTS
+void z_sched_wake_events(struct k_thread *head, uint32_t events)
+{
+	/* Wake a chain of event waiters (linked through
+	 * next_event_link) in a single pass under the scheduler lock,
+	 * rather than paying a separate z_unpend_thread() plus
+	 * z_ready_thread() lock round trip per thread.
+	 */
+	LOCKED(&sched_spinlock) {
+		for (struct k_thread *thread = head; thread != NULL;
+		     thread = thread->next_event_link) {
+			unpend_thread_no_timeout(thread);
+			(void)z_abort_thread_timeout(thread);
+			arch_thread_return_value_set(thread, 0);
+			thread->events = events;
+			if (!thread_active_elsewhere(thread)) {
+				ready_thread(thread);
+			}
+		}
+	}
+}
+#endif /* CONFIG_EVENTS */
+
 /* Priority set utility that does no rescheduling, it just changes the
  * run queue state, returning true if a reschedule is needed later.
  */
@@ -932,7 +1154,7 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-	flag_ipi();
+	flag_ipi(thread);
 
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
@@ -1189,21 +1411,21 @@ void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *thread)
 	 * a latency glitch to loop over all the threads like this.
 	 */
 	if (!pq->next_order_key) {
-		RB_FOR_EACH_CONTAINER(&pq->tree, t, base.qnode_rb) {
+		RB_FOR_EACH_CONTAINER(&pq->tree.tree, t, base.qnode_rb) {
 			t->base.order_key = pq->next_order_key++;
 		}
 	}
 
-	rb_insert(&pq->tree, &thread->base.qnode_rb);
+	rb_cached_insert(&pq->tree, &thread->base.qnode_rb);
 }
 
 void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
-	rb_remove(&pq->tree, &thread->base.qnode_rb);
+	rb_cached_remove(&pq->tree, &thread->base.qnode_rb);
 
-	if (!pq->tree.root) {
+	if (!pq->tree.tree.root) {
 		pq->next_order_key = 0;
 	}
 }
@@ -1211,7 +1433,7 @@ void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread)
 struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 {
 	struct k_thread *thread = NULL;
-	struct rbnode *n = rb_get_min(&pq->tree);
+	struct rbnode *n = rb_cached_get_min(&pq->tree);
 
 	if (n != NULL) {
 		thread = CONTAINER_OF(n, struct k_thread, base.qnode_rb);
@@ -1280,7 +1502,9 @@ void init_ready_q(struct _ready_q *rq)
 #if defined(CONFIG_SCHED_SCALABLE)
 	rq->runq = (struct _priq_rb) {
 		.tree = {
-			.lessthan_fn = z_priq_rb_lessthan,
+			.tree = {
+				.lessthan_fn = z_priq_rb_lessthan,
+			}
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
@@ -1294,7 +1518,8 @@ void init_ready_q(struct _ready_q *rq)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || \
+	defined(CONFIG_SCHED_PER_CPU_QUEUES)
 	unsigned int num_cpus = arch_num_cpus();
 
 	for (int i = 0; i < num_cpus; i++) {
@@ -1534,7 +1759,7 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-	flag_ipi();
+	flag_ipi(thread);
 
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
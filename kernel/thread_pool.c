@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <ksched.h>
+
+static void pool_entry_point(void *p1, void *p2, void *p3)
+{
+	struct k_thread_pool_entry *pe = p1;
+	struct k_thread_pool *pool = pe->pool;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	pe->entry(pe->p1, pe->p2, pe->p3);
+
+	/* Recycle the entry before terminating.  The thread object and
+	 * stack remain in use until the abort below us has switched out
+	 * for the last time, so the allocation side joins the previous
+	 * occupant before reusing an entry.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+
+	sys_slist_append(&pool->free, &pe->node);
+	k_spin_unlock(&pool->lock, key);
+}
+
+/* Link the statically defined entries into the free list on first
+ * use; called with the pool lock held.
+ */
+static void pool_init(struct k_thread_pool *pool)
+{
+	if (likely(pool->initialized)) {
+		return;
+	}
+
+	sys_slist_init(&pool->free);
+	for (uint16_t i = 0; i < pool->num_entries; i++) {
+		pool->entries[i].pool = pool;
+		sys_slist_append(&pool->free, &pool->entries[i].node);
+	}
+	pool->initialized = true;
+}
+
+k_tid_t k_thread_create_from_pool(struct k_thread_pool *pool,
+				  k_thread_entry_t entry,
+				  void *p1, void *p2, void *p3,
+				  int prio, uint32_t options,
+				  k_timeout_t delay)
+{
+	struct k_thread_pool_entry *pe;
+	sys_snode_t *node;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&pool->lock);
+	pool_init(pool);
+	node = sys_slist_get(&pool->free);
+	k_spin_unlock(&pool->lock, key);
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	pe = CONTAINER_OF(node, struct k_thread_pool_entry, node);
+
+	if (pe->used) {
+		/* The previous occupant pushed itself back just before
+		 * aborting and may not have switched out yet; joining
+		 * guarantees the thread object and stack are really
+		 * idle.  An ISR cannot wait for a not-quite-dead entry,
+		 * so put it back and report exhaustion.
+		 */
+		int ret = k_thread_join(&pe->thread,
+					arch_is_in_isr() ? K_NO_WAIT : K_FOREVER);
+
+		if (ret != 0) {
+			key = k_spin_lock(&pool->lock);
+			sys_slist_append(&pool->free, &pe->node);
+			k_spin_unlock(&pool->lock, key);
+			return NULL;
+		}
+	}
+
+	pe->used = true;
+	pe->entry = entry;
+	pe->p1 = p1;
+	pe->p2 = p2;
+	pe->p3 = p3;
+
+	return k_thread_create(&pe->thread, pe->stack, pool->stack_size,
+			       pool_entry_point, pe, NULL, NULL,
+			       prio, options, delay);
+}
@@ -14,7 +14,9 @@
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +38,185 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+static int32_t elapsed(void)
+{
+	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+}
+
+#ifdef CONFIG_TIMEOUT_EXPIRY_CACHE
+/* Copy of the nearest deadline, published with a seqlock so that
+ * z_get_next_timeout_expiry() can read it without timeout_lock.
+ * Writers run under timeout_lock: when a new earliest timeout is
+ * armed and at the end of every announcement.  Timeouts that fire or
+ * are aborted deliberately do not update the cache, so it may lag on
+ * the early side (never the late side): the reader can under- but
+ * never overestimate how far away the next deadline is.
+ */
+static atomic_t expiry_cache_seq;
+static uint64_t expiry_cache_next; /* absolute tick, UINT64_MAX = none */
+static uint64_t expiry_cache_base; /* curr_tick at publication */
+
+/* Called with timeout_lock held */
+static void expiry_cache_publish(int32_t next_ticks)
+{
+	uint64_t next = (next_ticks == (int32_t)K_TICKS_FOREVER) ?
+		UINT64_MAX : curr_tick + (uint64_t)MAX(0, next_ticks);
+
+	(void)atomic_inc(&expiry_cache_seq);
+	expiry_cache_next = next;
+	expiry_cache_base = curr_tick;
+	(void)atomic_inc(&expiry_cache_seq);
+}
+#else
+static inline void expiry_cache_publish(int32_t next_ticks)
+{
+	ARG_UNUSED(next_ticks);
+}
+#endif /* CONFIG_TIMEOUT_EXPIRY_CACHE */
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/* Hierarchical timer wheel.  Timeouts store their absolute expiry
+ * tick in dticks (CONFIG_TIMEOUT_64BIT is required, so no overflow)
+ * and hash into an unsorted per-level slot list, making arming and
+ * aborting O(1).  Timeouts beyond the wheel horizon are parked in the
+ * furthest slot and rehashed as the wheel turns underneath them.
+ */
+#define WHEEL_LEVELS 4
+#define WHEEL_BITS   CONFIG_TIMEOUT_WHEEL_SLOT_BITS
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   ((uint64_t)(WHEEL_SLOTS - 1))
+#define WHEEL_HORIZON ((uint64_t)1 << (WHEEL_LEVELS * WHEEL_BITS))
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static bool wheel_ready;
+
+/* One bit per slot marking the slots that may hold entries, so the
+ * next-event scan below never has to walk empty slots (or any entry at
+ * all).  Bits are set on insert and cleared when a slot is drained;
+ * aborting a timeout leaves its bit behind, to be cleared lazily the
+ * next time the slot is scanned.
+ */
+#define WHEEL_OCC_WORDS (((WHEEL_SLOTS) + 31) / 32)
+
+static uint32_t wheel_occ[WHEEL_LEVELS][WHEEL_OCC_WORDS];
+
+/* Tick of the next wheel event: either the expiry of the nearest
+ * level-0 entry or the opening of the nearest occupied higher-level
+ * window (whose entries then cascade down and get reprogrammed).
+ * Recomputed lazily from the occupancy bitmaps.
+ */
+static uint64_t next_event = UINT64_MAX;
+static bool next_event_valid = true;
+
+static void wheel_occ_set(int level, uint32_t slot)
+{
+	wheel_occ[level][slot / 32] |= BIT(slot % 32);
+}
+
+static void wheel_occ_clear(int level, uint32_t slot)
+{
+	wheel_occ[level][slot / 32] &= ~BIT(slot % 32);
+}
+
+static void wheel_init(void)
+{
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			sys_dlist_init(&wheel[level][slot]);
+		}
+	}
+	wheel_ready = true;
+}
+
+/* Next tick at which the given slot is serviced: for level 0 the tick
+ * its entries expire, for higher levels the tick its window opens and
+ * its entries cascade down a level.
+ */
+static uint64_t wheel_slot_event(int level, uint32_t slot)
+{
+	int shift = level * WHEEL_BITS;
+	uint64_t period = (uint64_t)1 << (shift + WHEEL_BITS);
+	uint64_t target = (uint64_t)slot << shift;
+
+	return curr_tick + ((target - curr_tick) & (period - 1U));
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	/* A zero delta happens when cascading an entry whose expiry
+	 * lands exactly on the window boundary being opened: it goes
+	 * into the current level-0 slot, which sys_clock_announce()
+	 * drains after the cascade, so it still fires on time.
+	 */
+	uint64_t delta = expiry > curr_tick ? expiry - curr_tick : 0U;
+	uint64_t slot_tick = curr_tick + MIN(delta, WHEEL_HORIZON - 1U);
+	uint32_t slot;
+	int level = 0;
+
+	while ((level < WHEEL_LEVELS - 1) &&
+	       ((slot_tick - curr_tick) >=
+		((uint64_t)1 << ((level + 1) * WHEEL_BITS)))) {
+		level++;
+	}
+
+	slot = (uint32_t)((slot_tick >> (level * WHEEL_BITS)) & WHEEL_MASK);
+
+	sys_dlist_append(&wheel[level][slot], &to->node);
+	wheel_occ_set(level, slot);
+
+	if (next_event_valid) {
+		next_event = MIN(next_event, wheel_slot_event(level, slot));
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+
+	if ((uint64_t)t->dticks <= next_event) {
+		next_event_valid = false;
+	}
+}
+
+static uint64_t wheel_next_event(void)
+{
+	if (!next_event_valid) {
+		next_event = UINT64_MAX;
+
+		for (int level = 0; level < WHEEL_LEVELS; level++) {
+			for (int word = 0; word < WHEEL_OCC_WORDS; word++) {
+				uint32_t bits = wheel_occ[level][word];
+
+				while (bits != 0U) {
+					uint32_t slot = (uint32_t)(word * 32) +
+						(uint32_t)(find_lsb_set(bits) - 1);
+
+					bits &= bits - 1U;
+
+					if (sys_dlist_is_empty(&wheel[level][slot])) {
+						/* Stale bit left by an
+						 * aborted timeout
+						 */
+						wheel_occ_clear(level, slot);
+						continue;
+					}
+
+					next_event = MIN(next_event,
+							 wheel_slot_event(level,
+									  slot));
+				}
+			}
+		}
+		next_event_valid = true;
+	}
+
+	return next_event;
+}
+
+#else /* !CONFIG_TIMEOUT_WHEEL */
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,23 +240,36 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
-{
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
-}
+#endif /* CONFIG_TIMEOUT_WHEEL */
 
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	/* This may be a cascade event rather than an actual expiry, in
+	 * which case the announcement it triggers rehashes the entries
+	 * and programs the clock for their real deadline.
+	 */
+	uint64_t event = wheel_next_event();
+
+	if ((event == UINT64_MAX) ||
+	    ((int64_t)(event - curr_tick - ticks_elapsed) > (int64_t)INT_MAX)) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, (int64_t)(event - curr_tick) - ticks_elapsed);
+	}
+#else
+	struct _timeout *to = first();
+
 	if ((to == NULL) ||
 	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
 		ret = MAX(0, to->dticks - ticks_elapsed);
 	}
+#endif
 
 #ifdef CONFIG_TIMESLICING
 	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
@@ -100,6 +294,25 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	LOCKED(&timeout_lock) {
+#ifdef CONFIG_TIMEOUT_WHEEL
+		uint64_t event_before;
+
+		if (!wheel_ready) {
+			wheel_init();
+		}
+
+		if (Z_TICK_ABS(timeout.ticks) >= 0) {
+			to->dticks = MAX(curr_tick + 1,
+					 (uint64_t)Z_TICK_ABS(timeout.ticks));
+		} else {
+			to->dticks = curr_tick + timeout.ticks + 1 + elapsed();
+		}
+
+		event_before = wheel_next_event();
+		wheel_insert(to);
+
+		if (wheel_next_event() < event_before) {
+#else
 		struct _timeout *t;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
@@ -125,6 +338,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		}
 
 		if (to == first()) {
+#endif /* CONFIG_TIMEOUT_WHEEL */
 #if CONFIG_TIMESLICING
 			/*
 			 * This is not ideal, since it does not
@@ -136,12 +350,16 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			 */
 			int32_t next_time = next_timeout();
 
+			expiry_cache_publish(next_time);
 			if (next_time == 0 ||
 			    _current_cpu->slice_ticks != next_time) {
 				sys_clock_set_timeout(next_time, false);
 			}
 #else
-			sys_clock_set_timeout(next_timeout(), false);
+			int32_t next_time = next_timeout();
+
+			expiry_cache_publish(next_time);
+			sys_clock_set_timeout(next_time, false);
 #endif	/* CONFIG_TIMESLICING */
 		}
 	}
@@ -170,6 +388,11 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	ticks = (k_ticks_t)((uint64_t)timeout->dticks - curr_tick);
+
+	return ticks - elapsed();
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
@@ -178,6 +401,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks - elapsed();
+#endif
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -204,12 +428,38 @@ k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 
 int32_t z_get_next_timeout_expiry(void)
 {
+#ifdef CONFIG_TIMEOUT_EXPIRY_CACHE
+	uint32_t seq;
+	uint64_t next, base;
+
+	do {
+		seq = (uint32_t)atomic_get(&expiry_cache_seq);
+		next = expiry_cache_next;
+		base = expiry_cache_base;
+	} while (((seq & 1U) != 0U) ||
+		 (seq != (uint32_t)atomic_get(&expiry_cache_seq)));
+
+	if (next == UINT64_MAX) {
+		return MAX_WAIT;
+	}
+
+	/* Relative to the tick the cache was published against; at
+	 * most one tick conservative since the cache is refreshed on
+	 * every announcement.
+	 */
+	if ((next - base) > (uint64_t)INT_MAX) {
+		return MAX_WAIT;
+	}
+
+	return (int32_t)(next - base);
+#else
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
 
 	LOCKED(&timeout_lock) {
 		ret = next_timeout();
 	}
 	return ret;
+#endif /* CONFIG_TIMEOUT_EXPIRY_CACHE */
 }
 
 void z_set_timeout_expiry(int32_t ticks, bool is_idle)
@@ -258,6 +508,71 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	while (announce_remaining > 0) {
+		curr_tick++;
+		announce_remaining--;
+
+		/* Rehash higher-level slots whose window opens at this
+		 * tick; entries either drop to a lower level or fire
+		 * from level 0 below.
+		 */
+		for (int level = 1; wheel_ready && (level < WHEEL_LEVELS);
+		     level++) {
+			sys_dlist_t pending;
+			sys_dnode_t *n;
+			uint32_t idx;
+
+			if ((curr_tick &
+			     (((uint64_t)1 << (level * WHEEL_BITS)) - 1U))
+			    != 0U) {
+				break;
+			}
+
+			idx = (uint32_t)((curr_tick >> (level * WHEEL_BITS)) &
+					 WHEEL_MASK);
+
+			/* Drain fully before rehashing: a parked
+			 * long-range entry may hash right back into
+			 * this slot.
+			 */
+			sys_dlist_init(&pending);
+			while ((n = sys_dlist_get(&wheel[level][idx])) != NULL) {
+				sys_dlist_append(&pending, n);
+			}
+			wheel_occ_clear(level, idx);
+
+			while ((n = sys_dlist_get(&pending)) != NULL) {
+				wheel_insert(CONTAINER_OF(n, struct _timeout,
+							  node));
+			}
+		}
+
+		if (wheel_ready) {
+			uint32_t idx = (uint32_t)(curr_tick & WHEEL_MASK);
+			sys_dlist_t *slot = &wheel[0][idx];
+			sys_dnode_t *n;
+
+			while ((n = sys_dlist_get(slot)) != NULL) {
+				struct _timeout *t =
+					CONTAINER_OF(n, struct _timeout, node);
+
+				k_spin_unlock(&timeout_lock, key);
+				t->fn(t);
+				key = k_spin_lock(&timeout_lock);
+			}
+			wheel_occ_clear(0, idx);
+		}
+	}
+
+	if (wheel_ready) {
+		/* The cached event may just have been serviced (fired
+		 * or cascaded away); recompute from the occupancy
+		 * bitmaps before reprogramming the clock below.
+		 */
+		next_event_valid = false;
+	}
+#else
 	struct _timeout *t = first();
 
 	for (t = first();
@@ -281,8 +596,12 @@ void sys_clock_announce(int32_t ticks)
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+	int32_t next_time = next_timeout();
 
-	sys_clock_set_timeout(next_timeout(), false);
+	expiry_cache_publish(next_time);
+	sys_clock_set_timeout(next_time, false);
 
 	k_spin_unlock(&timeout_lock, key);
 }
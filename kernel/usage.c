@@ -16,7 +16,41 @@
 #error "No data backend configured for CONFIG_SCHED_THREAD_USAGE"
 #endif
 
+#if !defined(CONFIG_SCHED_THREAD_USAGE_LOCKLESS) || \
+	defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 static struct k_spinlock usage_lock;
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+/* Usage counters are only ever written by their owning CPU (for thread
+ * counters, the CPU the thread is running on) with interrupts locked, so
+ * writers need no lock against each other. Each counter carries a
+ * seqlock sequence word, odd while an update is in flight, letting
+ * readers on other CPUs retry instead of contending on usage_lock.
+ */
+static ALWAYS_INLINE void usage_write_begin(struct k_cycle_stats *stats)
+{
+	(void)atomic_inc(&stats->seq);
+}
+
+static ALWAYS_INLINE void usage_write_end(struct k_cycle_stats *stats)
+{
+	(void)atomic_inc(&stats->seq);
+}
+
+static uint64_t usage_total_get(struct k_cycle_stats *stats)
+{
+	atomic_val_t seq;
+	uint64_t total;
+
+	do {
+		seq = atomic_get(&stats->seq);
+		total = stats->total;
+	} while ((seq != atomic_get(&stats->seq)) || ((seq & 1) != 0));
+
+	return total;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LOCKLESS */
 
 static uint32_t usage_now(void)
 {
@@ -96,6 +130,36 @@ void z_sched_usage_start(struct k_thread *thread)
 #endif
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+void z_sched_usage_stop(void)
+{
+	/* Only ever called by the owning CPU with interrupts locked in
+	 * the context switch path, so no lock is needed: the seqlock
+	 * counters exist solely so remote readers snapshot consistently.
+	 */
+	struct _cpu *cpu = _current_cpu;
+
+	uint32_t u0 = cpu->usage0;
+
+	if (u0 != 0) {
+		uint32_t cycles = usage_now() - u0;
+
+		if (cpu->current->base.usage.track_usage) {
+			usage_write_begin(&cpu->current->base.usage);
+			sched_thread_update_usage(cpu->current, cycles);
+			usage_write_end(&cpu->current->base.usage);
+		}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+		usage_write_begin(&cpu->usage);
+		sched_cpu_update_usage(cpu, cycles);
+		usage_write_end(&cpu->usage);
+#endif
+	}
+
+	cpu->usage0 = 0;
+}
+#else
 void z_sched_usage_stop(void)
 {
 	k_spinlock_key_t k   = k_spin_lock(&usage_lock);
@@ -117,8 +181,35 @@ void z_sched_usage_stop(void)
 	cpu->usage0 = 0;
 	k_spin_unlock(&usage_lock, k);
 }
+#endif /* CONFIG_SCHED_THREAD_USAGE_LOCKLESS */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
+{
+	struct _cpu *cpu = &_kernel.cpus[cpu_id];
+	uint64_t total;
+	unsigned int key;
+
+	total = usage_total_get(&cpu->usage);
+
+	/* If querying the CPU we are running on, fold in the cycles of
+	 * the in-progress timeslice, computed read-only. Remote CPUs'
+	 * in-flight cycles are left to their next context switch, so
+	 * their readings may lag by up to one timeslice.
+	 */
+	key = arch_irq_lock();
+	if ((cpu == _current_cpu) && (cpu->usage0 != 0) &&
+	    (cpu->current != cpu->idle_thread) && cpu->usage.track_usage) {
+		total += usage_now() - cpu->usage0;
+	}
+	arch_irq_unlock(key);
+
+	stats->total_cycles = total;
+	stats->idle_cycles = usage_total_get(&cpu->idle_thread->base.usage);
+	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
+}
+#else
 void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 {
 	k_spinlock_key_t  key;
@@ -168,8 +259,35 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	k_spin_unlock(&usage_lock, key);
 }
+#endif /* CONFIG_SCHED_THREAD_USAGE_LOCKLESS */
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+void z_sched_thread_usage(struct k_thread *thread,
+			  struct k_thread_runtime_stats *stats)
+{
+	uint64_t total;
+	unsigned int key;
+
+	total = usage_total_get(&thread->base.usage);
+
+	/* As in z_sched_cpu_usage(), fold in the in-progress timeslice
+	 * read-only if the thread happens to be running here
+	 */
+	key = arch_irq_lock();
+	if ((thread == _current_cpu->current) &&
+	    (_current_cpu->usage0 != 0) && thread->base.usage.track_usage) {
+		total += usage_now() - _current_cpu->usage0;
+	}
+	arch_irq_unlock(key);
+
+	stats->total_cycles = total;
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	stats->idle_cycles = 0;
+#endif
+	stats->execution_cycles = total;
+}
+#else
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats)
 {
@@ -224,6 +342,7 @@ void z_sched_thread_usage(struct k_thread *thread,
 
 	k_spin_unlock(&usage_lock, key);
 }
+#endif /* CONFIG_SCHED_THREAD_USAGE_LOCKLESS */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 int k_thread_runtime_stats_enable(k_tid_t  thread)
@@ -334,9 +453,17 @@ void k_sys_runtime_stats_disable(void)
 
 	for (uint8_t i = 0; i < num_cpus; i++) {
 		cpu = &_kernel.cpus[i];
+#ifdef CONFIG_SCHED_THREAD_USAGE_LOCKLESS
+		/* Remote CPUs' counters may not be written from here;
+		 * cycles since their last context switch are dropped and
+		 * accumulation simply stops at their next switch.
+		 */
+		ARG_UNUSED(now);
+#else
 		if (cpu->usage0 != 0) {
 			sched_cpu_update_usage(cpu, now - cpu->usage0);
 		}
+#endif
 		cpu->usage.track_usage = false;
 	}
 
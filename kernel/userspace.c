@@ -136,7 +136,9 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct z_object kobj;
 	sys_dnode_t dobj_list;
+#ifndef CONFIG_DYNAMIC_OBJECTS_HASH
 	struct rbnode node; /* must be immediately before data member */
+#endif
 
 	/* The object itself */
 	uint8_t data[] __aligned(DYN_OBJ_DATA_ALIGN_K_THREAD);
@@ -146,6 +148,7 @@ extern struct z_object *z_object_gperf_find(const void *obj);
 extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
+#ifndef CONFIG_DYNAMIC_OBJECTS_HASH
 static bool node_lessthan(struct rbnode *a, struct rbnode *b);
 
 /*
@@ -155,6 +158,7 @@ static bool node_lessthan(struct rbnode *a, struct rbnode *b);
 static struct rbtree obj_rb_tree = {
 	.lessthan_fn = node_lessthan
 };
+#endif
 
 /*
  * Linked list of allocated kernel objects, for iteration over all allocated
@@ -162,11 +166,6 @@ static struct rbtree obj_rb_tree = {
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
-/*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
- */
-
 static size_t obj_size_get(enum k_objects otype)
 {
 	size_t ret;
@@ -201,6 +200,113 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_HASH
+/* Open-addressing (linear probing) hash table of allocated kernel
+ * objects. Slots hold pointers to the containing struct dyn_obj;
+ * lookups probe for pointer equality, so a hit proves the candidate is
+ * a tracked dynamic object. Removal re-places the remainder of the
+ * probe cluster instead of leaving tombstones. All accesses are made
+ * with lists_lock held, but probes are short runs of slots so hold
+ * times stay small compared to a tree walk.
+ */
+#define OBJ_HASH_SIZE	BIT(CONFIG_DYNAMIC_OBJECTS_HASH_BITS)
+#define OBJ_HASH_MASK	(OBJ_HASH_SIZE - 1U)
+
+static struct dyn_obj *obj_hash[OBJ_HASH_SIZE];
+static unsigned int obj_hash_count;
+
+static uint32_t obj_hash_home(struct dyn_obj *dyn)
+{
+	/* Fibonacci hashing on the pointer value; the low bits are
+	 * mostly alignment zeroes, discard them first
+	 */
+	uint32_t val = (uint32_t)((uintptr_t)dyn >> 4);
+
+	return (val * 2654435761U) >>
+	       (32U - CONFIG_DYNAMIC_OBJECTS_HASH_BITS);
+}
+
+/* must be called with lists_lock held, table must not be full */
+static void obj_hash_place(struct dyn_obj *dyn)
+{
+	uint32_t slot = obj_hash_home(dyn);
+
+	while (obj_hash[slot] != NULL) {
+		slot = (slot + 1U) & OBJ_HASH_MASK;
+	}
+	obj_hash[slot] = dyn;
+}
+
+/* must be called with lists_lock held */
+static bool dyn_object_insert(struct dyn_obj *dyn)
+{
+	if (obj_hash_count == OBJ_HASH_SIZE) {
+		return false;
+	}
+	obj_hash_place(dyn);
+	obj_hash_count++;
+
+	return true;
+}
+
+/* must be called with lists_lock held */
+static void dyn_object_remove(struct dyn_obj *dyn)
+{
+	uint32_t slot = obj_hash_home(dyn);
+	uint32_t n;
+
+	for (n = 0U; n < OBJ_HASH_SIZE; n++) {
+		if (obj_hash[slot] == dyn) {
+			break;
+		}
+		__ASSERT(obj_hash[slot] != NULL, "object %p not in table",
+			 dyn);
+		slot = (slot + 1U) & OBJ_HASH_MASK;
+	}
+	obj_hash[slot] = NULL;
+	obj_hash_count--;
+
+	/* Re-place the remainder of the probe cluster so that no probe
+	 * sequence is broken by the new empty slot
+	 */
+	slot = (slot + 1U) & OBJ_HASH_MASK;
+	while (obj_hash[slot] != NULL) {
+		struct dyn_obj *moved = obj_hash[slot];
+
+		obj_hash[slot] = NULL;
+		obj_hash_place(moved);
+		slot = (slot + 1U) & OBJ_HASH_MASK;
+	}
+}
+
+static struct dyn_obj *dyn_object_find(void *obj)
+{
+	/* For any dynamically allocated kernel object, the object
+	 * pointer is just a member of the containing struct dyn_obj,
+	 * so just a little arithmetic is necessary to locate the
+	 * candidate to probe for
+	 */
+	struct dyn_obj *dobj = CONTAINER_OF(obj, struct dyn_obj, data);
+	struct dyn_obj *ret = NULL;
+	uint32_t slot = obj_hash_home(dobj);
+	uint32_t n;
+
+	k_spinlock_key_t key = k_spin_lock(&lists_lock);
+	for (n = 0U; n < OBJ_HASH_SIZE; n++) {
+		if (obj_hash[slot] == dobj) {
+			ret = dobj;
+			break;
+		}
+		if (obj_hash[slot] == NULL) {
+			break;
+		}
+		slot = (slot + 1U) & OBJ_HASH_MASK;
+	}
+	k_spin_unlock(&lists_lock, key);
+
+	return ret;
+}
+#else /* CONFIG_DYNAMIC_OBJECTS_HASH */
 static bool node_lessthan(struct rbnode *a, struct rbnode *b)
 {
 	return a < b;
@@ -218,6 +324,20 @@ static inline struct rbnode *dyn_obj_to_node(void *obj)
 	return &dobj->node;
 }
 
+/* must be called with lists_lock held */
+static bool dyn_object_insert(struct dyn_obj *dyn)
+{
+	rb_insert(&obj_rb_tree, &dyn->node);
+
+	return true;
+}
+
+/* must be called with lists_lock held */
+static void dyn_object_remove(struct dyn_obj *dyn)
+{
+	rb_remove(&obj_rb_tree, &dyn->node);
+}
+
 static struct dyn_obj *dyn_object_find(void *obj)
 {
 	struct rbnode *node;
@@ -240,6 +360,7 @@ static struct dyn_obj *dyn_object_find(void *obj)
 
 	return ret;
 }
+#endif /* CONFIG_DYNAMIC_OBJECTS_HASH */
 
 /**
  * @internal
@@ -321,7 +442,12 @@ struct z_object *z_dynamic_object_aligned_create(size_t align, size_t size)
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	rb_insert(&obj_rb_tree, &dyn->node);
+	if (!dyn_object_insert(dyn)) {
+		k_spin_unlock(&lists_lock, key);
+		LOG_ERR("dynamic object lookup table full");
+		k_free(dyn);
+		return NULL;
+	}
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
 	k_spin_unlock(&lists_lock, key);
 
@@ -398,8 +524,11 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		rb_remove(&obj_rb_tree, &dyn->node);
+		k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+		dyn_object_remove(dyn);
 		sys_dlist_remove(&dyn->dobj_list);
+		k_spin_unlock(&lists_lock, lists_key);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -508,8 +637,11 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		break;
 	}
 
-	rb_remove(&obj_rb_tree, &dyn->node);
+	k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+	dyn_object_remove(dyn);
 	sys_dlist_remove(&dyn->dobj_list);
+	k_spin_unlock(&lists_lock, lists_key);
 	k_free(dyn);
 out:
 #endif
@@ -635,6 +767,19 @@ void z_impl_k_object_access_grant(const void *object, struct k_thread *thread)
 	}
 }
 
+void z_impl_k_object_access_grant_list(const void *const *objects,
+				       size_t num_objects,
+				       struct k_thread *thread)
+{
+	for (size_t i = 0; i < num_objects; i++) {
+		struct z_object *ko = z_object_find(objects[i]);
+
+		if (ko != NULL) {
+			z_thread_perms_set(ko, thread);
+		}
+	}
+}
+
 void k_object_access_revoke(const void *object, struct k_thread *thread)
 {
 	struct z_object *ko = z_object_find(object);
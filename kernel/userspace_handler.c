@@ -7,6 +7,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <zephyr/sys/syscall_batch.h>
 
 static struct z_object *validate_any_object(const void *obj)
 {
@@ -49,6 +50,31 @@ static inline void z_vrfy_k_object_access_grant(const void *object,
 }
 #include <syscalls/k_object_access_grant_mrsh.c>
 
+static inline void z_vrfy_k_object_access_grant_list(const void *const *objects,
+						     size_t num_objects,
+						     struct k_thread *thread)
+{
+	Z_OOPS(Z_SYSCALL_OBJ_INIT(thread, K_OBJ_THREAD));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(objects, num_objects,
+					   sizeof(*objects)));
+
+	for (size_t i = 0; i < num_objects; i++) {
+		struct z_object *ko;
+		const void *object;
+
+		/* Copy each object pointer before validating it, in case
+		 * the user buffer is concurrently modified.
+		 */
+		Z_OOPS(z_user_from_copy(&object, &objects[i],
+					sizeof(object)));
+		ko = validate_any_object(object);
+		Z_OOPS(Z_SYSCALL_VERIFY_MSG(ko != NULL,
+					    "object %p access denied", object));
+		z_thread_perms_set(ko, thread);
+	}
+}
+#include <syscalls/k_object_access_grant_list_mrsh.c>
+
 static inline void z_vrfy_k_object_release(const void *object)
 {
 	struct z_object *ko;
@@ -65,3 +91,72 @@ static inline void *z_vrfy_k_object_alloc(enum k_objects otype)
 	return z_impl_k_object_alloc(otype);
 }
 #include <syscalls/k_object_alloc_mrsh.c>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries,
+			   uint32_t num_entries)
+{
+	/* There is no privilege transition to amortize from supervisor
+	 * mode; callers there can just make the calls directly.
+	 */
+	ARG_UNUSED(entries);
+	ARG_UNUSED(num_entries);
+
+	return -ENOSYS;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 uint32_t num_entries)
+{
+	struct k_syscall_batch_entry *copy;
+	void *ssf = _current->syscall_frame;
+	size_t size;
+	int ret;
+
+	if (Z_SYSCALL_VERIFY_MSG(num_entries <= K_SYSCALL_BATCH_MAX,
+				 "num_entries %u too large", num_entries)) {
+		return -EINVAL;
+	}
+
+	size = num_entries * sizeof(struct k_syscall_batch_entry);
+	copy = z_thread_malloc(size);
+	if (copy == NULL) {
+		return -ENOMEM;
+	}
+
+	if (z_user_from_copy(copy, entries, size) != 0) {
+		goto oops_free;
+	}
+
+	for (uint32_t i = 0; i < num_entries; i++) {
+		struct k_syscall_batch_entry *e = &copy[i];
+
+		/* Nested batches would let userspace recurse to
+		 * arbitrary kernel stack depth, so they are rejected
+		 * along with out-of-range IDs.
+		 */
+		if (Z_SYSCALL_VERIFY_MSG((e->id < K_SYSCALL_LIMIT) &&
+					 (e->id != K_SYSCALL_K_SYSCALL_BATCH),
+					 "bad syscall ID %u in entry %u",
+					 e->id, i)) {
+			ret = -EINVAL;
+			goto out;
+		}
+
+		e->ret = _k_syscall_table[e->id](e->args[0], e->args[1],
+						 e->args[2], e->args[3],
+						 e->args[4], e->args[5], ssf);
+	}
+	ret = 0;
+
+	if (z_user_to_copy(entries, copy, size) != 0) {
+		goto oops_free;
+	}
+out:
+	k_free(copy);
+	return ret;
+oops_free:
+	k_free(copy);
+	Z_OOPS(1);
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
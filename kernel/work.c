@@ -412,6 +412,72 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+int k_work_submit_batch(struct k_work_q *queue, struct k_work **works,
+			size_t count)
+{
+	__ASSERT_NO_MSG((works != NULL) || (count == 0U));
+
+	int submitted = 0;
+	bool need_resched = false;
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < count; i++) {
+		struct k_work_q *q = queue;
+		int rc = submit_to_queue_locked(works[i], &q);
+
+		if (rc >= 0) {
+			submitted++;
+		}
+		if (rc > 0) {
+			need_resched = true;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	/* Only the first successful submission can actually wake the
+	 * queue thread; later notifications under the same lock hold
+	 * are no-ops.  As in k_work_submit_to_queue(), reschedule once
+	 * here now the lock is released.
+	 */
+	if (need_resched) {
+		z_reschedule_unlocked();
+	}
+
+	return submitted;
+}
+
+int k_work_queue_flush_batch(struct k_work_q *queue)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+	__ASSERT_NO_MSG(!k_is_in_isr());
+	__ASSERT_NO_MSG(_current != &queue->thread);
+
+	struct z_work_flusher flusher;
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)) {
+		k_spin_unlock(&lock, key);
+		return -ENODEV;
+	}
+
+	/* Park a flusher behind everything already pending; serial
+	 * processing guarantees it runs after the current item and all
+	 * earlier submissions, even if the queue is momentarily idle.
+	 */
+	init_flusher(&flusher);
+	sys_slist_append(&queue->pending, &flusher.work.node);
+	(void)notify_queue_locked(queue);
+
+	k_spin_unlock(&lock, key);
+
+	k_sem_take(&flusher.sem, K_FOREVER);
+
+	return 0;
+}
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
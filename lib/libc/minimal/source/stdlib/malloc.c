@@ -35,6 +35,262 @@ Z_GENERIC_SECTION(POOL_SECTION) static struct sys_heap z_malloc_heap;
 Z_GENERIC_SECTION(POOL_SECTION) struct sys_mutex z_malloc_heap_mutex;
 Z_GENERIC_SECTION(POOL_SECTION) static char z_malloc_heap_mem[HEAP_BYTES];
 
+#ifdef CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE
+
+/*
+ * Small allocations are served from per-thread free lists held in
+ * thread-local storage and only refilled from (or drained back to) the
+ * shared heap in batches, so threads that allocate concurrently take
+ * the heap lock once per CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE_BATCH
+ * calls instead of on every call.
+ *
+ * Every allocation carries one header word just in front of the
+ * payload, with the payload kept aligned for z_max_align_t. For cached
+ * blocks the header holds the size class index, for everything else
+ * the offset back to the start of the underlying heap chunk. The two
+ * encodings cannot collide: offsets are at least CHUNK_HDR_SIZE, which
+ * is larger than the number of size classes.
+ */
+
+#define CHUNK_HDR_SIZE ROUND_UP(sizeof(uintptr_t), __alignof__(z_max_align_t))
+
+#define CACHE_CLASS_COUNT 4
+#define CACHE_CLASS_MIN   16
+#define CACHE_BATCH	  CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE_BATCH
+
+BUILD_ASSERT(CACHE_CLASS_COUNT < CHUNK_HDR_SIZE,
+	     "size class indexes must be distinguishable from chunk offsets");
+
+struct cache_block {
+	struct cache_block *next;
+};
+
+static __thread struct cache_block *cache_head[CACHE_CLASS_COUNT];
+static __thread uint8_t cache_count[CACHE_CLASS_COUNT];
+
+static void heap_lock(void)
+{
+	int lock_ret = sys_mutex_lock(&z_malloc_heap_mutex, K_FOREVER);
+
+	__ASSERT_NO_MSG(lock_ret == 0);
+	ARG_UNUSED(lock_ret);
+}
+
+static void heap_unlock(void)
+{
+	(void) sys_mutex_unlock(&z_malloc_heap_mutex);
+}
+
+static size_t cache_class_size(int cls)
+{
+	return (size_t)CACHE_CLASS_MIN << cls;
+}
+
+static int cache_class_of(size_t size)
+{
+	for (int cls = 0; cls < CACHE_CLASS_COUNT; cls++) {
+		if (size <= cache_class_size(cls)) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+/* Write the header word and return the payload of a heap chunk */
+static void *payload_init(void *base, size_t offset, uintptr_t hdr)
+{
+	uint8_t *payload = (uint8_t *)base + offset;
+
+	((uintptr_t *)payload)[-1] = hdr;
+
+	return payload;
+}
+
+static void cache_refill(int cls)
+{
+	size_t bytes = CHUNK_HDR_SIZE + cache_class_size(cls);
+
+	heap_lock();
+	for (int i = 0; i < CACHE_BATCH; i++) {
+		void *base = sys_heap_aligned_alloc(&z_malloc_heap,
+						    __alignof__(z_max_align_t),
+						    bytes);
+		if (base == NULL) {
+			break;
+		}
+
+		struct cache_block *blk =
+			payload_init(base, CHUNK_HDR_SIZE, (uintptr_t)cls);
+
+		blk->next = cache_head[cls];
+		cache_head[cls] = blk;
+		cache_count[cls]++;
+	}
+	heap_unlock();
+}
+
+static void cache_drain(int cls)
+{
+	heap_lock();
+	for (int i = 0; i < CACHE_BATCH && cache_head[cls] != NULL; i++) {
+		struct cache_block *blk = cache_head[cls];
+
+		cache_head[cls] = blk->next;
+		cache_count[cls]--;
+		sys_heap_free(&z_malloc_heap, (uint8_t *)blk - CHUNK_HDR_SIZE);
+	}
+	heap_unlock();
+}
+
+static void *alloc_direct(size_t alignment, size_t size)
+{
+	size_t offset = ROUND_UP(CHUNK_HDR_SIZE, alignment);
+	void *base;
+
+	if (size_add_overflow(size, offset, &size)) {
+		return NULL;
+	}
+
+	heap_lock();
+	base = sys_heap_aligned_alloc(&z_malloc_heap,
+				      MAX(alignment,
+					  __alignof__(z_max_align_t)),
+				      size);
+	heap_unlock();
+
+	if (base == NULL) {
+		return NULL;
+	}
+
+	return payload_init(base, offset, (uintptr_t)offset);
+}
+
+void *malloc(size_t size)
+{
+	int cls = cache_class_of(size);
+
+	if (cls >= 0) {
+		if (cache_head[cls] == NULL) {
+			cache_refill(cls);
+		}
+
+		struct cache_block *blk = cache_head[cls];
+
+		if (blk != NULL) {
+			cache_head[cls] = blk->next;
+			cache_count[cls]--;
+			return blk;
+		}
+
+		/* The refill found no free chunk of the full class
+		 * size; fall through to the direct path, which may
+		 * still carve a smaller fragment out of the heap.
+		 */
+	}
+
+	void *ret = alloc_direct(__alignof__(z_max_align_t), size);
+
+	if (ret == NULL && size != 0) {
+		errno = ENOMEM;
+	}
+
+	return ret;
+}
+
+/* Compile in when C11 */
+#if __STDC_VERSION__ >= 201112L
+void *aligned_alloc(size_t alignment, size_t size)
+{
+	void *ret = alloc_direct(alignment, size);
+
+	if (ret == NULL && size != 0) {
+		errno = ENOMEM;
+	}
+
+	return ret;
+}
+#endif /* __STDC_VERSION__ >= 201112L */
+
+void *realloc(void *ptr, size_t requested_size)
+{
+	if (ptr == NULL) {
+		return malloc(requested_size);
+	}
+
+	if (requested_size == 0) {
+		free(ptr);
+		return NULL;
+	}
+
+	uintptr_t hdr = ((uintptr_t *)ptr)[-1];
+
+	if (hdr < CACHE_CLASS_COUNT) {
+		size_t old_size = cache_class_size((int)hdr);
+
+		if (requested_size <= old_size) {
+			return ptr;
+		}
+
+		void *ret = malloc(requested_size);
+
+		if (ret != NULL) {
+			(void)memcpy(ret, ptr, old_size);
+			free(ptr);
+		}
+
+		return ret;
+	}
+
+	if (size_add_overflow(requested_size, hdr, &requested_size)) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	heap_lock();
+	void *base = sys_heap_aligned_realloc(&z_malloc_heap,
+					      (uint8_t *)ptr - hdr,
+					      __alignof__(z_max_align_t),
+					      requested_size);
+	heap_unlock();
+
+	if (base == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	return (uint8_t *)base + hdr;
+}
+
+void free(void *ptr)
+{
+	if (ptr == NULL) {
+		return;
+	}
+
+	uintptr_t hdr = ((uintptr_t *)ptr)[-1];
+
+	if (hdr < CACHE_CLASS_COUNT) {
+		int cls = (int)hdr;
+		struct cache_block *blk = ptr;
+
+		if (cache_count[cls] >= 2 * CACHE_BATCH) {
+			cache_drain(cls);
+		}
+
+		blk->next = cache_head[cls];
+		cache_head[cls] = blk;
+		cache_count[cls]++;
+		return;
+	}
+
+	heap_lock();
+	sys_heap_free(&z_malloc_heap, (uint8_t *)ptr - hdr);
+	heap_unlock();
+}
+
+#else /* !CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE */
+
 void *malloc(size_t size)
 {
 	int lock_ret;
@@ -76,6 +332,8 @@ void *aligned_alloc(size_t alignment, size_t size)
 }
 #endif /* __STDC_VERSION__ >= 201112L */
 
+#endif /* !CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE */
+
 static int malloc_prepare(const struct device *unused)
 {
 	ARG_UNUSED(unused);
@@ -86,6 +344,8 @@ static int malloc_prepare(const struct device *unused)
 	return 0;
 }
 
+#ifndef CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE
+
 void *realloc(void *ptr, size_t requested_size)
 {
 	int lock_ret;
@@ -116,6 +376,8 @@ void free(void *ptr)
 	(void) sys_mutex_unlock(&z_malloc_heap_mutex);
 }
 
+#endif /* !CONFIG_MINIMAL_LIBC_MALLOC_THREAD_CACHE */
+
 SYS_INIT(malloc_prepare, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
 #else /* No malloc arena */
 void *malloc(size_t size)
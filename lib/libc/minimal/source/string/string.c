@@ -253,49 +253,12 @@ int memcmp(const void *m1, const void *m2, size_t n)
 	return *c1 - *c2;
 }
 
-/**
- *
- * @brief Copy bytes in memory with overlapping areas
- *
- * @return pointer to destination buffer <d>
+/* Forward copy shared by memcpy() and memmove(). The parameters are
+ * deliberately not restrict-qualified: memmove() calls this with
+ * overlapping buffers (<d> preceding <s>), which the strictly
+ * ascending copy order tolerates but restrict would not allow.
  */
-
-void *memmove(void *d, const void *s, size_t n)
-{
-	char *dest = d;
-	const char *src  = s;
-
-	if ((size_t) (dest - src) < n) {
-		/*
-		 * The <src> buffer overlaps with the start of the <dest> buffer.
-		 * Copy backwards to prevent the premature corruption of <src>.
-		 */
-
-		while (n > 0) {
-			n--;
-			dest[n] = src[n];
-		}
-	} else {
-		/* It is safe to perform a forward-copy */
-		while (n > 0) {
-			*dest = *src;
-			dest++;
-			src++;
-			n--;
-		}
-	}
-
-	return d;
-}
-
-/**
- *
- * @brief Copy bytes in memory
- *
- * @return pointer to start of destination buffer
- */
-
-void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
+static void *copy_fwd(void *d, const void *s, size_t n)
 {
 	/* attempt word-sized copying only if buffers have identical alignment */
 
@@ -322,6 +285,27 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 		mem_word_t *d_word = (mem_word_t *)d_byte;
 		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
+#ifdef CONFIG_MINIMAL_LIBC_STRING_UNROLL
+		/* copy four words per iteration; the block is wide enough
+		 * for the compiler to emit multi-word load/store
+		 * instructions (LDM/STM on Arm)
+		 */
+		while (n >= 4 * sizeof(mem_word_t)) {
+			mem_word_t w0 = s_word[0];
+			mem_word_t w1 = s_word[1];
+			mem_word_t w2 = s_word[2];
+			mem_word_t w3 = s_word[3];
+
+			d_word[0] = w0;
+			d_word[1] = w1;
+			d_word[2] = w2;
+			d_word[3] = w3;
+			d_word += 4;
+			s_word += 4;
+			n -= 4 * sizeof(mem_word_t);
+		}
+#endif
+
 		while (n >= sizeof(mem_word_t)) {
 			*(d_word++) = *(s_word++);
 			n -= sizeof(mem_word_t);
@@ -342,6 +326,53 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 	return d;
 }
 
+/**
+ *
+ * @brief Copy bytes in memory with overlapping areas
+ *
+ * @return pointer to destination buffer <d>
+ */
+
+void *memmove(void *d, const void *s, size_t n)
+{
+	char *dest = d;
+	const char *src  = s;
+
+	if ((size_t) (dest - src) < n) {
+		/*
+		 * The <src> buffer overlaps with the start of the <dest> buffer.
+		 * Copy backwards to prevent the premature corruption of <src>.
+		 */
+
+		while (n > 0) {
+			n--;
+			dest[n] = src[n];
+		}
+	} else {
+		/*
+		 * It is safe to perform a forward-copy, even with
+		 * overlapping areas: <dest> precedes <src>, so the
+		 * strictly ascending copy order of copy_fwd() never
+		 * overwrites bytes it has yet to read.
+		 */
+		(void)copy_fwd(d, s, n);
+	}
+
+	return d;
+}
+
+/**
+ *
+ * @brief Copy bytes in memory
+ *
+ * @return pointer to start of destination buffer
+ */
+
+void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
+{
+	return copy_fwd(d, s, n);
+}
+
 /**
  *
  * @brief Set bytes in memory
@@ -376,6 +407,18 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+#ifdef CONFIG_MINIMAL_LIBC_STRING_UNROLL
+	/* fill four words per iteration, see memcpy() */
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+#endif
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_arena.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/__assert.h>
+#include <errno.h>
+
+/* Matches the base alignment guarantee of sys_heap_alloc() */
+#define ARENA_ALIGN sizeof(void *)
+
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes)
+{
+	arena->base = mem;
+	arena->size = bytes;
+	arena->offset = 0;
+	arena->backing = NULL;
+}
+
+int sys_arena_init_heap(struct sys_arena *arena, struct sys_heap *heap,
+			size_t bytes)
+{
+	void *mem = sys_heap_alloc(heap, bytes);
+
+	if (mem == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_arena_init(arena, mem, bytes);
+	arena->backing = heap;
+
+	return 0;
+}
+
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align,
+			      size_t bytes)
+{
+	__ASSERT((align & (align - 1)) == 0, "align must be a power of 2");
+
+	if (align < ARENA_ALIGN) {
+		align = ARENA_ALIGN;
+	}
+
+	uintptr_t addr = (uintptr_t)arena->base + arena->offset;
+	uintptr_t aligned = ROUND_UP(addr, align);
+	size_t pad = aligned - addr;
+	size_t avail = arena->size - arena->offset;
+
+	/* Ordered so that neither comparison can overflow */
+	if ((bytes > avail) || (pad > avail - bytes)) {
+		return NULL;
+	}
+
+	arena->offset += pad + bytes;
+
+	return (void *)aligned;
+}
+
+void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, 0, bytes);
+}
+
+void sys_arena_reset(struct sys_arena *arena)
+{
+	arena->offset = 0;
+}
+
+void sys_arena_destroy(struct sys_arena *arena)
+{
+	if (arena->backing != NULL) {
+		sys_heap_free(arena->backing, arena->base);
+	}
+
+	arena->base = NULL;
+	arena->size = 0;
+	arena->offset = 0;
+	arena->backing = NULL;
+}
+
+#ifdef CONFIG_SYS_ARENA_THREAD
+
+static __thread struct sys_arena *thread_arena;
+
+void sys_arena_thread_set(struct sys_arena *arena)
+{
+	thread_arena = arena;
+}
+
+struct sys_arena *sys_arena_thread_get(void)
+{
+	return thread_arena;
+}
+
+#endif /* CONFIG_SYS_ARENA_THREAD */
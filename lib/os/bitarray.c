@@ -45,6 +45,75 @@ static void setup_bundle_data(sys_bitarray_t *bitarray,
 	}
 }
 
+/*
+ * Refresh the summary bit for one bundle after the bundle has been
+ * modified.  No-op for bit arrays without a summary bitmap.
+ *
+ * @param bitarray Bitarray struct
+ * @param idx      Index of the modified bundle
+ */
+static void update_summary(sys_bitarray_t *bitarray, size_t idx)
+{
+	if (bitarray->summary == NULL) {
+		return;
+	}
+
+	if (~bitarray->bundles[idx] == 0U) {
+		bitarray->summary[idx / bundle_bitness(bitarray)] |=
+			BIT(idx % bundle_bitness(bitarray));
+	} else {
+		bitarray->summary[idx / bundle_bitness(bitarray)] &=
+			~BIT(idx % bundle_bitness(bitarray));
+	}
+}
+
+/*
+ * Find the first bundle, at or after idx, which is not fully set.
+ *
+ * Skips over fully allocated bundles one summary word at a time when
+ * the summary bitmap is available, otherwise scans the bundles
+ * directly.  The returned index may point past the last bundle when
+ * everything remaining is fully set; callers bound it themselves.
+ *
+ * @param bitarray Bitarray struct
+ * @param idx      Bundle index to start searching from
+ *
+ * @return Index of the first not fully set bundle
+ */
+static size_t next_not_full_bundle(sys_bitarray_t *bitarray, size_t idx)
+{
+	size_t word;
+	uint32_t not_full;
+
+	if (idx >= bitarray->num_bundles) {
+		return bitarray->num_bundles;
+	}
+
+	if (bitarray->summary == NULL) {
+		while ((idx < bitarray->num_bundles) &&
+		       (~bitarray->bundles[idx] == 0U)) {
+			idx++;
+		}
+
+		return idx;
+	}
+
+	word = idx / bundle_bitness(bitarray);
+	not_full = ~bitarray->summary[word] &
+		   ~(BIT(idx % bundle_bitness(bitarray)) - 1);
+
+	while (not_full == 0U) {
+		word++;
+		if ((word * bundle_bitness(bitarray)) >= bitarray->num_bundles) {
+			return bitarray->num_bundles;
+		}
+
+		not_full = ~bitarray->summary[word];
+	}
+
+	return (word * bundle_bitness(bitarray)) + find_lsb_set(not_full) - 1;
+}
+
 /*
  * Find out if the bits in a region is all set or all clear.
  *
@@ -188,6 +257,7 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 		} else {
 			bitarray->bundles[bd->sidx] &= ~bd->smask;
 		}
+		update_summary(bitarray, bd->sidx);
 	} else {
 		/* Start/end at different bundle.
 		 * So set/clear the bits in start and end bundles
@@ -199,14 +269,18 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			bitarray->bundles[bd->eidx] |= bd->emask;
 			for (idx = bd->sidx + 1; idx < bd->eidx; idx++) {
 				bitarray->bundles[idx] = ~0U;
+				update_summary(bitarray, idx);
 			}
 		} else {
 			bitarray->bundles[bd->sidx] &= ~bd->smask;
 			bitarray->bundles[bd->eidx] &= ~bd->emask;
 			for (idx = bd->sidx + 1; idx < bd->eidx; idx++) {
 				bitarray->bundles[idx] = 0U;
+				update_summary(bitarray, idx);
 			}
 		}
+		update_summary(bitarray, bd->sidx);
+		update_summary(bitarray, bd->eidx);
 	}
 }
 
@@ -230,6 +304,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx);
 
 	ret = 0;
 
@@ -258,6 +333,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx);
 
 	ret = 0;
 
@@ -334,6 +410,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx);
 
 	ret = 0;
 
@@ -373,6 +450,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx);
 
 	ret = 0;
 
@@ -388,7 +466,7 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 	uint32_t bit_idx;
 	int ret;
 	struct bundle_data bd;
-	size_t off_start, off_end;
+	size_t idx, off_start, off_end;
 	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
@@ -406,28 +484,16 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
 	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
+	 * instead of individual bits, skipping over fully allocated
+	 * bundles via the summary bitmap when one is present.
 	 */
-	for (ret = 0; ret < bitarray->num_bundles; ret++) {
-		if (~bitarray->bundles[ret] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[ret] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[ret]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
+	idx = next_not_full_bundle(bitarray, 0);
+	bit_idx = idx * bundle_bitness(bitarray);
+	if ((idx < bitarray->num_bundles) && (bitarray->bundles[idx] != 0U)) {
+		/* Find the first free bit in bundle if not all free */
+		off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
+		bit_idx += off_start;
 	}
 
 	off_end = bitarray->num_bits - num_bits;
@@ -443,9 +509,17 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		}
 
 		/* Fast-forward to the bit just after
-		 * the mismatched bit.
+		 * the mismatched bit, skipping over any fully
+		 * allocated bundles on the way.
 		 */
 		bit_idx = mismatch + 1;
+
+		idx = bit_idx / bundle_bitness(bitarray);
+		if ((idx < bitarray->num_bundles) &&
+		    (~bitarray->bundles[idx] == 0U)) {
+			idx = next_not_full_bundle(bitarray, idx + 1);
+			bit_idx = idx * bundle_bitness(bitarray);
+		}
 	}
 
 out:
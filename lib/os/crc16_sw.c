@@ -51,6 +51,12 @@ uint16_t crc16_reflect(uint16_t poly, uint16_t seed, const uint8_t *src, size_t
 
 uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 {
+#ifdef CONFIG_CRC_HW_DISPATCH
+	if ((z_crc_hw_ops != NULL) && (z_crc_hw_ops->crc16_ccitt != NULL)) {
+		return z_crc_hw_ops->crc16_ccitt(seed, src, len);
+	}
+#endif
+
 	for (; len > 0; len--) {
 		uint8_t e, f;
 
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/crc.h>
+
+const struct crc_hw_ops *z_crc_hw_ops;
+
+void crc_hw_register(const struct crc_hw_ops *ops)
+{
+	z_crc_hw_ops = ops;
+}
+
+void crc_hw_unregister(void)
+{
+	z_crc_hw_ops = NULL;
+}
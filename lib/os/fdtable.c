@@ -25,6 +25,7 @@ struct fd_entry {
 	void *obj;
 	const struct fd_op_vtable *vtable;
 	atomic_t refcount;
+	atomic_t pending_close;
 	struct k_mutex lock;
 };
 
@@ -61,11 +62,56 @@ static struct fd_entry fdtable[CONFIG_POSIX_MAX_FDS] = {
 
 static K_MUTEX_DEFINE(fdtable_lock);
 
+/* Refcount value parked on an entry while the last reference performs
+ * the teardown: not free (so the slot cannot be re-reserved under the
+ * running close vmethod), not live (so no new reference can be taken).
+ */
+#define FD_REFCOUNT_CLOSING (-1)
+
 static int z_fd_ref(int fd)
 {
 	return atomic_inc(&fdtable[fd].refcount) + 1;
 }
 
+/* Take a reference on an entry unless it is free, without ever
+ * blocking.  Mirrors the decrement loop in z_fd_unref() below.
+ */
+static int z_fd_ref_live(int fd)
+{
+	atomic_val_t rc;
+
+	do {
+		rc = atomic_get(&fdtable[fd].refcount);
+		if (rc <= 0) {
+			return -1;
+		}
+	} while (!atomic_cas(&fdtable[fd].refcount, rc, rc + 1));
+
+	return 0;
+}
+
+/* Tear down an entry whose last reference was just dropped.  If a
+ * close() was deferred because operations were still in flight, run
+ * the close vmethod now, under the per-descriptor lock so that a
+ * read()/write() which passed the liveness check just before the last
+ * reference went away has left the object first.
+ */
+static int z_fd_entry_teardown(int fd)
+{
+	int res = 0;
+
+	if (atomic_cas(&fdtable[fd].pending_close, 1, 0)) {
+		(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
+		res = fdtable[fd].vtable->close(fdtable[fd].obj);
+		k_mutex_unlock(&fdtable[fd].lock);
+	}
+
+	fdtable[fd].obj = NULL;
+	fdtable[fd].vtable = NULL;
+
+	return res;
+}
+
 static int z_fd_unref(int fd)
 {
 	atomic_val_t old_rc;
@@ -73,21 +119,24 @@ static int z_fd_unref(int fd)
 	/* Reference counter must be checked to avoid decrement refcount below
 	 * zero causing file descriptor leak. Loop statement below executes
 	 * atomic decrement if refcount value is grater than zero. Otherwise,
-	 * refcount is not going to be written.
+	 * refcount is not going to be written.  The last reference parks the
+	 * counter at FD_REFCOUNT_CLOSING instead of zero, so the slot only
+	 * becomes reusable once the teardown has finished.
 	 */
 	do {
 		old_rc = atomic_get(&fdtable[fd].refcount);
-		if (!old_rc) {
+		if (old_rc <= 0) {
 			return 0;
 		}
-	} while (!atomic_cas(&fdtable[fd].refcount, old_rc, old_rc - 1));
+	} while (!atomic_cas(&fdtable[fd].refcount, old_rc,
+			     old_rc == 1 ? FD_REFCOUNT_CLOSING : old_rc - 1));
 
 	if (old_rc != 1) {
 		return old_rc - 1;
 	}
 
-	fdtable[fd].obj = NULL;
-	fdtable[fd].vtable = NULL;
+	(void)z_fd_entry_teardown(fd);
+	atomic_set(&fdtable[fd].refcount, 0);
 
 	return 0;
 }
@@ -115,7 +164,7 @@ static int _check_fd(int fd)
 
 	fd = k_array_index_sanitize(fd, ARRAY_SIZE(fdtable));
 
-	if (!atomic_get(&fdtable[fd].refcount)) {
+	if (atomic_get(&fdtable[fd].refcount) <= 0) {
 		errno = EBADF;
 		return -1;
 	}
@@ -160,6 +209,46 @@ void *z_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable,
 	return entry->obj;
 }
 
+void *z_acquire_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable)
+{
+	struct fd_entry *entry;
+
+	*vtable = NULL;
+
+	if (fd < 0 || fd >= ARRAY_SIZE(fdtable)) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	fd = k_array_index_sanitize(fd, ARRAY_SIZE(fdtable));
+	entry = &fdtable[fd];
+
+	if (z_fd_ref_live(fd) < 0) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	/* The reference keeps the entry from being torn down, but it
+	 * may have been grabbed between z_reserve_fd() and
+	 * z_finalize_fd(), in which case there is no object yet.
+	 */
+	if (entry->vtable == NULL) {
+		(void)z_fd_unref(fd);
+		errno = EBADF;
+		return NULL;
+	}
+
+	*vtable = entry->vtable;
+
+	return entry->obj;
+}
+
+void z_release_fd(int fd)
+{
+	/* Assumes fd was already bounds-checked. */
+	(void)z_fd_unref(fd);
+}
+
 int z_reserve_fd(void)
 {
 	int fd;
@@ -172,6 +261,7 @@ int z_reserve_fd(void)
 		(void)z_fd_ref(fd);
 		fdtable[fd].obj = NULL;
 		fdtable[fd].vtable = NULL;
+		atomic_clear(&fdtable[fd].pending_close);
 		k_mutex_init(&fdtable[fd].lock);
 	}
 
@@ -264,19 +354,29 @@ FUNC_ALIAS(write, _write, ssize_t);
 
 int close(int fd)
 {
-	int res;
+	int res = 0;
 
 	if (_check_fd(fd) < 0) {
 		return -1;
 	}
 
-	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
-
-	res = fdtable[fd].vtable->close(fdtable[fd].obj);
-
-	k_mutex_unlock(&fdtable[fd].lock);
+	/* Mark the descriptor as closing, then drop the base reference
+	 * taken by z_reserve_fd().  With no operation in flight (the
+	 * common case) that is the last reference and the teardown runs
+	 * right here, reporting the close vmethod result as usual.  If a
+	 * z_acquire_fd_obj_and_vtable() holder is still inside the
+	 * object, the teardown is deferred to its z_release_fd() and
+	 * success is reported: there is nobody left to deliver the
+	 * deferred result to.
+	 */
+	atomic_set(&fdtable[fd].pending_close, 1);
 
-	z_free_fd(fd);
+	if (atomic_cas(&fdtable[fd].refcount, 1, FD_REFCOUNT_CLOSING)) {
+		res = z_fd_entry_teardown(fd);
+		atomic_set(&fdtable[fd].refcount, 0);
+	} else {
+		(void)z_fd_unref(fd);
+	}
 
 	return res;
 }
@@ -284,61 +384,85 @@ FUNC_ALIAS(close, _close, int);
 
 int fsync(int fd)
 {
-	if (_check_fd(fd) < 0) {
+	const struct fd_op_vtable *vtable;
+	void *obj = z_acquire_fd_obj_and_vtable(fd, &vtable);
+	int res;
+
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_FSYNC);
+	res = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_FSYNC);
+	z_release_fd(fd);
+
+	return res;
 }
 
 off_t lseek(int fd, off_t offset, int whence)
 {
-	if (_check_fd(fd) < 0) {
+	const struct fd_op_vtable *vtable;
+	void *obj = z_acquire_fd_obj_and_vtable(fd, &vtable);
+	off_t res;
+
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_LSEEK,
+	res = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_LSEEK,
 			  offset, whence);
+	z_release_fd(fd);
+
+	return res;
 }
 FUNC_ALIAS(lseek, _lseek, off_t);
 
 int ioctl(int fd, unsigned long request, ...)
 {
+	const struct fd_op_vtable *vtable;
+	void *obj = z_acquire_fd_obj_and_vtable(fd, &vtable);
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	if (vtable == NULL) {
 		return -1;
 	}
 
 	va_start(args, request);
-	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, request, args);
+	res = vtable->ioctl(obj, request, args);
 	va_end(args);
 
+	z_release_fd(fd);
+
 	return res;
 }
 
 int fcntl(int fd, int cmd, ...)
 {
+	const struct fd_op_vtable *vtable;
+	void *obj;
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	obj = z_acquire_fd_obj_and_vtable(fd, &vtable);
+	if (vtable == NULL) {
 		return -1;
 	}
 
 	/* Handle fdtable commands. */
 	if (cmd == F_DUPFD) {
 		/* Not implemented so far. */
+		z_release_fd(fd);
 		errno = EINVAL;
 		return -1;
 	}
 
 	/* The rest of commands are per-fd, handled by ioctl vmethod. */
 	va_start(args, cmd);
-	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, cmd, args);
+	res = vtable->ioctl(obj, cmd, args);
 	va_end(args);
 
+	z_release_fd(fd);
+
 	return res;
 }
 
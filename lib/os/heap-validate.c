@@ -56,7 +56,7 @@ static inline void check_nexts(struct z_heap *h, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
-	bool emptybit = (h->avail_buckets & BIT(bidx)) == 0;
+	bool emptybit = !bucket_avail(h, bidx);
 	bool emptylist = b->next == 0;
 	bool empties_match = emptybit == emptylist;
 
@@ -138,7 +138,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 			set_chunk_used(h, c, true);
 		}
 
-		bool empty = (h->avail_buckets & BIT(b)) == 0;
+		bool empty = !bucket_avail(h, b);
 		bool zero = n == 0;
 
 		if (empty != zero) {
@@ -37,11 +37,11 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(bucket_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
+		bucket_avail_clear(h, bidx);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -70,15 +70,15 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+		CHECK(!bucket_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
+		bucket_avail_set(h, bidx);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(bucket_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -215,6 +215,35 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 
 	CHECK(bi <= bucket_idx(h, h->end_chunk));
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+	/* With two-level segregated classes the head of any bucket at
+	 * or above the rounded-up request index is guaranteed to fit,
+	 * so the common case is a mask scan and a single list pop.
+	 */
+	int avail = bucket_avail_find_from(h, bucket_idx_roundup(h, sz));
+
+	if (avail >= 0) {
+		chunkid_t c = h->buckets[avail].next;
+
+		free_list_remove_bidx(h, c, avail);
+		CHECK(chunk_size(h, c) >= sz);
+		return c;
+	}
+
+	/* The exact (non-rounded) class may still hold a fitting chunk
+	 * below the round-up boundary; check its head before giving up.
+	 */
+	if (b->next) {
+		chunkid_t c = b->next;
+
+		if (chunk_size(h, c) >= sz) {
+			free_list_remove_bidx(h, c, bi);
+			return c;
+		}
+	}
+
+	return 0;
+#else
 	/* First try a bounded count of items from the minimal bucket
 	 * size.  These may not fit, trying (e.g.) three means that
 	 * (assuming that chunk sizes are evenly distributed[1]) we
@@ -246,10 +275,9 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	/* Otherwise pick the smallest non-empty bucket guaranteed to
 	 * fit and use that unconditionally.
 	 */
-	uint32_t bmask = h->avail_buckets & ~BIT_MASK(bi + 1);
+	int minbucket = bucket_avail_find_from(h, bi + 1);
 
-	if (bmask != 0U) {
-		int minbucket = __builtin_ctz(bmask);
+	if (minbucket >= 0) {
 		chunkid_t c = h->buckets[minbucket].next;
 
 		free_list_remove_bidx(h, c, minbucket);
@@ -258,6 +286,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	}
 
 	return 0;
+#endif /* CONFIG_SYS_HEAP_TLSF */
 }
 
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
@@ -509,7 +538,7 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	struct z_heap *h = (struct z_heap *)addr;
 	heap->heap = h;
 	h->end_chunk = heap_sz;
-	h->avail_buckets = 0;
+	(void)memset(&h->avail_buckets, 0, sizeof(h->avail_buckets));
 
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes = 0;
@@ -65,10 +65,22 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Second-level subdivision of each power-of-two size class, and the
+ * resulting worst-case bucket count (chunk sizes are at most 31 bits).
+ */
+#define Z_HEAP_SL_BITS 2
+#define Z_HEAP_MAX_BUCKETS (32 << Z_HEAP_SL_BITS)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	uint32_t avail_buckets[Z_HEAP_MAX_BUCKETS / 32];
+#else
 	uint32_t avail_buckets;
+#endif
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	size_t free_bytes;
 	size_t allocated_bytes;
@@ -247,12 +259,105 @@ static inline size_t chunksz_to_bytes(struct z_heap *h, chunksz_t chunksz_in)
 	return chunksz_in * CHUNK_UNIT - chunk_header_bytes(h);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+
+/* Two-level segregated fit: each power-of-two size class is split
+ * into 2^Z_HEAP_SL_BITS linearly spaced sub-classes, so the chunks
+ * within one bucket differ by at most a sub-class granule.  Lookup
+ * stays O(1): the head of any bucket above the (rounded up) request
+ * index is guaranteed to fit, no list walking required.
+ */
+static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	int fl = 31 - __builtin_clz(usable_sz);
+
+	if (fl < Z_HEAP_SL_BITS) {
+		return usable_sz;
+	}
+	return (fl << Z_HEAP_SL_BITS) +
+		((usable_sz >> (fl - Z_HEAP_SL_BITS)) & BIT_MASK(Z_HEAP_SL_BITS));
+}
+
+/* Bucket index for an allocation request: rounds the size up to the
+ * next sub-class boundary so every chunk in the resulting bucket (and
+ * any higher one) is large enough.
+ */
+static inline int bucket_idx_roundup(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	int fl = 31 - __builtin_clz(usable_sz);
+
+	if (fl >= Z_HEAP_SL_BITS) {
+		usable_sz += BIT(fl - Z_HEAP_SL_BITS) - 1U;
+	}
+	return bucket_idx(h, usable_sz + min_chunk_size(h) - 1U);
+}
+
+static inline void bucket_avail_set(struct z_heap *h, int bidx)
+{
+	h->avail_buckets[bidx / 32] |= BIT(bidx % 32);
+}
+
+static inline void bucket_avail_clear(struct z_heap *h, int bidx)
+{
+	h->avail_buckets[bidx / 32] &= ~BIT(bidx % 32);
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->avail_buckets[bidx / 32] & BIT(bidx % 32)) != 0U;
+}
+
+/* Smallest non-empty bucket with index >= bidx, or -1 */
+static inline int bucket_avail_find_from(struct z_heap *h, int bidx)
+{
+	uint32_t w = h->avail_buckets[bidx / 32] & ~BIT_MASK(bidx % 32);
+
+	for (int i = bidx / 32; i < (int)ARRAY_SIZE(h->avail_buckets); i++) {
+		if (w != 0U) {
+			return (i * 32) + __builtin_ctz(w);
+		}
+		if (i + 1 < (int)ARRAY_SIZE(h->avail_buckets)) {
+			w = h->avail_buckets[i + 1];
+		}
+	}
+	return -1;
+}
+
+#else /* !CONFIG_SYS_HEAP_TLSF */
+
 static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 {
 	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
 	return 31 - __builtin_clz(usable_sz);
 }
 
+static inline void bucket_avail_set(struct z_heap *h, int bidx)
+{
+	h->avail_buckets |= BIT(bidx);
+}
+
+static inline void bucket_avail_clear(struct z_heap *h, int bidx)
+{
+	h->avail_buckets &= ~BIT(bidx);
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->avail_buckets & BIT(bidx)) != 0U;
+}
+
+/* Smallest non-empty bucket with index >= bidx, or -1 */
+static inline int bucket_avail_find_from(struct z_heap *h, int bidx)
+{
+	uint32_t bmask = h->avail_buckets & ~BIT_MASK(bidx);
+
+	return (bmask != 0U) ? __builtin_ctz(bmask) : -1;
+}
+
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
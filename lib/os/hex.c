@@ -7,8 +7,24 @@
 #include <stddef.h>
 #include <zephyr/types.h>
 #include <errno.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 
+/* Nibble characters for the word-at-a-time encode path */
+static const char hex_chars[] = "0123456789abcdef";
+
+/* Character-to-nibble map for the word-at-a-time decode path, offset
+ * by one so that zero marks an invalid character.
+ */
+static const uint8_t hex_nibbles[256] = {
+	['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5,
+	['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+	['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15,
+	['f'] = 16,
+	['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15,
+	['F'] = 16,
+};
+
 int char2hex(char c, uint8_t *x)
 {
 	if (c >= '0' && c <= '9') {
@@ -43,7 +59,25 @@ size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
 		return 0;
 	}
 
-	for (size_t i = 0; i < buflen; i++) {
+	size_t i = 0;
+
+	/* Word-at-a-time: convert four bytes per iteration, writing
+	 * each half of the output as one 32-bit store.
+	 */
+	for (; (buflen - i) >= 4; i += 4) {
+		sys_put_be32(((uint32_t)hex_chars[buf[i] >> 4] << 24) |
+			     ((uint32_t)hex_chars[buf[i] & 0xf] << 16) |
+			     ((uint32_t)hex_chars[buf[i + 1] >> 4] << 8) |
+			     (uint32_t)hex_chars[buf[i + 1] & 0xf],
+			     (uint8_t *)&hex[2 * i]);
+		sys_put_be32(((uint32_t)hex_chars[buf[i + 2] >> 4] << 24) |
+			     ((uint32_t)hex_chars[buf[i + 2] & 0xf] << 16) |
+			     ((uint32_t)hex_chars[buf[i + 3] >> 4] << 8) |
+			     (uint32_t)hex_chars[buf[i + 3] & 0xf],
+			     (uint8_t *)&hex[2 * i + 4]);
+	}
+
+	for (; i < buflen; i++) {
 		if (hex2char(buf[i] >> 4, &hex[2 * i]) < 0) {
 			return 0;
 		}
@@ -74,8 +108,28 @@ size_t hex2bin(const char *hex, size_t hexlen, uint8_t *buf, size_t buflen)
 		buf++;
 	}
 
+	size_t i = 0;
+
+	/* Word-at-a-time: convert eight characters per iteration,
+	 * writing the four output bytes as one 32-bit store.
+	 */
+	for (; (i + 4) <= (hexlen / 2); i += 4) {
+		uint32_t v = 0;
+
+		for (size_t k = 0; k < 8; k++) {
+			uint8_t nib = hex_nibbles[(uint8_t)hex[2 * i + k]];
+
+			if (nib == 0U) {
+				return 0;
+			}
+			v = (v << 4) | (nib - 1U);
+		}
+
+		sys_put_be32(v, &buf[i]);
+	}
+
 	/* regular hex conversion */
-	for (size_t i = 0; i < hexlen / 2; i++) {
+	for (; i < hexlen / 2; i++) {
 		if (char2hex(hex[2 * i], &dec) < 0) {
 			return 0;
 		}
@@ -1096,3 +1096,326 @@ ssize_t json_calc_encoded_len(const struct json_obj_descr *descr,
 
 	return total;
 }
+
+/* Incremental (SAX-style) tokenizer.  Kept separate from the lexer
+ * above: that one requires the whole document in a writable buffer and
+ * backs up freely, while this one never looks behind the current chunk
+ * so tokens that straddle a chunk boundary are delivered as partial
+ * fragments instead.
+ */
+
+enum json_stream_expect {
+	JSON_EXPECT_VALUE,
+	JSON_EXPECT_KEY,
+	JSON_EXPECT_KEY_OR_END,
+	JSON_EXPECT_COLON,
+	JSON_EXPECT_COMMA_OR_END,
+	JSON_EXPECT_VALUE_OR_END,
+	JSON_EXPECT_DONE,
+};
+
+enum json_stream_mode {
+	JSON_MODE_NONE,
+	JSON_MODE_STRING,
+	JSON_MODE_STRING_ESCAPE,
+	JSON_MODE_NUMBER,
+	JSON_MODE_LITERAL,
+};
+
+void json_stream_init(struct json_stream *js, uint8_t *stack,
+		      size_t stack_size)
+{
+	js->pos = NULL;
+	js->end = NULL;
+	js->stack = stack;
+	js->stack_size = stack_size;
+	js->depth = 0;
+	js->expect = JSON_EXPECT_VALUE;
+	js->mode = JSON_MODE_NONE;
+	js->literal = 0;
+	js->literal_idx = 0;
+}
+
+void json_stream_feed(struct json_stream *js, const char *data, size_t len)
+{
+	js->pos = data;
+	js->end = data + len;
+}
+
+static void stream_fragment(struct json_stream_token *tok,
+			    enum json_tokens type, const char *start,
+			    const char *end, bool partial, bool is_key)
+{
+	tok->type = type;
+	tok->start = start;
+	tok->length = (size_t)(end - start);
+	tok->partial = partial;
+	tok->is_key = is_key;
+}
+
+/* A complete value was produced: decide what comes next from the
+ * enclosing container.
+ */
+static void stream_value_done(struct json_stream *js)
+{
+	js->expect = (js->depth == 0) ? JSON_EXPECT_DONE
+				      : JSON_EXPECT_COMMA_OR_END;
+}
+
+static bool stream_expects_value(const struct json_stream *js)
+{
+	return (js->expect == JSON_EXPECT_VALUE) ||
+	       (js->expect == JSON_EXPECT_VALUE_OR_END);
+}
+
+static int stream_string(struct json_stream *js,
+			 struct json_stream_token *tok)
+{
+	bool is_key = (js->expect == JSON_EXPECT_KEY) ||
+		      (js->expect == JSON_EXPECT_KEY_OR_END);
+	const char *start = js->pos;
+
+	while (js->pos < js->end) {
+		char chr = *js->pos;
+
+		if (js->mode == JSON_MODE_STRING_ESCAPE) {
+			js->mode = JSON_MODE_STRING;
+		} else if (chr == '\\') {
+			js->mode = JSON_MODE_STRING_ESCAPE;
+		} else if (chr == '"') {
+			stream_fragment(tok, JSON_TOK_STRING, start, js->pos,
+					false, is_key);
+			js->pos++;
+			js->mode = JSON_MODE_NONE;
+			if (is_key) {
+				js->expect = JSON_EXPECT_COLON;
+			} else {
+				stream_value_done(js);
+			}
+			return 0;
+		} else if ((chr >= '\0') && (chr < ' ')) {
+			return -EINVAL;
+		}
+		js->pos++;
+	}
+
+	if (js->pos == start) {
+		return -EAGAIN;
+	}
+
+	stream_fragment(tok, JSON_TOK_STRING, start, js->pos, true, is_key);
+	return 0;
+}
+
+static bool stream_number_char(char chr)
+{
+	return isdigit((unsigned char)chr) || (chr == '+') || (chr == '-') ||
+	       (chr == '.') || (chr == 'e') || (chr == 'E');
+}
+
+static int stream_number(struct json_stream *js,
+			 struct json_stream_token *tok)
+{
+	const char *start = js->pos;
+
+	while ((js->pos < js->end) && stream_number_char(*js->pos)) {
+		js->pos++;
+	}
+
+	if (js->pos < js->end) {
+		/* Hit a delimiter: the number is complete.  The
+		 * delimiter itself is handled on the next call.
+		 */
+		stream_fragment(tok, JSON_TOK_NUMBER, start, js->pos, false,
+				false);
+		js->mode = JSON_MODE_NONE;
+		stream_value_done(js);
+		return 0;
+	}
+
+	if (js->pos == start) {
+		return -EAGAIN;
+	}
+
+	stream_fragment(tok, JSON_TOK_NUMBER, start, js->pos, true, false);
+	return 0;
+}
+
+static int stream_literal(struct json_stream *js,
+			  struct json_stream_token *tok,
+			  enum json_tokens type)
+{
+	static const char true_str[] = "true";
+	static const char false_str[] = "false";
+	static const char null_str[] = "null";
+	const char *match;
+
+	switch (type) {
+	case JSON_TOK_TRUE:
+		match = true_str;
+		break;
+	case JSON_TOK_FALSE:
+		match = false_str;
+		break;
+	default:
+		match = null_str;
+		break;
+	}
+
+	while (match[js->literal_idx] != '\0') {
+		if (js->pos == js->end) {
+			return -EAGAIN;
+		}
+		if (*js->pos != match[js->literal_idx]) {
+			return -EINVAL;
+		}
+		js->pos++;
+		js->literal_idx++;
+	}
+
+	stream_fragment(tok, type, NULL, NULL, false, false);
+	js->mode = JSON_MODE_NONE;
+	js->literal_idx = 0;
+	stream_value_done(js);
+	return 0;
+}
+
+static int stream_pop(struct json_stream *js, struct json_stream_token *tok,
+		      enum json_tokens type)
+{
+	uint8_t container = (type == JSON_TOK_OBJECT_END)
+				    ? JSON_TOK_OBJECT_START
+				    : JSON_TOK_ARRAY_START;
+
+	if ((js->depth == 0) || (js->stack[js->depth - 1] != container)) {
+		return -EINVAL;
+	}
+
+	js->depth--;
+	js->pos++;
+	stream_fragment(tok, type, NULL, NULL, false, false);
+	stream_value_done(js);
+	return 0;
+}
+
+int json_stream_next(struct json_stream *js, struct json_stream_token *tok)
+{
+	enum json_tokens literal_type;
+
+	switch (js->mode) {
+	case JSON_MODE_STRING:
+	case JSON_MODE_STRING_ESCAPE:
+		return stream_string(js, tok);
+	case JSON_MODE_NUMBER:
+		return stream_number(js, tok);
+	case JSON_MODE_LITERAL:
+		literal_type = (enum json_tokens)js->literal;
+		return stream_literal(js, tok, literal_type);
+	default:
+		break;
+	}
+
+	while (js->pos < js->end) {
+		char chr = *js->pos;
+
+		if (isspace((unsigned char)chr)) {
+			js->pos++;
+			continue;
+		}
+
+		switch (chr) {
+		case '{':
+		case '[':
+			if (!stream_expects_value(js)) {
+				return -EINVAL;
+			}
+			if (js->depth >= js->stack_size) {
+				return -ENOMEM;
+			}
+			js->stack[js->depth++] = (uint8_t)chr;
+			js->pos++;
+			js->expect = (chr == '{') ? JSON_EXPECT_KEY_OR_END
+						  : JSON_EXPECT_VALUE_OR_END;
+			stream_fragment(tok, (enum json_tokens)chr, NULL,
+					NULL, false, false);
+			return 0;
+		case '}':
+			if ((js->expect != JSON_EXPECT_KEY_OR_END) &&
+			    (js->expect != JSON_EXPECT_COMMA_OR_END)) {
+				return -EINVAL;
+			}
+			return stream_pop(js, tok, JSON_TOK_OBJECT_END);
+		case ']':
+			if ((js->expect != JSON_EXPECT_VALUE_OR_END) &&
+			    (js->expect != JSON_EXPECT_COMMA_OR_END)) {
+				return -EINVAL;
+			}
+			return stream_pop(js, tok, JSON_TOK_ARRAY_END);
+		case ':':
+			if (js->expect != JSON_EXPECT_COLON) {
+				return -EINVAL;
+			}
+			js->pos++;
+			js->expect = JSON_EXPECT_VALUE;
+			continue;
+		case ',':
+			if (js->expect != JSON_EXPECT_COMMA_OR_END) {
+				return -EINVAL;
+			}
+			js->pos++;
+			js->expect = (js->stack[js->depth - 1] == '{')
+					     ? JSON_EXPECT_KEY
+					     : JSON_EXPECT_VALUE;
+			continue;
+		case '"':
+			if (!stream_expects_value(js) &&
+			    (js->expect != JSON_EXPECT_KEY) &&
+			    (js->expect != JSON_EXPECT_KEY_OR_END)) {
+				return -EINVAL;
+			}
+			js->pos++;
+			js->mode = JSON_MODE_STRING;
+			return stream_string(js, tok);
+		case 't':
+		case 'f':
+		case 'n':
+			if (!stream_expects_value(js)) {
+				return -EINVAL;
+			}
+			js->mode = JSON_MODE_LITERAL;
+			js->literal = (uint8_t)chr;
+			return stream_literal(js, tok, (enum json_tokens)chr);
+		default:
+			if (stream_number_char(chr) &&
+			    stream_expects_value(js)) {
+				js->mode = JSON_MODE_NUMBER;
+				return stream_number(js, tok);
+			}
+			return -EINVAL;
+		}
+	}
+
+	return -EAGAIN;
+}
+
+int json_stream_finish(struct json_stream *js, struct json_stream_token *tok)
+{
+	if (js->mode == JSON_MODE_NUMBER) {
+		/* Nothing terminates a trailing top-level number but
+		 * the end of the document itself.
+		 */
+		stream_fragment(tok, JSON_TOK_NUMBER, NULL, NULL, false,
+				false);
+		js->mode = JSON_MODE_NONE;
+		stream_value_done(js);
+	} else {
+		stream_fragment(tok, JSON_TOK_EOF, NULL, NULL, false, false);
+	}
+
+	if ((js->mode != JSON_MODE_NONE) ||
+	    (js->expect != JSON_EXPECT_DONE)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
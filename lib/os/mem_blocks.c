@@ -123,6 +123,7 @@ int sys_mem_blocks_alloc(sys_mem_blocks_t *mem_block, size_t count,
 {
 	int ret = 0;
 	int i;
+	void *ptr;
 
 	__ASSERT_NO_MSG(mem_block != NULL);
 	__ASSERT_NO_MSG(out_blocks != NULL);
@@ -140,8 +141,30 @@ int sys_mem_blocks_alloc(sys_mem_blocks_t *mem_block, size_t count,
 		goto out;
 	}
 
+	/* Bulk path: try to carve all blocks as one contiguous run,
+	 * which costs a single bitmap transaction instead of one per
+	 * block.  Fall back to gathering scattered blocks one by one
+	 * when fragmentation prevents it.
+	 */
+	ptr = alloc_blocks(mem_block, count);
+
+	if (ptr != NULL) {
+		for (i = 0; i < count; i++) {
+			out_blocks[i] = (uint8_t *)ptr +
+					((size_t)i << mem_block->blk_sz_shift);
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_LISTENER
+			heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(mem_block),
+						   out_blocks[i],
+						   BIT(mem_block->blk_sz_shift));
+#endif
+		}
+
+		goto out;
+	}
+
 	for (i = 0; i < count; i++) {
-		void *ptr = alloc_blocks(mem_block, 1);
+		ptr = alloc_blocks(mem_block, 1);
 
 		if (ptr == NULL) {
 			break;
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/mpmc_ring.h>
+#include <string.h>
+#include <errno.h>
+
+/* Bounded MPMC queue in the style described by Dmitry Vyukov: each
+ * slot carries a sequence stamp encoding both its position in the ring
+ * and whether it currently holds a published item.  A slot at index i
+ * is free for the producer at position p (p & mask == i) when its
+ * stamp equals p, and holds an item for the consumer at position p
+ * when its stamp equals p + 1.  Claiming is a compare-and-set on the
+ * respective position counter; publishing/releasing is a single stamp
+ * store, so producers and consumers never take a common lock and the
+ * only cross-role traffic is the slot itself.
+ */
+
+static inline atomic_val_t *slot_seq(struct mpmc_ring *ring, atomic_val_t pos)
+{
+	return &ring->seq[(uint32_t)pos & ring->mask];
+}
+
+static inline void *slot_data(struct mpmc_ring *ring, atomic_val_t pos)
+{
+	return &ring->data[((uint32_t)pos & ring->mask) * ring->item_size];
+}
+
+static inline uint32_t slot_index(struct mpmc_ring *ring, void *slot)
+{
+	return (uint32_t)((uint8_t *)slot - ring->data) / ring->item_size;
+}
+
+int mpmc_ring_init(struct mpmc_ring *ring, void *data, atomic_val_t *seq,
+		   uint32_t item_count, uint32_t item_size)
+{
+	if (!is_power_of_two(item_count)) {
+		return -EINVAL;
+	}
+
+	ring->data = data;
+	ring->seq = seq;
+	ring->mask = item_count - 1;
+	ring->item_size = item_size;
+	atomic_set(&ring->enq_pos, 0);
+	atomic_set(&ring->deq_pos, 0);
+
+	for (uint32_t i = 0; i < item_count; i++) {
+		seq[i] = (atomic_val_t)i;
+	}
+
+	return 0;
+}
+
+void *mpmc_ring_put_claim(struct mpmc_ring *ring)
+{
+	atomic_val_t pos = atomic_get(&ring->enq_pos);
+
+	for (;;) {
+		atomic_val_t seq = atomic_get((atomic_t *)slot_seq(ring, pos));
+		intptr_t dif = (intptr_t)(seq - pos);
+
+		if (dif == 0) {
+			/* Slot is free for this position; claim it */
+			if (atomic_cas(&ring->enq_pos, pos, pos + 1)) {
+				return slot_data(ring, pos);
+			}
+			/* Another producer won the race, retry with the
+			 * updated position
+			 */
+			pos = atomic_get(&ring->enq_pos);
+		} else if (dif < 0) {
+			/* Slot still holds an unconsumed item: full */
+			return NULL;
+		} else {
+			/* Another producer advanced past us */
+			pos = atomic_get(&ring->enq_pos);
+		}
+	}
+}
+
+void mpmc_ring_put_finish(struct mpmc_ring *ring, void *slot)
+{
+	atomic_t *seq = (atomic_t *)&ring->seq[slot_index(ring, slot)];
+
+	/* The stamp still holds the claimed position (only the owner
+	 * may touch it between claim and finish); bumping it to
+	 * position + 1 publishes the item
+	 */
+	atomic_set(seq, atomic_get(seq) + 1);
+}
+
+void *mpmc_ring_get_claim(struct mpmc_ring *ring)
+{
+	atomic_val_t pos = atomic_get(&ring->deq_pos);
+
+	for (;;) {
+		atomic_val_t seq = atomic_get((atomic_t *)slot_seq(ring, pos));
+		intptr_t dif = (intptr_t)(seq - (pos + 1));
+
+		if (dif == 0) {
+			/* Slot holds the item for this position */
+			if (atomic_cas(&ring->deq_pos, pos, pos + 1)) {
+				return slot_data(ring, pos);
+			}
+			pos = atomic_get(&ring->deq_pos);
+		} else if (dif < 0) {
+			/* Item not published yet: empty */
+			return NULL;
+		} else {
+			/* Another consumer advanced past us */
+			pos = atomic_get(&ring->deq_pos);
+		}
+	}
+}
+
+void mpmc_ring_get_finish(struct mpmc_ring *ring, void *slot)
+{
+	atomic_t *seq = (atomic_t *)&ring->seq[slot_index(ring, slot)];
+
+	/* Stamp holds position + 1; advance it a full lap so the slot
+	 * reads as free when the producers come around again
+	 */
+	atomic_set(seq, atomic_get(seq) + (atomic_val_t)ring->mask);
+}
+
+int mpmc_ring_put(struct mpmc_ring *ring, const void *item)
+{
+	void *slot = mpmc_ring_put_claim(ring);
+
+	if (slot == NULL) {
+		return -ENOMEM;
+	}
+
+	memcpy(slot, item, ring->item_size);
+	mpmc_ring_put_finish(ring, slot);
+
+	return 0;
+}
+
+int mpmc_ring_get(struct mpmc_ring *ring, void *item)
+{
+	void *slot = mpmc_ring_get_claim(ring);
+
+	if (slot == NULL) {
+		return -EAGAIN;
+	}
+
+	memcpy(item, slot, ring->item_size);
+	mpmc_ring_get_finish(ring, slot);
+
+	return 0;
+}
@@ -404,6 +404,54 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 	return item;
 }
 
+size_t mpsc_pbuf_alloc_batch(struct mpsc_pbuf_buffer *buffer,
+			     const size_t *wlen, size_t cnt,
+			     union mpsc_pbuf_generic **packets)
+{
+	k_spinlock_key_t key;
+	size_t alloc_cnt = 0;
+
+	key = k_spin_lock(&buffer->lock);
+
+	while (alloc_cnt < cnt) {
+		uint32_t free_wlen;
+		bool wrap = free_space(buffer, &free_wlen);
+
+		if ((wlen[alloc_cnt] <= buffer->size) &&
+		    (free_wlen >= wlen[alloc_cnt])) {
+			union mpsc_pbuf_generic *item = (union mpsc_pbuf_generic *)
+				&buffer->buf[buffer->tmp_wr_idx];
+
+			item->hdr.valid = 0;
+			item->hdr.busy = 0;
+			tmp_wr_idx_inc(buffer, wlen[alloc_cnt]);
+			packets[alloc_cnt++] = item;
+		} else if (wrap) {
+			add_skip_item(buffer, free_wlen);
+		} else {
+			/* No pending or dropping on the batch path; the
+			 * caller falls back to mpsc_pbuf_alloc() for the
+			 * remainder.
+			 */
+			break;
+		}
+	}
+
+	k_spin_unlock(&buffer->lock, key);
+
+	MPSC_PBUF_DBG(buffer, "batch allocated %d of %d packets",
+		      (int)alloc_cnt, (int)cnt);
+
+	if (IS_ENABLED(CONFIG_MPSC_CLEAR_ALLOCATED)) {
+		/* During test fill with 0's to simplify message comparison */
+		for (size_t i = 0; i < alloc_cnt; i++) {
+			memset(packets[i], 0, sizeof(int) * wlen[i]);
+		}
+	}
+
+	return alloc_cnt;
+}
+
 void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 		       union mpsc_pbuf_generic *item)
 {
@@ -418,6 +466,22 @@ void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 	MPSC_PBUF_DBG(buffer, "committed %p", item);
 }
 
+void mpsc_pbuf_commit_batch(struct mpsc_pbuf_buffer *buffer,
+			    union mpsc_pbuf_generic *const *packets,
+			    size_t cnt)
+{
+	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+	for (size_t i = 0; i < cnt; i++) {
+		packets[i]->hdr.valid = 1;
+		buffer->wr_idx = idx_inc(buffer, buffer->wr_idx,
+					 buffer->get_wlen(packets[i]));
+	}
+	max_utilization_update(buffer);
+	k_spin_unlock(&buffer->lock, key);
+	MPSC_PBUF_DBG(buffer, "batch committed %d packets", (int)cnt);
+}
+
 void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 			    const union mpsc_pbuf_generic item,
 			    const void *data)
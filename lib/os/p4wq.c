@@ -78,23 +78,58 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 	k_spinlock_key_t k = k_spin_lock(&queue->lock);
 
 	while (true) {
+		struct k_p4wq *src = queue;
 		struct rbnode *r = rb_get_max(&queue->queue);
 
+#ifdef CONFIG_P4WQ_WORK_STEALING
+		if ((r == NULL) && (queue->flags & K_P4WQ_WORK_STEALING)) {
+			/* Our own queue is empty, probe the siblings
+			 * for pending work before going idle.  Never
+			 * hold two queue locks at once (two threads
+			 * stealing from each other would deadlock), so
+			 * drop ours while walking the ring.
+			 */
+			k_spin_unlock(&queue->lock, k);
+			src = NULL;
+
+			for (struct k_p4wq *q = queue->steal_next;
+			     (q != NULL) && (q != queue); q = q->steal_next) {
+				k = k_spin_lock(&q->lock);
+				r = rb_get_max(&q->queue);
+				if (r != NULL) {
+					src = q;
+					break;
+				}
+				k_spin_unlock(&q->lock, k);
+			}
+
+			if (src == NULL) {
+				/* Nothing to steal, recheck our queue
+				 * (items may have arrived while the
+				 * lock was dropped) before pending.
+				 */
+				src = queue;
+				k = k_spin_lock(&queue->lock);
+				r = rb_get_max(&queue->queue);
+			}
+		}
+#endif
+
 		if (r) {
 			struct k_p4wq_work *w
 				= CONTAINER_OF(r, struct k_p4wq_work, rbnode);
 
-			rb_remove(&queue->queue, r);
+			rb_remove(&src->queue, r);
 			w->thread = _current;
-			sys_dlist_append(&queue->active, &w->dlnode);
+			sys_dlist_append(&src->active, &w->dlnode);
 			set_prio(_current, w);
 			thread_clear_requeued(_current);
 
-			k_spin_unlock(&queue->lock, k);
+			k_spin_unlock(&src->lock, k);
 
 			w->handler(w);
 
-			k = k_spin_lock(&queue->lock);
+			k = k_spin_lock(&src->lock);
 
 			/* Remove from the active list only if it
 			 * wasn't resubmitted already
@@ -104,6 +139,11 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 				w->thread = NULL;
 				k_sem_give(&w->done_sem);
 			}
+
+			if (src != queue) {
+				k_spin_unlock(&src->lock, k);
+				k = k_spin_lock(&queue->lock);
+			}
 		} else {
 			z_pend_curr(&queue->lock, k, &queue->waitq, K_FOREVER);
 			k = k_spin_lock(&queue->lock);
@@ -180,6 +220,17 @@ static int static_init(const struct device *dev)
 			}
 #endif
 		}
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+		if ((pp->flags & K_P4WQ_WORK_STEALING) &&
+		    (pp->flags & K_P4WQ_QUEUE_PER_THREAD)) {
+			/* Link the pool's queues into a stealing ring */
+			for (int i = 0; i < pp->num; i++) {
+				pp->queue[i].steal_next =
+					&pp->queue[(i + 1) % pp->num];
+			}
+		}
+#endif
 	}
 
 	return 0;
@@ -277,6 +328,34 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 	struct k_thread *th = z_unpend_first_thread(&queue->waitq);
 
 	if (th == NULL) {
+#ifdef CONFIG_P4WQ_WORK_STEALING
+		if (queue->flags & K_P4WQ_WORK_STEALING) {
+			/* All of our own threads are busy.  Wake an
+			 * idle sibling thread, which will find the item
+			 * through the stealing path in p4wq_loop().
+			 * Probing a sibling waitq needs its lock, so
+			 * drop ours first; worst case the wakeup is
+			 * spurious and the thread pends again.
+			 */
+			k_spin_unlock(&queue->lock, k);
+
+			for (struct k_p4wq *q = queue->steal_next;
+			     (q != NULL) && (q != queue); q = q->steal_next) {
+				k = k_spin_lock(&q->lock);
+				th = z_unpend_first_thread(&q->waitq);
+				if (th != NULL) {
+					set_prio(th, item);
+					z_ready_thread(th);
+					z_reschedule(&q->lock, k);
+					return;
+				}
+				k_spin_unlock(&q->lock, k);
+			}
+
+			LOG_WRN("Out of worker threads, priority guarantee violated");
+			return;
+		}
+#endif
 		LOG_WRN("Out of worker threads, priority guarantee violated");
 		goto out;
 	}
@@ -16,35 +16,61 @@ static struct sys_heap heap_pool[MAX_SHARED_MULTI_HEAP_ATTR][MAX_MULTI_HEAPS];
 
 static unsigned int attr_cnt[MAX_SHARED_MULTI_HEAP_ATTR];
 
+#ifdef CONFIG_SHARED_MULTI_HEAP_STATS
+static struct {
+	uint32_t hits;
+	uint32_t misses;
+} heap_stats[MAX_SHARED_MULTI_HEAP_ATTR][MAX_MULTI_HEAPS];
+#endif
+
+/* Allocation request as handed to the choice function: an ordered list
+ * of acceptable attributes, most preferred first.
+ */
+struct smh_alloc_spec {
+	const unsigned int *attrs;
+	size_t n_attr;
+};
+
 static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
 {
+	const struct smh_alloc_spec *spec = cfg;
 	struct sys_heap *h;
 	unsigned int attr;
 	void *block;
 
-	attr = (unsigned int)(long) cfg;
-
-	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || size == 0) {
+	if (size == 0) {
 		return NULL;
 	}
 
-	/* Set in case the user requested a non-existing attr */
-	block = NULL;
-
-	for (size_t hdx = 0; hdx < attr_cnt[attr]; hdx++) {
-		h = &heap_pool[attr][hdx];
+	for (size_t adx = 0; adx < spec->n_attr; adx++) {
+		attr = spec->attrs[adx];
 
-		if (h->heap == NULL) {
-			return NULL;
+		if (attr >= MAX_SHARED_MULTI_HEAP_ATTR) {
+			continue;
 		}
 
-		block = sys_heap_aligned_alloc(h, align, size);
-		if (block != NULL) {
-			break;
+		for (size_t hdx = 0; hdx < attr_cnt[attr]; hdx++) {
+			h = &heap_pool[attr][hdx];
+
+			if (h->heap == NULL) {
+				break;
+			}
+
+			block = sys_heap_aligned_alloc(h, align, size);
+			if (block != NULL) {
+#ifdef CONFIG_SHARED_MULTI_HEAP_STATS
+				heap_stats[attr][hdx].hits++;
+#endif
+				return block;
+			}
+#ifdef CONFIG_SHARED_MULTI_HEAP_STATS
+			heap_stats[attr][hdx].misses++;
+#endif
 		}
 	}
 
-	return block;
+	/* No region in the preference list could satisfy the request */
+	return NULL;
 }
 
 int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_data)
@@ -78,13 +104,45 @@ void shared_multi_heap_free(void *block)
 	sys_multi_heap_free(&shared_multi_heap, block);
 }
 
+void *shared_multi_heap_alloc_prefer(const unsigned int *attrs, size_t n_attr,
+				     size_t bytes)
+{
+	struct smh_alloc_spec spec = {
+		.attrs = attrs,
+		.n_attr = n_attr,
+	};
+
+	if (attrs == NULL || n_attr == 0) {
+		return NULL;
+	}
+
+	return sys_multi_heap_alloc(&shared_multi_heap, &spec, bytes);
+}
+
+void *shared_multi_heap_aligned_alloc_prefer(const unsigned int *attrs,
+					     size_t n_attr, size_t align,
+					     size_t bytes)
+{
+	struct smh_alloc_spec spec = {
+		.attrs = attrs,
+		.n_attr = n_attr,
+	};
+
+	if (attrs == NULL || n_attr == 0) {
+		return NULL;
+	}
+
+	return sys_multi_heap_aligned_alloc(&shared_multi_heap, &spec,
+					    align, bytes);
+}
+
 void *shared_multi_heap_alloc(unsigned int attr, size_t bytes)
 {
 	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR) {
 		return NULL;
 	}
 
-	return sys_multi_heap_alloc(&shared_multi_heap, (void *)(long) attr, bytes);
+	return shared_multi_heap_alloc_prefer(&attr, 1, bytes);
 }
 
 void *shared_multi_heap_aligned_alloc(unsigned int attr, size_t align, size_t bytes)
@@ -93,8 +151,39 @@ void *shared_multi_heap_aligned_alloc(unsigned int attr, size_t align, size_t by
 		return NULL;
 	}
 
-	return sys_multi_heap_aligned_alloc(&shared_multi_heap, (void *)(long) attr,
-					    align, bytes);
+	return shared_multi_heap_aligned_alloc_prefer(&attr, 1, align, bytes);
+}
+
+int shared_multi_heap_stats_get(unsigned int attr, unsigned int idx,
+				struct shared_multi_heap_stats *stats)
+{
+#ifdef CONFIG_SHARED_MULTI_HEAP_STATS
+	struct sys_memory_stats hstats;
+	int ret;
+
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || idx >= attr_cnt[attr] ||
+	    stats == NULL) {
+		return -EINVAL;
+	}
+
+	ret = sys_heap_runtime_stats_get(&heap_pool[attr][idx], &hstats);
+	if (ret != 0) {
+		return ret;
+	}
+
+	stats->hits = heap_stats[attr][idx].hits;
+	stats->misses = heap_stats[attr][idx].misses;
+	stats->allocated_bytes = hstats.allocated_bytes;
+	stats->max_allocated_bytes = hstats.max_allocated_bytes;
+
+	return 0;
+#else
+	ARG_UNUSED(attr);
+	ARG_UNUSED(idx);
+	ARG_UNUSED(stats);
+
+	return -ENOSYS;
+#endif
 }
 
 int shared_multi_heap_pool_init(void)
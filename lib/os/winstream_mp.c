@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/winstream.h>
+
+/* Same early-boot constraint as winstream.c: the standard library may
+ * not be available yet, so an internal bytewise copy is the default.
+ */
+#ifndef CONFIG_WINSTREAM_STDLIB_MEMCOPY
+# define MEMCPY(dst, src, n) \
+	do { for (int i = 0; i < (n); i++) { (dst)[i] = (src)[i]; } } while (0)
+#else
+# include <string.h>
+# define MEMCPY memcpy
+#endif
+
+#define WRITE_BARRIER() __asm__ volatile("")
+
+/* Multiple producers coordinate through two cumulative byte counters
+ * that live outside the shared window: 'claim' reserves space and
+ * 'done' counts finished copies.  The window header (start/end/seq) is
+ * only advanced when the two are equal, i.e. when no writer is
+ * mid-copy, so the reader never treats a half-written region as valid
+ * data.  Whoever observes that condition publishes on behalf of
+ * everyone; a writer that finds another publisher active just leaves,
+ * as its bytes are covered by that publisher or by the next write (or
+ * by an explicit sys_winstream_mp_flush() from the read side).
+ */
+static void winstream_mp_publish(struct sys_winstream_mp *mp)
+{
+	struct sys_winstream *ws = mp->ws;
+	uint32_t claim, avail;
+
+	if (!atomic_cas(&mp->publishing, 0, 1)) {
+		return;
+	}
+
+	do {
+		claim = (uint32_t)atomic_get(&mp->claim);
+		if ((uint32_t)atomic_get(&mp->done) != claim) {
+			break;
+		}
+
+		avail = MIN(claim, ws->len - 1);
+		ws->end = claim % ws->len;
+		ws->start = (claim - avail) % ws->len;
+		WRITE_BARRIER();
+		ws->seq = claim;
+	} while ((uint32_t)atomic_get(&mp->claim) != claim);
+
+	atomic_set(&mp->publishing, 0);
+}
+
+void sys_winstream_mp_write(struct sys_winstream_mp *mp,
+			    const char *data, uint32_t len)
+{
+	struct sys_winstream *ws = mp->ws;
+	uint32_t claim, off, suffix;
+
+	/* Writes larger than the window can't be claimed in one piece;
+	 * keep the tail, which is what a reader of a lossy stream wants.
+	 */
+	if (len > ws->len - 1) {
+		data += len - (ws->len - 1);
+		len = ws->len - 1;
+	}
+
+	claim = (uint32_t)atomic_add(&mp->claim, len);
+	off = claim % ws->len;
+
+	suffix = MIN(len, ws->len - off);
+	MEMCPY(&ws->data[off], data, suffix);
+	if (len > suffix) {
+		MEMCPY(&ws->data[0], data + suffix, len - suffix);
+	}
+
+	WRITE_BARRIER();
+	atomic_add(&mp->done, len);
+	winstream_mp_publish(mp);
+}
+
+void sys_winstream_mp_flush(struct sys_winstream_mp *mp)
+{
+	winstream_mp_publish(mp);
+}
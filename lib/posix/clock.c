@@ -20,6 +20,44 @@
 static struct timespec rt_clock_base;
 static struct k_spinlock rt_clock_base_lock;
 
+#ifdef CONFIG_POSIX_CLOCK_GETTIME_CYCLES
+/*
+ * Precomputed factors converting cycles to nanoseconds as
+ * ns = (cycles * cycle_mult) >> cycle_shift, evaluated with a split
+ * multiplication so the intermediate products fit into 64 bits.
+ */
+static uint32_t cycle_mult;
+static uint8_t cycle_shift;
+
+static inline uint64_t cycles_to_ns(uint64_t cycles)
+{
+	return ((cycles >> cycle_shift) * cycle_mult) +
+	       (((cycles & BIT64_MASK(cycle_shift)) * cycle_mult) >>
+		cycle_shift);
+}
+
+static int cycle_conv_init(const struct device *dev)
+{
+	uint64_t freq = sys_clock_hw_cycles_per_sec();
+	uint8_t shift = 32;
+
+	ARG_UNUSED(dev);
+
+	/* Largest shift for which the multiplier fits into 32 bits */
+	while (shift > 0 &&
+	       (((uint64_t)NSEC_PER_SEC << shift) / freq) > UINT32_MAX) {
+		shift--;
+	}
+
+	cycle_mult = (uint32_t)(((uint64_t)NSEC_PER_SEC << shift) / freq);
+	cycle_shift = shift;
+
+	return 0;
+}
+
+SYS_INIT(cycle_conv_init, POST_KERNEL, 0);
+#endif /* CONFIG_POSIX_CLOCK_GETTIME_CYCLES */
+
 /**
  * @brief Get clock time specified by clock_id.
  *
@@ -47,6 +85,12 @@ int z_impl_clock_gettime(clockid_t clock_id, struct timespec *ts)
 		return -1;
 	}
 
+#ifdef CONFIG_POSIX_CLOCK_GETTIME_CYCLES
+	uint64_t elapsed_ns = cycles_to_ns(k_cycle_get_64());
+
+	ts->tv_sec = (time_t) (elapsed_ns / NSEC_PER_SEC);
+	ts->tv_nsec = (int32_t) (elapsed_ns % NSEC_PER_SEC);
+#else
 	uint64_t ticks = k_uptime_ticks();
 	uint64_t elapsed_secs = ticks / CONFIG_SYS_CLOCK_TICKS_PER_SEC;
 	uint64_t nremainder = ticks - elapsed_secs * CONFIG_SYS_CLOCK_TICKS_PER_SEC;
@@ -54,6 +98,7 @@ int z_impl_clock_gettime(clockid_t clock_id, struct timespec *ts)
 	ts->tv_sec = (time_t) elapsed_secs;
 	/* For ns 32 bit conversion can be used since its smaller than 1sec. */
 	ts->tv_nsec = (int32_t) k_ticks_to_ns_floor32(nremainder);
+#endif
 
 	ts->tv_sec += base.tv_sec;
 	ts->tv_nsec += base.tv_nsec;
@@ -53,6 +53,13 @@ struct posix_thread {
 	enum pthread_state state;
 	pthread_mutex_t state_lock;
 	pthread_cond_t state_cond;
+
+#ifdef CONFIG_PTHREAD_STACK_POOL
+	/* Stack borrowed from the stack pool, NULL if caller-provided */
+	void *pool_stack;
+	/* Usable size of the borrowed stack */
+	size_t pool_stacksize;
+#endif
 };
 
 typedef struct pthread_key_obj {
@@ -40,6 +40,120 @@ static const struct pthread_attr init_pthread_attrs = {
 static struct posix_thread posix_thread_pool[CONFIG_MAX_PTHREAD_COUNT];
 static struct k_spinlock pthread_pool_lock;
 
+#ifdef CONFIG_PTHREAD_STACK_POOL
+static K_THREAD_STACK_ARRAY_DEFINE(stack_pool_small,
+				   CONFIG_PTHREAD_STACK_POOL_SMALL_COUNT,
+				   CONFIG_PTHREAD_STACK_POOL_SMALL_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(stack_pool_large,
+				   CONFIG_PTHREAD_STACK_POOL_LARGE_COUNT,
+				   CONFIG_PTHREAD_STACK_POOL_LARGE_SIZE);
+
+/* Bitmasks of stacks handed out, protected by pthread_pool_lock */
+static uint32_t stack_pool_small_used;
+static uint32_t stack_pool_large_used;
+
+/*
+ * Take a free stack from the smallest pool class that can hold the
+ * requested size, rounding the size up to the class. Returns NULL if
+ * all suitable stacks are handed out.
+ */
+static void *stack_pool_alloc(size_t *stacksize)
+{
+	k_spinlock_key_t key;
+	void *stack = NULL;
+	uint32_t i;
+
+	key = k_spin_lock(&pthread_pool_lock);
+
+	if (*stacksize <= CONFIG_PTHREAD_STACK_POOL_SMALL_SIZE) {
+		for (i = 0; i < CONFIG_PTHREAD_STACK_POOL_SMALL_COUNT; i++) {
+			if ((stack_pool_small_used & BIT(i)) == 0U) {
+				stack_pool_small_used |= BIT(i);
+				stack = stack_pool_small[i];
+				*stacksize = K_THREAD_STACK_SIZEOF(
+						stack_pool_small[i]);
+				break;
+			}
+		}
+	}
+
+	if (stack == NULL &&
+	    *stacksize <= CONFIG_PTHREAD_STACK_POOL_LARGE_SIZE) {
+		for (i = 0; i < CONFIG_PTHREAD_STACK_POOL_LARGE_COUNT; i++) {
+			if ((stack_pool_large_used & BIT(i)) == 0U) {
+				stack_pool_large_used |= BIT(i);
+				stack = stack_pool_large[i];
+				*stacksize = K_THREAD_STACK_SIZEOF(
+						stack_pool_large[i]);
+				break;
+			}
+		}
+	}
+
+	k_spin_unlock(&pthread_pool_lock, key);
+
+	return stack;
+}
+
+/* Return a stack taken with stack_pool_alloc() to its pool class. */
+static void stack_pool_release(void *stack)
+{
+	k_spinlock_key_t key;
+	uint32_t i;
+
+	key = k_spin_lock(&pthread_pool_lock);
+
+	for (i = 0; i < CONFIG_PTHREAD_STACK_POOL_SMALL_COUNT; i++) {
+		if (stack == (void *)stack_pool_small[i]) {
+			stack_pool_small_used &= ~BIT(i);
+			goto out;
+		}
+	}
+
+	for (i = 0; i < CONFIG_PTHREAD_STACK_POOL_LARGE_COUNT; i++) {
+		if (stack == (void *)stack_pool_large[i]) {
+			stack_pool_large_used &= ~BIT(i);
+			goto out;
+		}
+	}
+
+out:
+	k_spin_unlock(&pthread_pool_lock, key);
+}
+
+/*
+ * Steal a sufficiently large stack cached with an unallocated thread
+ * structure. Called when all pool classes are exhausted.
+ */
+static void *stack_pool_reclaim(size_t *stacksize)
+{
+	k_spinlock_key_t key;
+	struct posix_thread *thread;
+	void *stack = NULL;
+	uint32_t i;
+
+	key = k_spin_lock(&pthread_pool_lock);
+
+	for (i = 0; i < CONFIG_MAX_PTHREAD_COUNT; i++) {
+		thread = &posix_thread_pool[i];
+		if ((thread->state == PTHREAD_EXITED ||
+		     thread->state == PTHREAD_TERMINATED) &&
+		    thread->pool_stack != NULL &&
+		    thread->pool_stacksize >= *stacksize) {
+			stack = thread->pool_stack;
+			*stacksize = thread->pool_stacksize;
+			thread->pool_stack = NULL;
+			thread->pool_stacksize = 0;
+			break;
+		}
+	}
+
+	k_spin_unlock(&pthread_pool_lock, key);
+
+	return stack;
+}
+#endif /* CONFIG_PTHREAD_STACK_POOL */
+
 pthread_t pthread_self(void)
 {
 	return (struct posix_thread *)
@@ -158,8 +272,21 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *_attr,
 	k_spinlock_key_t cancel_key;
 	pthread_condattr_t cond_attr;
 	struct posix_thread *thread;
+	void *stack;
+	size_t stacksize;
 	const struct pthread_attr *attr = (const struct pthread_attr *)_attr;
 
+#ifdef CONFIG_PTHREAD_STACK_POOL
+	/* A missing stack, or no attribute object at all, is served from
+	 * the stack pool.
+	 */
+	if (attr == NULL) {
+		attr = &init_pthread_attrs;
+	} else if ((attr->initialized == 0U) ||
+		   (attr->stack != NULL && attr->stacksize == 0)) {
+		return EINVAL;
+	}
+#else
 	/*
 	 * FIXME: Pthread attribute must be non-null and it provides stack
 	 * pointer and stack size. So even though POSIX 1003.1 spec accepts
@@ -169,6 +296,10 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *_attr,
 	    || (attr->stack == NULL) || (attr->stacksize == 0)) {
 		return EINVAL;
 	}
+#endif
+
+	stack = attr->stack;
+	stacksize = attr->stacksize;
 
 	key = k_spin_lock(&pthread_pool_lock);
 	for (pthread_num = 0;
@@ -185,6 +316,49 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *_attr,
 		return EAGAIN;
 	}
 
+#ifdef CONFIG_PTHREAD_STACK_POOL
+	if (stack == NULL) {
+		if (stacksize == 0) {
+			stacksize = CONFIG_PTHREAD_STACK_POOL_SMALL_SIZE;
+		}
+
+		if (thread->pool_stack != NULL &&
+		    stacksize <= thread->pool_stacksize) {
+			/* Fast path, reuse the stack cached with the
+			 * recycled thread structure.
+			 */
+			stack = thread->pool_stack;
+			stacksize = thread->pool_stacksize;
+		} else {
+			if (thread->pool_stack != NULL) {
+				stack_pool_release(thread->pool_stack);
+				thread->pool_stack = NULL;
+				thread->pool_stacksize = 0;
+			}
+
+			stack = stack_pool_alloc(&stacksize);
+			if (stack == NULL) {
+				stack = stack_pool_reclaim(&stacksize);
+			}
+
+			if (stack == NULL) {
+				key = k_spin_lock(&pthread_pool_lock);
+				thread->state = PTHREAD_EXITED;
+				k_spin_unlock(&pthread_pool_lock, key);
+				return EAGAIN;
+			}
+
+			thread->pool_stack = stack;
+			thread->pool_stacksize = stacksize;
+		}
+	} else if (thread->pool_stack != NULL) {
+		/* The caller provides the stack, return the cached one */
+		stack_pool_release(thread->pool_stack);
+		thread->pool_stack = NULL;
+		thread->pool_stacksize = 0;
+	}
+#endif
+
 	rv = pthread_mutex_init(&thread->state_lock, NULL);
 	if (rv != 0) {
 		key = k_spin_lock(&pthread_pool_lock);
@@ -208,7 +382,7 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *_attr,
 	sys_slist_init(&thread->key_list);
 
 	*newthread = pthread_num;
-	k_thread_create(&thread->thread, attr->stack, attr->stacksize,
+	k_thread_create(&thread->thread, stack, stacksize,
 			(k_thread_entry_t)zephyr_thread_wrapper, (void *)arg, NULL, threadroutine,
 			prio, (~K_ESSENTIAL & attr->flags), K_MSEC(attr->delayedstart));
 	return 0;
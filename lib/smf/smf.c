@@ -20,9 +20,29 @@ struct internal_ctx {
 	bool exit      : 1;
 };
 
+#ifdef CONFIG_SMF_STATE_CHAINS
+/*
+ * Ancestor-or-self test on precomputed chains. The chains are ordered by
+ * depth, so it is enough to compare the entry at the ancestor's depth.
+ */
+static bool chain_contains(const struct smf_state *state,
+			   const struct smf_state *ancestor)
+{
+	return state->depth >= ancestor->depth &&
+	       state->chain[ancestor->depth - 1] == ancestor;
+}
+#endif
+
 static bool share_paren(const struct smf_state *test_state,
 			const struct smf_state *target_state)
 {
+#ifdef CONFIG_SMF_STATE_CHAINS
+	if (test_state != NULL && test_state->chain != NULL &&
+	    target_state->chain != NULL) {
+		return chain_contains(test_state, target_state);
+	}
+#endif
+
 	for (const struct smf_state *state = test_state;
 	     state != NULL;
 	     state = state->parent) {
@@ -78,6 +98,27 @@ __unused static bool smf_execute_ancestor_entry_actions(
 {
 	struct internal_ctx * const internal = (void *) &ctx->internal;
 
+#ifdef CONFIG_SMF_STATE_CHAINS
+	if (target->chain != NULL) {
+		/* Walk the precomputed chain, topmost ancestor first */
+		for (uint8_t i = 0; (uint8_t)(i + 1) < target->depth; i++) {
+			const struct smf_state *to_execute = target->chain[i];
+
+			if (!last_state_share_paren(ctx, to_execute) &&
+			    to_execute->entry) {
+				to_execute->entry(ctx);
+
+				/* No need to continue if terminate was set */
+				if (internal->terminate) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+#endif
+
 	for (const struct smf_state *to_execute = get_last_of(target);
 	     to_execute != NULL && to_execute != target;
 	     to_execute = get_child_of(target, to_execute)) {
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/uart_async_rx.h>
+
+static struct uart_async_rx_buf *get_buf(struct uart_async_rx *rx, uint8_t idx)
+{
+	return (struct uart_async_rx_buf *)&rx->buf[idx * rx->buf_len];
+}
+
+static struct uart_async_rx_buf *hdr_from_buffer(uint8_t *buffer)
+{
+	return CONTAINER_OF(buffer, struct uart_async_rx_buf, buffer);
+}
+
+static uint8_t inc_idx(struct uart_async_rx *rx, uint8_t idx)
+{
+	return (idx + 1) < rx->buf_cnt ? (idx + 1) : 0;
+}
+
+int uart_async_rx_init(struct uart_async_rx *rx,
+		       const struct uart_async_rx_config *config)
+{
+	size_t buf_len;
+
+	if (config->buf_cnt < 2) {
+		return -EINVAL;
+	}
+
+	buf_len = config->length / config->buf_cnt;
+	if ((buf_len <= offsetof(struct uart_async_rx_buf, buffer)) ||
+	    ((buf_len - offsetof(struct uart_async_rx_buf, buffer)) > UINT8_MAX)) {
+		return -EINVAL;
+	}
+
+	memset(rx, 0, sizeof(*rx));
+	rx->buf = config->buffer;
+	rx->buf_len = buf_len;
+	rx->buf_cnt = config->buf_cnt;
+
+	uart_async_rx_reset(rx);
+
+	return 0;
+}
+
+uint8_t *uart_async_rx_buf_req(struct uart_async_rx *rx)
+{
+	struct uart_async_rx_buf *buf;
+
+	if (atomic_get(&rx->free_cnt) == 0) {
+		return NULL;
+	}
+
+	buf = get_buf(rx, rx->drv_idx);
+	rx->drv_idx = inc_idx(rx, rx->drv_idx);
+	atomic_dec(&rx->free_cnt);
+
+	return buf->buffer;
+}
+
+void uart_async_rx_on_rdy(struct uart_async_rx *rx, uint8_t *buffer, size_t length)
+{
+	struct uart_async_rx_buf *buf = hdr_from_buffer(buffer);
+
+	buf->wr_idx += length;
+	atomic_add(&rx->pending_bytes, length);
+}
+
+void uart_async_rx_on_buf_rel(struct uart_async_rx *rx, uint8_t *buffer)
+{
+	struct uart_async_rx_buf *buf = hdr_from_buffer(buffer);
+
+	ARG_UNUSED(rx);
+
+	buf->completed = 1;
+}
+
+/* Return a fully consumed buffer to the pool of free buffers. */
+static void release_rd_buf(struct uart_async_rx *rx, struct uart_async_rx_buf *buf)
+{
+	buf->wr_idx = 0;
+	buf->completed = 0;
+	rx->rd_off = 0;
+	rx->rd_idx = inc_idx(rx, rx->rd_idx);
+	atomic_inc(&rx->free_cnt);
+}
+
+size_t uart_async_rx_data_claim(struct uart_async_rx *rx, uint8_t **data, size_t length)
+{
+	struct uart_async_rx_buf *buf;
+
+	if (atomic_get(&rx->pending_bytes) == 0) {
+		return 0;
+	}
+
+	buf = get_buf(rx, rx->rd_idx);
+	while (rx->rd_off == buf->wr_idx) {
+		if (!buf->completed) {
+			/* Pending data was reported for a following buffer
+			 * before this one was released by the driver.
+			 */
+			return 0;
+		}
+
+		release_rd_buf(rx, buf);
+		buf = get_buf(rx, rx->rd_idx);
+	}
+
+	*data = &buf->buffer[rx->rd_off];
+
+	return MIN(length, (size_t)(buf->wr_idx - rx->rd_off));
+}
+
+bool uart_async_rx_data_consumed(struct uart_async_rx *rx, size_t length)
+{
+	struct uart_async_rx_buf *buf = get_buf(rx, rx->rd_idx);
+
+	rx->rd_off += length;
+	atomic_sub(&rx->pending_bytes, length);
+
+	if (buf->completed && (rx->rd_off == buf->wr_idx)) {
+		release_rd_buf(rx, buf);
+		return true;
+	}
+
+	return false;
+}
+
+void uart_async_rx_reset(struct uart_async_rx *rx)
+{
+	rx->drv_idx = 0;
+	rx->rd_idx = 0;
+	rx->rd_off = 0;
+	atomic_set(&rx->pending_bytes, 0);
+	atomic_set(&rx->free_cnt, rx->buf_cnt);
+
+	for (uint8_t i = 0; i < rx->buf_cnt; i++) {
+		struct uart_async_rx_buf *buf = get_buf(rx, i);
+
+		buf->wr_idx = 0;
+		buf->completed = 0;
+	}
+}
@@ -4,6 +4,7 @@
 #
 # SPDX-License-Identifier: Apache-2.0
 
+import io
 import logging
 import struct
 
@@ -11,9 +12,13 @@ import struct
 # Note: keep sync with C code
 COREDUMP_HDR_ID = b'ZE'
 COREDUMP_HDR_VER = 1
+COREDUMP_HDR_FLAG_LZ4 = 0x1
 LOG_HDR_STRUCT = "<ccHHBBI"
 LOG_HDR_SIZE = struct.calcsize(LOG_HDR_STRUCT)
 
+LOG_LZ4_BLK_HDR_STRUCT = "<HH"
+LOG_LZ4_BLK_HDR_SIZE = struct.calcsize(LOG_LZ4_BLK_HDR_STRUCT)
+
 COREDUMP_ARCH_HDR_ID = b'A'
 LOG_ARCH_HDR_STRUCT = "<cHH"
 LOG_ARCH_HDR_SIZE = struct.calcsize(LOG_ARCH_HDR_STRUCT)
@@ -113,6 +118,40 @@ class CoredumpLogFile:
 
         return True
 
+    def decompress_lz4(self):
+        try:
+            import lz4.block
+        except ImportError:
+            logger.error("Cannot import lz4 module to decompress coredump, "
+                         "need to run 'pip install lz4'")
+            return False
+
+        data = bytearray()
+        while True:
+            blk_hdr = self.fd.read(LOG_LZ4_BLK_HDR_SIZE)
+            if not blk_hdr:
+                # no more data to read
+                break
+
+            if len(blk_hdr) != LOG_LZ4_BLK_HDR_SIZE:
+                logger.error("Truncated LZ4 block header")
+                return False
+
+            comp_bytes, orig_bytes = struct.unpack(LOG_LZ4_BLK_HDR_STRUCT, blk_hdr)
+
+            blk = self.fd.read(comp_bytes)
+            if len(blk) != comp_bytes:
+                logger.error("Truncated LZ4 block")
+                return False
+
+            data += lz4.block.decompress(blk, uncompressed_size=orig_bytes)
+
+        # Parse the sections from the decompressed stream
+        self.fd.close()
+        self.fd = io.BytesIO(bytes(data))
+
+        return True
+
     def parse(self):
         if self.fd is None:
             self.open()
@@ -144,6 +183,12 @@ class CoredumpLogFile:
 
         del id1, id2, hdr_ver, tgt_code, ptr_size, flags, reason
 
+        if self.log_hdr["flags"] & COREDUMP_HDR_FLAG_LZ4:
+            logger.info("Dump is LZ4 compressed")
+            if not self.decompress_lz4():
+                logger.error("Cannot decompress coredump")
+                return False
+
         while True:
             section_id = self.fd.read(1)
             if not section_id:
@@ -47,6 +47,7 @@ STATIC_STRING_SECTIONS = [
     'rodata',
     '.rodata',
     'pinned.rodata',
+    'log_strings_sections',
 ]
 
 
@@ -279,6 +280,13 @@ def extract_logging_subsys_information(elf, database, string_mappings):
     log_const_symbols = find_log_const_symbols(elf)
     parse_log_const_symbols(database, section_log_const, log_const_symbols, string_mappings)
 
+    # Record the base address of the log strings section so the parser
+    # can translate the section offsets emitted by the runtime when
+    # CONFIG_LOG_DICTIONARY_STR_ID is enabled.
+    section_log_strings = find_elf_sections(elf, "log_strings_sections")
+    if section_log_strings is not None:
+        database.set_log_strings_base(section_log_strings['start'])
+
 
 def is_die_attr_ref(attr):
     """
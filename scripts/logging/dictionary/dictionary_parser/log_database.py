@@ -243,6 +243,17 @@ class LogDatabase():
         return f"unknown<{domain_id}:{source_id}>"
 
 
+    def get_log_strings_base(self):
+        """Get the base address of the log strings section,
+        or None if not recorded"""
+        return self.database.get('log_strings_base')
+
+
+    def set_log_strings_base(self, base):
+        """Set the base address of the log strings section"""
+        self.database['log_strings_base'] = base
+
+
     def add_kconfig(self, name, val):
         """Add a kconfig name-value pair into database"""
         self.database['kconfigs'][name] = val
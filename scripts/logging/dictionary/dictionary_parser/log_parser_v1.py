@@ -59,6 +59,9 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPRESSED = 2
+MSG_TYPE_REPEAT = 3
+MSG_TYPE_NORMAL_STR_ID = 4
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -184,8 +187,17 @@ class LogParserV1(LogParser):
 
         if "CONFIG_LOG_TIMESTAMP_64BIT" in self.database.get_kconfigs():
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_64
+            self.timestamp_mask = (1 << 64) - 1
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
+            self.timestamp_mask = (1 << 32) - 1
+
+        # Compressed messages (CONFIG_LOG_DICTIONARY_COMPRESS) encode the
+        # package word by word and timestamps as deltas against the
+        # previous message.
+        self.fmt_pkg_word = endian + "I"
+        self.prev_timestamp = 0
+        self.prev_msg = None
 
         self.data_types = DataTypes(self.database)
 
@@ -442,6 +454,133 @@ class LogParserV1(LogParser):
         return next_msg_offset
 
 
+    @staticmethod
+    def decode_varint(logdata, offset):
+        """Decode one LEB128 encoded value, returning it and the
+        offset of the following byte"""
+        value = 0
+        shift = 0
+
+        while True:
+            byte = logdata[offset]
+            offset += 1
+
+            value |= (byte & 0x7f) << shift
+            shift += 7
+
+            if (byte & 0x80) == 0:
+                break
+
+        return value, offset
+
+
+    @staticmethod
+    def zigzag_decode(value):
+        """Decode a zigzag encoded signed value"""
+        return (value >> 1) ^ -(value & 1)
+
+
+    def parse_synthesized_msg(self, log_desc, source_id, timestamp, body):
+        """Reassemble an uncompressed message from decoded fields and
+        parse it"""
+        synth = struct.pack(self.fmt_msg_hdr, log_desc, source_id)
+        synth += struct.pack(self.fmt_msg_timestamp, timestamp)
+        synth += body
+
+        return self.parse_one_normal_msg(synth, 0)
+
+
+    def translate_str_offsets(self, body):
+        """Translate section offsets of read-only string arguments in a
+        reassembled package back into addresses using the log strings
+        section base recorded in the database"""
+        base = self.database.get_log_strings_base()
+        if base is None:
+            logger.error("------ Database has no log strings section base")
+            return None
+
+        word_size = self.data_types.get_sizeof(DataTypes.INT)
+
+        # Read-only string locations are single bytes holding the
+        # position (in 32-bit words) of the string argument, appended
+        # right after the argument words of the package.
+        pos_start = body[0] * word_size
+        num_ro_str_indexes = body[2]
+
+        body = bytearray(body)
+        for i in range(num_ro_str_indexes):
+            str_offset = body[pos_start + i] * word_size
+            str_id = struct.unpack_from(self.fmt_pkg_word, body, str_offset)[0]
+            struct.pack_into(self.fmt_pkg_word, body, str_offset,
+                             (base + str_id) & 0xffffffff)
+
+        return bytes(body)
+
+
+    def parse_one_compressed_msg(self, logdata, offset, str_id=False):
+        """Parse one compressed log message and print the encoded
+        message"""
+        hdr_byte = logdata[offset]
+        offset += 1
+
+        domain_id = hdr_byte & 0x07
+        level = (hdr_byte >> 3) & 0x07
+
+        source_id, offset = self.decode_varint(logdata, offset)
+        ts_delta, offset = self.decode_varint(logdata, offset)
+        pkg_len, offset = self.decode_varint(logdata, offset)
+        data_len, offset = self.decode_varint(logdata, offset)
+
+        self.prev_timestamp += self.zigzag_decode(ts_delta)
+        self.prev_timestamp &= self.timestamp_mask
+
+        # Package is encoded word by word, trailing bytes of an
+        # unaligned package are verbatim.
+        body = b''
+        while len(body) + 4 <= pkg_len:
+            word, offset = self.decode_varint(logdata, offset)
+            body += struct.pack(self.fmt_pkg_word, word)
+
+        remainder = (pkg_len - len(body)) + data_len
+        body += bytes(logdata[offset:(offset + remainder)])
+        offset += remainder
+
+        if str_id:
+            body = self.translate_str_offsets(body)
+            if body is None:
+                return None
+
+        log_desc = domain_id | (level << 3) | (pkg_len << 6) | (data_len << 16)
+        self.prev_msg = (log_desc, source_id, body)
+
+        if self.parse_synthesized_msg(log_desc, source_id,
+                                      self.prev_timestamp, body) is None:
+            return None
+
+        return offset
+
+
+    def parse_one_repeat_msg(self, logdata, offset):
+        """Parse one repeated message indication and re-print the
+        previous message with the new timestamp"""
+        ts_delta, offset = self.decode_varint(logdata, offset)
+
+        self.prev_timestamp += self.zigzag_decode(ts_delta)
+        self.prev_timestamp &= self.timestamp_mask
+
+        if self.prev_msg is None:
+            logger.error("------ Repeat indication without previous message")
+            return None
+
+        log_desc, source_id, body = self.prev_msg
+
+        if self.parse_synthesized_msg(log_desc, source_id,
+                                      self.prev_timestamp, body) is None:
+            return None
+
+        return offset
+
+
     def parse_log_data(self, logdata, debug=False):
         """Parse binary log data and print the encoded log messages"""
         offset = 0
@@ -464,6 +603,28 @@ class LogParserV1(LogParser):
 
                 offset = ret
 
+            elif msg_type == MSG_TYPE_NORMAL_COMPRESSED:
+                ret = self.parse_one_compressed_msg(logdata, offset)
+                if ret is None:
+                    return False
+
+                offset = ret
+
+            elif msg_type == MSG_TYPE_NORMAL_STR_ID:
+                ret = self.parse_one_compressed_msg(logdata, offset,
+                                                    str_id=True)
+                if ret is None:
+                    return False
+
+                offset = ret
+
+            elif msg_type == MSG_TYPE_REPEAT:
+                ret = self.parse_one_repeat_msg(logdata, offset)
+                if ret is None:
+                    return False
+
+                offset = ret
+
             else:
                 logger.error("------ Unknown message type: %s", msg_type)
                 return False
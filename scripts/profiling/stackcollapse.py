@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2022 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Fold sampling profiler output into flamegraph format.
+
+This script parses a console log containing the output of the
+"prof dump" shell command, resolves the sampled program counters
+into function names using the symbol table of the Zephyr ELF file,
+and prints one folded line per thread/function pair:
+
+    <thread>;<function> <count>
+
+The output can be fed directly to flamegraph.pl from
+https://github.com/brendangregg/FlameGraph to render a flamegraph.
+"""
+
+import argparse
+import re
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+
+# Note: keep sync with C code
+PROFILER_PREFIX_STR = "#PF:"
+
+SAMPLE_RE = re.compile(re.escape(PROFILER_PREFIX_STR) +
+                       r"S:(\d+):([0-9a-fA-F]+):([0-9a-fA-F]+)")
+THREAD_RE = re.compile(re.escape(PROFILER_PREFIX_STR) +
+                       r"T:([0-9a-fA-F]+):(\S+)")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(allow_abbrev=False)
+
+    parser.add_argument("logfile", help="Console log with 'prof dump' output")
+    parser.add_argument("elffile", help="Zephyr ELF file")
+
+    return parser.parse_args()
+
+
+def load_symbols(elffile):
+    """Extract sorted (address, size, name) tuples of all functions."""
+    symbols = []
+
+    with open(elffile, "rb") as fd:
+        elf = ELFFile(fd)
+
+        symtab = elf.get_section_by_name(".symtab")
+        if symtab is None:
+            print("ERROR: no symbol table in ELF file, exiting...")
+            sys.exit(1)
+
+        for sym in symtab.iter_symbols():
+            if sym.entry["st_info"]["type"] != "STT_FUNC":
+                continue
+
+            # Thumb function addresses have bit 0 set in the
+            # symbol table, sampled program counters do not.
+            addr = sym.entry["st_value"] & ~1
+
+            symbols.append((addr, sym.entry["st_size"], sym.name))
+
+    symbols.sort()
+
+    return symbols
+
+
+def resolve_pc(symbols, pc):
+    # Binary search for the last symbol at or below the sampled pc
+    low, high = 0, len(symbols)
+    while low < high:
+        mid = (low + high) // 2
+        if symbols[mid][0] <= pc:
+            low = mid + 1
+        else:
+            high = mid
+
+    if low > 0:
+        addr, size, name = symbols[low - 1]
+        # Zero sized symbols (e.g. assembly labels) match any
+        # following address, others only their own range
+        if size == 0 or pc < addr + size:
+            return name
+
+    return "[unknown]"
+
+
+def main():
+    args = parse_args()
+
+    symbols = load_symbols(args.elffile)
+
+    samples = []
+    threads = {}
+
+    with open(args.logfile, "r") as fd:
+        for line in fd.readlines():
+            match = SAMPLE_RE.search(line)
+            if match:
+                pc = int(match.group(2), 16)
+                tid = int(match.group(3), 16)
+                samples.append((tid, pc))
+                continue
+
+            match = THREAD_RE.search(line)
+            if match:
+                threads[int(match.group(1), 16)] = match.group(2)
+
+    if not samples:
+        print("ERROR: no profiler samples in log file, exiting...")
+        sys.exit(1)
+
+    folded = {}
+    for tid, pc in samples:
+        thread = threads.get(tid, f"thread-{tid:x}")
+
+        if pc == 0:
+            # Architecture without program counter sampling
+            key = thread
+        else:
+            key = f"{thread};{resolve_pc(symbols, pc)}"
+
+        folded[key] = folded.get(key, 0) + 1
+
+    for key, count in sorted(folded.items(), key=lambda kv: -kv[1]):
+        print(f"{key} {count}")
+
+
+if __name__ == "__main__":
+    main()
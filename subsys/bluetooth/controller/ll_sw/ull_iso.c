@@ -1595,6 +1595,34 @@ static isoal_status_t ll_iso_pdu_alloc(struct isoal_pdu_buffer *pdu_buffer)
 	return ISOAL_STATUS_OK;
 }
 
+#if defined(CONFIG_BT_CTLR_ISOAL_FAST_COPY)
+/**
+ * Copy SDU payload using word accesses where alignment permits. ISO SDU
+ * fragmentation copies every payload byte exactly once, so with a C library
+ * whose memcpy is a plain byte loop (e.g. minimal libc) this copy dominates
+ * the fragmentation cost for larger SDUs.
+ * @param[out] dst Destination, within the PDU payload
+ * @param[in]  src Source SDU data
+ * @param[in]  len Length of data to copy
+ */
+static void iso_fast_copy(uint8_t *dst, const uint8_t *src, size_t len)
+{
+	if ((((uintptr_t)dst | (uintptr_t)src) & (sizeof(uint32_t) - 1U)) == 0U) {
+		while (len >= sizeof(uint32_t)) {
+			*(uint32_t *)dst = *(const uint32_t *)src;
+			dst += sizeof(uint32_t);
+			src += sizeof(uint32_t);
+			len -= sizeof(uint32_t);
+		}
+	}
+
+	while (len > 0U) {
+		*dst++ = *src++;
+		len--;
+	}
+}
+#endif /* CONFIG_BT_CTLR_ISOAL_FAST_COPY */
+
 /**
  * Write the given SDU payload to the target PDU buffer at the given offset.
  * @param[in,out]  pdu_buffer  Target PDU buffer
@@ -1621,7 +1649,12 @@ static isoal_status_t ll_iso_pdu_write(struct isoal_pdu_buffer *pdu_buffer,
 	}
 
 	/* Copy source to destination at given offset */
+#if defined(CONFIG_BT_CTLR_ISOAL_FAST_COPY)
+	iso_fast_copy(&pdu_buffer->pdu->payload[pdu_offset], sdu_payload,
+		      consume_len);
+#else
 	memcpy(&pdu_buffer->pdu->payload[pdu_offset], sdu_payload, consume_len);
+#endif
 
 	return ISOAL_STATUS_OK;
 }
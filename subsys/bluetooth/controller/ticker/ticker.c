@@ -271,6 +271,18 @@ struct ticker_instance {
 					 */
 #endif /* !CONFIG_BT_TICKER_SLOT_AGNOSTIC */
 
+#if defined(CONFIG_BT_TICKER_COLLISION_LOOKAHEAD)
+	uint8_t  lookahead_count;	/* Number of valid pre-resolved
+					 * collision verdicts
+					 */
+	uint8_t  lookahead_id[CONFIG_BT_TICKER_COLLISION_LOOKAHEAD_DEPTH];
+					/* Ids of ticker nodes with
+					 * pre-resolved collision verdicts
+					 */
+	uint8_t  lookahead_skip[CONFIG_BT_TICKER_COLLISION_LOOKAHEAD_DEPTH];
+					/* Pre-resolved collision verdicts */
+#endif /* CONFIG_BT_TICKER_COLLISION_LOOKAHEAD */
+
 
 	ticker_caller_id_get_cb_t caller_id_get_cb; /* Function for retrieving
 						     * the caller id from user
@@ -901,6 +913,78 @@ static uint8_t ticker_resolve_collision(struct ticker_node *nodes,
 
 	return 0U;
 }
+
+#if defined(CONFIG_BT_TICKER_COLLISION_LOOKAHEAD)
+/**
+ * @brief Pre-resolve collisions for upcoming ticker nodes
+ *
+ * @details Walks the first slot reserving nodes in the ticker list and
+ * caches the collision verdict ticker_worker would otherwise compute by
+ * traversing the list at event time. Called at the end of ticker_job,
+ * outside the radio ISR window. Ticker node state is only mutated in
+ * job context, hence the cached verdicts remain valid until the next
+ * job execution.
+ *
+ * @param instance Pointer to ticker instance
+ * @internal
+ */
+static void ticker_job_collision_lookahead(struct ticker_instance *instance)
+{
+	struct ticker_node *node;
+	uint8_t id_head;
+	uint8_t count;
+
+	node = &instance->nodes[0];
+	id_head = instance->ticker_id_head;
+	count = 0U;
+
+	while ((id_head != TICKER_NULL) &&
+	       (count < CONFIG_BT_TICKER_COLLISION_LOOKAHEAD_DEPTH)) {
+		struct ticker_node *ticker = &node[id_head];
+
+		if (ticker->ticks_slot != 0U) {
+			instance->lookahead_id[count] = id_head;
+			instance->lookahead_skip[count] =
+				ticker_resolve_collision(node, ticker);
+			count++;
+		}
+
+		id_head = ticker->next;
+	}
+
+	instance->lookahead_count = count;
+}
+
+/**
+ * @brief Get collision verdict for a ticker node, using the cache
+ *
+ * @details Returns the pre-resolved collision verdict for the ticker
+ * node, falling back to resolving at event time if the node was beyond
+ * the lookahead depth.
+ *
+ * @param instance  Pointer to ticker instance
+ * @param nodes     Pointer to ticker node array
+ * @param ticker    Pointer to ticker to resolve
+ * @param ticker_id Id of ticker node
+ *
+ * @return 0 if no collision was detected. 1 if ticker node collides
+ * with other ticker node of higher composite priority
+ * @internal
+ */
+static uint8_t ticker_collision_resolve_cached(struct ticker_instance *instance,
+					       struct ticker_node *nodes,
+					       struct ticker_node *ticker,
+					       uint8_t ticker_id)
+{
+	for (uint8_t i = 0U; i < instance->lookahead_count; i++) {
+		if (instance->lookahead_id[i] == ticker_id) {
+			return instance->lookahead_skip[i];
+		}
+	}
+
+	return ticker_resolve_collision(nodes, ticker);
+}
+#endif /* CONFIG_BT_TICKER_COLLISION_LOOKAHEAD */
 #endif /* !CONFIG_BT_TICKER_LOW_LAT &&
 	* !CONFIG_BT_TICKER_SLOT_AGNOSTIC
 	*/
@@ -1001,7 +1085,13 @@ void ticker_worker(void *param)
 		if (ticker->ticks_slot != 0U &&
 		   (slot_reserved ||
 		    (instance->ticks_slot_previous > ticks_expired) ||
-		    ticker_resolve_collision(node, ticker))) {
+#if defined(CONFIG_BT_TICKER_COLLISION_LOOKAHEAD)
+		    ticker_collision_resolve_cached(instance, node, ticker,
+						    (uint8_t)(ticker - node))
+#else /* !CONFIG_BT_TICKER_COLLISION_LOOKAHEAD */
+		    ticker_resolve_collision(node, ticker)
+#endif /* !CONFIG_BT_TICKER_COLLISION_LOOKAHEAD */
+		   )) {
 #if defined(CONFIG_BT_TICKER_EXT)
 			struct ticker_ext *ext_data = ticker->ext_data;
 
@@ -2659,6 +2749,13 @@ void ticker_job(void *param)
 		compare_trigger = 0U;
 	}
 
+#if defined(CONFIG_BT_TICKER_COLLISION_LOOKAHEAD)
+	/* Pre-resolve collisions for the upcoming events, outside the
+	 * radio ISR window
+	 */
+	ticker_job_collision_lookahead(instance);
+#endif /* CONFIG_BT_TICKER_COLLISION_LOOKAHEAD */
+
 	/* Permit worker to run */
 	instance->job_guard = 0U;
 
@@ -2714,6 +2811,10 @@ uint8_t ticker_init(uint8_t instance_index, uint8_t count_node, void *node,
 	instance->count_node = count_node;
 	instance->nodes = node;
 
+#if defined(CONFIG_BT_TICKER_COLLISION_LOOKAHEAD)
+	instance->lookahead_count = 0U;
+#endif /* CONFIG_BT_TICKER_COLLISION_LOOKAHEAD */
+
 #if !defined(CONFIG_BT_TICKER_LOW_LAT) && \
 	!defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC) && \
 	defined(CONFIG_BT_TICKER_PRIORITY_SET)
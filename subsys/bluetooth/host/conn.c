@@ -257,6 +257,10 @@ struct bt_conn *bt_conn_new(struct bt_conn *conns, size_t size)
 #if defined(CONFIG_BT_CONN_TX)
 	k_work_init(&conn->tx_complete_work, tx_complete_work);
 #endif /* CONFIG_BT_CONN_TX */
+#if defined(CONFIG_BT_CONN_TX_QUOTA)
+	k_sem_init(&conn->tx_quota, CONFIG_BT_CONN_TX_QUOTA_MAX,
+		   CONFIG_BT_CONN_TX_QUOTA_MAX);
+#endif /* CONFIG_BT_CONN_TX_QUOTA */
 
 	return conn;
 }
@@ -596,7 +600,7 @@ fail:
 	/* If we get here, something has seriously gone wrong:
 	 * We also need to destroy the `parent` buf.
 	 */
-	k_sem_give(bt_conn_get_pkts(conn));
+	bt_conn_give_pkts(conn);
 	if (tx) {
 		/* `buf` might not get destroyed, and its `tx` pointer will still be reachable.
 		 * Make sure that we don't try to use the destroyed context later.
@@ -612,9 +616,22 @@ static int send_frag(struct bt_conn *conn,
 		     struct net_buf *buf, struct net_buf *frag,
 		     uint8_t flags)
 {
+#if defined(CONFIG_BT_CONN_TX_QUOTA)
+	/* Enforce the per-connection quota before drawing from the shared
+	 * controller buffer pool.
+	 */
+	if (k_sem_take(&conn->tx_quota, K_NO_WAIT)) {
+		LOG_DBG("conn %p quota exhausted", conn);
+		return -ENOBUFS;
+	}
+#endif /* CONFIG_BT_CONN_TX_QUOTA */
+
 	/* Check if the controller can accept ACL packets */
 	if (k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT)) {
 		LOG_DBG("no controller bufs");
+#if defined(CONFIG_BT_CONN_TX_QUOTA)
+		k_sem_give(&conn->tx_quota);
+#endif /* CONFIG_BT_CONN_TX_QUOTA */
 		return -ENOBUFS;
 	}
 
@@ -791,6 +808,16 @@ static int conn_prepare_events(struct bt_conn *conn,
 	bool buffers_available = k_sem_count_get(conn_pkts) > 0;
 	bool packets_waiting = !k_fifo_is_empty(&conn->tx_queue);
 
+#if defined(CONFIG_BT_CONN_TX_QUOTA)
+	if (k_sem_count_get(&conn->tx_quota) == 0) {
+		/* The quota is the tighter limit: wait for one of this
+		 * connection's own packets to be acknowledged.
+		 */
+		conn_pkts = &conn->tx_quota;
+		buffers_available = false;
+	}
+#endif /* CONFIG_BT_CONN_TX_QUOTA */
+
 	if (packets_waiting && !buffers_available) {
 		/* Only resume sending when the controller has buffer space
 		 * available for this connection.
@@ -906,7 +933,7 @@ static void process_unack_tx(struct bt_conn *conn)
 		if (conn->pending_no_cb) {
 			conn->pending_no_cb--;
 			irq_unlock(key);
-			k_sem_give(bt_conn_get_pkts(conn));
+			bt_conn_give_pkts(conn);
 			continue;
 		}
 
@@ -926,7 +953,7 @@ static void process_unack_tx(struct bt_conn *conn)
 
 		conn_tx_destroy(conn, tx);
 
-		k_sem_give(bt_conn_get_pkts(conn));
+		bt_conn_give_pkts(conn);
 	}
 }
 
@@ -202,6 +202,14 @@ struct bt_conn {
 	struct k_work           tx_complete_work;
 #endif /* CONFIG_BT_CONN_TX */
 
+#if defined(CONFIG_BT_CONN_TX_QUOTA)
+	/* Limits the number of controller buffers this connection may
+	 * occupy; taken before the shared buffer semaphore and given
+	 * back whenever a controller buffer is returned.
+	 */
+	struct k_sem		tx_quota;
+#endif /* CONFIG_BT_CONN_TX_QUOTA */
+
 	/* Queue for outgoing ACL data */
 	struct k_fifo		tx_queue;
 
@@ -421,6 +429,17 @@ void bt_conn_cleanup_all(void);
 /* Selects based on connection type right semaphore for ACL packets */
 struct k_sem *bt_conn_get_pkts(struct bt_conn *conn);
 
+/* Returns a controller buffer credit, including the per-connection
+ * quota when enabled.
+ */
+static inline void bt_conn_give_pkts(struct bt_conn *conn)
+{
+	k_sem_give(bt_conn_get_pkts(conn));
+#if defined(CONFIG_BT_CONN_TX_QUOTA)
+	k_sem_give(&conn->tx_quota);
+#endif /* CONFIG_BT_CONN_TX_QUOTA */
+}
+
 /* k_poll related helpers for the TX thread */
 int bt_conn_prepare_events(struct k_poll_event events[]);
 void bt_conn_process_tx(struct bt_conn *conn);
@@ -56,6 +56,28 @@ LOG_MODULE_REGISTER(bt_gatt);
 
 static uint16_t last_static_handle;
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+/* Flat handle-to-attribute table covering handles
+ * 1..CONFIG_BT_GATT_ATTR_INDEX_SIZE. All registration paths populate
+ * it, so within the covered range the table is authoritative: a NULL
+ * entry means no attribute with that handle exists.
+ */
+static const struct bt_gatt_attr *attr_index[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+
+static void attr_index_set(uint16_t handle, const struct bt_gatt_attr *attr)
+{
+	if ((handle != 0U) && (handle <= ARRAY_SIZE(attr_index))) {
+		attr_index[handle - 1] = attr;
+	}
+}
+#else
+static inline void attr_index_set(uint16_t handle, const struct bt_gatt_attr *attr)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(attr);
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -340,7 +362,7 @@ static void sc_store(struct gatt_sc_cfg *cfg)
 				       &cfg->peer, NULL);
 	}
 
-	err = settings_save_one(key, (char *)&cfg->data, sizeof(cfg->data));
+	err = bt_settings_store(key, (char *)&cfg->data, sizeof(cfg->data));
 	if (err) {
 		LOG_ERR("failed to store SC (err %d)", err);
 		return;
@@ -380,7 +402,7 @@ static int bt_gatt_clear_sc(uint8_t id, const bt_addr_le_t *addr)
 					       &cfg->peer, NULL);
 		}
 
-		err = settings_delete(key);
+		err = bt_settings_delete(key);
 		if (err) {
 			LOG_ERR("failed to delete SC (err %d)", err);
 		} else {
@@ -948,7 +970,7 @@ static int bt_gatt_store_cf(struct bt_conn *conn)
 				       &conn->le.dst, NULL);
 	}
 
-	err = settings_save_one(key, str, len);
+	err = bt_settings_store(key, str, len);
 	if (err) {
 		LOG_ERR("Failed to store Client Features (err %d)", err);
 		return err;
@@ -1122,6 +1144,11 @@ populate:
 
 	gatt_insert(svc, last_handle);
 
+	/* Index the attributes only once registration cannot fail anymore */
+	for (attrs = svc->attrs, count = svc->attr_count; count; attrs++, count--) {
+		attr_index_set(attrs->handle, attrs);
+	}
+
 	return 0;
 }
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
@@ -1286,6 +1313,10 @@ static void bt_gatt_service_init(void)
 	}
 
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
+		for (size_t i = 0; i < svc->attr_count; i++) {
+			attr_index_set(last_static_handle + i + 1, &svc->attrs[i]);
+		}
+
 		last_static_handle += svc->attr_count;
 	}
 }
@@ -1458,6 +1489,8 @@ static int gatt_unregister(struct bt_gatt_service *svc)
 	for (uint16_t i = 0; i < svc->attr_count; i++) {
 		struct bt_gatt_attr *attr = &svc->attrs[i];
 
+		attr_index_set(attr->handle, NULL);
+
 		if (attr->write == bt_gatt_attr_write_ccc) {
 			gatt_unregister_ccc(attr->user_data);
 		}
@@ -1819,6 +1852,22 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	/* Exact-handle lookups without a filter (the common case for ATT
+	 * reads, writes and notifications) resolve through the index.
+	 */
+	if ((start_handle == end_handle) && (uuid == NULL) && (attr_data == NULL) &&
+	    (start_handle != 0U) && (start_handle <= ARRAY_SIZE(attr_index))) {
+		const struct bt_gatt_attr *attr = attr_index[start_handle - 1];
+
+		if (attr != NULL) {
+			(void)func(attr, start_handle, user_data);
+		}
+
+		return;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -5677,7 +5726,7 @@ int bt_gatt_store_ccc(uint8_t id, const bt_addr_le_t *addr)
 		len = 0;
 	}
 
-	err = settings_save_one(key, str, len);
+	err = bt_settings_store(key, str, len);
 	if (err) {
 		LOG_ERR("Failed to store CCCs (err %d)", err);
 		return err;
@@ -5943,7 +5992,7 @@ static int bt_gatt_clear_ccc(uint8_t id, const bt_addr_le_t *addr)
 					       addr, NULL);
 		}
 
-		return settings_delete(key);
+		return bt_settings_delete(key);
 	}
 
 	return 0;
@@ -5972,7 +6021,7 @@ static int bt_gatt_clear_cf(uint8_t id, const bt_addr_le_t *addr)
 					       addr, NULL);
 		}
 
-		return settings_delete(key);
+		return bt_settings_delete(key);
 	}
 
 	return 0;
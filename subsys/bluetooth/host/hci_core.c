@@ -429,6 +429,10 @@ static void hci_num_completed_packets(struct net_buf *buf)
 	for (i = 0; i < evt->num_handles; i++) {
 		uint16_t handle, count;
 		struct bt_conn *conn;
+		uint16_t credits = 0;
+		bool mismatch = false;
+		bool complete = false;
+		unsigned int key;
 
 		handle = sys_le16_to_cpu(evt->h[i].handle);
 		count = sys_le16_to_cpu(evt->h[i].count);
@@ -441,38 +445,48 @@ static void hci_num_completed_packets(struct net_buf *buf)
 			continue;
 		}
 
+		/* Process all credits for the handle in one go, deferring
+		 * the semaphore hand-back and the completion work submission
+		 * until the accounting is done.
+		 */
+		key = irq_lock();
+
 		while (count--) {
 			struct bt_conn_tx *tx;
 			sys_snode_t *node;
-			unsigned int key;
-
-			key = irq_lock();
 
 			if (conn->pending_no_cb) {
 				conn->pending_no_cb--;
-				irq_unlock(key);
-				k_sem_give(bt_conn_get_pkts(conn));
+				credits++;
 				continue;
 			}
 
 			node = sys_slist_get(&conn->tx_pending);
-			irq_unlock(key);
-
 			if (!node) {
-				LOG_ERR("packets count mismatch");
+				mismatch = true;
 				break;
 			}
 
 			tx = CONTAINER_OF(node, struct bt_conn_tx, node);
-
-			key = irq_lock();
 			conn->pending_no_cb = tx->pending_no_cb;
 			tx->pending_no_cb = 0U;
 			sys_slist_append(&conn->tx_complete, &tx->node);
-			irq_unlock(key);
+			complete = true;
+			credits++;
+		}
 
+		irq_unlock(key);
+
+		if (mismatch) {
+			LOG_ERR("packets count mismatch");
+		}
+
+		if (complete) {
 			k_work_submit(&conn->tx_complete_work);
-			k_sem_give(bt_conn_get_pkts(conn));
+		}
+
+		while (credits--) {
+			bt_conn_give_pkts(conn);
 		}
 
 		bt_conn_unref(conn);
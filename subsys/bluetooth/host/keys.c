@@ -326,7 +326,7 @@ void bt_keys_clear(struct bt_keys *keys)
 		}
 
 		LOG_DBG("Deleting key %s", key);
-		settings_delete(key);
+		bt_settings_delete(key);
 	}
 
 	(void)memset(keys, 0, sizeof(*keys));
@@ -351,7 +351,7 @@ int bt_keys_store(struct bt_keys *keys)
 				       NULL);
 	}
 
-	err = settings_save_one(key, keys->storage_start, BT_KEYS_STORAGE_LEN);
+	err = bt_settings_store(key, keys->storage_start, BT_KEYS_STORAGE_LEN);
 	if (err) {
 		LOG_ERR("Failed to save keys (err %d)", err);
 		return err;
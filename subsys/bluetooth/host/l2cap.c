@@ -1001,6 +1001,9 @@ static void l2cap_chan_destroy(struct bt_l2cap_chan *chan)
 		net_buf_unref(le_chan->_sdu);
 		le_chan->_sdu = NULL;
 		le_chan->_sdu_len = 0U;
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+		le_chan->_sdu_seg = 0U;
+#endif
 	}
 }
 
@@ -2248,6 +2251,9 @@ static void l2cap_chan_shutdown(struct bt_l2cap_chan *chan)
 		net_buf_unref(le_chan->_sdu);
 		le_chan->_sdu = NULL;
 		le_chan->_sdu_len = 0U;
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+		le_chan->_sdu_seg = 0U;
+#endif
 	}
 
 	/* Cleanup outstanding request */
@@ -2424,6 +2430,77 @@ static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 	net_buf_unref(buf);
 }
 
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+static void l2cap_chan_le_recv_frags_sdu(struct bt_l2cap_le_chan *chan)
+{
+	struct net_buf *buf = chan->_sdu;
+	uint16_t seg = chan->_sdu_seg;
+	int err;
+
+	chan->_sdu = NULL;
+	chan->_sdu_len = 0U;
+	chan->_sdu_seg = 0U;
+
+	/* The ACL metadata in the head buffer is no longer needed; store
+	 * the segment count for bt_l2cap_chan_recv_complete().
+	 */
+	memcpy(net_buf_user_data(buf), &seg, sizeof(seg));
+
+	LOG_DBG("chan %p len %zu", chan, net_buf_frags_len(buf));
+
+	__ASSERT_NO_MSG(bt_l2cap_chan_get_state(&chan->chan) == BT_L2CAP_CONNECTED);
+
+	err = chan->chan.ops->recv_frags(&chan->chan, buf);
+	if (err < 0) {
+		if (err != -EINPROGRESS) {
+			LOG_ERR("err %d", err);
+			bt_l2cap_chan_disconnect(&chan->chan);
+			net_buf_unref(buf);
+		}
+		return;
+	}
+
+	if (bt_l2cap_chan_get_state(&chan->chan) == BT_L2CAP_CONNECTED) {
+		l2cap_chan_send_credits(chan, buf, seg);
+	}
+
+	net_buf_unref(buf);
+}
+
+static void l2cap_chan_le_recv_seg_frags(struct bt_l2cap_le_chan *chan,
+					 struct net_buf *buf)
+{
+	size_t len = net_buf_frags_len(chan->_sdu);
+
+	if (len + buf->len > chan->_sdu_len) {
+		LOG_ERR("SDU length mismatch");
+		bt_l2cap_chan_disconnect(&chan->chan);
+		return;
+	}
+
+	chan->_sdu_seg++;
+
+	LOG_DBG("chan %p seg %u len %zu", chan, chan->_sdu_seg, len + buf->len);
+
+	/* Chain the segment as received; the payload is not copied */
+	net_buf_frag_add(chan->_sdu, net_buf_ref(buf));
+
+	if (len + buf->len < chan->_sdu_len) {
+		/* Give more credits if remote has run out of them, this
+		 * should only happen if the remote cannot fully utilize the
+		 * MPS for some reason.
+		 */
+		if (!atomic_get(&chan->rx.credits) &&
+		    chan->_sdu_seg == chan->rx.init_credits) {
+			l2cap_chan_update_credits(chan, chan->_sdu);
+		}
+		return;
+	}
+
+	l2cap_chan_le_recv_frags_sdu(chan);
+}
+#endif /* CONFIG_BT_L2CAP_RX_FRAGS */
+
 static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf)
 {
@@ -2495,6 +2572,12 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 
 	/* Check if segments already exist */
 	if (chan->_sdu) {
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+		if (chan->chan.ops->recv_frags) {
+			l2cap_chan_le_recv_seg_frags(chan, buf);
+			return;
+		}
+#endif /* CONFIG_BT_L2CAP_RX_FRAGS */
 		l2cap_chan_le_recv_seg(chan, buf);
 		return;
 	}
@@ -2515,6 +2598,29 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 		return;
 	}
 
+#if defined(CONFIG_BT_L2CAP_RX_FRAGS)
+	if (chan->chan.ops->recv_frags) {
+		if (buf->len > sdu_len) {
+			LOG_ERR("SDU length mismatch");
+			bt_l2cap_chan_disconnect(&chan->chan);
+			return;
+		}
+
+		/* Keep the segment as the head of the SDU chain instead of
+		 * copying it out; the caller drops its own reference.
+		 */
+		chan->_sdu = net_buf_ref(buf);
+		chan->_sdu_len = sdu_len;
+		chan->_sdu_seg = 1U;
+
+		if (buf->len == sdu_len) {
+			l2cap_chan_le_recv_frags_sdu(chan);
+		}
+
+		return;
+	}
+#endif /* CONFIG_BT_L2CAP_RX_FRAGS */
+
 	/* Always allocate buffer from the channel if supported. */
 	if (chan->chan.ops->alloc_buf) {
 		chan->_sdu = chan->chan.ops->alloc_buf(&chan->chan);
@@ -31,6 +31,106 @@ LOG_MODULE_REGISTER(bt_scan);
 static bt_le_scan_cb_t *scan_dev_found_cb;
 static sys_slist_t scan_cbs = SYS_SLIST_STATIC_INIT(&scan_cbs);
 
+#if defined(CONFIG_BT_SCAN_REPORT_BATCHING)
+static sys_slist_t scan_batch_cbs = SYS_SLIST_STATIC_INIT(&scan_batch_cbs);
+
+/* Reports are accumulated into the active half of a double buffer by
+ * the RX thread and the halves are swapped under the lock when a batch
+ * is dispatched, so dispatching never blocks report reception.
+ */
+static struct bt_le_scan_batch_report
+	scan_batch_pool[2][CONFIG_BT_SCAN_REPORT_BATCH_COUNT];
+static uint8_t scan_batch_active;
+static uint8_t scan_batch_count;
+static struct k_spinlock scan_batch_lock;
+
+static void scan_batch_flush(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(scan_batch_work, scan_batch_flush);
+
+static void scan_batch_flush(struct k_work *work)
+{
+	struct bt_le_scan_batch_report *reports;
+	struct bt_le_scan_batch_cb *listener;
+	k_spinlock_key_t key;
+	uint8_t count;
+
+	ARG_UNUSED(work);
+
+	key = k_spin_lock(&scan_batch_lock);
+	reports = scan_batch_pool[scan_batch_active];
+	count = scan_batch_count;
+	scan_batch_active ^= 1;
+	scan_batch_count = 0U;
+	k_spin_unlock(&scan_batch_lock, key);
+
+	if (count == 0U) {
+		return;
+	}
+
+	for (uint8_t i = 0U; i < count; i++) {
+		reports[i].info.addr = &reports[i].addr;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&scan_batch_cbs, listener, node) {
+		if (listener->reports) {
+			listener->reports(reports, count);
+		}
+	}
+}
+
+static void scan_batch_put(const bt_addr_le_t *addr,
+			   const struct bt_le_scan_recv_info *info,
+			   struct net_buf_simple *buf, uint16_t len)
+{
+	struct bt_le_scan_batch_report *report;
+	k_spinlock_key_t key;
+	bool submit;
+
+	if (sys_slist_is_empty(&scan_batch_cbs)) {
+		return;
+	}
+
+	key = k_spin_lock(&scan_batch_lock);
+	if (scan_batch_count >= CONFIG_BT_SCAN_REPORT_BATCH_COUNT) {
+		/* The pending flush has not run yet; scan reports are
+		 * lossy by nature, drop this one and expedite the flush.
+		 */
+		k_spin_unlock(&scan_batch_lock, key);
+		LOG_DBG("Batch full, dropped adv report");
+		k_work_reschedule(&scan_batch_work, K_NO_WAIT);
+		return;
+	}
+
+	report = &scan_batch_pool[scan_batch_active][scan_batch_count++];
+	submit = (scan_batch_count == CONFIG_BT_SCAN_REPORT_BATCH_COUNT);
+
+	bt_addr_le_copy(&report->addr, addr);
+	report->info = *info;
+	report->info.addr = NULL;
+	report->len = MIN(len, CONFIG_BT_SCAN_REPORT_BATCH_DATA_MAX);
+	memcpy(report->data, buf->data, report->len);
+	k_spin_unlock(&scan_batch_lock, key);
+
+	if (submit) {
+		k_work_reschedule(&scan_batch_work, K_NO_WAIT);
+	} else {
+		/* No-op if a flush is already scheduled */
+		(void)k_work_schedule(&scan_batch_work,
+			K_MSEC(CONFIG_BT_SCAN_REPORT_BATCH_TIMEOUT_MS));
+	}
+}
+
+void bt_le_scan_batch_cb_register(struct bt_le_scan_batch_cb *cb)
+{
+	sys_slist_append(&scan_batch_cbs, &cb->node);
+}
+
+void bt_le_scan_batch_cb_unregister(struct bt_le_scan_batch_cb *cb)
+{
+	sys_slist_find_and_remove(&scan_batch_cbs, &cb->node);
+}
+#endif /* CONFIG_BT_SCAN_REPORT_BATCHING */
+
 #if defined(CONFIG_BT_EXT_ADV)
 /* A buffer used to reassemble advertisement data from the controller. */
 NET_BUF_SIMPLE_DEFINE(ext_scan_buf, CONFIG_BT_EXT_SCAN_BUF_SIZE);
@@ -464,6 +564,10 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
 	}
 
+#if defined(CONFIG_BT_SCAN_REPORT_BATCHING)
+	scan_batch_put(&id_addr, info, buf, len);
+#endif /* CONFIG_BT_SCAN_REPORT_BATCHING */
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
@@ -255,6 +255,123 @@ void bt_settings_save_id(void)
 	k_work_submit(&save_id_work);
 }
 
+#if defined(CONFIG_BT_SETTINGS_BATCH)
+struct batch_entry {
+	char key[BT_SETTINGS_KEY_MAX];
+	uint8_t value[CONFIG_BT_SETTINGS_BATCH_VALUE_MAX];
+	uint16_t value_len;
+	bool used;
+	bool delete;
+};
+
+static struct batch_entry batch_queue[CONFIG_BT_SETTINGS_BATCH_QUEUE_SIZE];
+static K_MUTEX_DEFINE(batch_lock);
+
+static void batch_flush(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(batch_queue); i++) {
+		struct batch_entry *entry = &batch_queue[i];
+
+		if (!entry->used) {
+			continue;
+		}
+
+		if (entry->delete) {
+			err = settings_delete(entry->key);
+		} else {
+			err = settings_save_one(entry->key, entry->value,
+						entry->value_len);
+		}
+
+		if (err) {
+			LOG_ERR("Failed to commit %s (err %d)", entry->key,
+				err);
+		} else {
+			LOG_DBG("Committed %s", entry->key);
+		}
+
+		entry->used = false;
+	}
+
+	k_mutex_unlock(&batch_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(batch_work, batch_flush);
+
+static int batch_add(const char *key, const void *value, size_t len,
+		     bool delete)
+{
+	struct batch_entry *entry = NULL;
+
+	if (len > CONFIG_BT_SETTINGS_BATCH_VALUE_MAX ||
+	    strlen(key) >= BT_SETTINGS_KEY_MAX) {
+		return -ENOMEM;
+	}
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(batch_queue); i++) {
+		if (batch_queue[i].used) {
+			/* Coalesce writes to the same key */
+			if (!strcmp(batch_queue[i].key, key)) {
+				entry = &batch_queue[i];
+				break;
+			}
+		} else if (!entry) {
+			entry = &batch_queue[i];
+		}
+	}
+
+	if (!entry) {
+		k_mutex_unlock(&batch_lock);
+		return -ENOMEM;
+	}
+
+	strcpy(entry->key, key);
+	if (value) {
+		memcpy(entry->value, value, len);
+	}
+	entry->value_len = len;
+	entry->delete = delete;
+	entry->used = true;
+
+	k_mutex_unlock(&batch_lock);
+
+	/* Only starts the timeout if the work is not already scheduled, so
+	 * subsequent writes are collected into the same commit.
+	 */
+	k_work_schedule(&batch_work,
+			K_MSEC(CONFIG_BT_SETTINGS_BATCH_TIMEOUT_MS));
+
+	return 0;
+}
+
+int bt_settings_store(const char *key, const void *value, size_t len)
+{
+	if (!batch_add(key, value, len, false)) {
+		return 0;
+	}
+
+	/* Value too large or queue full, store directly */
+	return settings_save_one(key, value, len);
+}
+
+int bt_settings_delete(const char *key)
+{
+	if (!batch_add(key, NULL, 0, true)) {
+		return 0;
+	}
+
+	return settings_delete(key);
+}
+#endif /* CONFIG_BT_SETTINGS_BATCH */
+
 static int commit_settings(void)
 {
 	int err;
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/settings/settings.h>
+
 /* Max settings key length (with all components) */
 #define BT_SETTINGS_KEY_MAX 36
 
@@ -18,3 +20,24 @@ int bt_settings_decode_key(const char *key, bt_addr_le_t *addr);
 void bt_settings_save_id(void);
 
 int bt_settings_init(void);
+
+#if defined(CONFIG_BT_SETTINGS_BATCH)
+/* Queue a value for storage. Writes to the same key are coalesced and
+ * committed to the settings backend from the system workqueue.
+ */
+int bt_settings_store(const char *key, const void *value, size_t len);
+
+/* Queue a key for deletion, see bt_settings_store(). */
+int bt_settings_delete(const char *key);
+#else
+static inline int bt_settings_store(const char *key, const void *value,
+				    size_t len)
+{
+	return settings_save_one(key, value, len);
+}
+
+static inline int bt_settings_delete(const char *key)
+{
+	return settings_delete(key);
+}
+#endif /* CONFIG_BT_SETTINGS_BATCH */
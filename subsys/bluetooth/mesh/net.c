@@ -79,11 +79,38 @@ struct iv_val {
 	      iv_duration:7;
 } __packed;
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+/* Set-associative message cache: the (src, seq) pair of a PDU selects one
+ * set of MSG_CACHE_WAYS entries kept in recency order, so the lookup cost
+ * stays constant regardless of the cache size. Unused entries are all-zero
+ * and can never match, as the unassigned address is not a valid source.
+ */
+#define MSG_CACHE_WAYS 4
+#define MSG_CACHE_SETS (CONFIG_BT_MESH_MSG_CACHE_SIZE / MSG_CACHE_WAYS)
+
+BUILD_ASSERT(MSG_CACHE_SETS > 0,
+	     "BT_MESH_MSG_CACHE_SIZE too small for the hashed message cache");
+
+static struct msg_cache_entry {
+	uint32_t src : 15, /* MSb of source is always 0 */
+	      seq : 17;
+} msg_cache[MSG_CACHE_SETS][MSG_CACHE_WAYS];
+
+static struct msg_cache_entry *msg_cache_set_get(uint16_t src, uint32_t seq)
+{
+	uint32_t hash = ((uint32_t)src << 17) ^ (seq & BIT_MASK(17));
+
+	hash ^= hash >> 16;
+
+	return msg_cache[hash % MSG_CACHE_SETS];
+}
+#else
 static struct {
 	uint32_t src : 15, /* MSb of source is always 0 */
 	      seq : 17;
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
 static uint16_t msg_cache_next;
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
 
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
@@ -139,6 +166,49 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+static bool msg_cache_match(struct net_buf_simple *pdu)
+{
+	uint32_t seq = SEQ(pdu->data) & BIT_MASK(17);
+	uint16_t src = SRC(pdu->data);
+	struct msg_cache_entry *set;
+	uint16_t i;
+
+	set = msg_cache_set_get(src, seq);
+
+	for (i = 0U; i < MSG_CACHE_WAYS; i++) {
+		if (set[i].src == src && set[i].seq == seq) {
+			struct msg_cache_entry entry = set[i];
+
+			/* Mark as most recently seen */
+			for (; i > 0U; i--) {
+				set[i] = set[i - 1];
+			}
+			set[0] = entry;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void msg_cache_add(struct bt_mesh_net_rx *rx)
+{
+	struct msg_cache_entry *set;
+	uint16_t i;
+
+	set = msg_cache_set_get(rx->ctx.addr, rx->seq);
+
+	/* Evict the least recently seen entry of the set */
+	for (i = MSG_CACHE_WAYS - 1; i > 0U; i--) {
+		set[i] = set[i - 1];
+	}
+
+	set[0].src = rx->ctx.addr;
+	set[0].seq = rx->seq;
+}
+#else
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
 	uint16_t i;
@@ -167,6 +237,7 @@ static void msg_cache_add(struct bt_mesh_net_rx *rx)
 	msg_cache[msg_cache_next].seq = rx->seq;
 	msg_cache_next++;
 }
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
 
 static void store_iv(bool only_duration)
 {
@@ -209,7 +280,9 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const uint8_t key[16],
 	}
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 	msg_cache_next = 0U;
+#endif
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
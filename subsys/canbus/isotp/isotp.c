@@ -116,6 +116,61 @@ static inline uint32_t receive_get_sf_length(struct net_buf *buf)
 	return len;
 }
 
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+static uint8_t receive_effective_bs(struct isotp_recv_ctx *ctx)
+{
+	atomic_val_t backlog = atomic_get(&ctx->backlog);
+	uint8_t bs = ctx->opts.bs;
+
+	/* Halve the block size for every completed buffer the application
+	 * has not read yet, so a slow consumer throttles the sender
+	 * instead of running the receive pool dry.
+	 */
+	while (backlog-- > 0 && bs > 1) {
+		bs >>= 1;
+	}
+
+	return bs;
+}
+
+static uint8_t receive_effective_stmin(struct isotp_recv_ctx *ctx)
+{
+	atomic_val_t backlog = atomic_get(&ctx->backlog);
+	uint8_t stmin = ctx->opts.stmin;
+
+	if (backlog <= 0) {
+		return stmin;
+	}
+
+	/* Escalate the 100 us to 900 us values (0xF1 to 0xF9) to the
+	 * millisecond range first, then double per unread buffer.
+	 */
+	if (stmin >= ISOTP_STMIN_US_BEGIN) {
+		stmin = 1;
+		backlog--;
+	}
+
+	while (backlog-- > 0) {
+		stmin = MIN(MAX(stmin, 1U) * 2U, ISOTP_STMIN_MS_MAX);
+	}
+
+	return stmin;
+}
+#else
+static inline uint8_t receive_effective_bs(struct isotp_recv_ctx *ctx)
+{
+	return ctx->opts.bs;
+}
+#endif /* CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL */
+
+static void receive_fifo_put(struct isotp_recv_ctx *ctx, struct net_buf *buf)
+{
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+	atomic_inc(&ctx->backlog);
+#endif
+	net_buf_put(&ctx->fifo, buf);
+}
+
 static void receive_send_fc(struct isotp_recv_ctx *ctx, uint8_t fs)
 {
 	struct can_frame frame = {
@@ -133,8 +188,13 @@ static void receive_send_fc(struct isotp_recv_ctx *ctx, uint8_t fs)
 	}
 
 	*data++ = ISOTP_PCI_TYPE_FC | fs;
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+	*data++ = ctx->opts.bs != 0 ? ctx->bs : 0;
+	*data++ = receive_effective_stmin(ctx);
+#else
 	*data++ = ctx->opts.bs;
 	*data++ = ctx->opts.stmin;
+#endif
 	payload_len = data - frame.data;
 
 #if defined(CONFIG_ISOTP_REQUIRE_RX_PADDING) || \
@@ -215,7 +275,7 @@ static int receive_alloc_buffer(struct isotp_recv_ctx *ctx)
 		/* Alloc all buffers because we can't wait during reception */
 		buf = receive_alloc_buffer_chain(ctx->length);
 	} else {
-		buf = receive_alloc_buffer_chain(ctx->opts.bs *
+		buf = receive_alloc_buffer_chain(ctx->bs *
 						 (ISOTP_CAN_DL - 1));
 	}
 
@@ -265,7 +325,7 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 		ud_rem_len = net_buf_user_data(ctx->buf);
 		*ud_rem_len = 0;
 		LOG_DBG("SM process SF of length %d", ctx->length);
-		net_buf_put(&ctx->fifo, ctx->buf);
+		receive_fifo_put(ctx, ctx->buf);
 		ctx->state = ISOTP_RX_STATE_RECYCLE;
 		receive_state_machine(ctx);
 		break;
@@ -287,10 +347,10 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 		}
 
 		if (ctx->opts.bs) {
-			ctx->bs = ctx->opts.bs;
+			ctx->bs = receive_effective_bs(ctx);
 			ud_rem_len = net_buf_user_data(ctx->buf);
 			*ud_rem_len = ctx->length;
-			net_buf_put(&ctx->fifo, ctx->buf);
+			receive_fifo_put(ctx, ctx->buf);
 		}
 
 		ctx->wft = ISOTP_WFT_FIRST;
@@ -513,15 +573,15 @@ static void process_cf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 	if (ctx->length == 0) {
 		ctx->state = ISOTP_RX_STATE_RECYCLE;
 		*ud_rem_len = 0;
-		net_buf_put(&ctx->fifo, ctx->buf);
+		receive_fifo_put(ctx, ctx->buf);
 		return;
 	}
 
 	if (ctx->opts.bs && !--ctx->bs) {
 		LOG_DBG("Block is complete. Allocate new buffer");
-		ctx->bs = ctx->opts.bs;
+		ctx->bs = receive_effective_bs(ctx);
 		*ud_rem_len = ctx->length;
-		net_buf_put(&ctx->fifo, ctx->buf);
+		receive_fifo_put(ctx, ctx->buf);
 		ctx->state = ISOTP_RX_STATE_TRY_ALLOC;
 	}
 }
@@ -602,6 +662,9 @@ int isotp_bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
 	ctx->rx_addr = *rx_addr;
 	ctx->tx_addr = *tx_addr;
 	k_fifo_init(&ctx->fifo);
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+	atomic_clear(&ctx->backlog);
+#endif
 
 	__ASSERT(opts->stmin < ISOTP_STMIN_MAX, "STmin limit");
 	__ASSERT(opts->stmin <= ISOTP_STMIN_MS_MAX ||
@@ -677,6 +740,9 @@ int isotp_recv_net(struct isotp_recv_ctx *ctx, struct net_buf **buffer,
 		return ret;
 	}
 
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+	atomic_dec(&ctx->backlog);
+#endif
 	*buffer = buf;
 
 	return *(uint32_t *)net_buf_user_data(buf);
@@ -696,6 +762,10 @@ int isotp_recv(struct isotp_recv_ctx *ctx, uint8_t *data, size_t len,
 
 			return err;
 		}
+
+#ifdef CONFIG_ISOTP_DYNAMIC_FLOW_CONTROL
+		atomic_dec(&ctx->backlog);
+#endif
 	}
 
 	/* traverse fragments and delete them after copying the data */
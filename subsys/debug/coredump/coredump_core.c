@@ -5,12 +5,17 @@
  */
 
 #include <errno.h>
+#include <string.h>
 #include <kernel_internal.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/debug/coredump.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+#include <lz4.h>
+#endif
+
 #include "coredump_internal.h"
 
 #if defined(CONFIG_DEBUG_COREDUMP_BACKEND_LOGGING)
@@ -34,6 +39,76 @@ static struct coredump_backend_api
 #define DT_DRV_COMPAT zephyr_coredump
 #endif
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+
+#define LZ4_BLK_SIZE	CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4_BLOCK_SIZE
+
+/* Compressed block header.
+ *
+ * Needs to be kept in sync with
+ * scripts/coredump/coredump_parser/log_parser.py.
+ */
+struct coredump_lz4_blk_hdr_t {
+	/* Number of compressed bytes following this header */
+	uint16_t	comp_bytes;
+
+	/* Number of bytes the block decompresses to */
+	uint16_t	orig_bytes;
+} __packed;
+
+static uint8_t lz4_blk[LZ4_BLK_SIZE];
+static uint8_t lz4_out[LZ4_COMPRESSBOUND(LZ4_BLK_SIZE)];
+static uint16_t lz4_blk_fill;
+
+static void lz4_block_flush(void)
+{
+	struct coredump_lz4_blk_hdr_t blk_hdr;
+	uint16_t orig_bytes = lz4_blk_fill;
+	int comp_bytes;
+
+	if (orig_bytes == 0U) {
+		return;
+	}
+
+	comp_bytes = LZ4_compress_default((const char *)lz4_blk,
+					  (char *)lz4_out,
+					  orig_bytes, sizeof(lz4_out));
+	lz4_blk_fill = 0U;
+
+	if (comp_bytes <= 0) {
+		/*
+		 * Cannot happen with a worst case sized output buffer,
+		 * but do not emit a corrupt stream if it ever does.
+		 */
+		return;
+	}
+
+	blk_hdr.comp_bytes = sys_cpu_to_le16((uint16_t)comp_bytes);
+	blk_hdr.orig_bytes = sys_cpu_to_le16(orig_bytes);
+
+	backend_api->buffer_output((uint8_t *)&blk_hdr, sizeof(blk_hdr));
+	backend_api->buffer_output(lz4_out, comp_bytes);
+}
+
+static void lz4_buffer_output(uint8_t *buf, size_t buflen)
+{
+	while (buflen > 0) {
+		size_t copy = MIN(buflen,
+				  (size_t)(LZ4_BLK_SIZE - lz4_blk_fill));
+
+		memcpy(&lz4_blk[lz4_blk_fill], buf, copy);
+		lz4_blk_fill += copy;
+		buf += copy;
+		buflen -= copy;
+
+		if (lz4_blk_fill == LZ4_BLK_SIZE) {
+			lz4_block_flush();
+		}
+	}
+}
+
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4 */
+
 static void dump_header(unsigned int reason)
 {
 	struct coredump_hdr_t hdr = {
@@ -52,6 +127,11 @@ static void dump_header(unsigned int reason)
 
 	hdr.tgt_code = sys_cpu_to_le16(arch_coredump_tgt_code_get());
 
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4)) {
+		hdr.flag = COREDUMP_HDR_FLAG_LZ4;
+	}
+
+	/* Header is not compressed so host tools can always read it. */
 	backend_api->buffer_output((uint8_t *)&hdr, sizeof(hdr));
 }
 
@@ -137,10 +217,18 @@ void coredump(unsigned int reason, const z_arch_esf_t *esf,
 void z_coredump_start(void)
 {
 	backend_api->start();
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+	lz4_blk_fill = 0U;
+#endif
 }
 
 void z_coredump_end(void)
 {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+	lz4_block_flush();
+#endif
+
 	backend_api->end();
 }
 
@@ -151,7 +239,11 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 		return;
 	}
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+	lz4_buffer_output(buf, buflen);
+#else
 	backend_api->buffer_output(buf, buflen);
+#endif
 }
 
 void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/profiler.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#if defined(CONFIG_CPU_CORTEX_M)
+#include <zephyr/arch/arm/aarch32/cortex_m/cmsis.h>
+#endif
+
+#ifdef CONFIG_PROFILER_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+/* One profiler sample.
+ *
+ * Needs to be kept in sync with scripts/profiling/stackcollapse.py.
+ */
+struct profiler_sample {
+	uintptr_t	pc;
+	uintptr_t	tid;
+} __packed;
+
+static struct ring_buf sample_ring[CONFIG_MP_NUM_CPUS];
+static uint8_t sample_buf[CONFIG_MP_NUM_CPUS][CONFIG_PROFILER_BUFFER_SIZE];
+
+static uint32_t samples_dropped;
+static bool profiler_running;
+
+static uintptr_t profiler_pc_get(void)
+{
+#if defined(CONFIG_CPU_CORTEX_M)
+	/*
+	 * Timer expiry functions run in handler mode with the frame of
+	 * the preempted thread stacked on PSP; the return address is the
+	 * seventh word of the basic frame. If the sampling interrupt
+	 * preempted another interrupt, the sample is attributed to the
+	 * last location of the preempted thread instead.
+	 */
+	return ((uint32_t *)__get_PSP())[6];
+#else
+	/*
+	 * Program counter sampling is not supported on this
+	 * architecture; samples still attribute time to threads.
+	 */
+	return 0;
+#endif
+}
+
+static void sample_timer_handler(struct k_timer *timer)
+{
+	struct ring_buf *rb = &sample_ring[_current_cpu->id];
+	struct profiler_sample sample = {
+		.pc = profiler_pc_get(),
+		.tid = (uintptr_t)k_current_get(),
+	};
+
+	ARG_UNUSED(timer);
+
+	/*
+	 * Samples have to stay whole in the ring buffer, so drop the
+	 * sample instead of doing a partial put.
+	 */
+	if (ring_buf_space_get(rb) < sizeof(sample)) {
+		samples_dropped++;
+		return;
+	}
+
+	ring_buf_put(rb, (uint8_t *)&sample, sizeof(sample));
+}
+
+static K_TIMER_DEFINE(sample_timer, sample_timer_handler, NULL);
+
+int profiler_start(void)
+{
+	if (profiler_running) {
+		return -EALREADY;
+	}
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		ring_buf_init(&sample_ring[i], sizeof(sample_buf[i]),
+			      sample_buf[i]);
+	}
+
+	samples_dropped = 0;
+	profiler_running = true;
+
+	k_timer_start(&sample_timer,
+		      K_USEC(CONFIG_PROFILER_SAMPLE_PERIOD_US),
+		      K_USEC(CONFIG_PROFILER_SAMPLE_PERIOD_US));
+
+	return 0;
+}
+
+int profiler_stop(void)
+{
+	if (!profiler_running) {
+		return -EALREADY;
+	}
+
+	k_timer_stop(&sample_timer);
+	profiler_running = false;
+
+	return 0;
+}
+
+uint32_t profiler_samples_drain(profiler_sample_cb cb, void *user_data)
+{
+	struct profiler_sample sample;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		while (ring_buf_get(&sample_ring[i], (uint8_t *)&sample,
+				    sizeof(sample)) == sizeof(sample)) {
+			cb(i, sample.pc, (k_tid_t)sample.tid, user_data);
+		}
+	}
+
+	return samples_dropped;
+}
+
+#ifdef CONFIG_PROFILER_SHELL
+
+/* Keep the prefix in sync with scripts/profiling/stackcollapse.py */
+#define PROFILER_PREFIX_STR	"#PF:"
+
+static int cmd_prof_start(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (profiler_start() != 0) {
+		shell_error(sh, "Profiler already running");
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "Profiler started");
+
+	return 0;
+}
+
+static int cmd_prof_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (profiler_stop() != 0) {
+		shell_error(sh, "Profiler not running");
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "Profiler stopped");
+
+	return 0;
+}
+
+static void dump_sample_cb(uint8_t cpu, uintptr_t pc, k_tid_t tid,
+			   void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	shell_print(sh, PROFILER_PREFIX_STR "S:%u:%lx:%lx", cpu,
+		    (unsigned long)pc, (unsigned long)tid);
+}
+
+static void dump_thread_cb(const struct k_thread *thread, void *user_data)
+{
+	const struct shell *sh = user_data;
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	if ((name == NULL) || (name[0] == '\0')) {
+		return;
+	}
+
+	shell_print(sh, PROFILER_PREFIX_STR "T:%lx:%s",
+		    (unsigned long)thread, name);
+}
+
+static int cmd_prof_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t dropped;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, PROFILER_PREFIX_STR "BEGIN#");
+
+	dropped = profiler_samples_drain(dump_sample_cb, (void *)sh);
+
+	k_thread_foreach(dump_thread_cb, (void *)sh);
+
+	shell_print(sh, PROFILER_PREFIX_STR "END#");
+
+	if (dropped > 0) {
+		shell_warn(sh, "%u samples dropped, consider increasing "
+			   "PROFILER_BUFFER_SIZE", dropped);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_prof,
+	SHELL_CMD(start, NULL, "Start sampling.", cmd_prof_start),
+	SHELL_CMD(stop, NULL, "Stop sampling.", cmd_prof_stop),
+	SHELL_CMD(dump, NULL, "Dump collected samples.", cmd_prof_dump),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(prof, &sub_prof, "Sampling profiler commands", NULL);
+
+#endif /* CONFIG_PROFILER_SHELL */
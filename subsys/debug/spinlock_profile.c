@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Spinlock contention profiler
+ *
+ * Collects per-lock acquisition counts, accumulated spin (wait)
+ * cycles and maximum hold times into per-CPU tables.  The hooks in
+ * k_spin_lock()/k_spin_unlock() run with interrupts masked on the
+ * local CPU and only ever touch that CPU's table, so no additional
+ * synchronization is needed on the collection path and the profiler
+ * itself never takes a lock.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/spinlock.h>
+
+#define PROFILE_MAX_LOCKS CONFIG_SPIN_LOCK_PROFILE_MAX_LOCKS
+
+struct profile_entry {
+	struct k_spinlock *lock;
+	uint64_t acquisitions;
+	uint64_t spin_cycles;
+	uint32_t max_hold_cycles;
+	uint32_t hold_start;
+};
+
+static struct profile_entry
+	profile_table[CONFIG_MP_MAX_NUM_CPUS][PROFILE_MAX_LOCKS];
+
+/* Acquisitions lost because the owning CPU's table was full */
+static uint32_t profile_dropped[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Open-addressed lookup keyed on the lock address.  Entries are only
+ * ever inserted, never removed, so probing can stop at the first
+ * empty slot.
+ */
+static struct profile_entry *entry_find(struct k_spinlock *l, bool insert)
+{
+	struct profile_entry *table = profile_table[_current_cpu->id];
+	uint32_t home = ((uint32_t)((uintptr_t)l >> 3) * 2654435761U) %
+			PROFILE_MAX_LOCKS;
+
+	for (uint32_t i = 0; i < PROFILE_MAX_LOCKS; i++) {
+		struct profile_entry *e =
+			&table[(home + i) % PROFILE_MAX_LOCKS];
+
+		if (e->lock == l) {
+			return e;
+		}
+		if (e->lock == NULL) {
+			if (insert) {
+				e->lock = l;
+				return e;
+			}
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+
+void z_spin_lock_profile(struct k_spinlock *l, uint32_t spin_cycles)
+{
+	struct profile_entry *e = entry_find(l, true);
+
+	if (e == NULL) {
+		profile_dropped[_current_cpu->id]++;
+		return;
+	}
+
+	e->acquisitions++;
+	e->spin_cycles += spin_cycles;
+	e->hold_start = sys_clock_cycle_get_32();
+}
+
+void z_spin_unlock_profile(struct k_spinlock *l)
+{
+	struct profile_entry *e = entry_find(l, false);
+	uint32_t held;
+
+	if (e == NULL) {
+		return;
+	}
+
+	held = sys_clock_cycle_get_32() - e->hold_start;
+	if (held > e->max_hold_cycles) {
+		e->max_hold_cycles = held;
+	}
+}
+
+void k_spin_lock_profile_foreach(k_spin_lock_profile_cb_t cb, void *user_data)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		for (uint32_t i = 0; i < PROFILE_MAX_LOCKS; i++) {
+			struct profile_entry *e = &profile_table[cpu][i];
+
+			if ((e->lock == NULL) || (e->acquisitions == 0U)) {
+				continue;
+			}
+
+			struct k_spin_lock_profile_stats stats = {
+				.lock = e->lock,
+				.acquisitions = e->acquisitions,
+				.spin_cycles = e->spin_cycles,
+				.max_hold_cycles = e->max_hold_cycles,
+			};
+
+			cb(cpu, &stats, user_data);
+		}
+	}
+}
+
+void k_spin_lock_profile_reset(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	/* Keys are kept so that probe sequences on other CPUs stay
+	 * valid; only the counters are cleared.  Samples recorded
+	 * concurrently with the reset may be lost, which is harmless.
+	 */
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		for (uint32_t i = 0; i < PROFILE_MAX_LOCKS; i++) {
+			struct profile_entry *e = &profile_table[cpu][i];
+
+			e->acquisitions = 0;
+			e->spin_cycles = 0;
+			e->max_hold_cycles = 0;
+		}
+		profile_dropped[cpu] = 0;
+	}
+}
+
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+
+static void dump_cb(int cpu, const struct k_spin_lock_profile_stats *stats,
+		    void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	shell_print(sh, "%3d %10p %12llu %14llu %12u", cpu, stats->lock,
+		    (unsigned long long)stats->acquisitions,
+		    (unsigned long long)stats->spin_cycles,
+		    stats->max_hold_cycles);
+}
+
+static int cmd_spinlock_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%3s %10s %12s %14s %12s", "cpu", "lock",
+		    "acquisitions", "spin cycles", "max hold");
+	k_spin_lock_profile_foreach(dump_cb, (void *)sh);
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		if (profile_dropped[cpu] != 0U) {
+			shell_print(sh, "cpu %u: %u acquisitions untracked "
+				    "(table full)", cpu, profile_dropped[cpu]);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_spinlock_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_spin_lock_profile_reset();
+	shell_print(sh, "Spinlock statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(spinlock_cmds,
+	SHELL_CMD(dump, NULL, "Dump spinlock contention statistics",
+		  cmd_spinlock_dump),
+	SHELL_CMD(reset, NULL, "Reset spinlock contention statistics",
+		  cmd_spinlock_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(spinlock, &spinlock_cmds,
+		   "Spinlock contention profiling commands", NULL);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * RAM-based backing store with LZ4 page compression
+ */
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/sys/mem_blocks.h>
+#include <zephyr/sys/util.h>
+#include <lz4.h>
+
+/* Data pages are LZ4-compressed on eviction, so the same amount of
+ * backing RAM holds several times more evicted pages than the plain
+ * BACKING_STORE_RAM implementation, at the cost of compression work on
+ * every page-out/page-in.
+ *
+ * The compressed image of a page is scattered over fixed-size storage
+ * blocks, so no contiguous-region allocation is needed and the store
+ * does not fragment. A location token is an index into a table of slot
+ * descriptors, each recording the blocks holding that page's image and
+ * its compressed length. Pages whose compressed image would not shrink
+ * (e.g. already-compressed or random data) are stored raw.
+ *
+ * Page-in/page-out operations are serialized by the core paging logic,
+ * so a single bounce buffer is used for compression and decompression,
+ * and it is sufficient for k_mem_paging_backing_store_location_get() to
+ * check that a worst-case (incompressible) page worth of blocks is
+ * still free for the page-out that follows.
+ *
+ * Like the plain RAM backing store, locations are freed as soon as
+ * pages are paged in, in k_mem_paging_backing_store_page_finalize(),
+ * so all data pages are treated as dirty and Z_PAGE_FRAME_BACKED is
+ * never set. See ram.c for notes on optimizing this.
+ */
+#define STORE_BLOCK_SIZE CONFIG_BACKING_STORE_RAM_COMPRESSED_BLOCK_SIZE
+#define STORE_NUM_BLOCKS ((CONFIG_BACKING_STORE_RAM_COMPRESSED_BUFFER_PAGES * \
+			   CONFIG_MMU_PAGE_SIZE) / STORE_BLOCK_SIZE)
+#define BLOCKS_PER_PAGE	 ceiling_fraction(CONFIG_MMU_PAGE_SIZE, \
+					  STORE_BLOCK_SIZE)
+
+struct page_slot {
+	/* Storage blocks holding this page's (possibly compressed) image */
+	void *blocks[BLOCKS_PER_PAGE];
+	/* Image size in bytes; equals CONFIG_MMU_PAGE_SIZE if stored raw */
+	uint16_t len;
+	/* Number of valid entries in blocks[] */
+	uint8_t num_blocks;
+	/* Whether the image is LZ4-compressed */
+	bool compressed;
+	/* Slot is allocated, possibly awaiting its page-out */
+	bool in_use;
+};
+
+SYS_MEM_BLOCKS_DEFINE_STATIC(store_blocks, STORE_BLOCK_SIZE,
+			     STORE_NUM_BLOCKS, sizeof(void *));
+
+static struct page_slot page_slots[CONFIG_BACKING_STORE_RAM_COMPRESSED_PAGES];
+static unsigned int free_slots;
+static unsigned int free_blocks;
+
+/* Bounce buffer for the contiguous compressed image */
+static char comp_buf[CONFIG_MMU_PAGE_SIZE];
+
+static struct page_slot *location_to_slot(uintptr_t location)
+{
+	__ASSERT(location < ARRAY_SIZE(page_slots), "bad location 0x%lx",
+		 location);
+	__ASSERT(page_slots[location].in_use, "free location 0x%lx", location);
+
+	return &page_slots[location];
+}
+
+static void slot_copy_in(struct page_slot *slot, const char *src, size_t len)
+{
+	for (size_t i = 0; i < slot->num_blocks; i++) {
+		size_t chunk = MIN(len - (i * STORE_BLOCK_SIZE),
+				   (size_t)STORE_BLOCK_SIZE);
+
+		(void)memcpy(slot->blocks[i], src + (i * STORE_BLOCK_SIZE),
+			     chunk);
+	}
+}
+
+static void slot_copy_out(struct page_slot *slot, char *dst)
+{
+	for (size_t i = 0; i < slot->num_blocks; i++) {
+		size_t chunk = MIN((size_t)slot->len - (i * STORE_BLOCK_SIZE),
+				   (size_t)STORE_BLOCK_SIZE);
+
+		(void)memcpy(dst + (i * STORE_BLOCK_SIZE), slot->blocks[i],
+			     chunk);
+	}
+}
+
+int k_mem_paging_backing_store_location_get(struct z_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	unsigned int reserve = page_fault ? 1U : 2U;
+
+	/* Keep one slot and one worst-case page of blocks in reserve for
+	 * page faults, analogous to the plain RAM store's last slab
+	 */
+	if ((free_slots < reserve) ||
+	    (free_blocks < (reserve * BLOCKS_PER_PAGE))) {
+		return -ENOMEM;
+	}
+
+	for (uintptr_t i = 0; i < ARRAY_SIZE(page_slots); i++) {
+		if (!page_slots[i].in_use) {
+			page_slots[i].in_use = true;
+			page_slots[i].num_blocks = 0U;
+			free_slots--;
+			*location = i;
+			return 0;
+		}
+	}
+
+	/* Implies a mismatch between free_slots and the slot table */
+	__ASSERT(false, "slot count mismatch");
+
+	return -ENOMEM;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	struct page_slot *slot = location_to_slot(location);
+
+	if (slot->num_blocks > 0U) {
+		int ret = sys_mem_blocks_free(&store_blocks, slot->num_blocks,
+					      slot->blocks);
+
+		__ASSERT(ret == 0, "block count mismatch");
+		(void)ret;
+		free_blocks += slot->num_blocks;
+		slot->num_blocks = 0U;
+	}
+	slot->in_use = false;
+	free_slots++;
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct page_slot *slot = location_to_slot(location);
+	const char *src;
+	int len, ret;
+
+	/* Bound the output below the page size so incompressible pages
+	 * fail fast and get stored raw
+	 */
+	len = LZ4_compress_default(Z_SCRATCH_PAGE, comp_buf,
+				   CONFIG_MMU_PAGE_SIZE,
+				   CONFIG_MMU_PAGE_SIZE - 1);
+	if (len > 0) {
+		src = comp_buf;
+		slot->compressed = true;
+	} else {
+		src = Z_SCRATCH_PAGE;
+		len = CONFIG_MMU_PAGE_SIZE;
+		slot->compressed = false;
+	}
+
+	slot->len = (uint16_t)len;
+	slot->num_blocks = (uint8_t)ceiling_fraction((unsigned int)len,
+						     STORE_BLOCK_SIZE);
+
+	/* Cannot fail: a worst-case page of blocks was held in reserve
+	 * by k_mem_paging_backing_store_location_get()
+	 */
+	ret = sys_mem_blocks_alloc(&store_blocks, slot->num_blocks,
+				   slot->blocks);
+	__ASSERT(ret == 0, "block count mismatch");
+	(void)ret;
+	free_blocks -= slot->num_blocks;
+
+	slot_copy_in(slot, src, (size_t)len);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct page_slot *slot = location_to_slot(location);
+
+	if (slot->compressed) {
+		int ret;
+
+		slot_copy_out(slot, comp_buf);
+		ret = LZ4_decompress_safe(comp_buf, Z_SCRATCH_PAGE, slot->len,
+					  CONFIG_MMU_PAGE_SIZE);
+		__ASSERT(ret == CONFIG_MMU_PAGE_SIZE,
+			 "corrupt compressed page at location 0x%lx",
+			 location);
+		(void)ret;
+	} else {
+		slot_copy_out(slot, Z_SCRATCH_PAGE);
+	}
+}
+
+void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
+					      uintptr_t location)
+{
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	free_slots = ARRAY_SIZE(page_slots);
+	free_blocks = STORE_NUM_BLOCKS;
+}
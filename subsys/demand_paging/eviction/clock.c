@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second-chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* Page frames are visited in a fixed circular order by a "hand" which
+ * resumes where the previous eviction left off. A page that has been
+ * accessed since the hand last passed it gets a second chance: its
+ * accessed state is cleared and the hand advances. The first page found
+ * not accessed is evicted.
+ *
+ * Unlike NRU there is no periodic timer clearing accessed states; the
+ * hand itself ages pages, so a page referenced since the hand's previous
+ * pass is never evicted. This approximates LRU more closely for working
+ * sets that are re-touched frequently, such as XIP code.
+ */
+static size_t clock_hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *last_pf = NULL, *pf;
+	bool last_dirty = false;
+	uintptr_t flags;
+	size_t i;
+
+	/* Two full sweeps: the first may do nothing but clear accessed
+	 * states, in which case the second is guaranteed to find a
+	 * victim among the evictable page frames.
+	 */
+	for (i = 0; i < (Z_NUM_PAGE_FRAMES * 2U); i++) {
+		pf = &z_page_frames[clock_hand];
+		clock_hand++;
+		if (clock_hand == Z_NUM_PAGE_FRAMES) {
+			clock_hand = 0;
+		}
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Query the accessed state, clearing it for the second
+		 * chance if it was set
+		 */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		last_pf = pf;
+		last_dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0UL) {
+			break;
+		}
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	clock_hand = 0;
+}
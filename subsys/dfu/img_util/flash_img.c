@@ -18,6 +18,10 @@
 #include <zephyr/dfu/mcuboot.h>
 #endif
 
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK_PIPELINED
+#include <zephyr/crypto/crypto.h>
+#endif
+
 #include <zephyr/devicetree.h>
 #ifdef CONFIG_TRUSTED_EXECUTION_NONSECURE
 	#define UPLOAD_FLASH_AREA_LABEL slot1_ns_partition
@@ -128,3 +132,119 @@ int flash_img_check(struct flash_img_context *ctx,
 	return rc;
 }
 #endif
+
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK_PIPELINED
+
+#define PIPELINE_CHUNK_SIZE (CONFIG_IMG_BLOCK_BUF_SIZE / 2)
+#define SHA256_DIGEST_SIZE  32
+
+/* Hash one chunk from the system work queue, so the caller can read
+ * the next chunk from flash in the meantime.
+ */
+struct flash_img_hash_work {
+	struct k_work work;
+	struct hash_ctx *hash_ctx;
+	struct hash_pkt pkt;
+	struct k_sem done;
+	int rc;
+};
+
+static void flash_img_hash_work_handler(struct k_work *work)
+{
+	struct flash_img_hash_work *hw =
+		CONTAINER_OF(work, struct flash_img_hash_work, work);
+
+	hw->rc = hash_update(hw->hash_ctx, &hw->pkt);
+	k_sem_give(&hw->done);
+}
+
+int flash_img_check_pipelined(struct flash_img_context *ctx,
+			      const struct flash_img_check *fic,
+			      uint8_t area_id,
+			      const struct device *crypto_dev)
+{
+	uint8_t digest[SHA256_DIGEST_SIZE];
+	struct flash_img_hash_work hw;
+	struct hash_ctx hash_ctx;
+	struct hash_pkt pkt;
+	bool pending = false;
+	size_t chunk;
+	size_t pos;
+	uint8_t idx = 0U;
+	int rc;
+
+	if (!ctx || !fic || !fic->match || fic->clen == 0 ||
+	    crypto_dev == NULL || !device_is_ready(crypto_dev)) {
+		return -EINVAL;
+	}
+
+	rc = flash_area_open(area_id,
+			     (const struct flash_area **)&(ctx->flash_area));
+	if (rc) {
+		return rc;
+	}
+
+	hash_ctx.flags = CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS;
+	rc = hash_begin_session(crypto_dev, &hash_ctx, CRYPTO_HASH_ALGO_SHA256);
+	if (rc) {
+		goto out_close;
+	}
+
+	k_work_init(&hw.work, flash_img_hash_work_handler);
+	k_sem_init(&hw.done, 0, 1);
+	hw.hash_ctx = &hash_ctx;
+
+	for (pos = 0; pos < fic->clen; pos += chunk, idx ^= 1U) {
+		uint8_t *buf = &ctx->buf[(size_t)idx * PIPELINE_CHUNK_SIZE];
+
+		chunk = MIN(PIPELINE_CHUNK_SIZE, fic->clen - pos);
+
+		/* Read the next chunk into one half of the buffer while
+		 * the work queue hashes the other half
+		 */
+		rc = flash_area_read(ctx->flash_area, pos, buf, chunk);
+
+		if (pending) {
+			k_sem_take(&hw.done, K_FOREVER);
+			pending = false;
+			if (hw.rc != 0 && rc == 0) {
+				rc = hw.rc;
+			}
+		}
+
+		if (rc != 0) {
+			goto out_free;
+		}
+
+		hw.pkt.in_buf = buf;
+		hw.pkt.in_len = chunk;
+		hw.pkt.out_buf = NULL;
+		k_work_submit(&hw.work);
+		pending = true;
+	}
+
+	if (pending) {
+		k_sem_take(&hw.done, K_FOREVER);
+		rc = hw.rc;
+		if (rc != 0) {
+			goto out_free;
+		}
+	}
+
+	pkt.in_buf = NULL;
+	pkt.in_len = 0;
+	pkt.out_buf = digest;
+	rc = hash_compute(&hash_ctx, &pkt);
+	if (rc == 0 && memcmp(digest, fic->match, SHA256_DIGEST_SIZE) != 0) {
+		rc = -EILSEQ;
+	}
+
+out_free:
+	(void)hash_free_session(crypto_dev, &hash_ctx);
+out_close:
+	flash_area_close(ctx->flash_area);
+	ctx->flash_area = NULL;
+
+	return rc;
+}
+#endif /* CONFIG_IMG_ENABLE_IMAGE_CHECK_PIPELINED */
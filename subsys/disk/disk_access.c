@@ -53,6 +53,329 @@ struct disk_info *disk_access_get_di(const char *name)
 	return disk;
 }
 
+#ifdef CONFIG_DISK_ACCESS_CACHE
+
+/* Sector cache shared by all registered disks, with deferred write-back.
+ * Single sector transfers, which is what FAT table and directory accesses
+ * come down to, are served from the cache; larger transfers bypass it
+ * after bringing the affected range in line with the disk. Dirty sectors
+ * are written out on eviction, on DISK_IOCTL_CTRL_SYNC and when the disk
+ * is unregistered.
+ */
+struct sector_cache_entry {
+	struct disk_info *disk; /* NULL if unused */
+	uint32_t sector;
+	uint32_t last_use;
+	bool dirty;
+	uint8_t data[CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE];
+};
+
+static struct sector_cache_entry sector_cache[CONFIG_DISK_ACCESS_CACHE_SECTOR_COUNT];
+static uint32_t sector_cache_use_counter;
+
+/* Staging buffer for coalesced flushes and read-ahead, and the sequential
+ * read detector feeding the read-ahead. Both protected by the cache lock.
+ */
+static uint8_t sector_cache_burst_buf[CONFIG_DISK_ACCESS_CACHE_BURST_SECTORS *
+				      CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE];
+static struct disk_info *sector_cache_seq_disk;
+static uint32_t sector_cache_seq_next;
+
+/* lock to protect the sector cache */
+static struct k_mutex sector_cache_lock;
+
+static bool sector_cache_usable(struct disk_info *disk)
+{
+	uint32_t sector_size;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+			      &sector_size) != 0)) {
+		return false;
+	}
+
+	return sector_size == CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE;
+}
+
+static struct sector_cache_entry *sector_cache_find(const struct disk_info *disk,
+						    uint32_t sector)
+{
+	for (int i = 0; i < ARRAY_SIZE(sector_cache); i++) {
+		if ((sector_cache[i].disk == disk) &&
+		    (sector_cache[i].sector == sector)) {
+			return &sector_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Write out a dirty entry together with any cached dirty neighbours, so
+ * that runs of adjacent sectors reach the media as one transfer.
+ */
+static int sector_cache_flush_entry(struct sector_cache_entry *entry)
+{
+	struct disk_info *disk = entry->disk;
+	struct sector_cache_entry *run;
+	uint32_t first = entry->sector;
+	uint32_t cnt = 1;
+	int rc;
+
+	if (!entry->dirty) {
+		return 0;
+	}
+
+	while (cnt < CONFIG_DISK_ACCESS_CACHE_BURST_SECTORS) {
+		run = sector_cache_find(disk, first - 1);
+		if ((run == NULL) || !run->dirty) {
+			break;
+		}
+		first--;
+		cnt++;
+	}
+
+	while (cnt < CONFIG_DISK_ACCESS_CACHE_BURST_SECTORS) {
+		run = sector_cache_find(disk, first + cnt);
+		if ((run == NULL) || !run->dirty) {
+			break;
+		}
+		cnt++;
+	}
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		run = sector_cache_find(disk, first + i);
+		memcpy(&sector_cache_burst_buf[i * sizeof(run->data)],
+		       run->data, sizeof(run->data));
+	}
+
+	rc = disk->ops->write(disk, sector_cache_burst_buf, first, cnt);
+	if (rc == 0) {
+		for (uint32_t i = 0; i < cnt; i++) {
+			sector_cache_find(disk, first + i)->dirty = false;
+		}
+	}
+
+	return rc;
+}
+
+static struct sector_cache_entry *sector_cache_evict(void)
+{
+	struct sector_cache_entry *lru = &sector_cache[0];
+
+	for (int i = 0; i < ARRAY_SIZE(sector_cache); i++) {
+		if (sector_cache[i].disk == NULL) {
+			return &sector_cache[i];
+		}
+
+		if ((int32_t)(sector_cache[i].last_use - lru->last_use) < 0) {
+			lru = &sector_cache[i];
+		}
+	}
+
+	if (sector_cache_flush_entry(lru) != 0) {
+		return NULL;
+	}
+
+	lru->disk = NULL;
+	return lru;
+}
+
+static int sector_cache_flush_range(const struct disk_info *disk,
+				    uint32_t start_sector, uint32_t num_sector)
+{
+	int rc = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(sector_cache); i++) {
+		struct sector_cache_entry *entry = &sector_cache[i];
+
+		if ((entry->disk == disk) &&
+		    (entry->sector - start_sector < num_sector)) {
+			rc = sector_cache_flush_entry(entry);
+			if (rc != 0) {
+				break;
+			}
+		}
+	}
+
+	return rc;
+}
+
+static void sector_cache_drop_range(const struct disk_info *disk,
+				    uint32_t start_sector, uint32_t num_sector)
+{
+	for (int i = 0; i < ARRAY_SIZE(sector_cache); i++) {
+		struct sector_cache_entry *entry = &sector_cache[i];
+
+		if ((entry->disk == disk) &&
+		    (entry->sector - start_sector < num_sector)) {
+			entry->disk = NULL;
+		}
+	}
+}
+
+static int sector_cache_flush_disk(const struct disk_info *disk, bool drop)
+{
+	int rc = 0, flush_rc;
+
+	k_mutex_lock(&sector_cache_lock, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(sector_cache); i++) {
+		struct sector_cache_entry *entry = &sector_cache[i];
+
+		if (entry->disk != disk) {
+			continue;
+		}
+
+		flush_rc = sector_cache_flush_entry(entry);
+		if ((flush_rc != 0) && (rc == 0)) {
+			rc = flush_rc;
+		}
+
+		if (drop) {
+			entry->disk = NULL;
+		}
+	}
+
+	if (drop && (sector_cache_seq_disk == disk)) {
+		sector_cache_seq_disk = NULL;
+	}
+	k_mutex_unlock(&sector_cache_lock);
+
+	return rc;
+}
+
+static int sector_cache_read(struct disk_info *disk, uint8_t *data_buf,
+			     uint32_t start_sector, uint32_t num_sector)
+{
+	struct sector_cache_entry *entry;
+	int rc;
+
+	k_mutex_lock(&sector_cache_lock, K_FOREVER);
+
+	if ((num_sector != 1U) || !sector_cache_usable(disk)) {
+		/* Bring the disk up to date, then bypass the cache */
+		rc = sector_cache_flush_range(disk, start_sector, num_sector);
+		if (rc == 0) {
+			rc = disk->ops->read(disk, data_buf, start_sector,
+					     num_sector);
+		}
+		goto out;
+	}
+
+	entry = sector_cache_find(disk, start_sector);
+	if (entry == NULL) {
+		struct sector_cache_entry *fill[CONFIG_DISK_ACCESS_CACHE_BURST_SECTORS];
+		uint32_t sector_count;
+		uint32_t cnt = 1;
+
+		if ((CONFIG_DISK_ACCESS_CACHE_BURST_SECTORS > 1) &&
+		    (disk == sector_cache_seq_disk) &&
+		    (start_sector == sector_cache_seq_next)) {
+			/* Sequential pattern; read ahead into the cache */
+			cnt = CONFIG_DISK_ACCESS_CACHE_BURST_SECTORS;
+			if ((disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT,
+					      &sector_count) == 0) &&
+			    (start_sector + cnt > sector_count)) {
+				cnt = sector_count - start_sector;
+			}
+		}
+
+		/* Reserve the entries up front: eviction may flush through
+		 * the staging buffer, so it must not run after the read.
+		 */
+		for (uint32_t i = 0; i < cnt; i++) {
+			if (sector_cache_find(disk, start_sector + i) != NULL) {
+				/* Keep the cached, possibly dirty, copy */
+				fill[i] = NULL;
+				continue;
+			}
+
+			fill[i] = sector_cache_evict();
+			if (fill[i] == NULL) {
+				if (i == 0) {
+					rc = -EIO;
+					goto out;
+				}
+				cnt = i;
+				break;
+			}
+
+			fill[i]->disk = disk;
+			fill[i]->sector = start_sector + i;
+			fill[i]->dirty = false;
+			fill[i]->last_use = ++sector_cache_use_counter;
+		}
+
+		rc = disk->ops->read(disk, sector_cache_burst_buf,
+				     start_sector, cnt);
+		if (rc != 0) {
+			for (uint32_t i = 0; i < cnt; i++) {
+				if (fill[i] != NULL) {
+					fill[i]->disk = NULL;
+				}
+			}
+			goto out;
+		}
+
+		for (uint32_t i = 0; i < cnt; i++) {
+			if (fill[i] != NULL) {
+				memcpy(fill[i]->data,
+				       &sector_cache_burst_buf[i * sizeof(fill[i]->data)],
+				       sizeof(fill[i]->data));
+			}
+		}
+
+		entry = fill[0];
+	}
+
+	entry->last_use = ++sector_cache_use_counter;
+	memcpy(data_buf, entry->data, sizeof(entry->data));
+	sector_cache_seq_disk = disk;
+	sector_cache_seq_next = start_sector + 1;
+	rc = 0;
+out:
+	k_mutex_unlock(&sector_cache_lock);
+
+	return rc;
+}
+
+static int sector_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+			      uint32_t start_sector, uint32_t num_sector)
+{
+	struct sector_cache_entry *entry;
+	int rc = 0;
+
+	k_mutex_lock(&sector_cache_lock, K_FOREVER);
+
+	if ((num_sector != 1U) || !sector_cache_usable(disk)) {
+		/* Cached copies of the range are superseded by this write */
+		sector_cache_drop_range(disk, start_sector, num_sector);
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		goto out;
+	}
+
+	entry = sector_cache_find(disk, start_sector);
+	if (entry == NULL) {
+		entry = sector_cache_evict();
+		if (entry == NULL) {
+			rc = -EIO;
+			goto out;
+		}
+
+		entry->disk = disk;
+		entry->sector = start_sector;
+	}
+
+	memcpy(entry->data, data_buf, sizeof(entry->data));
+	entry->dirty = true;
+	entry->last_use = ++sector_cache_use_counter;
+out:
+	k_mutex_unlock(&sector_cache_lock);
+
+	return rc;
+}
+
+#endif /* CONFIG_DISK_ACCESS_CACHE */
+
 int disk_access_init(const char *pdrv)
 {
 	struct disk_info *disk = disk_access_get_di(pdrv);
@@ -87,7 +410,12 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		rc = sector_cache_read(disk, data_buf, start_sector,
+				       num_sector);
+#else
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -101,7 +429,12 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		rc = sector_cache_write(disk, data_buf, start_sector,
+					num_sector);
+#else
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -114,6 +447,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->ioctl != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		if (cmd == DISK_IOCTL_CTRL_SYNC) {
+			rc = sector_cache_flush_disk(disk, false);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+#endif
 		rc = disk->ops->ioctl(disk, cmd, buf);
 	}
 
@@ -161,6 +502,14 @@ int disk_access_unregister(struct disk_info *disk)
 		rc = -EINVAL;
 		goto unreg_err;
 	}
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	rc = sector_cache_flush_disk(disk, true);
+	if (rc != 0) {
+		LOG_ERR("cache flush failed (%d)", rc);
+		goto unreg_err;
+	}
+#endif
+
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
 	LOG_DBG("disk interface(%s) unregistered", disk->name);
@@ -174,6 +523,9 @@ static int disk_init(const struct device *dev)
 	ARG_UNUSED(dev);
 
 	k_mutex_init(&mutex);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	k_mutex_init(&sector_cache_lock);
+#endif
 	sys_dlist_init(&disk_access_list);
 	return 0;
 }
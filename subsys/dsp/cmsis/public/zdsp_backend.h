@@ -16,6 +16,16 @@ extern "C" {
 
 #include <arm_math.h>
 
+/* An override header can implement selected function families with
+ * vendor-optimized kernels (e.g. Helium/MVE) and define the matching
+ * ZDSP_BACKEND_OVERRIDE_* guards; every family it does not override
+ * keeps the CMSIS-DSP implementation below.
+ */
+#ifdef CONFIG_DSP_BACKEND_CMSIS_OVERRIDES
+#include <zdsp_backend_overrides.h>
+#endif
+
+#ifndef ZDSP_BACKEND_OVERRIDE_MULT
 static inline void zdsp_mult_q7(const q7_t *src_a, const q7_t *src_b, q7_t *dst,
 				uint32_t block_size)
 {
@@ -36,7 +46,9 @@ static inline void zdsp_mult_f32(const float32_t *src_a, const float32_t *src_b,
 {
 	arm_mult_f32(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_MULT */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_ADD
 static inline void zdsp_add_q7(const q7_t *src_a, const q7_t *src_b, q7_t *dst, uint32_t block_size)
 {
 	arm_add_q7(src_a, src_b, dst, block_size);
@@ -56,7 +68,9 @@ static inline void zdsp_add_f32(const float32_t *src_a, const float32_t *src_b,
 {
 	arm_add_f32(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_ADD */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_SUB
 static inline void zdsp_sub_q7(const q7_t *src_a, const q7_t *src_b, q7_t *dst, uint32_t block_size)
 {
 	arm_sub_q7(src_a, src_b, dst, block_size);
@@ -76,7 +90,9 @@ static inline void zdsp_sub_f32(const float32_t *src_a, const float32_t *src_b,
 {
 	arm_sub_f32(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_SUB */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_SCALE
 static inline void zdsp_scale_q7(const q7_t *src, q7_t scale_fract, int8_t shift, q7_t *dst,
 				 uint32_t block_size)
 {
@@ -98,7 +114,9 @@ static inline void zdsp_scale_f32(const float32_t *src, float32_t scale, float32
 {
 	arm_scale_f32(src, scale, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_SCALE */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_ABS
 static inline void zdsp_abs_q7(const q7_t *src, q7_t *dst, uint32_t block_size)
 {
 	arm_abs_q7(src, dst, block_size);
@@ -115,7 +133,9 @@ static inline void zdsp_abs_f32(const float32_t *src, float32_t *dst, uint32_t b
 {
 	arm_abs_f32(src, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_ABS */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_NEGATE
 static inline void zdsp_negate_q7(const q7_t *src, q7_t *dst, uint32_t block_size)
 {
 	arm_negate_q7(src, dst, block_size);
@@ -132,7 +152,9 @@ static inline void zdsp_negate_f32(const float32_t *src, float32_t *dst, uint32_
 {
 	arm_negate_f32(src, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_NEGATE */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_DOT_PROD
 static inline void zdsp_dot_prod_q7(const q7_t *src_a, const q7_t *src_b, uint32_t block_size,
 				    q31_t *dst)
 {
@@ -153,7 +175,9 @@ static inline void zdsp_dot_prod_f32(const float32_t *src_a, const float32_t *sr
 {
 	arm_dot_prod_f32(src_a, src_b, block_size, dst);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_DOT_PROD */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_SHIFT
 static inline void zdsp_shift_q7(const q7_t *src, int8_t shift_bits, q7_t *dst, uint32_t block_size)
 {
 	arm_shift_q7(src, shift_bits, dst, block_size);
@@ -168,7 +192,9 @@ static inline void zdsp_shift_q31(const q31_t *src, int8_t shift_bits, q31_t *ds
 {
 	arm_shift_q31(src, shift_bits, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_SHIFT */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_OFFSET
 static inline void zdsp_offset_q7(const q7_t *src, q7_t offset, q7_t *dst, uint32_t block_size)
 {
 	arm_offset_q7(src, offset, dst, block_size);
@@ -186,7 +212,9 @@ static inline void zdsp_offset_f32(const float32_t *src, float32_t offset, float
 {
 	arm_offset_f32(src, offset, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_OFFSET */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_CLIP
 static inline void zdsp_clip_q7(const q7_t *src, q7_t *dst, q7_t low, q7_t high,
 				uint32_t num_samples)
 {
@@ -207,7 +235,9 @@ static inline void zdsp_clip_f32(const float32_t *src, float32_t *dst, float32_t
 {
 	arm_clip_f32(src, dst, low, high, num_samples);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_CLIP */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_AND
 static inline void zdsp_and_u8(const uint8_t *src_a, const uint8_t *src_b, uint8_t *dst,
 			       uint32_t block_size)
 {
@@ -223,7 +253,9 @@ static inline void zdsp_and_u32(const uint32_t *src_a, const uint32_t *src_b, ui
 {
 	arm_and_u32(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_AND */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_OR
 static inline void zdsp_or_u8(const uint8_t *src_a, const uint8_t *src_b, uint8_t *dst,
 			      uint32_t block_size)
 {
@@ -239,7 +271,9 @@ static inline void zdsp_or_u32(const uint32_t *src_a, const uint32_t *src_b, uin
 {
 	arm_or_u32(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_OR */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_XOR
 static inline void zdsp_xor_u8(const uint8_t *src_a, const uint8_t *src_b, uint8_t *dst,
 			       uint32_t block_size)
 {
@@ -255,7 +289,9 @@ static inline void zdsp_xor_u32(const uint32_t *src_a, const uint32_t *src_b, ui
 {
 	arm_xor_u32(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_XOR */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_NOT
 static inline void zdsp_not_u8(const uint8_t *src, uint8_t *dst, uint32_t block_size)
 {
 	arm_not_u8(src, dst, block_size);
@@ -268,6 +304,7 @@ static inline void zdsp_not_u32(const uint32_t *src, uint32_t *dst, uint32_t blo
 {
 	arm_not_u32(src, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_NOT */
 
 #ifdef __cplusplus
 }
@@ -16,57 +16,75 @@ extern "C" {
 
 #include <arm_math_f16.h>
 
+#ifndef ZDSP_BACKEND_OVERRIDE_MULT_F16
 static inline void zdsp_mult_f16(const float16_t *src_a, const float16_t *src_b, float16_t *dst,
 				 uint32_t block_size)
 {
 	arm_mult_f16(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_MULT_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_ADD_F16
 static inline void zdsp_add_f16(const float16_t *src_a, const float16_t *src_b, float16_t *dst,
 				uint32_t block_size)
 {
 	arm_add_f16(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_ADD_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_SUB_F16
 static inline void zdsp_sub_f16(const float16_t *src_a, const float16_t *src_b, float16_t *dst,
 				uint32_t block_size)
 {
 	arm_sub_f16(src_a, src_b, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_SUB_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_SCALE_F16
 static inline void zdsp_scale_f16(const float16_t *src, float16_t scale, float16_t *dst,
 				  uint32_t block_size)
 {
 	arm_scale_f16(src, scale, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_SCALE_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_ABS_F16
 static inline void zdsp_abs_f16(const float16_t *src, float16_t *dst, uint32_t block_size)
 {
 	arm_abs_f16(src, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_ABS_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_DOT_PROD_F16
 static inline void zdsp_dot_prod_f16(const float16_t *src_a, const float16_t *src_b,
 				     uint32_t block_size, float16_t *result)
 {
 	arm_dot_prod_f16(src_a, src_b, block_size, result);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_DOT_PROD_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_OFFSET_F16
 static inline void zdsp_offset_f16(const float16_t *src, float16_t offset, float16_t *dst,
 				   uint32_t block_size)
 {
 	arm_offset_f16(src, offset, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_OFFSET_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_NEGATE_F16
 static inline void zdsp_negate_f16(const float16_t *src, float16_t *dst, uint32_t block_size)
 {
 	arm_negate_f16(src, dst, block_size);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_NEGATE_F16 */
 
+#ifndef ZDSP_BACKEND_OVERRIDE_CLIP_F16
 static inline void zdsp_clip_f16(const float16_t *src, float16_t *dst, float16_t low,
 				 float16_t high, uint32_t num_samples)
 {
 	arm_clip_f16(src, dst, low, high, num_samples);
 }
+#endif /* ZDSP_BACKEND_OVERRIDE_CLIP_F16 */
 
 #ifdef __cplusplus
 }
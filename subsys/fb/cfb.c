@@ -59,10 +59,48 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING)
+	/** Bounding box of the modified area, in pixels in X direction
+	 * and in tile rows in Y direction. Empty when dirty_x0 > dirty_x1.
+	 */
+	uint16_t dirty_x0;
+	uint16_t dirty_x1;
+	uint16_t dirty_t0;
+	uint16_t dirty_t1;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING)
+static void fb_dirty_clear(struct char_framebuffer *fb)
+{
+	fb->dirty_x0 = UINT16_MAX;
+	fb->dirty_x1 = 0U;
+	fb->dirty_t0 = UINT16_MAX;
+	fb->dirty_t1 = 0U;
+}
+
+static void fb_dirty_mark(struct char_framebuffer *fb, uint16_t x0,
+			  uint16_t t0, uint16_t x1, uint16_t t1)
+{
+	fb->dirty_x0 = MIN(fb->dirty_x0, x0);
+	fb->dirty_x1 = MAX(fb->dirty_x1, MIN(x1, fb->x_res - 1U));
+	fb->dirty_t0 = MIN(fb->dirty_t0, t0);
+	fb->dirty_t1 = MAX(fb->dirty_t1, MIN(t1, fb->y_res / 8U - 1U));
+}
+
+static void fb_dirty_mark_all(struct char_framebuffer *fb)
+{
+	fb_dirty_mark(fb, 0U, 0U, fb->x_res - 1U, fb->y_res / 8U - 1U);
+}
+#else
+#define fb_dirty_clear(fb)
+#define fb_dirty_mark(fb, x0, t0, x1, t1)
+#define fb_dirty_mark_all(fb)
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING */
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 {
 	return (uint8_t *)fptr->data +
@@ -150,6 +188,9 @@ int cfb_print(const struct device *dev, char *str, uint16_t x, uint16_t y)
 				x = 0U;
 				y += fptr->height;
 			}
+			fb_dirty_mark(&char_fb, x, y / 8U,
+				      x + fptr->width - 1U,
+				      (y + fptr->height) / 8U - 1U);
 			x += fb->kerning + draw_char_vtmono(fb, str[i], x, y);
 		}
 		return 0;
@@ -187,6 +228,9 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			}
 		}
 
+		fb_dirty_mark(&char_fb, x, y / 8U, x + width - 1U,
+			      (y + height) / 8U - 1U);
+
 		return 0;
 	}
 
@@ -218,6 +262,8 @@ int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 	desc.pitch = fb->x_res;
 	memset(fb->buf, 0, fb->size);
 
+	fb_dirty_mark_all(&char_fb);
+
 	return 0;
 }
 
@@ -231,6 +277,7 @@ int cfb_framebuffer_invert(const struct device *dev)
 	}
 
 	fb->inverted = !fb->inverted;
+	fb_dirty_mark_all(fb);
 
 	return 0;
 }
@@ -240,21 +287,47 @@ int cfb_framebuffer_finalize(const struct device *dev)
 	const struct display_driver_api *api = dev->api;
 	const struct char_framebuffer *fb = &char_fb;
 	struct display_buffer_descriptor desc;
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING)
+	uint16_t tiles;
+	int err;
+#endif
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
+	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
+		cfb_invert(fb);
+		fb_dirty_mark_all(&char_fb);
+	}
+
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING)
+	if (fb->dirty_x0 > fb->dirty_x1) {
+		/* Nothing was modified since the last finalize */
+		return 0;
+	}
+
+	tiles = fb->dirty_t1 - fb->dirty_t0 + 1U;
+	desc.width = fb->dirty_x1 - fb->dirty_x0 + 1U;
+	desc.height = tiles * 8U;
+	desc.pitch = fb->x_res;
+	desc.buf_size = (tiles - 1U) * fb->x_res + desc.width;
+
+	err = api->write(dev, fb->dirty_x0, fb->dirty_t0 * 8U, &desc,
+			 &fb->buf[fb->dirty_t0 * fb->x_res + fb->dirty_x0]);
+	if (err == 0) {
+		fb_dirty_clear(&char_fb);
+	}
+
+	return err;
+#else
 	desc.buf_size = fb->size;
 	desc.width = fb->x_res;
 	desc.height = fb->y_res;
 	desc.pitch = fb->x_res;
 
-	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
-		cfb_invert(fb);
-	}
-
 	return api->write(dev, 0, 0, &desc, fb->buf);
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING */
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -358,5 +431,8 @@ int cfb_framebuffer_init(const struct device *dev)
 
 	memset(fb->buf, 0, fb->size);
 
+	fb_dirty_clear(fb);
+	fb_dirty_mark_all(fb);
+
 	return 0;
 }
@@ -8,6 +8,8 @@
 #include <stddef.h>
 #include <string.h>
 
+#include <zephyr/sys/crc.h>
+
 #include <zephyr/fs/fcb.h>
 #include "fcb_priv.h"
 
@@ -117,6 +119,202 @@ err:
 	return rc;
 }
 
+#ifdef CONFIG_FCB_APPEND_BATCH
+
+struct fcb_batch_ctx {
+	uint8_t buf[CONFIG_FCB_APPEND_BATCH_BUF_SIZE];
+	uint16_t buf_len;
+	uint32_t write_off;
+};
+
+static int
+fcb_batch_flush(struct fcb *fcb, struct fcb_batch_ctx *ctx, bool final)
+{
+	uint16_t wr_len = ctx->buf_len;
+	int rc;
+
+	if (!final && fcb->f_align > 1U) {
+		/* Only write up to an alignment boundary so the next flush
+		 * starts at a writable offset.
+		 */
+		wr_len &= ~((uint16_t)fcb->f_align - 1U);
+	}
+
+	if (wr_len == 0U) {
+		return 0;
+	}
+
+	rc = fcb_flash_write(fcb, fcb->f_active.fe_sector, ctx->write_off,
+			     ctx->buf, wr_len);
+	if (rc) {
+		return -EIO;
+	}
+
+	ctx->write_off += wr_len;
+	ctx->buf_len -= wr_len;
+	memmove(ctx->buf, &ctx->buf[wr_len], ctx->buf_len);
+
+	return 0;
+}
+
+/* Stage bytes for writing, updating the entry CRC as the data goes by.
+ * A NULL data pointer stages padding bytes.
+ */
+static int
+fcb_batch_put(struct fcb *fcb, struct fcb_batch_ctx *ctx, const uint8_t *data,
+	      uint16_t len, uint8_t *crc)
+{
+	uint16_t chunk;
+	int rc;
+
+	while (len) {
+		if (ctx->buf_len == sizeof(ctx->buf)) {
+			rc = fcb_batch_flush(fcb, ctx, false);
+			if (rc) {
+				return rc;
+			}
+		}
+
+		chunk = MIN(len, sizeof(ctx->buf) - ctx->buf_len);
+		if (data) {
+			memcpy(&ctx->buf[ctx->buf_len], data, chunk);
+			if (crc) {
+				*crc = crc8_ccitt(*crc, data, chunk);
+			}
+			data += chunk;
+		} else {
+			memset(&ctx->buf[ctx->buf_len], fcb->f_erase_value,
+			       chunk);
+		}
+
+		ctx->buf_len += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static uint32_t
+fcb_batch_entry_len(const struct fcb_batch_entry *entry)
+{
+	uint32_t len = 0U;
+
+	for (int i = 0; i < entry->iov_cnt; i++) {
+		len += entry->iov[i].iov_len;
+	}
+
+	return len;
+}
+
+int
+fcb_append_batch(struct fcb *fcb, const struct fcb_batch_entry *entries,
+		 int cnt, struct fcb_entry *locs)
+{
+	struct fcb_batch_ctx ctx;
+	struct flash_sector *sector;
+	struct fcb_entry *active;
+	uint32_t total = 0U;
+	int rc;
+
+	if (cnt <= 0) {
+		return -EINVAL;
+	}
+
+	for (int i = 0; i < cnt; i++) {
+		uint32_t len = fcb_batch_entry_len(&entries[i]);
+
+		if (len >= FCB_MAX_LEN) {
+			return -EINVAL;
+		}
+
+		total += fcb_len_in_flash(fcb, (len < 0x80) ? 1 : 2) +
+			 fcb_len_in_flash(fcb, len) +
+			 fcb_len_in_flash(fcb, FCB_CRC_SZ);
+	}
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	active = &fcb->f_active;
+	if (active->fe_elem_off + total > active->fe_sector->fs_size) {
+		sector = fcb_new_sector(fcb, fcb->f_scratch_cnt);
+		if (!sector || (sector->fs_size <
+			fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)) + total)) {
+			rc = -ENOSPC;
+			goto err;
+		}
+		rc = fcb_sector_hdr_init(fcb, sector, fcb->f_active_id + 1);
+		if (rc) {
+			goto err;
+		}
+		fcb->f_active.fe_sector = sector;
+		fcb->f_active.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
+		fcb->f_active_id++;
+	}
+
+	ctx.buf_len = 0U;
+	ctx.write_off = active->fe_elem_off;
+
+	for (int i = 0; i < cnt; i++) {
+		const struct fcb_batch_entry *entry = &entries[i];
+		uint16_t len = fcb_batch_entry_len(entry);
+		uint8_t crc = CRC8_CCITT_INITIAL_VALUE;
+		uint32_t elem_off = ctx.write_off + ctx.buf_len;
+		uint8_t hdr[2];
+		int hdr_cnt;
+
+		hdr_cnt = fcb_put_len(fcb, hdr, len);
+		if (hdr_cnt < 0) {
+			rc = hdr_cnt;
+			goto err;
+		}
+
+		if (locs) {
+			locs[i].fe_sector = active->fe_sector;
+			locs[i].fe_elem_off = elem_off;
+			locs[i].fe_data_off = elem_off +
+				fcb_len_in_flash(fcb, hdr_cnt);
+			locs[i].fe_data_len = len;
+		}
+
+		rc = fcb_batch_put(fcb, &ctx, hdr, hdr_cnt, &crc);
+		rc = rc ? rc : fcb_batch_put(fcb, &ctx, NULL,
+			fcb_len_in_flash(fcb, hdr_cnt) - hdr_cnt, NULL);
+
+		for (int j = 0; !rc && j < entry->iov_cnt; j++) {
+			rc = fcb_batch_put(fcb, &ctx, entry->iov[j].iov_base,
+					   entry->iov[j].iov_len, &crc);
+		}
+
+		rc = rc ? rc : fcb_batch_put(fcb, &ctx, NULL,
+			fcb_len_in_flash(fcb, len) - len, NULL);
+		rc = rc ? rc : fcb_batch_put(fcb, &ctx, &crc, FCB_CRC_SZ,
+					     NULL);
+		rc = rc ? rc : fcb_batch_put(fcb, &ctx, NULL,
+			fcb_len_in_flash(fcb, FCB_CRC_SZ) - FCB_CRC_SZ, NULL);
+		if (rc) {
+			goto err;
+		}
+	}
+
+	rc = fcb_batch_flush(fcb, &ctx, true);
+	if (rc) {
+		goto err;
+	}
+
+	active->fe_elem_off = ctx.write_off;
+
+	k_mutex_unlock(&fcb->f_mtx);
+	return 0;
+err:
+	k_mutex_unlock(&fcb->f_mtx);
+	return rc;
+}
+
+#endif /* CONFIG_FCB_APPEND_BATCH */
+
 int
 fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 {
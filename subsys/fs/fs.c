@@ -79,6 +79,81 @@ static const struct fs_file_system_t *fs_type_get(int type)
 	return (ep != NULL) ? ep->fstp : NULL;
 }
 
+#ifdef CONFIG_FILE_SYSTEM_MNT_POINT_CACHE
+
+/* Recently resolved mount points, most recent first. The cache is only
+ * consulted when no mount point is nested under another, as only then a
+ * prefix match against any cached entry is necessarily the longest one.
+ * Protected by the subsystem mutex.
+ */
+static struct fs_mount_t *mnt_point_cache[CONFIG_FILE_SYSTEM_MNT_POINT_CACHE_SIZE];
+static bool mnt_points_nested;
+
+static bool mnt_point_matches(const struct fs_mount_t *mp,
+			      const char *name, size_t name_len)
+{
+	size_t len = mp->mountp_len;
+
+	if (len > name_len) {
+		return false;
+	}
+
+	if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
+		return false;
+	}
+
+	return strncmp(name, mp->mnt_point, len) == 0;
+}
+
+static void mnt_point_cache_insert(struct fs_mount_t *mp)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(mnt_point_cache) - 1; ++i) {
+		if (mnt_point_cache[i] == mp) {
+			break;
+		}
+	}
+
+	while (i > 0) {
+		mnt_point_cache[i] = mnt_point_cache[i - 1];
+		--i;
+	}
+
+	mnt_point_cache[0] = mp;
+}
+
+static void mnt_point_cache_purge(const struct fs_mount_t *mp)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(mnt_point_cache); ++i) {
+		if (mnt_point_cache[i] == mp) {
+			mnt_point_cache[i] = NULL;
+		}
+	}
+}
+
+static void mnt_point_nesting_update(void)
+{
+	struct fs_mount_t *itr, *other;
+	sys_dnode_t *node, *onode;
+
+	mnt_points_nested = false;
+	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
+		itr = CONTAINER_OF(node, struct fs_mount_t, node);
+		SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, onode) {
+			other = CONTAINER_OF(onode, struct fs_mount_t, node);
+			if ((itr != other) &&
+			    mnt_point_matches(itr, other->mnt_point,
+					      other->mountp_len)) {
+				mnt_points_nested = true;
+				return;
+			}
+		}
+	}
+}
+
+#endif /* CONFIG_FILE_SYSTEM_MNT_POINT_CACHE */
+
 static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			    const char *name, size_t *match_len)
 {
@@ -88,6 +163,21 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 	sys_dnode_t *node;
 
 	k_mutex_lock(&mutex, K_FOREVER);
+
+#ifdef CONFIG_FILE_SYSTEM_MNT_POINT_CACHE
+	if (!mnt_points_nested) {
+		for (size_t i = 0; i < ARRAY_SIZE(mnt_point_cache); ++i) {
+			itr = mnt_point_cache[i];
+			if ((itr != NULL) &&
+			    mnt_point_matches(itr, name, name_len)) {
+				mnt_p = itr;
+				mnt_point_cache_insert(itr);
+				goto unlock;
+			}
+		}
+	}
+#endif
+
 	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
 		itr = CONTAINER_OF(node, struct fs_mount_t, node);
 		len = itr->mountp_len;
@@ -115,6 +205,13 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			longest_match = len;
 		}
 	}
+
+#ifdef CONFIG_FILE_SYSTEM_MNT_POINT_CACHE
+	if (mnt_p != NULL) {
+		mnt_point_cache_insert(mnt_p);
+	}
+unlock:
+#endif
 	k_mutex_unlock(&mutex);
 
 	if (mnt_p == NULL) {
@@ -174,6 +271,64 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 	return rc;
 }
 
+#ifdef CONFIG_FILE_SYSTEM_OPEN_AT
+int fs_open_at(struct fs_file_t *zfp, const struct fs_dir_t *zdp,
+	       const char *name, fs_mode_t flags)
+{
+	char path[CONFIG_FILE_SYSTEM_OPEN_AT_PATH_MAX];
+	const struct fs_mount_t *mp;
+	int len;
+	int rc;
+
+	if ((name == NULL) || (name[0] == '\0') || (name[0] == '/')) {
+		LOG_ERR("invalid file name!!");
+		return -EINVAL;
+	}
+
+	if ((zdp == NULL) || (zdp->mp == NULL) ||
+	    (zdp->open_path[0] == '\0')) {
+		LOG_ERR("invalid directory handle!!");
+		return -EINVAL;
+	}
+
+	if (zfp->mp != NULL) {
+		return -EBUSY;
+	}
+
+	len = snprintf(path, sizeof(path), "%s/%s", zdp->open_path, name);
+	if ((len < 0) || ((size_t)len >= sizeof(path))) {
+		LOG_ERR("path too long!!");
+		return -EINVAL;
+	}
+
+	/* The directory handle already identifies the mount point, so no
+	 * path resolution is needed.
+	 */
+	mp = zdp->mp;
+
+	if (((mp->flags & FS_MOUNT_FLAG_READ_ONLY) != 0) &&
+	    (flags & FS_O_CREATE || flags & FS_O_WRITE)) {
+		return -EROFS;
+	}
+
+	CHECKIF(mp->fs->open == NULL) {
+		return -ENOTSUP;
+	}
+
+	zfp->mp = mp;
+	rc = mp->fs->open(zfp, path, flags);
+	if (rc < 0) {
+		LOG_ERR("file open error (%d)", rc);
+		zfp->mp = NULL;
+		return rc;
+	}
+
+	zfp->flags = flags;
+
+	return rc;
+}
+#endif /* CONFIG_FILE_SYSTEM_OPEN_AT */
+
 int fs_close(struct fs_file_t *zfp)
 {
 	int rc = -EINVAL;
@@ -364,6 +519,18 @@ int fs_opendir(struct fs_dir_t *zdp, const char *abs_path)
 		LOG_ERR("directory open error (%d)", rc);
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_OPEN_AT
+	if (rc == 0) {
+		/* Remember the path for fs_open_at; directories opened with
+		 * a path that does not fit cannot be used with it.
+		 */
+		zdp->open_path[0] = '\0';
+		if (strlen(abs_path) < sizeof(zdp->open_path)) {
+			strcpy(zdp->open_path, abs_path);
+		}
+	}
+#endif
+
 	return rc;
 }
 
@@ -716,6 +883,10 @@ int fs_mount(struct fs_mount_t *mp)
 	sys_dlist_append(&fs_mnt_list, &mp->node);
 	LOG_DBG("fs mounted at %s", mp->mnt_point);
 
+#ifdef CONFIG_FILE_SYSTEM_MNT_POINT_CACHE
+	mnt_point_nesting_update();
+#endif
+
 mount_err:
 	k_mutex_unlock(&mutex);
 	return rc;
@@ -792,6 +963,11 @@ int fs_unmount(struct fs_mount_t *mp)
 	sys_dlist_remove(&mp->node);
 	LOG_DBG("fs unmounted from %s", mp->mnt_point);
 
+#ifdef CONFIG_FILE_SYSTEM_MNT_POINT_CACHE
+	mnt_point_cache_purge(mp);
+	mnt_point_nesting_update();
+#endif
+
 unmount_err:
 	k_mutex_unlock(&mutex);
 	return rc;
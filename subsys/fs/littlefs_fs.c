@@ -159,13 +159,143 @@ static int errno_to_lfs(int error)
 }
 
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+
+/* Whole-block read cache shared by all mounted littlefs filesystems on the
+ * flash backend. Writes go through to flash immediately (updating a cached
+ * copy in place), so littlefs's power-loss guarantees are unaffected and no
+ * dirty data is ever held in RAM.
+ */
+struct block_cache_entry {
+	const struct lfs_config *cfg; /* Owning filesystem, NULL if unused */
+	lfs_block_t block;
+	uint32_t last_use;
+	uint8_t data[CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCK_SIZE];
+};
+
+static struct block_cache_entry block_cache[CONFIG_FS_LITTLEFS_BLOCK_CACHE_COUNT];
+static uint32_t block_cache_use_counter;
+static K_MUTEX_DEFINE(block_cache_lock);
+
+static bool block_cache_applicable(const struct lfs_config *c)
+{
+	return c->block_size <= CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCK_SIZE;
+}
+
+static struct block_cache_entry *block_cache_find(const struct lfs_config *c,
+						  lfs_block_t block)
+{
+	for (int i = 0; i < ARRAY_SIZE(block_cache); i++) {
+		if (block_cache[i].cfg == c && block_cache[i].block == block) {
+			return &block_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct block_cache_entry *block_cache_evict(void)
+{
+	struct block_cache_entry *lru = &block_cache[0];
+
+	for (int i = 0; i < ARRAY_SIZE(block_cache); i++) {
+		if (block_cache[i].cfg == NULL) {
+			return &block_cache[i];
+		}
+
+		if ((int32_t)(block_cache[i].last_use - lru->last_use) < 0) {
+			lru = &block_cache[i];
+		}
+	}
+
+	return lru;
+}
+
+static void block_cache_invalidate(const struct lfs_config *c,
+				   lfs_block_t block)
+{
+	struct block_cache_entry *entry;
+
+	k_mutex_lock(&block_cache_lock, K_FOREVER);
+	entry = block_cache_find(c, block);
+	if (entry) {
+		entry->cfg = NULL;
+	}
+	k_mutex_unlock(&block_cache_lock);
+}
+
+static void block_cache_invalidate_fs(const struct lfs_config *c)
+{
+	k_mutex_lock(&block_cache_lock, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(block_cache); i++) {
+		if (block_cache[i].cfg == c) {
+			block_cache[i].cfg = NULL;
+		}
+	}
+	k_mutex_unlock(&block_cache_lock);
+}
+
+static int block_cache_read(const struct lfs_config *c, lfs_block_t block,
+			    lfs_off_t off, void *buffer, lfs_size_t size)
+{
+	const struct flash_area *fa = c->context;
+	struct block_cache_entry *entry;
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_lock, K_FOREVER);
+
+	entry = block_cache_find(c, block);
+	if (!entry) {
+		entry = block_cache_evict();
+		rc = flash_area_read(fa, (size_t)block * c->block_size,
+				     entry->data, c->block_size);
+		if (rc < 0) {
+			entry->cfg = NULL;
+			goto out;
+		}
+		entry->cfg = c;
+		entry->block = block;
+	}
+
+	entry->last_use = ++block_cache_use_counter;
+	memcpy(buffer, &entry->data[off], size);
+out:
+	k_mutex_unlock(&block_cache_lock);
+
+	return rc;
+}
+
+static void block_cache_update(const struct lfs_config *c, lfs_block_t block,
+			       lfs_off_t off, const void *buffer,
+			       lfs_size_t size)
+{
+	struct block_cache_entry *entry;
+
+	k_mutex_lock(&block_cache_lock, K_FOREVER);
+	entry = block_cache_find(c, block);
+	if (entry) {
+		memcpy(&entry->data[off], buffer, size);
+	}
+	k_mutex_unlock(&block_cache_lock);
+}
+
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
+	int rc;
 
-	int rc = flash_area_read(fa, offset, buffer, size);
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (block_cache_applicable(c)) {
+		return errno_to_lfs(block_cache_read(c, block, off, buffer,
+						     size));
+	}
+#endif
+
+	rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
 }
@@ -178,6 +308,12 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (rc >= 0 && block_cache_applicable(c)) {
+		block_cache_update(c, block, off, buffer, size);
+	}
+#endif
+
 	return errno_to_lfs(rc);
 }
 
@@ -188,6 +324,12 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	int rc = flash_area_erase(fa, offset, c->block_size);
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (block_cache_applicable(c)) {
+		block_cache_invalidate(c, block);
+	}
+#endif
+
 	return errno_to_lfs(rc);
 }
 
@@ -851,6 +993,13 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 		goto out;
 	}
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	/* Drop anything a previous mount may have left behind. */
+	if (!littlefs_on_blkdev(mountp->flags)) {
+		block_cache_invalidate_fs(&fs->cfg);
+	}
+#endif
+
 	/* Mount it, formatting if needed. */
 	ret = lfs_mount(&fs->lfs, &fs->cfg);
 	if (ret < 0 &&
@@ -936,6 +1085,9 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	lfs_unmount(&fs->lfs);
 
 	if (!littlefs_on_blkdev(mountp->flags)) {
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+		block_cache_invalidate_fs(&fs->cfg);
+#endif
 		flash_area_close(fs->backend);
 	}
 
@@ -40,6 +40,70 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return pos % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+
+static void nvs_lookup_cache_update(struct nvs_fs *fs, uint32_t ate_addr,
+				    const struct nvs_ate *ate)
+{
+	struct nvs_lookup_cache_entry *cache_entry;
+
+	cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate->id)];
+	cache_entry->data_addr = (ate_addr & ADDR_SECT_MASK) + ate->offset;
+	cache_entry->id = ate->id;
+	cache_entry->len = ate->len;
+}
+
+static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr, ate_addr;
+	struct nvs_lookup_cache_entry *cache_entry;
+	struct nvs_ate ate;
+
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	addr = fs->ate_wra;
+
+	while (true) {
+		/* Make a copy of 'addr' as it will be advanced by nvs_pref_ate() */
+		ate_addr = addr;
+		rc = nvs_prev_ate(fs, &addr, &ate);
+
+		if (rc) {
+			return rc;
+		}
+
+		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
+
+		if (ate.id != 0xFFFF &&
+		    cache_entry->data_addr == NVS_LOOKUP_CACHE_NO_ADDR &&
+		    nvs_ate_valid(fs, &ate)) {
+			nvs_lookup_cache_update(fs, ate_addr, &ate);
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
+static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+	struct nvs_lookup_cache_entry *cache_entry = fs->lookup_cache;
+	struct nvs_lookup_cache_entry *const cache_end =
+		&fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+
+	for (; cache_entry < cache_end; ++cache_entry) {
+		if ((cache_entry->data_addr >> ADDR_SECT_SHIFT) == sector) {
+			cache_entry->data_addr = NVS_LOOKUP_CACHE_NO_ADDR;
+			cache_entry->id = 0xFFFF;
+		}
+	}
+}
+
+#else /* CONFIG_NVS_LOOKUP_CACHE_FULL */
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
@@ -86,6 +150,7 @@ static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 	}
 }
 
+#endif /* CONFIG_NVS_LOOKUP_CACHE_FULL */
 #endif /* CONFIG_NVS_LOOKUP_CACHE */
 
 /* basic routines */
@@ -170,7 +235,11 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+		nvs_lookup_cache_update(fs, fs->ate_wra, entry);
+#else
 		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+#endif
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -695,6 +764,40 @@ gc_done:
 	return 0;
 }
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+
+static bool nvs_gc_pending(struct nvs_fs *fs)
+{
+	uint32_t free_space = fs->ate_wra - fs->data_wra;
+
+	return free_space < (((uint32_t)fs->sector_size *
+			      CONFIG_NVS_GC_BACKGROUND_WATERMARK) / 100U);
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* Re-check under the lock, a write may have triggered gc already */
+	if (nvs_gc_pending(fs)) {
+		rc = nvs_sector_close(fs);
+		if (!rc) {
+			rc = nvs_gc(fs);
+		}
+
+		if (rc) {
+			LOG_ERR("Background gc failed (err %d)", rc);
+		}
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+}
+
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -936,6 +1039,9 @@ int nvs_mount(struct nvs_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->nvs_lock);
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1100,6 +1206,12 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		gc_count++;
 	}
 	rc = len;
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	if (nvs_gc_pending(fs)) {
+		k_work_submit(&fs->gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -1132,7 +1244,38 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 
 	cnt_his = 0U;
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+	if (cnt == 0U) {
+		const struct nvs_lookup_cache_entry *cache_entry =
+			&fs->lookup_cache[nvs_lookup_cache_pos(id)];
+
+		if (cache_entry->data_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+			/* No ID hashing to this position is stored */
+			return -ENOENT;
+		}
+
+		if (cache_entry->id == id) {
+			if (cache_entry->len == 0U) {
+				/* Deleted entry */
+				return -ENOENT;
+			}
+
+			rc = nvs_flash_rd(fs, cache_entry->data_addr, data,
+					  MIN(len, cache_entry->len));
+			if (rc) {
+				goto err;
+			}
+
+			return cache_entry->len;
+		}
+
+		/* The position is taken by a colliding ID, fall through to
+		 * walking the allocation table.
+		 */
+	}
+
+	wlk_addr = fs->ate_wra;
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
@@ -43,10 +43,78 @@ static int send(const struct device *instance, void *token,
 	return icmsg_send(conf, dev_data, msg, len);
 }
 
+static int get_tx_buffer(const struct device *instance, void *token,
+			 void **data, uint32_t *user_len, k_timeout_t wait)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+	size_t len;
+	int r;
+
+	if (!K_TIMEOUT_EQ(wait, K_NO_WAIT)) {
+		return -ENOTSUP;
+	}
+
+	len = *user_len;
+
+	r = icmsg_get_tx_buffer(conf, dev_data, data, &len);
+
+	*user_len = len;
+
+	return r;
+}
+
+static int drop_tx_buffer(const struct device *instance, void *token,
+			  const void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_drop_tx_buffer(conf, dev_data, data);
+}
+
+static int send_nocopy(const struct device *instance, void *token,
+		       const void *msg, size_t len)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_send_nocopy(conf, dev_data, msg, len);
+}
+
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICMSG_NOCOPY_RX
+static int hold_rx_buffer(const struct device *instance, void *token,
+			  void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_hold_rx_buffer(conf, dev_data, data);
+}
+
+static int release_rx_buffer(const struct device *instance, void *token,
+			     void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_release_rx_buffer(conf, dev_data, data);
+}
+#endif /* CONFIG_IPC_SERVICE_BACKEND_ICMSG_NOCOPY_RX */
+
 const static struct ipc_service_backend backend_ops = {
 	.register_endpoint = register_ept,
 	.deregister_endpoint = deregister_ept,
 	.send = send,
+
+	.get_tx_buffer = get_tx_buffer,
+	.drop_tx_buffer = drop_tx_buffer,
+	.send_nocopy = send_nocopy,
+
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICMSG_NOCOPY_RX
+	.hold_rx_buffer = hold_rx_buffer,
+	.release_rx_buffer = release_rx_buffer,
+#endif
 };
 
 static int backend_init(const struct device *instance)
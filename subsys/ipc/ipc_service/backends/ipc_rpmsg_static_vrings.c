@@ -9,6 +9,7 @@
 #include <zephyr/cache.h>
 #include <zephyr/device.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
 
 #include <zephyr/ipc/ipc_service_backend.h>
 #include <zephyr/ipc/ipc_static_vrings.h>
@@ -25,13 +26,15 @@
 
 #define WQ_STACK_SIZE	CONFIG_IPC_SERVICE_BACKEND_RPMSG_WQ_STACK_SIZE
 
+#define NUM_QUEUES	CONFIG_IPC_SERVICE_BACKEND_RPMSG_NUM_QUEUES
+
 #define STATE_READY	(0)
 #define STATE_BUSY	(1)
 #define STATE_INITED	(2)
 
-K_THREAD_STACK_ARRAY_DEFINE(mbox_stack, NUM_INSTANCES, WQ_STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(mbox_stack, NUM_INSTANCES * NUM_QUEUES, WQ_STACK_SIZE);
 
-struct backend_data_t {
+struct backend_queue_t {
 	/* RPMsg */
 	struct ipc_rpmsg_instance rpmsg_inst;
 
@@ -42,6 +45,17 @@ struct backend_data_t {
 	struct k_work mbox_work;
 	struct k_work_q mbox_wq;
 
+	/* Unique libmetal SHM device name */
+	char shm_device_name[16];
+
+	/* General */
+	unsigned int role;
+};
+
+struct backend_data_t {
+	/* VRING queue pairs */
+	struct backend_queue_t queue[NUM_QUEUES];
+
 	/* General */
 	unsigned int role;
 	atomic_t state;
@@ -58,6 +72,8 @@ struct backend_config_t {
 	struct mbox_channel mbox_rx;
 	unsigned int wq_prio_type;
 	unsigned int wq_prio;
+	unsigned int queue_prio[2 * NUM_QUEUES];
+	unsigned int queue_prio_len;
 	unsigned int id;
 	unsigned int buffer_size;
 };
@@ -241,23 +257,40 @@ static int ept_cb(struct rpmsg_endpoint *ep, void *data, size_t len, uint32_t sr
 	return RPMSG_SUCCESS;
 }
 
-static int vr_shm_configure(struct ipc_static_vrings *vr, const struct backend_config_t *conf)
+/*
+ * The shared memory is evenly split between the queues. Each slice hosts an
+ * independent VDEV status region and VRING pair, so the queues can progress
+ * without contending on each other's descriptors.
+ */
+static size_t queue_shm_size(const struct backend_config_t *conf)
+{
+	return (NUM_QUEUES == 1) ? conf->shm_size :
+				   ROUND_DOWN(conf->shm_size / NUM_QUEUES, VRING_ALIGNMENT);
+}
+
+static int vr_shm_configure(struct ipc_static_vrings *vr, const struct backend_config_t *conf,
+			    unsigned int q_idx)
 {
+	uintptr_t q_shm_addr;
+	size_t q_shm_size;
 	unsigned int num_desc;
 
-	num_desc = optimal_num_desc(conf->shm_size, conf->buffer_size);
+	q_shm_size = queue_shm_size(conf);
+	q_shm_addr = conf->shm_addr + q_idx * q_shm_size;
+
+	num_desc = optimal_num_desc(q_shm_size, conf->buffer_size);
 	if (num_desc == 0) {
 		return -ENOMEM;
 	}
 
-	vr->shm_addr = conf->shm_addr + VDEV_STATUS_SIZE;
+	vr->shm_addr = q_shm_addr + VDEV_STATUS_SIZE;
 	vr->shm_size = shm_size(num_desc, conf->buffer_size) - VDEV_STATUS_SIZE;
 
 	vr->rx_addr = vr->shm_addr + VRING_COUNT * vq_ring_size(num_desc, conf->buffer_size);
 	vr->tx_addr = ROUND_UP(vr->rx_addr + vring_size(num_desc, VRING_ALIGNMENT),
 			       VRING_ALIGNMENT);
 
-	vr->status_reg_addr = conf->shm_addr;
+	vr->status_reg_addr = q_shm_addr;
 
 	vr->vring_size = num_desc;
 
@@ -275,13 +308,13 @@ static void virtio_notify_cb(struct virtqueue *vq, void *priv)
 
 static void mbox_callback_process(struct k_work *item)
 {
-	struct backend_data_t *data;
+	struct backend_queue_t *queue;
 	unsigned int vq_id;
 
-	data = CONTAINER_OF(item, struct backend_data_t, mbox_work);
-	vq_id = (data->role == ROLE_HOST) ? VIRTQUEUE_ID_HOST : VIRTQUEUE_ID_REMOTE;
+	queue = CONTAINER_OF(item, struct backend_queue_t, mbox_work);
+	vq_id = (queue->role == ROLE_HOST) ? VIRTQUEUE_ID_HOST : VIRTQUEUE_ID_REMOTE;
 
-	virtqueue_notification(data->vr.vq[vq_id]);
+	virtqueue_notification(queue->vr.vq[vq_id]);
 }
 
 static void mbox_callback(const struct device *instance, uint32_t channel,
@@ -289,22 +322,46 @@ static void mbox_callback(const struct device *instance, uint32_t channel,
 {
 	struct backend_data_t *data = user_data;
 
-	k_work_submit_to_queue(&data->mbox_wq, &data->mbox_work);
+	/*
+	 * A single RX signal is shared by all the queues, so fan the
+	 * notification out to every queue workqueue. A virtqueue with no
+	 * pending buffers simply ignores the spurious notification.
+	 */
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		k_work_submit_to_queue(&data->queue[q].mbox_wq, &data->queue[q].mbox_work);
+	}
+}
+
+static int queue_wq_prio(const struct backend_config_t *conf, unsigned int q_idx)
+{
+	unsigned int prio = conf->wq_prio;
+	unsigned int prio_type = conf->wq_prio_type;
+
+	/* Per-queue priorities override the instance-wide one when provided */
+	if ((2 * q_idx + 1) < conf->queue_prio_len) {
+		prio = conf->queue_prio[2 * q_idx];
+		prio_type = conf->queue_prio[2 * q_idx + 1];
+	}
+
+	return (prio_type == PRIO_COOP) ? K_PRIO_COOP(prio) : K_PRIO_PREEMPT(prio);
 }
 
 static int mbox_init(const struct device *instance)
 {
 	const struct backend_config_t *conf = instance->config;
 	struct backend_data_t *data = instance->data;
-	int prio, err;
+	struct backend_queue_t *queue;
+	int err;
 
-	prio = (conf->wq_prio_type == PRIO_COOP) ? K_PRIO_COOP(conf->wq_prio) :
-						   K_PRIO_PREEMPT(conf->wq_prio);
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		queue = &data->queue[q];
 
-	k_work_queue_init(&data->mbox_wq);
-	k_work_queue_start(&data->mbox_wq, mbox_stack[conf->id], WQ_STACK_SIZE, prio, NULL);
+		k_work_queue_init(&queue->mbox_wq);
+		k_work_queue_start(&queue->mbox_wq, mbox_stack[conf->id * NUM_QUEUES + q],
+				   WQ_STACK_SIZE, queue_wq_prio(conf, q), NULL);
 
-	k_work_init(&data->mbox_work, mbox_callback_process);
+		k_work_init(&queue->mbox_work, mbox_callback_process);
+	}
 
 	err = mbox_register_callback(&conf->mbox_rx, mbox_callback, data);
 	if (err != 0) {
@@ -326,10 +383,12 @@ static int mbox_deinit(const struct device *instance)
 		return err;
 	}
 
-	k_work_queue_drain(&data->mbox_wq, 1);
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		k_work_queue_drain(&data->queue[q].mbox_wq, 1);
 
-	wq_thread = k_work_queue_thread_get(&data->mbox_wq);
-	k_thread_abort(wq_thread);
+		wq_thread = k_work_queue_thread_get(&data->queue[q].mbox_wq);
+		k_thread_abort(wq_thread);
+	}
 
 	return 0;
 }
@@ -415,7 +474,12 @@ static int register_ept(const struct device *instance, void **token,
 		return -EINVAL;
 	}
 
-	rpmsg_inst = &data->rpmsg_inst;
+	/*
+	 * The endpoint priority selects the queue (and so the VRING pair and
+	 * the RX workqueue) the endpoint is served by. Out-of-range priorities
+	 * are clamped so existing configurations keep working on queue 0.
+	 */
+	rpmsg_inst = &data->queue[CLAMP(cfg->prio, 0, NUM_QUEUES - 1)].rpmsg_inst;
 
 	rpmsg_ept = (data->role == ROLE_HOST) ?
 			register_ept_on_host(rpmsg_inst, cfg) :
@@ -521,21 +585,35 @@ static int open(const struct device *instance)
 	struct rpmsg_device *rdev;
 	int err;
 
+	struct backend_queue_t *queue;
+
 	if (!atomic_cas(&data->state, STATE_READY, STATE_BUSY)) {
 		return -EALREADY;
 	}
 
-	err = vr_shm_configure(&data->vr, conf);
-	if (err != 0) {
-		goto error;
-	}
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		queue = &data->queue[q];
 
-	data->vr.notify_cb = virtio_notify_cb;
-	data->vr.priv = (void *) conf;
+		err = vr_shm_configure(&queue->vr, conf, q);
+		if (err != 0) {
+			goto error;
+		}
 
-	err = ipc_static_vrings_init(&data->vr, conf->role);
-	if (err != 0) {
-		goto error;
+		queue->vr.notify_cb = virtio_notify_cb;
+		queue->vr.priv = (void *) conf;
+
+		/*
+		 * Each queue registers its own SHM device on the libmetal bus,
+		 * so the names have to be unique per queue.
+		 */
+		snprintk(queue->shm_device_name, sizeof(queue->shm_device_name),
+			 "ipc%u.q%u", conf->id, q);
+		queue->vr.shm_device.name = queue->shm_device_name;
+
+		err = ipc_static_vrings_init(&queue->vr, conf->role);
+		if (err != 0) {
+			goto error;
+		}
 	}
 
 	err = mbox_init(instance);
@@ -543,20 +621,23 @@ static int open(const struct device *instance)
 		goto error;
 	}
 
-	rpmsg_inst = &data->rpmsg_inst;
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		queue = &data->queue[q];
+		rpmsg_inst = &queue->rpmsg_inst;
 
-	rpmsg_inst->bound_cb = bound_cb;
-	rpmsg_inst->cb = ept_cb;
+		rpmsg_inst->bound_cb = bound_cb;
+		rpmsg_inst->cb = ept_cb;
 
-	err = ipc_rpmsg_init(rpmsg_inst, data->role, conf->buffer_size,
-			     data->vr.shm_io, &data->vr.vdev,
-			     (void *) data->vr.shm_device.regions->virt,
-			     data->vr.shm_device.regions->size, ns_bind_cb);
-	if (err != 0) {
-		goto error;
+		err = ipc_rpmsg_init(rpmsg_inst, data->role, conf->buffer_size,
+				     queue->vr.shm_io, &queue->vr.vdev,
+				     (void *) queue->vr.shm_device.regions->virt,
+				     queue->vr.shm_device.regions->size, ns_bind_cb);
+		if (err != 0) {
+			goto error;
+		}
 	}
 
-	rdev = rpmsg_virtio_get_rpmsg_device(&rpmsg_inst->rvdev);
+	rdev = rpmsg_virtio_get_rpmsg_device(&data->queue[0].rpmsg_inst.rvdev);
 
 	data->tx_buffer_size = rpmsg_virtio_get_buffer_size(rdev);
 	if (data->tx_buffer_size < 0) {
@@ -578,22 +659,23 @@ static int close(const struct device *instance)
 {
 	const struct backend_config_t *conf = instance->config;
 	struct backend_data_t *data = instance->data;
-	struct ipc_rpmsg_instance *rpmsg_inst;
 	int err;
 
 	if (!atomic_cas(&data->state, STATE_INITED, STATE_BUSY)) {
 		return -EALREADY;
 	}
 
-	rpmsg_inst = &data->rpmsg_inst;
-
-	if (!check_endpoints_freed(rpmsg_inst)) {
-		return -EBUSY;
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		if (!check_endpoints_freed(&data->queue[q].rpmsg_inst)) {
+			return -EBUSY;
+		}
 	}
 
-	err = ipc_rpmsg_deinit(rpmsg_inst, data->role);
-	if (err != 0) {
-		goto error;
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		err = ipc_rpmsg_deinit(&data->queue[q].rpmsg_inst, data->role);
+		if (err != 0) {
+			goto error;
+		}
 	}
 
 	err = mbox_deinit(instance);
@@ -601,13 +683,15 @@ static int close(const struct device *instance)
 		goto error;
 	}
 
-	err = ipc_static_vrings_deinit(&data->vr, conf->role);
-	if (err != 0) {
-		goto error;
-	}
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		err = ipc_static_vrings_deinit(&data->queue[q].vr, conf->role);
+		if (err != 0) {
+			goto error;
+		}
 
-	memset(&data->vr, 0, sizeof(struct ipc_static_vrings));
-	memset(rpmsg_inst, 0, sizeof(struct ipc_rpmsg_instance));
+		memset(&data->queue[q].vr, 0, sizeof(struct ipc_static_vrings));
+		memset(&data->queue[q].rpmsg_inst, 0, sizeof(struct ipc_rpmsg_instance));
+	}
 
 	atomic_set(&data->state, STATE_READY);
 	return 0;
@@ -736,13 +820,24 @@ static int backend_init(const struct device *instance)
 
 	data->role = conf->role;
 
-	k_mutex_init(&data->rpmsg_inst.mtx);
+	for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+		data->queue[q].role = conf->role;
+		k_mutex_init(&data->queue[q].rpmsg_inst.mtx);
+	}
+
 	atomic_set(&data->state, STATE_READY);
 
 	return 0;
 }
 
+#define QUEUE_PRIO_ELEM(node_id, prop, idx) DT_PROP_BY_IDX(node_id, prop, idx),
+
 #define DEFINE_BACKEND_DEVICE(i)							\
+	BUILD_ASSERT(COND_CODE_1(DT_INST_NODE_HAS_PROP(i, zephyr_queue_priorities),	\
+		     (DT_INST_PROP_LEN(i, zephyr_queue_priorities) <= 2 * NUM_QUEUES),	\
+		     (1)),								\
+		     "zephyr,queue-priorities has more entries than queues");		\
+											\
 	static struct backend_config_t backend_config_##i = {				\
 		.role = DT_ENUM_IDX_OR(DT_DRV_INST(i), role, ROLE_HOST),		\
 		.shm_size = DT_REG_SIZE(DT_INST_PHANDLE(i, memory_region)),		\
@@ -755,6 +850,16 @@ static int backend_init(const struct device *instance)
 		.wq_prio_type = COND_CODE_1(DT_INST_NODE_HAS_PROP(i, zephyr_priority),	\
 			   (DT_INST_PROP_BY_IDX(i, zephyr_priority, 1)),		\
 			   (PRIO_PREEMPT)),						\
+		.queue_prio = {								\
+			COND_CODE_1(DT_INST_NODE_HAS_PROP(i, zephyr_queue_priorities),	\
+			(DT_INST_FOREACH_PROP_ELEM(i, zephyr_queue_priorities,		\
+						   QUEUE_PRIO_ELEM)),			\
+			())								\
+		},									\
+		.queue_prio_len =							\
+			COND_CODE_1(DT_INST_NODE_HAS_PROP(i, zephyr_queue_priorities),	\
+			(DT_INST_PROP_LEN(i, zephyr_queue_priorities)),			\
+			(0)),								\
 		.buffer_size = DT_INST_PROP_OR(i, zephyr_buffer_size,			\
 					       RPMSG_BUFFER_SIZE),			\
 		.id = i,								\
@@ -784,7 +889,11 @@ static int shared_memory_prepare(const struct device *arg)
 
 	for (int i = 0; i < DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT); i++) {
 		if (config[i]->role == ROLE_HOST) {
-			memset((void *) config[i]->shm_addr, 0, VDEV_STATUS_SIZE);
+			for (unsigned int q = 0; q < NUM_QUEUES; q++) {
+				memset((void *) (config[i]->shm_addr +
+						 q * queue_shm_size(config[i])),
+				       0, VDEV_STATUS_SIZE);
+			}
 		}
 	}
 
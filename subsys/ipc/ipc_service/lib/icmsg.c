@@ -142,11 +142,35 @@ static void submit_work_if_buffer_free_and_data_available(
 	submit_mbox_work(dev_data);
 }
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+static void release_rx_packet(struct icmsg_data_t *dev_data, void *buf)
+{
+	/* The compare and swap arbitrates between the processing work and a
+	 * thread releasing a held buffer, so the packet is freed exactly once.
+	 */
+	if (atomic_ptr_cas(&dev_data->rx_claimed_buf, buf, NULL)) {
+		spsc_pbuf_free(dev_data->rx_ib, dev_data->rx_claimed_len);
+	}
+}
+#endif
+
 static void mbox_callback_process(struct k_work *item)
 {
 	struct icmsg_data_t *dev_data = CONTAINER_OF(item, struct icmsg_data_t, mbox_work);
 
 	atomic_t state = atomic_get(&dev_data->state);
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	char *rx_data;
+	int len = spsc_pbuf_claim(dev_data->rx_ib, &rx_data);
+
+	if (len == 0) {
+		return;
+	}
+
+	dev_data->rx_claimed_len = len;
+	atomic_ptr_set(&dev_data->rx_claimed_buf, rx_data);
+#else
+	uint8_t *rx_data = dev_data->rx_buffer;
 	int len = spsc_pbuf_read(dev_data->rx_ib, dev_data->rx_buffer,
 				 RX_BUF_SIZE);
 
@@ -159,19 +183,21 @@ static void mbox_callback_process(struct k_work *item)
 	} else if (len <= 0) {
 		return;
 	}
+#endif
 
 	if (state == ICMSG_STATE_READY) {
 		if (dev_data->cb->received) {
-			dev_data->cb->received(dev_data->rx_buffer, len,
-					       dev_data->ctx);
+			dev_data->cb->received(rx_data, len, dev_data->ctx);
 		}
 	} else {
 		int ret;
 
 		__ASSERT_NO_MSG(state == ICMSG_STATE_BUSY);
-		if (len != sizeof(magic) ||
-		    memcmp(magic, dev_data->rx_buffer, len)) {
+		if (len != sizeof(magic) || memcmp(magic, rx_data, len)) {
 			__ASSERT_NO_MSG(false);
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+			release_rx_packet(dev_data, rx_data);
+#endif
 			return;
 		}
 
@@ -185,6 +211,13 @@ static void mbox_callback_process(struct k_work *item)
 		(void)ret;
 	}
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	/* Hand the packet back to the buffer unless the callback held it */
+	if (is_rx_buffer_free(dev_data)) {
+		release_rx_packet(dev_data, rx_data);
+	}
+#endif
+
 	submit_work_if_buffer_free_and_data_available(dev_data);
 }
 
@@ -435,7 +468,7 @@ int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
 		return -EBUSY;
 	}
 
-	if (data != dev_data->rx_buffer) {
+	if (data != atomic_ptr_get(&dev_data->rx_claimed_buf)) {
 		return -EINVAL;
 	}
 
@@ -458,7 +491,7 @@ int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
 		return -EBUSY;
 	}
 
-	if (data != dev_data->rx_buffer) {
+	if (data != atomic_ptr_get(&dev_data->rx_claimed_buf)) {
 		return -EINVAL;
 	}
 
@@ -468,6 +501,8 @@ int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
 		return -EALREADY;
 	}
 
+	release_rx_packet(dev_data, (void *)data);
+
 	submit_work_if_buffer_free_and_data_available(dev_data);
 
 	return 0;
@@ -88,7 +88,7 @@ static int libmetal_setup(struct ipc_static_vrings *vr)
 		return err;
 	}
 
-	err = metal_device_open("generic", SHM_DEVICE_NAME, &device);
+	err = metal_device_open("generic", vr->shm_device.name, &device);
 	if (err != 0) {
 		return err;
 	}
@@ -166,7 +166,12 @@ int ipc_static_vrings_init(struct ipc_static_vrings *vr, unsigned int role)
 		return -EINVAL;
 	}
 
-	vr->shm_device.name = SHM_DEVICE_NAME;
+	/* Keep a name provided by the user, so several vrings objects can be
+	 * registered on the same libmetal bus.
+	 */
+	if (vr->shm_device.name == NULL) {
+		vr->shm_device.name = SHM_DEVICE_NAME;
+	}
 	vr->shm_device.num_regions = 1;
 	vr->shm_physmap[0] = vr->shm_addr;
 
@@ -58,4 +58,30 @@ config LOG_BACKEND_FS_FILES_LIMIT
 	  Limit of number of files with logs. It is also limited by
 	  size of file system partition.
 
+config LOG_BACKEND_FS_BATCH
+	bool "Batched writes"
+	help
+	  Accumulate formatted output in a RAM buffer and write it to the
+	  file system as one transfer when the buffer fills up or the flush
+	  timeout expires, instead of one write and sync per message. This
+	  greatly reduces the number of flash operations on file systems
+	  which update metadata on every write. Output buffered when the
+	  system crashes is lost unless the logger reached panic mode.
+
+config LOG_BACKEND_FS_BATCH_SIZE
+	int "Batch buffer size"
+	depends on LOG_BACKEND_FS_BATCH
+	default 512
+	range 32 8192
+	help
+	  Size in bytes of the RAM buffer accumulating formatted output.
+
+config LOG_BACKEND_FS_BATCH_FLUSH_TIMEOUT
+	int "Batch flush timeout"
+	depends on LOG_BACKEND_FS_BATCH
+	default 1000
+	help
+	  Buffered output is written to the file system at the latest this
+	  many milliseconds after it was formatted.
+
 endif # LOG_BACKEND_FS
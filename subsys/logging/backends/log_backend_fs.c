@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
@@ -146,7 +147,7 @@ close_dir:
 	return rc;
 }
 
-int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+static int write_to_fs(uint8_t *data, size_t length, void *ctx)
 {
 	int rc;
 	struct fs_file_t *f = &file;
@@ -225,6 +226,68 @@ on_error:
 	return length;
 }
 
+#ifdef CONFIG_LOG_BACKEND_FS_BATCH
+
+static uint8_t __aligned(4) batch_buf[CONFIG_LOG_BACKEND_FS_BATCH_SIZE];
+static size_t batch_len;
+static K_MUTEX_DEFINE(batch_lock);
+
+/* Write out buffered output as a single file system transfer. Called
+ * with the batch lock held.
+ */
+static void batch_flush(void)
+{
+	if (batch_len > 0U) {
+		(void)write_to_fs(batch_buf, batch_len, NULL);
+		batch_len = 0;
+	}
+}
+
+static void batch_flush_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+	batch_flush();
+	k_mutex_unlock(&batch_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(batch_flush_work, batch_flush_work_handler);
+
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	if ((batch_len + length) > sizeof(batch_buf)) {
+		batch_flush();
+	}
+
+	if (length >= sizeof(batch_buf)) {
+		/* Too large to buffer, write through. */
+		(void)write_to_fs(data, length, ctx);
+	} else {
+		if (batch_len == 0U) {
+			k_work_schedule(&batch_flush_work,
+				K_MSEC(CONFIG_LOG_BACKEND_FS_BATCH_FLUSH_TIMEOUT));
+		}
+		memcpy(&batch_buf[batch_len], data, length);
+		batch_len += length;
+	}
+
+	k_mutex_unlock(&batch_lock);
+
+	return length;
+}
+
+#else /* CONFIG_LOG_BACKEND_FS_BATCH */
+
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+	return write_to_fs(data, length, ctx);
+}
+
+#endif /* CONFIG_LOG_BACKEND_FS_BATCH */
+
 static int get_log_file_id(struct fs_dirent *ent)
 {
 	size_t len;
@@ -460,6 +523,12 @@ static void log_backend_fs_init(const struct log_backend *const backend)
 
 static void panic(struct log_backend const *const backend)
 {
+#ifdef CONFIG_LOG_BACKEND_FS_BATCH
+	/* Write out already formatted output which would otherwise be
+	 * lost. Locking is skipped as other contexts no longer run.
+	 */
+	batch_flush();
+#endif
 	/* In case of panic deinitialize backend. It is better to keep
 	 * current data rather than log new and risk of failure.
 	 */
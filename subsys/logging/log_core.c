@@ -32,6 +32,10 @@ LOG_MODULE_REGISTER(log);
 #define CONFIG_LOG_PROCESS_TRIGGER_THRESHOLD 0
 #endif
 
+#ifndef CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE
+#define CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE 1
+#endif
+
 #ifndef CONFIG_LOG_PROCESS_THREAD_STACK_SIZE
 #define CONFIG_LOG_PROCESS_THREAD_STACK_SIZE 1
 #endif
@@ -129,6 +133,53 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 		  MPSC_PBUF_MAX_UTILIZATION : 0)
 };
 
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+/* Additional buffers for CPUs other than CPU 0, which keeps using
+ * log_buffer. Placing them in the log_mpsc_pbuf section registers them
+ * with the processing thread, which merges messages from all registered
+ * buffers in timestamp order (see z_log_msg_claim_oldest).
+ */
+#define LOG_PERCPU_BUF_DEFINE(i, _) \
+	COND_CODE_0(i, (), ( \
+	static uint32_t __aligned(Z_LOG_MSG2_ALIGNMENT) \
+		percpu_buf32_##i[CONFIG_LOG_BUFFER_SIZE / sizeof(int)]; \
+	static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_msg_ptr_cpu_##i); \
+	static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, \
+						 log_buffer_cpu_##i);))
+
+#define LOG_PERCPU_BUF_PTR(i, _) COND_CODE_0(i, (&log_buffer), (&log_buffer_cpu_##i))
+#define LOG_PERCPU_STORAGE_PTR(i, _) COND_CODE_0(i, (buf32), (percpu_buf32_##i))
+
+LISTIFY(CONFIG_MP_NUM_CPUS, LOG_PERCPU_BUF_DEFINE, (), _)
+
+static struct mpsc_pbuf_buffer *const percpu_log_buffer[CONFIG_MP_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_NUM_CPUS, LOG_PERCPU_BUF_PTR, (,), _)
+};
+
+static uint32_t *const percpu_log_storage[CONFIG_MP_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_NUM_CPUS, LOG_PERCPU_STORAGE_PTR, (,), _)
+};
+
+static struct mpsc_pbuf_buffer *percpu_buffer_get(const struct log_msg *msg)
+{
+	uintptr_t p = (uintptr_t)msg;
+
+	/* The producing thread may have migrated to another CPU between
+	 * allocation and commit, so resolve the owning buffer from the
+	 * message location instead of from the current CPU.
+	 */
+	for (int i = 1; i < CONFIG_MP_NUM_CPUS; i++) {
+		uintptr_t buf = (uintptr_t)percpu_log_storage[i];
+
+		if ((p >= buf) && (p < (buf + CONFIG_LOG_BUFFER_SIZE))) {
+			return percpu_log_buffer[i];
+		}
+	}
+
+	return &log_buffer;
+}
+#endif /* CONFIG_LOG_PERCPU_BUFFER */
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -490,6 +541,29 @@ static inline bool z_log_unordered_pending(void)
 	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && unordered_cnt;
 }
 
+static void failure_report_check(void)
+{
+	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
+		return;
+	}
+
+	bool dropped_pend = z_log_dropped_pending();
+	bool unordered_pend = z_log_unordered_pending();
+
+	if ((dropped_pend || unordered_pend) &&
+	   (k_uptime_get() - last_failure_report) > CONFIG_LOG_FAILURE_REPORT_PERIOD) {
+		if (dropped_pend) {
+			dropped_notify();
+		}
+
+		if (unordered_pend) {
+			unordered_notify();
+		}
+	}
+
+	last_failure_report += CONFIG_LOG_FAILURE_REPORT_PERIOD;
+}
+
 bool z_impl_log_process(void)
 {
 	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -519,26 +593,74 @@ bool z_impl_log_process(void)
 		return false;
 	}
 
-	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
-		bool dropped_pend = z_log_dropped_pending();
-		bool unordered_pend = z_log_unordered_pending();
+	failure_report_check();
 
-		if ((dropped_pend || unordered_pend) &&
-		   (k_uptime_get() - last_failure_report) > CONFIG_LOG_FAILURE_REPORT_PERIOD) {
-			if (dropped_pend) {
-				dropped_notify();
+	return z_log_msg_pending();
+}
+
+#if CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE > 1
+/* Variant of log_process() used by the processing thread. A batch of
+ * messages is claimed and each active backend is run over the whole batch
+ * before the messages are freed, so that backend iteration and filtering
+ * overhead is amortized over the batch.
+ */
+static bool log_process_batch(void)
+{
+	union log_msg_generic *msgs[CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE];
+	union log_msg_generic *filtered[CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE];
+	k_timeout_t backoff = K_NO_WAIT;
+	uint32_t cnt = 0;
+
+	if (!backend_attached) {
+		return false;
+	}
+
+	while (cnt < ARRAY_SIZE(msgs)) {
+		msgs[cnt] = z_log_msg_claim(&backoff);
+		if (msgs[cnt] == NULL) {
+			break;
+		}
+
+		cnt++;
+	}
+
+	if (cnt > 0) {
+		atomic_sub(&buffered_cnt, cnt);
+
+		STRUCT_SECTION_FOREACH(log_backend, backend) {
+			uint32_t fcnt = 0;
+
+			if (!log_backend_is_active(backend)) {
+				continue;
+			}
+
+			for (uint32_t i = 0; i < cnt; i++) {
+				if (msg_filter_check(backend, msgs[i])) {
+					filtered[fcnt++] = msgs[i];
+				}
 			}
 
-			if (unordered_pend) {
-				unordered_notify();
+			if (fcnt > 0) {
+				log_backend_msg_process_batch(backend,
+							      filtered, fcnt);
 			}
 		}
 
-		last_failure_report += CONFIG_LOG_FAILURE_REPORT_PERIOD;
+		for (uint32_t i = 0; i < cnt; i++) {
+			z_log_msg_free(msgs[i]);
+		}
+	} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 &&
+		   !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
+		k_timer_start(&log_process_thread_timer, backoff, K_NO_WAIT);
+
+		return false;
 	}
 
+	failure_report_check();
+
 	return z_log_msg_pending();
 }
+#endif /* CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE > 1 */
 
 #ifdef CONFIG_USERSPACE
 bool z_vrfy_log_process(void)
@@ -583,6 +705,15 @@ void z_log_msg_init(void)
 {
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
+
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+	for (int i = 1; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = percpu_log_storage[i];
+		mpsc_pbuf_init(percpu_log_buffer[i], &config);
+	}
+#endif
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -597,7 +728,11 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+	return msg_alloc(percpu_log_buffer[arch_curr_cpu()->id], wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -617,7 +752,11 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+	msg_commit(percpu_buffer_get(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -697,7 +836,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+	     IS_ENABLED(CONFIG_LOG_PERCPU_BUFFER)) && len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -706,6 +846,9 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 
 static void msg_free(struct mpsc_pbuf_buffer *buffer, const union log_msg_generic *msg)
 {
+#ifdef CONFIG_LOG_TRANSIENT_STR_POOL
+	z_log_msg_str_pool_release((struct log_msg *)&msg->log);
+#endif
 	mpsc_pbuf_free(buffer, &msg->buf);
 }
 
@@ -726,7 +869,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if (!(IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+	      IS_ENABLED(CONFIG_LOG_PERCPU_BUFFER)) || (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -870,7 +1014,11 @@ static void log_process_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 
 
+#if CONFIG_LOG_PROCESS_THREAD_BATCH_SIZE > 1
+		if (log_process_batch() == false) {
+#else
 		if (log_process() == false) {
+#endif
 			if (processed_any) {
 				processed_any = false;
 				log_backend_notify_all(LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_frontend.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/sys/cbprintf.h>
+
+#include "log_frontend_trace.h"
+
+static struct k_spinlock lock;
+static uint32_t dropped;
+
+static inline void hdr_fill(struct log_dict_output_normal_msg_hdr_t *hdr,
+			    const void *source,
+			    const struct log_msg_desc desc)
+{
+	hdr->type = MSG_NORMAL;
+	hdr->domain = desc.domain;
+	hdr->level = desc.level;
+	hdr->package_len = desc.package_len;
+	hdr->data_len = desc.data_len;
+	hdr->timestamp = z_log_timestamp();
+	hdr->source = (source != NULL) ?
+			(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+				log_dynamic_source_id((void *)source) :
+				log_const_source_id((void *)source)) :
+			0U;
+}
+
+/* Report messages dropped by the port. Called with the lock held. */
+static void dropped_flush(void)
+{
+	struct log_dict_output_dropped_msg_t msg = {
+		.type = MSG_DROPPED_MSG,
+		.num_dropped_messages = MIN(dropped, 9999),
+	};
+
+	if (log_frontend_trace_port_begin(sizeof(msg))) {
+		log_frontend_trace_port_write((const uint8_t *)&msg, sizeof(msg));
+		dropped = 0;
+	}
+}
+
+void log_frontend_msg(const void *source,
+		      const struct log_msg_desc desc,
+		      uint8_t *package, const void *data)
+{
+	struct log_dict_output_normal_msg_hdr_t hdr;
+	struct log_msg_desc outdesc = desc;
+	uint8_t *outpkg = package;
+
+	/* Strings from transient buffers must be appended to the package
+	 * since the host decoder can only resolve addresses of strings
+	 * present in the image. Packages without such strings, the common
+	 * case, are sent as is.
+	 */
+	if ((desc.package_len > 0U) && (package[3] != 0U)) {
+		uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR;
+		uint16_t strl[4];
+		int plen = cbprintf_package_copy(package, desc.package_len,
+						 NULL, 0, flags,
+						 strl, ARRAY_SIZE(strl));
+
+		if (plen < 0) {
+			return;
+		}
+
+		outpkg = alloca(plen);
+		plen = cbprintf_package_copy(package, desc.package_len,
+					     outpkg, plen, flags,
+					     strl, ARRAY_SIZE(strl));
+		if (plen < 0) {
+			return;
+		}
+
+		outdesc.package_len = plen;
+	}
+
+	hdr_fill(&hdr, source, outdesc);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (dropped != 0U) {
+		dropped_flush();
+	}
+
+	if (log_frontend_trace_port_begin(sizeof(hdr) + outdesc.package_len +
+					  outdesc.data_len)) {
+		log_frontend_trace_port_write((const uint8_t *)&hdr, sizeof(hdr));
+		log_frontend_trace_port_write(outpkg, outdesc.package_len);
+		if (outdesc.data_len > 0U) {
+			log_frontend_trace_port_write(data, outdesc.data_len);
+		}
+	} else {
+		dropped++;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void log_frontend_panic(void)
+{
+	log_frontend_trace_port_panic();
+}
+
+void log_frontend_init(void)
+{
+	log_frontend_trace_port_init();
+}
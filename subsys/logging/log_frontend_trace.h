@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_SUBSYS_LOGGING_LOG_FRONTEND_TRACE_H_
+#define ZEPHYR_SUBSYS_LOGGING_LOG_FRONTEND_TRACE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Port interface of the trace port log frontend. The frontend serializes
+ * messages in the context of the log call and relies on the port to get
+ * the bytes off chip. All functions are called with interrupts locked so
+ * records from different contexts do not interleave.
+ */
+
+/** @brief Initialize the trace port. */
+void log_frontend_trace_port_init(void);
+
+/** @brief Start a record of a given total length.
+ *
+ * Ports with limited buffering use the length to reject records that do
+ * not fit, so that a record is either output completely or not at all.
+ *
+ * @param len Total record length in bytes.
+ *
+ * @retval true when the record can be written.
+ * @retval false when the record must be dropped.
+ */
+bool log_frontend_trace_port_begin(size_t len);
+
+/** @brief Write part of a record started with log_frontend_trace_port_begin().
+ *
+ * @param buf Data to write.
+ * @param len Number of bytes to write.
+ */
+void log_frontend_trace_port_write(const uint8_t *buf, size_t len);
+
+/** @brief Panic state notification. */
+void log_frontend_trace_port_panic(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SUBSYS_LOGGING_LOG_FRONTEND_TRACE_H_ */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <soc.h>
+
+#include "log_frontend_trace.h"
+
+#define STIM_PORT CONFIG_LOG_FRONTEND_TRACE_ITM_PORT
+
+static void stim_write32(uint32_t data)
+{
+	while (ITM->PORT[STIM_PORT].u32 == 0U) {
+	}
+	ITM->PORT[STIM_PORT].u32 = data;
+}
+
+void log_frontend_trace_port_init(void)
+{
+	/* Enable trace units */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	/* Enable access to ITM registers */
+	ITM->LAR = 0xC5ACCE55;
+	/* Enable the stimulus port used by the frontend */
+	ITM->TER |= BIT(STIM_PORT);
+	/* Enable ITM */
+	ITM->TCR |= ITM_TCR_ITMENA_Msk;
+}
+
+bool log_frontend_trace_port_begin(size_t len)
+{
+	ARG_UNUSED(len);
+
+	/* Stimulus port writes stall until the FIFO drains, nothing is
+	 * ever dropped.
+	 */
+	return true;
+}
+
+void log_frontend_trace_port_write(const uint8_t *buf, size_t len)
+{
+	while (len >= sizeof(uint32_t)) {
+		uint32_t word;
+
+		memcpy(&word, buf, sizeof(word));
+		stim_write32(word);
+		buf += sizeof(uint32_t);
+		len -= sizeof(uint32_t);
+	}
+
+	while (len > 0U) {
+		while (ITM->PORT[STIM_PORT].u32 == 0U) {
+		}
+		ITM->PORT[STIM_PORT].u8 = *buf;
+		buf++;
+		len--;
+	}
+}
+
+void log_frontend_trace_port_panic(void)
+{
+	/* Writes are synchronous, there is nothing to flush. */
+}
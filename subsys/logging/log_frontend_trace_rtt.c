@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <SEGGER_RTT.h>
+
+#include "log_frontend_trace.h"
+
+#define RTT_BUFFER CONFIG_LOG_FRONTEND_TRACE_RTT_BUFFER
+
+static uint8_t rtt_buf[CONFIG_LOG_FRONTEND_TRACE_RTT_BUFFER_SIZE];
+
+void log_frontend_trace_port_init(void)
+{
+	SEGGER_RTT_ConfigUpBuffer(RTT_BUFFER, "Logger", rtt_buf, sizeof(rtt_buf),
+				  SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+}
+
+bool log_frontend_trace_port_begin(size_t len)
+{
+	/* The frontend uses a dedicated up buffer, so the space checked
+	 * here cannot be consumed by another writer before the record is
+	 * written out.
+	 */
+	return SEGGER_RTT_GetAvailWriteSpace(RTT_BUFFER) >= len;
+}
+
+void log_frontend_trace_port_write(const uint8_t *buf, size_t len)
+{
+	(void)SEGGER_RTT_WriteSkipNoLock(RTT_BUFFER, buf, len);
+}
+
+void log_frontend_trace_port_panic(void)
+{
+	/* Writes are synchronous and the host reads the up buffer without
+	 * target assistance, there is nothing to flush.
+	 */
+}
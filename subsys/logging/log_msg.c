@@ -3,6 +3,8 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <string.h>
+
 #include <zephyr/kernel.h>
 #include <zephyr/syscall_handler.h>
 #include <zephyr/logging/log_internal.h>
@@ -15,6 +17,128 @@
 	!(IS_ENABLED(CONFIG_LOG_FRONTEND) && \
 	 (IS_ENABLED(CONFIG_LOG_FRONTEND_ONLY) || log_backend_count_get() == 0))
 
+#ifdef CONFIG_LOG_TRANSIENT_STR_POOL
+#define STR_POOL_SLOT_SIZE CONFIG_LOG_TRANSIENT_STR_POOL_SLOT_SIZE
+#define STR_POOL_SLOT_COUNT CONFIG_LOG_TRANSIENT_STR_POOL_SLOT_COUNT
+
+/* Pool of fixed size slots holding bounded copies of transient strings.
+ * Slots are claimed lock-free from any context at message creation and
+ * recycled when the message is freed after processing.
+ */
+static uint8_t str_pool[STR_POOL_SLOT_COUNT][STR_POOL_SLOT_SIZE];
+static ATOMIC_DEFINE(str_pool_busy, STR_POOL_SLOT_COUNT);
+
+static inline bool str_pool_member(const char *str)
+{
+	return (str >= (const char *)&str_pool[0][0]) &&
+	       (str < (const char *)&str_pool[0][0] + sizeof(str_pool));
+}
+
+static void str_pool_free(const char *str)
+{
+	atomic_clear_bit(str_pool_busy,
+			 ((uintptr_t)str - (uintptr_t)str_pool) /
+			 STR_POOL_SLOT_SIZE);
+}
+
+static char *str_pool_claim(const char *str)
+{
+	size_t len = strnlen(str, STR_POOL_SLOT_SIZE);
+
+	if (len == STR_POOL_SLOT_SIZE) {
+		/* Does not fit together with the terminator. */
+		return NULL;
+	}
+
+	for (int i = 0; i < STR_POOL_SLOT_COUNT; i++) {
+		if (atomic_test_and_set_bit(str_pool_busy, i)) {
+			continue;
+		}
+
+		memcpy(str_pool[i], str, len + 1);
+
+		return (char *)str_pool[i];
+	}
+
+	return NULL;
+}
+
+/* Claim pool slots for all transient strings of a package and patch the
+ * string arguments to point at the stable bounded copies. On success the
+ * package no longer references transient memory and can be queued with a
+ * plain copy, skipping the package rebuild that appends the strings.
+ * Returns false, with any already claimed slots released and the
+ * arguments restored, if a string does not fit or the pool is exhausted;
+ * the caller then falls back to copying the strings into the package.
+ */
+static bool str_pool_convert(uint8_t *package)
+{
+	struct cbprintf_package_desc *desc = (void *)package;
+	uint32_t *buf32 = (uint32_t *)package;
+	const char *orig[4];
+	uint8_t *pos;
+
+	/* Packages created by the logging macros in deferred mode carry
+	 * (index, position) pairs for the transient strings and have no
+	 * appended strings.
+	 */
+	if (desc->rw_str_cnt == 0 || desc->str_cnt != 0 ||
+	    desc->rw_str_cnt > ARRAY_SIZE(orig)) {
+		return false;
+	}
+
+	pos = &package[desc->len * sizeof(int)] + desc->ro_str_cnt;
+
+	for (int i = 0; i < desc->rw_str_cnt; i++) {
+		uint8_t arg_pos = pos[2 * i + 1];
+		const char *str = *(const char **)&buf32[arg_pos];
+		char *copy = str_pool_claim(str);
+
+		if (copy == NULL) {
+			for (int j = 0; j < i; j++) {
+				str_pool_free(*(const char **)&buf32[pos[2 * j + 1]]);
+				*(const char **)&buf32[pos[2 * j + 1]] = orig[j];
+			}
+
+			return false;
+		}
+
+		orig[i] = str;
+		*(const char **)&buf32[arg_pos] = copy;
+	}
+
+	return true;
+}
+
+static void str_pool_release_package(uint8_t *package)
+{
+	struct cbprintf_package_desc *desc = (void *)package;
+	uint32_t *buf32 = (uint32_t *)package;
+	uint8_t *pos;
+
+	if (desc->rw_str_cnt == 0 || desc->str_cnt != 0) {
+		return;
+	}
+
+	pos = &package[desc->len * sizeof(int)] + desc->ro_str_cnt;
+
+	for (int i = 0; i < desc->rw_str_cnt; i++) {
+		const char *str = *(const char **)&buf32[pos[2 * i + 1]];
+
+		if (str_pool_member(str)) {
+			str_pool_free(str);
+		}
+	}
+}
+
+void z_log_msg_str_pool_release(struct log_msg *msg)
+{
+	if (msg->hdr.desc.package_len > 0) {
+		str_pool_release_package(msg->data);
+	}
+}
+#endif /* CONFIG_LOG_TRANSIENT_STR_POOL */
+
 void z_log_msg_finalize(struct log_msg *msg, const void *source,
 			 const struct log_msg_desc desc, const void *data)
 {
@@ -52,7 +176,27 @@ void z_impl_z_log_msg_static_create(const void *source,
 	struct log_msg *msg;
 
 	if (inlen > 0) {
+#ifdef CONFIG_LOG_TRANSIENT_STR_POOL
+		if (str_pool_convert(package)) {
+			/* The transient strings now point at stable
+			 * bounded copies, so the package can be queued
+			 * as is without the string appending rebuild.
+			 */
+			msg = z_log_msg_alloc(log_msg_get_total_wlen(out_desc));
+			if (msg) {
+				memcpy(msg->data, package, inlen);
+			} else {
+				str_pool_release_package(package);
+			}
+
+			z_log_msg_finalize(msg, source, out_desc, data);
+
+			return;
+		}
+#endif
 		uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
+				 (IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ?
+				  CBPRINTF_PACKAGE_CONVERT_KEEP_RO_STR : 0) |
 				 CBPRINTF_PACKAGE_CONVERT_PTR_CHECK;
 		uint16_t strl[4];
 		int len;
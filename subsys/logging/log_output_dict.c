@@ -10,7 +10,9 @@
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 			 void *ctx)
@@ -24,9 +26,193 @@ static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 	} while (len != 0);
 }
 
+#ifdef CONFIG_LOG_DICTIONARY_COMPRESS
+static log_timestamp_t prev_timestamp;
+static uint32_t prev_hdr;
+static uintptr_t prev_source;
+static bool prev_valid;
+static uint8_t prev_msg[CONFIG_LOG_DICTIONARY_COMPRESS_MSG_CACHE];
+
+static size_t varint_encode(uint64_t value, uint8_t *buf)
+{
+	size_t len = 0U;
+
+	do {
+		buf[len] = value & 0x7fU;
+		value >>= 7;
+		if (value != 0U) {
+			buf[len] |= 0x80U;
+		}
+		len++;
+	} while (value != 0U);
+
+	return len;
+}
+
+static void varint_write(log_output_func_t outf, uint64_t value, void *ctx)
+{
+	uint8_t buf[10];
+
+	buffer_write(outf, buf, varint_encode(value, buf), ctx);
+}
+
+#ifdef CONFIG_LOG_DICTIONARY_STR_ID
+extern const char __log_strings_start[];
+extern const char __log_strings_end[];
+
+/* Locate the read-only string location array of a package, provided that
+ * every listed string resides in the log strings section and can thus be
+ * sent as a section offset. Returns NULL when offsets cannot be used for
+ * this package.
+ */
+static const uint8_t *ro_str_positions(uint8_t *package, size_t pkg_len,
+				       uint8_t *ro_cnt)
+{
+	struct cbprintf_package_desc *desc = (void *)package;
+	uint32_t *buf32 = (uint32_t *)package;
+	const uint8_t *pos = &package[desc->len * sizeof(int)];
+
+	if ((pkg_len < sizeof(uint32_t)) || (desc->ro_str_cnt == 0U) ||
+	    ((desc->len * sizeof(int)) + desc->ro_str_cnt > pkg_len)) {
+		return NULL;
+	}
+
+	for (uint8_t i = 0; i < desc->ro_str_cnt; i++) {
+		const char *str = *(const char **)&buf32[pos[i]];
+
+		if ((str < __log_strings_start) || (str >= __log_strings_end)) {
+			return NULL;
+		}
+	}
+
+	*ro_cnt = desc->ro_str_cnt;
+
+	return pos;
+}
+
+static bool is_ro_str_word(const uint8_t *ro_pos, uint8_t ro_cnt, size_t word)
+{
+	for (uint8_t i = 0; i < ro_cnt; i++) {
+		if (ro_pos[i] == word) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif /* CONFIG_LOG_DICTIONARY_STR_ID */
+
+static uint64_t timestamp_delta(log_timestamp_t timestamp)
+{
+	int64_t delta;
+
+	if (sizeof(log_timestamp_t) > sizeof(uint32_t)) {
+		delta = (int64_t)(timestamp - prev_timestamp);
+	} else {
+		delta = (int32_t)((uint32_t)timestamp - (uint32_t)prev_timestamp);
+	}
+
+	prev_timestamp = timestamp;
+
+	/* Zigzag encoding keeps occasional negative deltas short. */
+	return ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+}
+
+static void msg_process_compressed(const struct log_output *output,
+				   struct log_msg *msg)
+{
+	void *source = (void *)log_msg_get_source(msg);
+	uintptr_t source_id = (source != NULL) ?
+				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+					log_dynamic_source_id(source) :
+					log_const_source_id(source)) :
+				0U;
+	size_t pkg_len;
+	size_t data_len;
+	uint8_t *package = log_msg_get_package(msg, &pkg_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+	/* Same bit layout as log_dict_output_normal_msg_hdr_t. */
+	uint32_t hdr = msg->hdr.desc.domain | (msg->hdr.desc.level << 3) |
+		       (pkg_len << 6) | (data_len << 16);
+	uint8_t byte;
+	size_t i;
+#ifdef CONFIG_LOG_DICTIONARY_STR_ID
+	uint8_t ro_cnt = 0U;
+	const uint8_t *ro_pos = ro_str_positions(package, pkg_len, &ro_cnt);
+#endif
+
+	if (prev_valid && (hdr == prev_hdr) && (source_id == prev_source) &&
+	    (memcmp(prev_msg, package, pkg_len) == 0) &&
+	    (memcmp(&prev_msg[pkg_len], data, data_len) == 0)) {
+		byte = MSG_REPEAT;
+		buffer_write(output->func, &byte, sizeof(byte), (void *)output);
+		varint_write(output->func, timestamp_delta(msg->hdr.timestamp),
+			     (void *)output);
+		log_output_flush(output);
+		return;
+	}
+
+	byte = MSG_NORMAL_COMPRESSED;
+#ifdef CONFIG_LOG_DICTIONARY_STR_ID
+	if (ro_pos != NULL) {
+		byte = MSG_NORMAL_STR_ID;
+	}
+#endif
+	buffer_write(output->func, &byte, sizeof(byte), (void *)output);
+	byte = msg->hdr.desc.domain | (msg->hdr.desc.level << 3);
+	buffer_write(output->func, &byte, sizeof(byte), (void *)output);
+	varint_write(output->func, source_id, (void *)output);
+	varint_write(output->func, timestamp_delta(msg->hdr.timestamp),
+		     (void *)output);
+	varint_write(output->func, pkg_len, (void *)output);
+	varint_write(output->func, data_len, (void *)output);
+
+	/* The package is a sequence of words, most of which hold small
+	 * argument values, so encode it word by word. Trailing bytes of
+	 * an unaligned package go out verbatim.
+	 */
+	for (i = 0U; (i + sizeof(uint32_t)) <= pkg_len; i += sizeof(uint32_t)) {
+		uint32_t word;
+
+		memcpy(&word, &package[i], sizeof(word));
+#ifdef CONFIG_LOG_DICTIONARY_STR_ID
+		if ((ro_pos != NULL) &&
+		    is_ro_str_word(ro_pos, ro_cnt, i / sizeof(uint32_t))) {
+			word -= (uint32_t)(uintptr_t)__log_strings_start;
+		}
+#endif
+		varint_write(output->func, word, (void *)output);
+	}
+
+	if (i < pkg_len) {
+		buffer_write(output->func, &package[i], pkg_len - i,
+			     (void *)output);
+	}
+
+	if (data_len > 0U) {
+		buffer_write(output->func, data, data_len, (void *)output);
+	}
+
+	if ((pkg_len + data_len) <= sizeof(prev_msg)) {
+		memcpy(prev_msg, package, pkg_len);
+		memcpy(&prev_msg[pkg_len], data, data_len);
+		prev_hdr = hdr;
+		prev_source = source_id;
+		prev_valid = true;
+	} else {
+		prev_valid = false;
+	}
+
+	log_output_flush(output);
+}
+#endif /* CONFIG_LOG_DICTIONARY_COMPRESS */
+
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
+#ifdef CONFIG_LOG_DICTIONARY_COMPRESS
+	msg_process_compressed(output, msg);
+#else
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
@@ -60,6 +246,7 @@ void log_dict_output_msg_process(const struct log_output *output,
 	}
 
 	log_output_flush(output);
+#endif /* CONFIG_LOG_DICTIONARY_COMPRESS */
 }
 
 void log_dict_output_dropped_process(const struct log_output *output, uint32_t cnt)
@@ -5,6 +5,9 @@
  */
 
 #include <LoRaMac.h>
+#if CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE > 1
+#include <utilities.h>
+#endif
 #include <zephyr/kernel.h>
 #include <zephyr/settings/settings.h>
 #include "lorawan_nvm.h"
@@ -81,11 +84,31 @@ static void lorawan_nvm_save_settings(uint16_t nvm_notify_flag)
 	settings_save();
 }
 
+#if CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE > 1
+/* Number of crypto context changes since the last persisted one */
+static uint32_t crypto_updates_pending;
+#endif
+
 void lorawan_nvm_data_mgmt_event(uint16_t flags)
 {
-	if (flags != LORAMAC_NVM_NOTIFY_FLAG_NONE) {
-		lorawan_nvm_save_settings(flags);
+	if (flags == LORAMAC_NVM_NOTIFY_FLAG_NONE) {
+		return;
+	}
+
+#if CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE > 1
+	if (flags == LORAMAC_NVM_NOTIFY_FLAG_CRYPTO &&
+	    ++crypto_updates_pending < CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE) {
+		/* The counters stay cached in the MAC context in RAM. The
+		 * restored values are gap-advanced on boot, so deferring
+		 * this write cannot lead to counter reuse.
+		 */
+		return;
 	}
+
+	crypto_updates_pending = 0;
+#endif
+
+	lorawan_nvm_save_settings(flags);
 }
 
 static int load_setting(void *tgt, size_t tgt_size,
@@ -163,6 +186,23 @@ int lorawan_nvm_data_restore(void)
 		return err;
 	}
 
+#if CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE > 1
+	LoRaMacNvmData_t *nvm = mib_req.Param.Contexts;
+
+	/*
+	 * Up to LORAWAN_NVM_SETTINGS_BATCH_SIZE - 1 counter updates may not
+	 * have been persisted before the last reset. Advance past every value
+	 * that may already have been used on air and persist the result
+	 * before the counters are used again.
+	 */
+	nvm->Crypto.DevNonce += CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE;
+	nvm->Crypto.FCntList.FCntUp += CONFIG_LORAWAN_NVM_SETTINGS_BATCH_SIZE;
+	nvm->Crypto.Crc32 = Crc32((uint8_t *)&nvm->Crypto,
+				  sizeof(nvm->Crypto) -
+				  sizeof(nvm->Crypto.Crc32));
+	lorawan_nvm_save_settings(LORAMAC_NVM_NOTIFY_FLAG_CRYPTO);
+#endif
+
 	LOG_DBG("Crypto version: %"PRIu32", DevNonce: %d, JoinNonce: %"PRIu32,
 		mib_req.Param.Contexts->Crypto.LrWanVersion.Value,
 		mib_req.Param.Contexts->Crypto.DevNonce,
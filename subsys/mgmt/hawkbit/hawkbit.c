@@ -39,6 +39,9 @@ LOG_MODULE_REGISTER(hawkbit, CONFIG_HAWKBIT_LOG_LEVEL);
 #endif
 
 #define ADDRESS_ID 1
+#define RESUME_ACTION_ID 2
+
+#define HAWKBIT_PROGRESS_KEY "hawkbit/progress"
 
 #define CANCEL_BASE_SIZE 50
 #define RECV_BUFFER_SIZE 640
@@ -72,6 +75,10 @@ struct hawkbit_download {
 	int download_progress;
 	size_t downloaded_size;
 	size_t http_content_size;
+#ifdef CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD
+	size_t resume_offset;
+	bool resume_checked;
+#endif
 	uint8_t file_hash[SHA256_HASH_SIZE];
 };
 
@@ -746,9 +753,33 @@ static void response_cb(struct http_response *rsp, enum http_final_call final_da
 		break;
 
 	case HAWKBIT_DOWNLOAD:
+#ifdef CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD
+		/* On the first callback of a resumed download check whether
+		 * the server honoured the Range header; if not, the response
+		 * carries the whole artifact and the stream has to restart
+		 * from the beginning.
+		 */
+		if ((hb_context.dl.resume_offset > 0) && !hb_context.dl.resume_checked) {
+			hb_context.dl.resume_checked = true;
+
+			if (rsp->http_status_code != 206) {
+				LOG_WRN("Server ignored the Range header, "
+					"restarting the download");
+				hb_context.dl.resume_offset = 0;
+				flash_img_init(&hb_context.flash_ctx);
+			}
+		}
+
+		if (hb_context.dl.http_content_size == 0) {
+			/* A ranged response only carries the remainder. */
+			hb_context.dl.http_content_size = rsp->content_length +
+							  hb_context.dl.resume_offset;
+		}
+#else
 		if (hb_context.dl.http_content_size == 0) {
 			hb_context.dl.http_content_size = rsp->content_length;
 		}
+#endif
 
 		if (rsp->body_found) {
 			body_data = rsp->body_frag_start;
@@ -770,6 +801,12 @@ static void response_cb(struct http_response *rsp, enum http_final_call final_da
 		if (downloaded > hb_context.dl.download_progress) {
 			hb_context.dl.download_progress = downloaded;
 			LOG_DBG("Download percentage: %d%% ", hb_context.dl.download_progress);
+
+#ifdef CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD
+			/* Checkpoint so a reset resumes close to this point */
+			(void)stream_flash_progress_save(&hb_context.flash_ctx.stream,
+							 HAWKBIT_PROGRESS_KEY);
+#endif
 		}
 
 		if (final_data == HTTP_DATA_FINAL) {
@@ -792,6 +829,10 @@ static bool send_request(enum http_method method, enum hawkbit_http_request type
 	const char *fini = hawkbit_status_finished(finished);
 	const char *exec = hawkbit_status_execution(execution);
 	char device_id[DEVICE_ID_HEX_MAX_SIZE] = { 0 };
+#ifdef CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD
+	char range_header[sizeof("Range: bytes=-\r\n") + 10];
+	const char *download_headers[3];
+#endif
 #ifndef CONFIG_HAWKBIT_DDI_NO_SECURITY
 	static const char *const headers[] = {
 #ifdef CONFIG_HAWKBIT_DDI_GATEWAY_SECURITY
@@ -942,6 +983,24 @@ static bool send_request(enum http_method method, enum hawkbit_http_request type
 		break;
 
 	case HAWKBIT_DOWNLOAD:
+#ifdef CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD
+		if (hb_context.dl.resume_offset > 0) {
+			int h = 0;
+
+			/* Request only the part that is not yet in flash. */
+			snprintk(range_header, sizeof(range_header), "Range: bytes=%zu-\r\n",
+				 hb_context.dl.resume_offset);
+#ifndef CONFIG_HAWKBIT_DDI_NO_SECURITY
+			download_headers[h++] = headers[0];
+#endif
+			download_headers[h++] = range_header;
+			download_headers[h] = NULL;
+			hb_context.http_req.header_fields = download_headers;
+
+			LOG_INF("Resuming download at offset %zu",
+				hb_context.dl.resume_offset);
+		}
+#endif
 		ret = http_client_req(hb_context.sock, &hb_context.http_req, HAWKBIT_RECV_TIMEOUT,
 				      "HAWKBIT_DOWNLOAD");
 		if (ret < 0) {
@@ -1137,6 +1196,71 @@ enum hawkbit_response hawkbit_probe(void)
 
 	flash_img_init(&hb_context.flash_ctx);
 
+#ifdef CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD
+	int32_t resume_action = 0;
+	int attempt = 0;
+
+	/* Only continue a stored download of the very same action; anything
+	 * else in the slot is stale.
+	 */
+	(void)nvs_read(&fs, RESUME_ACTION_ID, &resume_action, sizeof(resume_action));
+	if (resume_action == hb_context.json_action_id) {
+		(void)stream_flash_progress_load(&hb_context.flash_ctx.stream,
+						 HAWKBIT_PROGRESS_KEY);
+	} else {
+		(void)stream_flash_progress_clear(&hb_context.flash_ctx.stream,
+						  HAWKBIT_PROGRESS_KEY);
+		(void)nvs_write(&fs, RESUME_ACTION_ID, &hb_context.json_action_id,
+				sizeof(hb_context.json_action_id));
+	}
+
+	while (true) {
+		hb_context.dl.resume_offset = flash_img_bytes_written(&hb_context.flash_ctx);
+		hb_context.dl.resume_checked = false;
+		hb_context.dl.download_progress = 0;
+		hb_context.dl.http_content_size = 0;
+
+		ret = (int)send_request(HTTP_GET, HAWKBIT_DOWNLOAD,
+				  HAWKBIT_STATUS_FINISHED_NONE,
+				  HAWKBIT_STATUS_EXEC_NONE);
+
+		if (hb_context.code_status == HAWKBIT_DOWNLOAD_ERROR) {
+			/* Flash write errors do not get better on retry */
+			goto cleanup;
+		}
+
+		if (ret && hb_context.final_data_received) {
+			break;
+		}
+
+		if (++attempt >= CONFIG_HAWKBIT_DOWNLOAD_ATTEMPTS) {
+			LOG_ERR("Download is not complete");
+			hb_context.code_status = HAWKBIT_DOWNLOAD_ERROR;
+			goto cleanup;
+		}
+
+		LOG_WRN("Download dropped, reconnecting (attempt %d)", attempt);
+
+		/* Remember how far the stream got, then reconnect and restart
+		 * it from that point.
+		 */
+		(void)stream_flash_progress_save(&hb_context.flash_ctx.stream,
+						 HAWKBIT_PROGRESS_KEY);
+		cleanup_connection();
+
+		if (!start_http_client()) {
+			hb_context.code_status = HAWKBIT_NETWORKING_ERROR;
+			goto error;
+		}
+
+		flash_img_init(&hb_context.flash_ctx);
+		(void)stream_flash_progress_load(&hb_context.flash_ctx.stream,
+						 HAWKBIT_PROGRESS_KEY);
+	}
+
+	/* The artifact is fully stored; the progress slot is done. */
+	(void)stream_flash_progress_clear(&hb_context.flash_ctx.stream, HAWKBIT_PROGRESS_KEY);
+#else
 	ret = (int)send_request(HTTP_GET, HAWKBIT_DOWNLOAD,
 			  HAWKBIT_STATUS_FINISHED_NONE,
 			  HAWKBIT_STATUS_EXEC_NONE);
@@ -1157,6 +1281,7 @@ enum hawkbit_response hawkbit_probe(void)
 		hb_context.code_status = HAWKBIT_DOWNLOAD_ERROR;
 		goto cleanup;
 	}
+#endif /* CONFIG_HAWKBIT_RESUMABLE_DOWNLOAD */
 
 	/* Verify the hash of the stored firmware */
 	fic.match = hb_context.dl.file_hash;
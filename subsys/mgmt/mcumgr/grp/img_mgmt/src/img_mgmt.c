@@ -249,6 +249,127 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+/**
+ * Out-of-order chunk buffered until the upload offset catches up with it.
+ * A slot with a zero `len` is free.
+ */
+struct img_mgmt_window_chunk {
+	size_t off;
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_TRANSPORT_NETBUF_SIZE];
+};
+
+static struct img_mgmt_window_chunk
+	upload_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNKS];
+
+/*
+ * Drops all buffered out-of-order chunks.
+ */
+static void img_mgmt_window_reset(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(upload_window); i++) {
+		upload_window[i].len = 0;
+	}
+}
+
+/*
+ * Returns the number of free chunk buffers in the upload window.
+ */
+static size_t img_mgmt_window_free(void)
+{
+	size_t count = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(upload_window); i++) {
+		if (upload_window[i].len == 0) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Buffers a chunk that arrived ahead of the expected upload offset so it can
+ * be written to flash once the data preceding it has arrived.  Chunks that
+ * fall outside the current upload, retransmissions of already buffered data
+ * and chunks that do not fit a buffer slot are dropped; the client will
+ * retransmit them if they are still needed.
+ */
+static void img_mgmt_window_stash(size_t off, const uint8_t *data, size_t len)
+{
+	struct img_mgmt_window_chunk *slot = NULL;
+
+	if (len == 0 || len > sizeof(upload_window[0].data) ||
+	    off <= g_img_mgmt_state.off || off + len > g_img_mgmt_state.size) {
+		return;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(upload_window); i++) {
+		if (upload_window[i].len != 0 && upload_window[i].off == off) {
+			/* Retransmission of an already buffered chunk. */
+			return;
+		}
+
+		if (slot == NULL && upload_window[i].len == 0) {
+			slot = &upload_window[i];
+		}
+	}
+
+	if (slot == NULL) {
+		/* The client overran the advertised window. */
+		return;
+	}
+
+	slot->off = off;
+	slot->len = len;
+	memcpy(slot->data, data, len);
+}
+
+/**
+ * Writes any buffered chunks that have become contiguous with the current
+ * upload offset.  On failure the image write stream cannot be recovered and
+ * the upload must be restarted.
+ *
+ * @param last	Gets set to true if a buffered chunk completed the upload.
+ *
+ * @return 0 on success; MGMT_ERR code on flash write failure.
+ */
+static int img_mgmt_window_drain(bool *last)
+{
+	bool progress = true;
+
+	while (progress) {
+		progress = false;
+
+		for (int i = 0; i < ARRAY_SIZE(upload_window); i++) {
+			struct img_mgmt_window_chunk *chunk = &upload_window[i];
+			int rc;
+
+			if (chunk->len == 0 || chunk->off != g_img_mgmt_state.off) {
+				continue;
+			}
+
+			if (chunk->off + chunk->len == g_img_mgmt_state.size) {
+				*last = true;
+			}
+
+			rc = img_mgmt_write_image_data(chunk->off, chunk->data, chunk->len,
+						       *last);
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += chunk->len;
+			chunk->len = 0;
+			progress = true;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW */
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -256,6 +377,10 @@ void img_mgmt_reset_upload(void)
 {
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	img_mgmt_window_reset();
+#endif
 }
 
 /**
@@ -329,6 +454,14 @@ img_mgmt_upload_good_rsp(struct smp_streamer *ctxt)
 	ok = ok && zcbor_tstr_put_lit(zse, "off")		&&
 		   zcbor_size_put(zse, g_img_mgmt_state.off);
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	/* Advertise how many chunks the client may have in flight: one
+	 * in-order chunk plus a buffer slot for each out-of-order chunk.
+	 */
+	ok = ok && zcbor_tstr_put_lit(zse, "win")		&&
+		   zcbor_size_put(zse, img_mgmt_window_free() + 1);
+#endif
+
 	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
 }
 
@@ -435,6 +568,13 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+		/* A chunk ahead of the expected offset is part of a pipelined
+		 * upload; keep it for later instead of having the client
+		 * retransmit it.
+		 */
+		img_mgmt_window_stash(req.off, req.img_data.value, req.img_data.len);
+#endif
 		return img_mgmt_upload_good_rsp(ctxt);
 	}
 
@@ -466,6 +606,11 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 
 		g_img_mgmt_state.off = 0;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+		/* Drop chunks buffered for a previous, aborted upload. */
+		img_mgmt_window_reset();
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0);
 #endif
@@ -534,7 +679,16 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+			/* Append buffered out-of-order chunks that have become
+			 * contiguous with the new offset.
+			 */
+			rc = img_mgmt_window_drain(&last);
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
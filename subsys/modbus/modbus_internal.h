@@ -97,6 +97,14 @@ struct modbus_serial_config {
 	uint16_t uart_buf_ctr;
 	/* Storage of received characters or characters to send */
 	uint8_t uart_buf[CONFIG_MODBUS_BUFFER_SIZE];
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	/* Reception buffers handed over to the UART driver */
+	uint8_t async_rx_buf[2][CONFIG_MODBUS_BUFFER_SIZE];
+	/* Index of the reception buffer currently handed over */
+	uint8_t async_rx_buf_idx;
+	/* Serial line reception is enabled */
+	bool async_rx_enabled;
+#endif
 };
 
 #define MODBUS_STATE_CONFIGURED		0
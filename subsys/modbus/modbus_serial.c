@@ -37,14 +37,22 @@ static void modbus_serial_tx_on(struct modbus_context *ctx)
 		gpio_pin_set(cfg->de->port, cfg->de->pin, 1);
 	}
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	uart_tx(cfg->dev, cfg->uart_buf, cfg->uart_buf_ctr, SYS_FOREVER_US);
+#else
 	uart_irq_tx_enable(cfg->dev);
+#endif
 }
 
 static void modbus_serial_tx_off(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	(void)uart_tx_abort(cfg->dev);
+#else
 	uart_irq_tx_disable(cfg->dev);
+#endif
 	if (cfg->de != NULL) {
 		gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
 	}
@@ -58,14 +66,26 @@ static void modbus_serial_rx_on(struct modbus_context *ctx)
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 1);
 	}
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	cfg->async_rx_enabled = true;
+	cfg->async_rx_buf_idx = 0;
+	(void)uart_rx_enable(cfg->dev, cfg->async_rx_buf[0],
+			     sizeof(cfg->async_rx_buf[0]), cfg->rtu_timeout);
+#else
 	uart_irq_rx_enable(cfg->dev);
+#endif
 }
 
 static void modbus_serial_rx_off(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	cfg->async_rx_enabled = false;
+	(void)uart_rx_disable(cfg->dev);
+#else
 	uart_irq_rx_disable(cfg->dev);
+#endif
 	if (cfg->re != NULL) {
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
 	}
@@ -304,6 +324,71 @@ static void rtu_tx_adu(struct modbus_context *ctx)
 	modbus_serial_tx_on(ctx);
 }
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+static void uart_async_callback(const struct device *dev,
+				struct uart_event *evt, void *app_data)
+{
+	struct modbus_context *ctx = (struct modbus_context *)app_data;
+	struct modbus_serial_config *cfg;
+
+	if (ctx == NULL) {
+		LOG_ERR("Modbus hardware is not properly initialized");
+		return;
+	}
+
+	cfg = ctx->cfg;
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		/*
+		 * The reception timeout equals the RTU timeout, the driver
+		 * thus hands over whole frames delimited by an idle line.
+		 */
+		if (evt->data.rx.len >
+		    (size_t)(CONFIG_MODBUS_BUFFER_SIZE - cfg->uart_buf_ctr)) {
+			LOG_WRN("RX buffer overflow");
+			break;
+		}
+
+		memcpy(&cfg->uart_buf[cfg->uart_buf_ctr],
+		       &evt->data.rx.buf[evt->data.rx.offset],
+		       evt->data.rx.len);
+		cfg->uart_buf_ctr += evt->data.rx.len;
+		cfg->uart_buf_ptr = &cfg->uart_buf[cfg->uart_buf_ctr];
+
+		k_work_submit(&ctx->server_work);
+		break;
+	case UART_RX_BUF_REQUEST:
+		cfg->async_rx_buf_idx = (cfg->async_rx_buf_idx + 1) % 2;
+		uart_rx_buf_rsp(cfg->dev,
+				cfg->async_rx_buf[cfg->async_rx_buf_idx],
+				sizeof(cfg->async_rx_buf[0]));
+		break;
+	case UART_RX_DISABLED:
+		if (cfg->async_rx_enabled) {
+			/* Restart reception, e.g. after an RX error */
+			cfg->async_rx_buf_idx = 0;
+			(void)uart_rx_enable(cfg->dev, cfg->async_rx_buf[0],
+					     sizeof(cfg->async_rx_buf[0]),
+					     cfg->rtu_timeout);
+		}
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("Reception stopped, reason %d",
+			evt->data.rx_stop.reason);
+		break;
+	case UART_TX_DONE:
+		/* The frame including the last stop bit has been sent */
+		cfg->uart_buf_ptr = &cfg->uart_buf[0];
+		cfg->uart_buf_ctr = 0;
+		modbus_serial_tx_off(ctx);
+		modbus_serial_rx_on(ctx);
+		break;
+	default:
+		break;
+	}
+}
+#else
 /*
  * A byte has been received from a serial port. We just store it in the buffer
  * for processing when a complete packet has been received.
@@ -415,6 +500,7 @@ static void rtu_tmr_handler(struct k_timer *t_id)
 
 	k_work_submit(&ctx->server_work);
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 static int configure_gpio(struct modbus_context *ctx)
 {
@@ -508,8 +594,13 @@ int modbus_serial_init(struct modbus_context *ctx,
 	struct uart_config uart_cfg;
 
 	switch (param.mode) {
-	case MODBUS_MODE_RTU:
 	case MODBUS_MODE_ASCII:
+		if (IS_ENABLED(CONFIG_MODBUS_SERIAL_ASYNC)) {
+			/* Asynchronous API supports RTU framing only */
+			return -ENOTSUP;
+		}
+		__fallthrough;
+	case MODBUS_MODE_RTU:
 		ctx->mode = param.mode;
 		break;
 	default:
@@ -578,9 +669,17 @@ int modbus_serial_init(struct modbus_context *ctx,
 	cfg->uart_buf_ctr = 0;
 	cfg->uart_buf_ptr = &cfg->uart_buf[0];
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	if (uart_callback_set(cfg->dev, uart_async_callback, ctx) != 0) {
+		LOG_ERR("Bus device %s does not support asynchronous API",
+			cfg->dev->name);
+		return -ENOTSUP;
+	}
+#else
 	uart_irq_callback_user_data_set(cfg->dev, uart_cb_handler, ctx);
 	k_timer_init(&cfg->rtu_timer, rtu_tmr_handler, NULL);
 	k_timer_user_data_set(&cfg->rtu_timer, ctx);
+#endif
 
 	modbus_serial_rx_on(ctx);
 	LOG_INF("RTU timeout %u us", cfg->rtu_timeout);
@@ -592,5 +691,7 @@ void modbus_serial_disable(struct modbus_context *ctx)
 {
 	modbus_serial_tx_off(ctx);
 	modbus_serial_rx_off(ctx);
+#ifndef CONFIG_MODBUS_SERIAL_ASYNC
 	k_timer_stop(&ctx->cfg->rtu_timer);
+#endif
 }
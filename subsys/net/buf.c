@@ -162,6 +162,53 @@ const struct net_buf_data_cb net_buf_fixed_cb = {
 	.unref = fixed_data_unref,
 };
 
+static uint8_t *slab_data_alloc(struct net_buf *buf, size_t *size,
+				k_timeout_t timeout)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	struct k_mem_slab *slab = buf_pool->alloc->alloc_data;
+	uint8_t *ref_count;
+	void *b;
+
+	if (k_mem_slab_alloc(slab, &b, timeout) != 0) {
+		return NULL;
+	}
+
+	/* Reserve extra space for a ref-count (uint8_t) */
+	ref_count = (uint8_t *)b;
+	*ref_count = 1U;
+
+	/* The whole remainder of the block is usable, so a full-sized
+	 * request always comes back as one contiguous buffer.
+	 */
+	*size = MIN(*size, slab->block_size - sizeof(void *));
+
+	/* Return pointer to the byte following the ref count */
+	return ref_count + sizeof(void *);
+}
+
+static void slab_data_unref(struct net_buf *buf, uint8_t *data)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	struct k_mem_slab *slab = buf_pool->alloc->alloc_data;
+	uint8_t *ref_count;
+	void *b;
+
+	ref_count = data - sizeof(void *);
+	if (--(*ref_count)) {
+		return;
+	}
+
+	b = ref_count;
+	k_mem_slab_free(slab, &b);
+}
+
+const struct net_buf_data_cb net_buf_slab_cb = {
+	.alloc = slab_data_alloc,
+	.ref   = generic_data_ref,
+	.unref = slab_data_unref,
+};
+
 #if (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 
 static uint8_t *heap_data_alloc(struct net_buf *buf, size_t *size,
@@ -59,6 +59,76 @@ static const uint8_t da_inline_size_table[] = {
 	16, 8, 2, 0, 0, 8, 2, 0, 16, 6, 4, 1, 6
 	};
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+/* Cache of recent address compression decisions so that traffic
+ * flowing repeatedly between the same pair of addresses does not need
+ * to re-run the address analysis and the compression context search
+ * for every packet.
+ */
+struct net_6lo_comp_cache {
+	struct net_if *iface;
+	struct in6_addr src;
+	struct in6_addr dst;
+	uint16_t iphc;	   /* CID/SAC/SAM/M/DAC/DAM bits */
+	uint8_t cid;	   /* Inlined context identifier byte */
+	uint8_t sa_inline; /* Bytes of the src address carried inline */
+	uint8_t da_inline; /* Bytes of the dst address carried inline */
+	bool in_use;
+};
+
+static struct net_6lo_comp_cache
+	comp_cache[CONFIG_NET_6LO_COMPRESSION_CACHE_SIZE];
+static uint8_t comp_cache_next;
+
+static struct net_6lo_comp_cache *comp_cache_lookup(struct net_if *iface,
+						    struct net_ipv6_hdr *ipv6)
+{
+	uint8_t i;
+
+	for (i = 0U; i < CONFIG_NET_6LO_COMPRESSION_CACHE_SIZE; i++) {
+		struct net_6lo_comp_cache *cache = &comp_cache[i];
+
+		if (cache->in_use && cache->iface == iface &&
+		    net_ipv6_addr_cmp(&cache->dst,
+				      (struct in6_addr *)ipv6->dst) &&
+		    net_ipv6_addr_cmp(&cache->src,
+				      (struct in6_addr *)ipv6->src)) {
+			return cache;
+		}
+	}
+
+	return NULL;
+}
+
+static void comp_cache_add(struct net_if *iface, struct net_ipv6_hdr *ipv6,
+			   uint16_t iphc, uint8_t cid)
+{
+	struct net_6lo_comp_cache *cache = &comp_cache[comp_cache_next];
+
+	comp_cache_next = (comp_cache_next + 1) %
+		CONFIG_NET_6LO_COMPRESSION_CACHE_SIZE;
+
+	cache->iface = iface;
+	net_ipv6_addr_copy_raw((uint8_t *)&cache->src, ipv6->src);
+	net_ipv6_addr_copy_raw((uint8_t *)&cache->dst, ipv6->dst);
+	cache->iphc = iphc & (NET_6LO_IPHC_CID_MASK | NET_6LO_IPHC_SA_MASK |
+			      NET_6LO_IPHC_DA_MASK);
+	cache->cid = cid;
+	cache->sa_inline = sa_inline_size_table[
+		(cache->iphc & NET_6LO_IPHC_SA_MASK) >> NET_6LO_IPHC_SAM_POS];
+	cache->da_inline = da_inline_size_table[
+		cache->iphc & (NET_6LO_IPHC_DAC_MASK | NET_6LO_IPHC_DAM_MASK)];
+	cache->in_use = true;
+}
+
+static void comp_cache_clear(void)
+{
+	(void)memset(comp_cache, 0, sizeof(comp_cache));
+}
+#else
+#define comp_cache_clear()
+#endif /* CONFIG_NET_6LO_COMPRESSION_CACHE */
+
 static int get_udp_nhc_inlined_size(uint8_t nhc)
 {
 	int size = 0;
@@ -178,6 +248,11 @@ void net_6lo_set_context(struct net_if *iface,
 	int unused = -1;
 	uint8_t i;
 
+	/* The cached compression decisions may depend on the context
+	 * information, so drop them when the contexts change.
+	 */
+	comp_cache_clear();
+
 	/* If the context information already exists, update or remove
 	 * as per data.
 	 */
@@ -730,6 +805,9 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	struct net_6lo_context *src_ctx = NULL;
 	struct net_6lo_context *dst_ctx = NULL;
+#endif
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+	struct net_6lo_comp_cache *cache;
 #endif
 	uint8_t compressed = 0;
 	uint16_t iphc = (NET_6LO_DISPATCH_IPHC << 8);
@@ -759,6 +837,47 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 		inline_pos = compress_nh_udp(udp, inline_pos, false);
 	}
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+	cache = comp_cache_lookup(net_pkt_iface(pkt), ipv6);
+	if (cache) {
+		/* A fully elided address is derived from the link layer
+		 * address, which is not part of the cache key, so that
+		 * part of the decision is re-verified before use.
+		 */
+		if (((cache->iphc & NET_6LO_IPHC_DAM_MASK) ==
+		     NET_6LO_IPHC_DAM_11 &&
+		     !net_ipv6_addr_based_on_ll((struct in6_addr *)ipv6->dst,
+						net_pkt_lladdr_dst(pkt))) ||
+		    ((cache->iphc & NET_6LO_IPHC_SAM_MASK) ==
+		     NET_6LO_IPHC_SAM_11 &&
+		     !net_ipv6_addr_based_on_ll((struct in6_addr *)ipv6->src,
+						net_pkt_lladdr_src(pkt)))) {
+			cache->in_use = false;
+			cache = NULL;
+		}
+	}
+
+	if (cache) {
+		NET_DBG("Using cached compression decision 0x%04x",
+			cache->iphc);
+
+		iphc |= cache->iphc;
+
+		/* The inlined part of a unicast address is always the
+		 * tail of the address.
+		 */
+		inline_pos -= cache->da_inline;
+		memmove(inline_pos, &ipv6->dst[16U - cache->da_inline],
+			cache->da_inline);
+
+		inline_pos -= cache->sa_inline;
+		memmove(inline_pos, &ipv6->src[16U - cache->sa_inline],
+			cache->sa_inline);
+
+		goto addr_end;
+	}
+#endif
+
 	if (net_6lo_ll_prefix_padded_with_zeros((struct in6_addr *)ipv6->dst)) {
 		inline_pos = compress_da(ipv6, pkt, inline_pos, &iphc);
 		goto da_end;
@@ -807,6 +926,29 @@ da_end:
 	inline_pos = set_sa_inline(ipv6, inline_pos, &iphc);
 sa_end:
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+	/* Multicast destinations do not carry a contiguous tail of the
+	 * address inline so they are not cached.
+	 */
+	if (!(iphc & NET_6LO_IPHC_M_1)) {
+		uint8_t cid = 0U;
+
+#if defined(CONFIG_NET_6LO_CONTEXT)
+		if (src_ctx) {
+			cid = src_ctx->cid << 4;
+		}
+
+		if (dst_ctx) {
+			cid |= dst_ctx->cid & 0x0F;
+		}
+#endif
+
+		comp_cache_add(net_pkt_iface(pkt), ipv6, iphc, cid);
+	}
+
+addr_end:
+#endif
+
 	inline_pos = compress_hoplimit(ipv6, inline_pos, &iphc);
 	inline_pos = compress_nh(ipv6, inline_pos, &iphc);
 	inline_pos = compress_tfl(ipv6, inline_pos, &iphc);
@@ -816,6 +958,12 @@ sa_end:
 		inline_pos -= sizeof(uint8_t);
 		*inline_pos = 0;
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+		if (cache) {
+			*inline_pos = cache->cid;
+		}
+#endif
+
 		if (src_ctx) {
 			*inline_pos = src_ctx->cid << 4;
 		}
@@ -57,6 +57,9 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 /** Remote address specified */
 #define NET_CONN_LOCAL_ADDR_SPEC	BIT(6)
 
+/** Connection is in the 4-tuple hash table */
+#define NET_CONN_HASHED			BIT(7)
+
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
@@ -64,6 +67,197 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+/* Connections with a fully specified remote and local end point are
+ * additionally kept in a hash table keyed on the connection 4-tuple so
+ * that the RX path can demultiplex unicast UDP and TCP packets without
+ * scanning every registered handler. Listening (wildcard) connections
+ * are only found with the ranked scan over the conn_used list.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_BUCKETS];
+
+#define NET_CONN_SPEC_MASK	(NET_CONN_REMOTE_PORT_SPEC |	\
+				 NET_CONN_LOCAL_PORT_SPEC |	\
+				 NET_CONN_REMOTE_ADDR_SPEC |	\
+				 NET_CONN_LOCAL_ADDR_SPEC)
+
+/* FNV-1a over the connection 4-tuple. The ports are taken in network
+ * byte order on both the connection and the packet side so the values
+ * hash identically.
+ */
+static uint32_t conn_tuple_hash(uint8_t family, uint16_t proto,
+				const uint8_t *remote_addr,
+				const uint8_t *local_addr,
+				size_t addr_len,
+				uint16_t remote_port,
+				uint16_t local_port)
+{
+	uint32_t hash = 0x811c9dc5U;
+	size_t i;
+
+	for (i = 0U; i < addr_len; i++) {
+		hash = (hash ^ remote_addr[i]) * 0x01000193U;
+	}
+
+	for (i = 0U; i < addr_len; i++) {
+		hash = (hash ^ local_addr[i]) * 0x01000193U;
+	}
+
+	hash = (hash ^ remote_port) * 0x01000193U;
+	hash = (hash ^ local_port) * 0x01000193U;
+	hash = (hash ^ proto) * 0x01000193U;
+	hash = (hash ^ family) * 0x01000193U;
+
+	return hash;
+}
+
+uint32_t net_conn_tuple_hash(uint8_t family, uint16_t proto,
+			     const uint8_t *remote_addr,
+			     const uint8_t *local_addr,
+			     size_t addr_len,
+			     uint16_t remote_port,
+			     uint16_t local_port)
+{
+	return conn_tuple_hash(family, proto, remote_addr, local_addr,
+			       addr_len, remote_port, local_port);
+}
+
+static inline sys_slist_t *conn_hash_bucket(uint32_t hash)
+{
+	return &conn_hash[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+/* Must be called with conn_lock held. */
+static void conn_hash_insert(struct net_conn *conn)
+{
+	const uint8_t *remote_addr;
+	const uint8_t *local_addr;
+	size_t addr_len;
+
+	if (conn->proto != IPPROTO_UDP && conn->proto != IPPROTO_TCP) {
+		return;
+	}
+
+	if ((conn->flags & NET_CONN_SPEC_MASK) != NET_CONN_SPEC_MASK) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+		remote_addr = (const uint8_t *)
+			&net_sin6(&conn->remote_addr)->sin6_addr;
+		local_addr = (const uint8_t *)
+			&net_sin6(&conn->local_addr)->sin6_addr;
+		addr_len = sizeof(struct in6_addr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && conn->family == AF_INET) {
+		remote_addr = (const uint8_t *)
+			&net_sin(&conn->remote_addr)->sin_addr;
+		local_addr = (const uint8_t *)
+			&net_sin(&conn->local_addr)->sin_addr;
+		addr_len = sizeof(struct in_addr);
+	} else {
+		return;
+	}
+
+	conn->tuple_hash = conn_tuple_hash(conn->family, conn->proto,
+					   remote_addr, local_addr, addr_len,
+					   net_sin(&conn->remote_addr)->sin_port,
+					   net_sin(&conn->local_addr)->sin_port);
+
+	sys_slist_prepend(conn_hash_bucket(conn->tuple_hash),
+			  &conn->hash_node);
+	conn->flags |= NET_CONN_HASHED;
+}
+
+/* Must be called with conn_lock held. */
+static void conn_hash_remove(struct net_conn *conn)
+{
+	if (conn->flags & NET_CONN_HASHED) {
+		sys_slist_find_and_remove(conn_hash_bucket(conn->tuple_hash),
+					  &conn->hash_node);
+		conn->flags &= ~NET_CONN_HASHED;
+	}
+}
+
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port,
+					 uint16_t dst_port)
+{
+	uint8_t family = net_pkt_family(pkt);
+	const uint8_t *remote_addr;
+	const uint8_t *local_addr;
+	struct net_conn *conn;
+	size_t addr_len;
+	uint32_t hash;
+
+	if (src_port == 0U || dst_port == 0U) {
+		return NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		remote_addr = ip_hdr->ipv6->src;
+		local_addr = ip_hdr->ipv6->dst;
+		addr_len = sizeof(struct in6_addr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		remote_addr = ip_hdr->ipv4->src;
+		local_addr = ip_hdr->ipv4->dst;
+		addr_len = sizeof(struct in_addr);
+	} else {
+		return NULL;
+	}
+
+	hash = conn_tuple_hash(family, proto, remote_addr, local_addr,
+			       addr_len, src_port, dst_port);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(conn_hash_bucket(hash), conn,
+				     hash_node) {
+		if (conn->tuple_hash != hash ||
+		    conn->proto != proto || conn->family != family) {
+			continue;
+		}
+
+		if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			continue;
+		}
+
+		if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+			if (!net_ipv6_addr_cmp_raw(
+				(uint8_t *)&net_sin6(&conn->remote_addr)->sin6_addr,
+				remote_addr) ||
+			    !net_ipv6_addr_cmp_raw(
+				(uint8_t *)&net_sin6(&conn->local_addr)->sin6_addr,
+				local_addr)) {
+				continue;
+			}
+		} else {
+			if (!net_ipv4_addr_cmp_raw(
+				(uint8_t *)&net_sin(&conn->remote_addr)->sin_addr,
+				remote_addr) ||
+			    !net_ipv4_addr_cmp_raw(
+				(uint8_t *)&net_sin(&conn->local_addr)->sin_addr,
+				local_addr)) {
+				continue;
+			}
+		}
+
+		if (conn->context != NULL &&
+		    net_context_is_bound_to_iface(conn->context) &&
+		    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+#else
+#define conn_hash_insert(conn)
+#define conn_hash_remove(conn)
+#endif /* CONFIG_NET_CONN_HASH_LOOKUP */
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -141,6 +335,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_insert(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -396,6 +591,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_remove(conn);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 	k_mutex_unlock(&conn_lock);
 
@@ -634,6 +830,24 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+	if (IS_ENABLED(CONFIG_NET_IP) &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    !is_mcast_pkt && !is_bcast_pkt &&
+	    ((IS_ENABLED(CONFIG_NET_UDP) && proto == IPPROTO_UDP) ||
+	     (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP))) {
+		/* A fully specified connection is always the most specific
+		 * match for a unicast packet, so when the hash table has one
+		 * for this 4-tuple the ranked scan can be skipped entirely.
+		 */
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto,
+					      src_port, dst_port);
+		if (best_match != NULL) {
+			goto deliver;
+		}
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -806,6 +1020,9 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+deliver:
+#endif
 	if (best_match) {
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", best_match, best_match->cb,
 			best_match->user_data, best_match->flags);
@@ -857,6 +1074,12 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
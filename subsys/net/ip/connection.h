@@ -54,6 +54,14 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+	/** Node for the established-connection hash table */
+	sys_snode_t hash_node;
+
+	/** Precomputed hash of the connection 4-tuple */
+	uint32_t tuple_hash;
+#endif
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
@@ -192,6 +200,30 @@ static inline enum net_verdict net_conn_input(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IP || CONFIG_NET_CONNECTION_SOCKETS */
 
+/**
+ * @brief Compute the hash of a connection 4-tuple.
+ *
+ * This is the same hash that keys the connection lookup table, exposed
+ * so that other parts of the stack (e.g. receive queue flow steering)
+ * classify flows consistently with the connection layer.
+ *
+ * @param family Address family (AF_INET or AF_INET6)
+ * @param proto Transport protocol
+ * @param remote_addr Remote address in network byte order
+ * @param local_addr Local address in network byte order
+ * @param addr_len Address length in bytes
+ * @param remote_port Remote port in network byte order
+ * @param local_port Local port in network byte order
+ *
+ * @return Hash of the tuple.
+ */
+uint32_t net_conn_tuple_hash(uint8_t family, uint16_t proto,
+			     const uint8_t *remote_addr,
+			     const uint8_t *local_addr,
+			     size_t addr_len,
+			     uint16_t remote_port,
+			     uint16_t local_port);
+
 /**
  * @typedef net_conn_foreach_cb_t
  * @brief Callback used while iterating over network connection
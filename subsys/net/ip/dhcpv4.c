@@ -31,6 +31,11 @@ LOG_MODULE_REGISTER(net_dhcpv4, CONFIG_NET_DHCPV4_LOG_LEVEL);
 #include "ipv4.h"
 #include "net_stats.h"
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+#include <stdlib.h>
+#include <zephyr/settings/settings.h>
+#endif
+
 #define PKT_WAIT_TIME K_SECONDS(1)
 
 static K_MUTEX_DEFINE(lock);
@@ -63,6 +68,100 @@ static const char *dhcpv4_msg_type_name(enum dhcpv4_msg_type msg_type)
 	return name[msg_type - 1];
 }
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+/* The leased address is stored with the settings subsystem so that the
+ * client can skip the discovery sequence after a reboot and request the
+ * previous address right away (INIT-REBOOT, RFC 2131 ch. 3.2).
+ */
+#define DHCPV4_LEASE_SETTINGS_BASE "net/dhcpv4/lease"
+
+static void dhcpv4_lease_store(struct net_if *iface)
+{
+	char key[sizeof(DHCPV4_LEASE_SETTINGS_BASE) + 4];
+	int ret;
+
+	if (net_ipv4_addr_cmp(&iface->config.dhcpv4.requested_ip,
+			      &iface->config.dhcpv4.cached_ip)) {
+		/* The stored lease is already up to date */
+		return;
+	}
+
+	snprintk(key, sizeof(key), DHCPV4_LEASE_SETTINGS_BASE "/%d",
+		 net_if_get_by_iface(iface));
+
+	ret = settings_save_one(key, &iface->config.dhcpv4.requested_ip,
+				sizeof(struct in_addr));
+	if (ret < 0) {
+		NET_DBG("Cannot store lease (%d)", ret);
+		return;
+	}
+
+	net_ipaddr_copy(&iface->config.dhcpv4.cached_ip,
+			&iface->config.dhcpv4.requested_ip);
+	iface->config.dhcpv4.lease_cached = true;
+}
+
+static void dhcpv4_lease_forget(struct net_if *iface)
+{
+	char key[sizeof(DHCPV4_LEASE_SETTINGS_BASE) + 4];
+	int ret;
+
+	if (!iface->config.dhcpv4.lease_cached) {
+		return;
+	}
+
+	snprintk(key, sizeof(key), DHCPV4_LEASE_SETTINGS_BASE "/%d",
+		 net_if_get_by_iface(iface));
+
+	ret = settings_delete(key);
+	if (ret < 0) {
+		NET_DBG("Cannot delete lease (%d)", ret);
+	}
+
+	iface->config.dhcpv4.cached_ip.s_addr = INADDR_ANY;
+	iface->config.dhcpv4.lease_cached = false;
+}
+
+static int dhcpv4_lease_settings_set(const char *name, size_t len,
+				     settings_read_cb read_cb, void *cb_arg)
+{
+	const char *next;
+	struct net_if *iface;
+	struct in_addr addr;
+
+	if (!settings_name_steq(name, "lease", &next) || !next) {
+		return -ENOENT;
+	}
+
+	iface = net_if_get_by_index(atoi(next));
+	if (!iface) {
+		return -ENOENT;
+	}
+
+	if (len != sizeof(addr)) {
+		return -EINVAL;
+	}
+
+	if (read_cb(cb_arg, &addr, sizeof(addr)) < 0) {
+		return -EINVAL;
+	}
+
+	net_ipaddr_copy(&iface->config.dhcpv4.cached_ip, &addr);
+	iface->config.dhcpv4.lease_cached = true;
+
+	NET_DBG("iface %p cached lease %s", iface,
+		net_sprint_ipv4_addr(&addr));
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(net_dhcpv4, "net/dhcpv4", NULL,
+			       dhcpv4_lease_settings_set, NULL, NULL);
+#else
+#define dhcpv4_lease_store(iface)
+#define dhcpv4_lease_forget(iface)
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
+
 /* Add magic cookie to DCHPv4 messages */
 static inline bool dhcpv4_add_cookie(struct net_pkt *pkt)
 {
@@ -354,6 +453,16 @@ static uint32_t dhcpv4_send_request(struct net_if *iface)
 	case NET_DHCPV4_REQUESTING:
 		with_server_id = true;
 		with_requested_ip = true;
+
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		/* When requesting the cached lease after a reboot there
+		 * is no server to identify yet, and RFC 2131 ch. 4.3.2
+		 * forbids the server identifier in INIT-REBOOT.
+		 */
+		if (iface->config.dhcpv4.init_reboot) {
+			with_server_id = false;
+		}
+#endif
 		break;
 	case NET_DHCPV4_RENEWING:
 		/* Since we have an address populate the ciaddr field.
@@ -461,6 +570,10 @@ static void dhcpv4_enter_selecting(struct net_if *iface)
 	iface->config.dhcpv4.server_id.s_addr = INADDR_ANY;
 	iface->config.dhcpv4.requested_ip.s_addr = INADDR_ANY;
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	iface->config.dhcpv4.init_reboot = false;
+#endif
+
 	iface->config.dhcpv4.state = NET_DHCPV4_SELECTING;
 	NET_DBG("enter state=%s",
 		net_dhcpv4_state_name(iface->config.dhcpv4.state));
@@ -553,6 +666,11 @@ static void dhcpv4_enter_bound(struct net_if *iface)
 		iface->config.dhcpv4.rebinding_time = rebinding_time;
 	}
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	iface->config.dhcpv4.init_reboot = false;
+#endif
+	dhcpv4_lease_store(iface);
+
 	iface->config.dhcpv4.state = NET_DHCPV4_BOUND;
 	NET_DBG("enter state=%s renewal=%us rebinding=%us",
 		net_dhcpv4_state_name(iface->config.dhcpv4.state),
@@ -960,6 +1078,11 @@ static void dhcpv4_handle_msg_nak(struct net_if *iface)
 			NET_DBG("Failed to remove addr from iface");
 		}
 
+		/* The server rejected the address so forget the cached
+		 * lease to avoid requesting it again on next boot.
+		 */
+		dhcpv4_lease_forget(iface);
+
 		/* Restart the configuration process. */
 		dhcpv4_enter_selecting(iface);
 		break;
@@ -1188,6 +1311,26 @@ static void dhcpv4_start_internal(struct net_if *iface, bool first_start)
 					DHCPV4_INITIAL_DELAY_MIN) + DHCPV4_INITIAL_DELAY_MIN;
 		}
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		if (iface->config.dhcpv4.lease_cached) {
+			/* INIT-REBOOT (RFC 2131 ch. 3.2): request the
+			 * previously leased address right away without
+			 * the initial delay, and fall back to the
+			 * discovery sequence if the server rejects it.
+			 */
+			net_ipaddr_copy(&iface->config.dhcpv4.requested_ip,
+					&iface->config.dhcpv4.cached_ip);
+			iface->config.dhcpv4.attempts = 0U;
+			iface->config.dhcpv4.init_reboot = true;
+			iface->config.dhcpv4.state = NET_DHCPV4_REQUESTING;
+			timeout = 0U;
+
+			NET_DBG("request cached lease %s",
+				net_sprint_ipv4_addr(
+					&iface->config.dhcpv4.requested_ip));
+		}
+#endif
+
 		NET_DBG("wait timeout=%us", timeout);
 
 		if (sys_slist_is_empty(&dhcpv4_ifaces)) {
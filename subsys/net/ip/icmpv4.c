@@ -66,8 +66,11 @@ int net_icmpv4_finalize(struct net_pkt *pkt)
 	}
 
 	icmp_hdr->chksum = 0U;
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_IPV4_ICMP)) {
 		icmp_hdr->chksum = net_calc_chksum_icmpv4(pkt);
+	} else {
+		net_pkt_set_l4_chksum_offloaded(pkt, true);
 	}
 
 	return net_pkt_set_data(pkt, &icmpv4_access);
@@ -715,7 +718,9 @@ enum net_verdict net_icmpv4_input(struct net_pkt *pkt,
 		return NET_DROP;
 	}
 
-	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+	if (!net_pkt_is_l4_chksum_offloaded(pkt) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_IPV4_ICMP)) {
 		if (net_calc_chksum_icmpv4(pkt) != 0U) {
 			NET_DBG("DROP: Invalid checksum");
 			goto drop;
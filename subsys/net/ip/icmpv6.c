@@ -80,8 +80,11 @@ int net_icmpv6_finalize(struct net_pkt *pkt)
 	}
 
 	icmp_hdr->chksum = 0U;
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_IPV6_ICMP)) {
 		icmp_hdr->chksum = net_calc_chksum_icmpv6(pkt);
+	} else {
+		net_pkt_set_l4_chksum_offloaded(pkt, true);
 	}
 
 	return net_pkt_set_data(pkt, &icmp_access);
@@ -437,7 +440,9 @@ enum net_verdict net_icmpv6_input(struct net_pkt *pkt,
 	}
 
 
-	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+	if (!net_pkt_is_l4_chksum_offloaded(pkt) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_IPV6_ICMP)) {
 		if (net_calc_chksum_icmpv6(pkt) != 0U) {
 			NET_DBG("DROP: invalid checksum");
 			goto drop;
@@ -479,8 +479,11 @@ static int send_ipv4_fragment(struct net_pkt *pkt, uint16_t rand_id, uint16_t fi
 	ipv4_hdr->len = htons((fit_len + net_pkt_ip_hdr_len(pkt)));
 
 	ipv4_hdr->chksum = 0;
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(frag_pkt))) {
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(frag_pkt),
+					 NET_IF_CHECKSUM_IPV4_HEADER)) {
 		ipv4_hdr->chksum = net_calc_chksum_ipv4(frag_pkt);
+	} else {
+		net_pkt_set_ip_chksum_offloaded(frag_pkt, true);
 	}
 
 	net_pkt_set_data(frag_pkt, &ipv4_access);
@@ -117,6 +117,14 @@ struct net_ipv6_nbr_data {
 	 */
 	uint32_t stale_counter;
 #endif
+
+#if defined(CONFIG_NET_IPV6_NBR_CACHE_HASH)
+	/** Last-use stamp for LRU eviction when the table is full. */
+	uint32_t lru_stamp;
+
+	/** Index of the next neighbor in the same hash bucket. */
+	uint8_t hash_next;
+#endif
 };
 
 static inline struct net_ipv6_nbr_data *net_ipv6_nbr_data(struct net_nbr *nbr)
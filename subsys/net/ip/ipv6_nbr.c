@@ -137,6 +137,117 @@ static inline struct net_nbr *get_nbr_from_data(struct net_ipv6_nbr_data *data)
 	return NULL;
 }
 
+#if defined(CONFIG_NET_IPV6_NBR_CACHE_HASH)
+/* The neighbor table is additionally indexed by a hash of the IPv6
+ * address so that lookups on the packet path do not need to scan the
+ * whole table. The buckets chain neighbors together by their pool
+ * index; a bucket count in the same order as the table size keeps the
+ * chains short.
+ */
+#define NBR_HASH_END 0xff
+
+static uint8_t nbr_hash_head[CONFIG_NET_IPV6_NBR_CACHE_HASH_BUCKETS];
+static uint32_t nbr_lru_counter;
+
+static inline uint8_t nbr_get_index(struct net_nbr *nbr)
+{
+	return ((uint8_t *)nbr - (uint8_t *)net_neighbor_pool) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+/* FNV-1a over the IPv6 address */
+static inline uint8_t nbr_hash_bucket(const struct in6_addr *addr)
+{
+	uint32_t hash = 0x811c9dc5U;
+	size_t i;
+
+	for (i = 0U; i < sizeof(addr->s6_addr); i++) {
+		hash = (hash ^ addr->s6_addr[i]) * 0x01000193U;
+	}
+
+	return hash % CONFIG_NET_IPV6_NBR_CACHE_HASH_BUCKETS;
+}
+
+static inline void nbr_lru_touch(struct net_nbr *nbr)
+{
+	net_ipv6_nbr_data(nbr)->lru_stamp = ++nbr_lru_counter;
+}
+
+static void nbr_hash_insert(struct net_nbr *nbr)
+{
+	uint8_t bucket = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+
+	net_ipv6_nbr_data(nbr)->hash_next = nbr_hash_head[bucket];
+	nbr_hash_head[bucket] = nbr_get_index(nbr);
+
+	nbr_lru_touch(nbr);
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	uint8_t bucket = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = nbr_get_index(nbr);
+	uint8_t *slot = &nbr_hash_head[bucket];
+
+	while (*slot != NBR_HASH_END) {
+		if (*slot == idx) {
+			*slot = net_ipv6_nbr_data(nbr)->hash_next;
+			return;
+		}
+
+		slot = &net_ipv6_nbr_data(get_nbr(*slot))->hash_next;
+	}
+}
+
+static void nbr_hash_clear(void)
+{
+	(void)memset(nbr_hash_head, NBR_HASH_END, sizeof(nbr_hash_head));
+}
+
+/* Evict the least recently used neighbor to make room for a new entry.
+ * Routers, static entries and neighbors with pending neighbor discovery
+ * are never evicted.
+ */
+static void nbr_lru_evict(void)
+{
+	struct net_nbr *lru = NULL;
+	uint32_t oldest = 0U;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
+		struct net_nbr *nbr = get_nbr(i);
+		struct net_ipv6_nbr_data *data;
+
+		if (!nbr->ref) {
+			continue;
+		}
+
+		data = net_ipv6_nbr_data(nbr);
+		if (data->is_router || data->pending ||
+		    data->state == NET_IPV6_NBR_STATE_STATIC) {
+			continue;
+		}
+
+		if (lru == NULL || (int32_t)(data->lru_stamp - oldest) < 0) {
+			lru = nbr;
+			oldest = data->lru_stamp;
+		}
+	}
+
+	if (lru) {
+		NET_DBG("Evicting LRU nbr %p IPv6 %s", lru,
+			net_sprint_ipv6_addr(&net_ipv6_nbr_data(lru)->addr));
+
+		net_ipv6_nbr_rm(lru->iface, &net_ipv6_nbr_data(lru)->addr);
+	}
+}
+#else
+#define nbr_hash_insert(nbr)
+#define nbr_hash_remove(nbr)
+#define nbr_hash_clear()
+#define nbr_lru_touch(nbr)
+#endif /* CONFIG_NET_IPV6_NBR_CACHE_HASH */
+
 static void ipv6_nbr_set_state(struct net_nbr *nbr,
 			       enum net_ipv6_nbr_state new_state)
 {
@@ -258,6 +369,22 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
+#if defined(CONFIG_NET_IPV6_NBR_CACHE_HASH)
+	uint8_t idx = nbr_hash_head[nbr_hash_bucket(addr)];
+
+	while (idx != NBR_HASH_END) {
+		struct net_nbr *nbr = get_nbr(idx);
+		struct net_ipv6_nbr_data *data = net_ipv6_nbr_data(nbr);
+
+		if (nbr->ref && (!iface || nbr->iface == iface) &&
+		    net_ipv6_addr_cmp(&data->addr, addr)) {
+			nbr_lru_touch(nbr);
+			return nbr;
+		}
+
+		idx = data->hash_next;
+	}
+#else
 	int i;
 
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
@@ -275,6 +402,7 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 			return nbr;
 		}
 	}
+#endif
 
 	return NULL;
 }
@@ -429,6 +557,8 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 
 	nbr_init(nbr, iface, addr, is_router, state);
 
+	nbr_hash_insert(nbr);
+
 	NET_DBG("nbr %p iface %p/%d state %d IPv6 %s",
 		nbr, iface, net_if_get_by_iface(iface), state,
 		net_sprint_ipv6_addr(addr));
@@ -570,7 +700,15 @@ static struct net_nbr *add_nbr(struct net_if *iface,
 
 	nbr = nbr_new(iface, addr, is_router, state);
 	if (!nbr) {
-		return NULL;
+#if defined(CONFIG_NET_IPV6_NBR_CACHE_HASH)
+		/* As a last resort evict the least recently used
+		 * neighbor and try once more.
+		 */
+		nbr_lru_evict();
+
+		nbr = nbr_new(iface, addr, is_router, state);
+#endif
+		return nbr;
 	}
 
 	return nbr;
@@ -649,12 +787,17 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	/* This is called whenever the last reference to the neighbor is
+	 * dropped, so it covers every removal path.
+	 */
+	nbr_hash_remove(nbr);
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
 {
 	NET_DBG("Neighbor table %p cleared", table);
+
+	nbr_hash_clear();
 }
 
 struct in6_addr *net_ipv6_nbr_lookup_by_index(struct net_if *iface,
@@ -2575,6 +2718,7 @@ void net_ipv6_nbr_init(void)
 	net_icmpv6_register_handler(&na_input_handler);
 	k_work_init_delayable(&ipv6_ns_reply_timer, ipv6_ns_reply_timeout);
 	k_sem_init(&nbr_lock, 1, K_SEM_MAX_LIMIT);
+	nbr_hash_clear();
 #endif
 #if defined(CONFIG_NET_IPV6_ND)
 	net_icmpv6_register_handler(&ra_input_handler);
@@ -60,6 +60,100 @@ static struct net_context contexts[NET_MAX_CONTEXT];
  */
 static struct k_sem contexts_lock;
 
+/* Free context slots are kept in a LIFO list so that allocating a context
+ * does not need to scan the whole table. The list is protected by its own
+ * spinlock so that a slot can be released from any locking context.
+ */
+static struct k_spinlock free_contexts_lock;
+static int16_t free_contexts_head = -1;
+static int16_t free_contexts_next[NET_MAX_CONTEXT];
+
+static void context_mark_free(int idx)
+{
+	k_spinlock_key_t key = k_spin_lock(&free_contexts_lock);
+
+	free_contexts_next[idx] = free_contexts_head;
+	free_contexts_head = (int16_t)idx;
+
+	k_spin_unlock(&free_contexts_lock, key);
+}
+
+static int context_take_free(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&free_contexts_lock);
+	int idx = free_contexts_head;
+
+	if (idx >= 0) {
+		free_contexts_head = free_contexts_next[idx];
+	}
+
+	k_spin_unlock(&free_contexts_lock, key);
+
+	return idx;
+}
+
+/* Return a context slot to the free list when the NET_CONTEXT_IN_USE flag
+ * is cleared. Clearing the flag and putting the slot back are done
+ * atomically so that a context released twice (e.g. both by an offload
+ * driver and by the caller) is only listed once.
+ */
+static void context_release(struct net_context *context)
+{
+	k_spinlock_key_t key = k_spin_lock(&free_contexts_lock);
+
+	if (context->flags & NET_CONTEXT_IN_USE) {
+		context->flags &= ~NET_CONTEXT_IN_USE;
+
+		free_contexts_next[context - contexts] = free_contexts_head;
+		free_contexts_head = (int16_t)(context - contexts);
+	}
+
+	k_spin_unlock(&free_contexts_lock, key);
+}
+
+/* Operations that only touch the receive side of a context (receive
+ * callback registration and packet delivery) take the receive lock so
+ * that they can run in parallel with a transmit on the same context.
+ * The transmit path keeps using the context lock directly. Operations
+ * that change the context state take both locks, always in the same
+ * order.
+ */
+static inline void context_recv_lock(struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_RECV_LOCK)
+	k_mutex_lock(&context->recv_lock, K_FOREVER);
+#else
+	k_mutex_lock(&context->lock, K_FOREVER);
+#endif
+}
+
+static inline void context_recv_unlock(struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_RECV_LOCK)
+	k_mutex_unlock(&context->recv_lock);
+#else
+	k_mutex_unlock(&context->lock);
+#endif
+}
+
+static inline void context_state_lock(struct net_context *context)
+{
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+#if defined(CONFIG_NET_CONTEXT_RECV_LOCK)
+	k_mutex_lock(&context->recv_lock, K_FOREVER);
+#endif
+}
+
+static inline void context_state_unlock(struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_RECV_LOCK)
+	k_mutex_unlock(&context->recv_lock);
+#endif
+
+	k_mutex_unlock(&context->lock);
+}
+
 #if defined(CONFIG_NET_UDP) || defined(CONFIG_NET_TCP)
 static int check_used_port(enum net_ip_protocol proto,
 			   uint16_t local_port,
@@ -249,78 +343,84 @@ int net_context_get(sa_family_t family, enum net_sock_type type, uint16_t proto,
 	k_sem_take(&contexts_lock, K_FOREVER);
 
 	ret = -ENOENT;
-	for (i = 0; i < NET_MAX_CONTEXT; i++) {
-		if (net_context_is_used(&contexts[i])) {
-			continue;
-		}
+	i = context_take_free();
+	if (i < 0) {
+		goto give;
+	}
 
-		memset(&contexts[i], 0, sizeof(contexts[i]));
-		/* FIXME - Figure out a way to get the correct network interface
-		 * as it is not known at this point yet.
-		 */
-		if (!net_if_is_ip_offloaded(net_if_get_default())
-			&& proto == IPPROTO_TCP) {
-			if (net_tcp_get(&contexts[i]) < 0) {
-				break;
-			}
+	memset(&contexts[i], 0, sizeof(contexts[i]));
+	/* FIXME - Figure out a way to get the correct network interface
+	 * as it is not known at this point yet.
+	 */
+	if (!net_if_is_ip_offloaded(net_if_get_default())
+		&& proto == IPPROTO_TCP) {
+		if (net_tcp_get(&contexts[i]) < 0) {
+			goto put_back;
 		}
+	}
 
-		contexts[i].iface = -1;
-		contexts[i].flags = 0U;
-		atomic_set(&contexts[i].refcount, 1);
+	contexts[i].iface = -1;
+	contexts[i].flags = 0U;
+	atomic_set(&contexts[i].refcount, 1);
 
-		net_context_set_family(&contexts[i], family);
-		net_context_set_type(&contexts[i], type);
-		net_context_set_proto(&contexts[i], proto);
+	net_context_set_family(&contexts[i], family);
+	net_context_set_type(&contexts[i], type);
+	net_context_set_proto(&contexts[i], proto);
 
 #if defined(CONFIG_NET_CONTEXT_RCVTIMEO)
-		contexts[i].options.rcvtimeo = K_FOREVER;
+	contexts[i].options.rcvtimeo = K_FOREVER;
 #endif
 #if defined(CONFIG_NET_CONTEXT_SNDTIMEO)
-		contexts[i].options.sndtimeo = K_FOREVER;
+	contexts[i].options.sndtimeo = K_FOREVER;
 #endif
 
-		if (IS_ENABLED(CONFIG_NET_IP)) {
-			(void)memset(&contexts[i].remote, 0, sizeof(struct sockaddr));
-			(void)memset(&contexts[i].local, 0, sizeof(struct sockaddr_ptr));
+	if (IS_ENABLED(CONFIG_NET_IP)) {
+		(void)memset(&contexts[i].remote, 0, sizeof(struct sockaddr));
+		(void)memset(&contexts[i].local, 0, sizeof(struct sockaddr_ptr));
 
-			if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
-				struct sockaddr_in6 *addr6 =
-					(struct sockaddr_in6 *)&contexts[i].local;
-				addr6->sin6_port =
-					find_available_port(&contexts[i], (struct sockaddr *)addr6);
+		if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+			struct sockaddr_in6 *addr6 =
+				(struct sockaddr_in6 *)&contexts[i].local;
+			addr6->sin6_port =
+				find_available_port(&contexts[i], (struct sockaddr *)addr6);
 
-				if (!addr6->sin6_port) {
-					ret = -EADDRINUSE;
-					break;
-				}
+			if (!addr6->sin6_port) {
+				ret = -EADDRINUSE;
+				goto put_back;
 			}
-			if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
-				struct sockaddr_in *addr = (struct sockaddr_in *)&contexts[i].local;
+		}
+		if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+			struct sockaddr_in *addr = (struct sockaddr_in *)&contexts[i].local;
 
-				addr->sin_port =
-					find_available_port(&contexts[i], (struct sockaddr *)addr);
+			addr->sin_port =
+				find_available_port(&contexts[i], (struct sockaddr *)addr);
 
-				if (!addr->sin_port) {
-					ret = -EADDRINUSE;
-					break;
-				}
+			if (!addr->sin_port) {
+				ret = -EADDRINUSE;
+				goto put_back;
 			}
 		}
+	}
 
-		if (IS_ENABLED(CONFIG_NET_CONTEXT_SYNC_RECV)) {
-			k_sem_init(&contexts[i].recv_data_wait, 1, K_SEM_MAX_LIMIT);
-		}
+	if (IS_ENABLED(CONFIG_NET_CONTEXT_SYNC_RECV)) {
+		k_sem_init(&contexts[i].recv_data_wait, 1, K_SEM_MAX_LIMIT);
+	}
+
+	k_mutex_init(&contexts[i].lock);
+#if defined(CONFIG_NET_CONTEXT_RECV_LOCK)
+	k_mutex_init(&contexts[i].recv_lock);
+#endif
 
-		k_mutex_init(&contexts[i].lock);
+	contexts[i].flags |= NET_CONTEXT_IN_USE;
+	*context = &contexts[i];
 
-		contexts[i].flags |= NET_CONTEXT_IN_USE;
-		*context = &contexts[i];
+	ret = 0;
+	goto give;
 
-		ret = 0;
-		break;
-	}
+put_back:
+	context_mark_free(i);
 
+give:
 	k_sem_give(&contexts_lock);
 
 	if (ret < 0) {
@@ -333,7 +433,7 @@ int net_context_get(sa_family_t family, enum net_sock_type type, uint16_t proto,
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) && net_if_is_ip_offloaded(net_if_get_default())) {
 		ret = net_offload_get(net_if_get_default(), family, type, proto, context);
 		if (ret < 0) {
-			(*context)->flags &= ~NET_CONTEXT_IN_USE;
+			context_release(*context);
 			*context = NULL;
 			return ret;
 		}
@@ -357,7 +457,7 @@ int net_context_unref(struct net_context *context)
 		return old_rc - 1;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	net_tcp_unref(context);
 
@@ -373,11 +473,11 @@ int net_context_unref(struct net_context *context)
 
 	net_context_set_state(context, NET_CONTEXT_UNCONNECTED);
 
-	context->flags &= ~NET_CONTEXT_IN_USE;
+	context_release(context);
 
 	NET_DBG("Context %p released", context);
 
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return 0;
 }
@@ -392,11 +492,11 @@ int net_context_put(struct net_context *context)
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
-		context->flags &= ~NET_CONTEXT_IN_USE;
+		context_release(context);
 		ret = net_offload_put(net_context_get_iface(context), context);
 		goto unlock;
 	}
@@ -412,7 +512,7 @@ int net_context_put(struct net_context *context)
 	net_context_unref(context);
 
 unlock:
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return ret;
 }
@@ -582,7 +682,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 						addrlen);
 		}
 
-		k_mutex_lock(&context->lock, K_FOREVER);
+		context_state_lock(context);
 
 		ret = 0;
 
@@ -615,7 +715,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 			net_if_get_by_iface(iface), iface);
 
 	unlock_ipv6:
-		k_mutex_unlock(&context->lock);
+		context_state_unlock(context);
 
 		return ret;
 	}
@@ -680,7 +780,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 						addrlen);
 		}
 
-		k_mutex_lock(&context->lock, K_FOREVER);
+		context_state_lock(context);
 
 		ret = 0;
 
@@ -713,7 +813,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 			net_if_get_by_iface(iface), iface);
 
 	unlock_ipv4:
-		k_mutex_unlock(&context->lock);
+		context_state_unlock(context);
 
 		return ret;
 	}
@@ -748,7 +848,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 						addrlen);
 		}
 
-		k_mutex_lock(&context->lock, K_FOREVER);
+		context_state_lock(context);
 
 		net_context_set_iface(context, iface);
 
@@ -769,7 +869,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 				net_sll_ptr(&context->local)->sll_addr,
 				net_sll_ptr(&context->local)->sll_halen));
 
-		k_mutex_unlock(&context->lock);
+		context_state_unlock(context);
 
 		return 0;
 	}
@@ -803,7 +903,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 						addrlen);
 		}
 
-		k_mutex_lock(&context->lock, K_FOREVER);
+		context_state_lock(context);
 
 		net_context_set_iface(context, iface);
 		net_context_set_family(context, AF_CAN);
@@ -816,7 +916,7 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 			context, net_context_get_proto(context),
 			can_addr->can_ifindex, iface);
 
-		k_mutex_unlock(&context->lock);
+		context_state_unlock(context);
 
 		return 0;
 	}
@@ -857,14 +957,14 @@ int net_context_listen(struct net_context *context, int backlog)
 					  context, backlog);
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	if (net_tcp_listen(context) >= 0) {
-		k_mutex_unlock(&context->lock);
+		context_state_unlock(context);
 		return 0;
 	}
 
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return -EOPNOTSUPP;
 }
@@ -948,7 +1048,7 @@ int net_context_connect(struct net_context *context,
 	NET_ASSERT(addr);
 	NET_ASSERT(PART_OF_ARRAY(contexts, context));
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	if (!net_context_is_used(context)) {
 		ret = -EBADF;
@@ -1103,7 +1203,7 @@ int net_context_connect(struct net_context *context,
 	}
 
 unlock:
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return ret;
 }
@@ -1121,7 +1221,7 @@ int net_context_accept(struct net_context *context,
 		return -EBADF;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
@@ -1149,7 +1249,7 @@ int net_context_accept(struct net_context *context,
 	}
 
 unlock:
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return ret;
 }
@@ -1211,6 +1311,22 @@ static int get_context_txtime(struct net_context *context,
 #endif
 }
 
+static int get_context_busy_poll(struct net_context *context,
+				 void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_BUSY_POLL)
+	*((uint32_t *)value) = context->options.busy_poll;
+
+	if (len) {
+		*len = sizeof(uint32_t);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int get_context_rcvtimeo(struct net_context *context,
 				void *value, size_t *len)
 {
@@ -1321,6 +1437,65 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 	return ret;
 }
 
+#if defined(CONFIG_NET_CONTEXT_TX_ZEROCOPY)
+struct tx_zc_meta {
+	struct net_context *context;
+	void *base;
+	size_t len;
+};
+
+static void tx_zc_buf_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(tx_zc_bufs, CONFIG_NET_CONTEXT_TX_ZEROCOPY_BUF_COUNT,
+			  0, sizeof(struct tx_zc_meta), tx_zc_buf_destroy);
+
+static void tx_zc_buf_destroy(struct net_buf *buf)
+{
+	struct tx_zc_meta *meta = (struct tx_zc_meta *)net_buf_user_data(buf);
+	struct net_context *context = meta->context;
+
+	if (context->tx_zc_cb) {
+		context->tx_zc_cb(context, meta->base, meta->len,
+				  context->tx_zc_user_data);
+	}
+
+	net_buf_destroy(buf);
+}
+
+static int context_attach_zc_data(struct net_context *context,
+				  struct net_pkt *pkt,
+				  const struct msghdr *msghdr)
+{
+	int i;
+
+	for (i = 0; i < msghdr->msg_iovlen; i++) {
+		struct tx_zc_meta *meta;
+		struct net_buf *buf;
+
+		if (msghdr->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		buf = net_buf_alloc_with_data(&tx_zc_bufs,
+					      msghdr->msg_iov[i].iov_base,
+					      msghdr->msg_iov[i].iov_len,
+					      PKT_WAIT_TIME);
+		if (!buf) {
+			return -ENOBUFS;
+		}
+
+		meta = (struct tx_zc_meta *)net_buf_user_data(buf);
+		meta->context = context;
+		meta->base = msghdr->msg_iov[i].iov_base;
+		meta->len = msghdr->msg_iov[i].iov_len;
+
+		net_pkt_append_buffer(pkt, buf);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_CONTEXT_TX_ZEROCOPY */
+
 static int context_setup_udp_packet(struct net_context *context,
 				    struct net_pkt *pkt,
 				    const void *buf,
@@ -1455,12 +1630,14 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  int flags)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface;
 	struct net_pkt *pkt;
 	size_t tmp_len;
+	bool tx_zc = false;
 	int ret;
 
 	NET_ASSERT(PART_OF_ARRAY(contexts, context));
@@ -1668,7 +1845,35 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
-	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	if (IS_ENABLED(CONFIG_NET_CONTEXT_TX_ZEROCOPY) &&
+	    msghdr != NULL && (flags & ZSOCK_MSG_ZEROCOPY) != 0) {
+		/* Only the native TCP transmit path can pin application
+		 * buffers until the peer has acknowledged the data.
+		 */
+		if (!(IS_ENABLED(CONFIG_NET_TCP) &&
+		      net_context_get_proto(context) == IPPROTO_TCP) ||
+		    (IS_ENABLED(CONFIG_NET_OFFLOAD) && iface != NULL &&
+		     net_if_is_ip_offloaded(iface))) {
+			return -EOPNOTSUPP;
+		}
+
+		tx_zc = true;
+	}
+
+	if (tx_zc) {
+		/* The carrier packet gets no buffer of its own, the
+		 * application buffers are attached to it as they are.
+		 */
+		pkt = net_pkt_alloc_on_iface(iface, PKT_WAIT_TIME);
+		if (pkt) {
+			net_pkt_set_family(pkt,
+					   net_context_get_family(context));
+			net_pkt_set_context(pkt, context);
+		}
+	} else {
+		pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	}
+
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -1676,7 +1881,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (!tx_zc && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
 				tmp_len, len);
@@ -1741,7 +1946,15 @@ static int context_sendto(struct net_context *context,
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
+#if defined(CONFIG_NET_CONTEXT_TX_ZEROCOPY)
+		if (tx_zc) {
+			ret = context_attach_zc_data(context, pkt, msghdr);
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr);
+		}
+#else
 		ret = context_write_data(pkt, buf, len, msghdr);
+#endif
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1847,7 +2060,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, 0);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -1866,7 +2079,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, flags);
 
 	k_mutex_unlock(&context->lock);
 
@@ -1887,7 +2100,7 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, 0);
 
 	k_mutex_unlock(&context->lock);
 
@@ -1906,7 +2119,7 @@ enum net_verdict net_context_packet_received(struct net_conn *conn,
 	NET_ASSERT(context);
 	NET_ASSERT(net_pkt_iface(pkt));
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_recv_lock(context);
 
 	net_context_set_iface(context, net_pkt_iface(pkt));
 	net_pkt_set_context(pkt, context);
@@ -1927,7 +2140,7 @@ enum net_verdict net_context_packet_received(struct net_conn *conn,
 	k_sem_give(&context->recv_data_wait);
 #endif /* CONFIG_NET_CONTEXT_SYNC_RECV */
 
-	k_mutex_unlock(&context->lock);
+	context_recv_unlock(context);
 
 	context->recv_cb(context, pkt, ip_hdr, proto_hdr, 0, user_data);
 
@@ -1936,7 +2149,7 @@ enum net_verdict net_context_packet_received(struct net_conn *conn,
 	return verdict;
 
 unlock:
-	k_mutex_unlock(&context->lock);
+	context_recv_unlock(context);
 
 	return verdict;
 }
@@ -2087,7 +2300,7 @@ int net_context_recv(struct net_context *context,
 		return -EBADF;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_recv_lock(context);
 
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
@@ -2157,11 +2370,11 @@ int net_context_recv(struct net_context *context,
 		 */
 		k_sem_reset(&context->recv_data_wait);
 
-		k_mutex_unlock(&context->lock);
+		context_recv_unlock(context);
 
 		ret = k_sem_take(&context->recv_data_wait, timeout);
 
-		k_mutex_lock(&context->lock, K_FOREVER);
+		context_recv_lock(context);
 
 		if (ret == -EAGAIN) {
 			ret = -ETIMEDOUT;
@@ -2171,7 +2384,7 @@ int net_context_recv(struct net_context *context,
 #endif /* CONFIG_NET_CONTEXT_SYNC_RECV */
 
 unlock:
-	k_mutex_unlock(&context->lock);
+	context_recv_unlock(context);
 
 	return ret;
 }
@@ -2186,11 +2399,11 @@ int net_context_update_recv_wnd(struct net_context *context,
 		return 0;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_recv_lock(context);
 
 	ret = net_tcp_update_recv_wnd(context, delta);
 
-	k_mutex_unlock(&context->lock);
+	context_recv_unlock(context);
 
 	return ret;
 }
@@ -2250,6 +2463,22 @@ static int set_context_proxy(struct net_context *context,
 #endif
 }
 
+static int set_context_busy_poll(struct net_context *context,
+				 const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_BUSY_POLL)
+	if (len != sizeof(uint32_t)) {
+		return -EINVAL;
+	}
+
+	context->options.busy_poll = *((uint32_t *)value);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_rcvtimeo(struct net_context *context,
 				const void *value, size_t len)
 {
@@ -2359,7 +2588,7 @@ int net_context_set_option(struct net_context *context,
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	switch (option) {
 	case NET_OPT_PRIORITY:
@@ -2386,9 +2615,12 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_DSCP_ECN:
 		ret = set_context_dscp_ecn(context, value, len);
 		break;
+	case NET_OPT_BUSY_POLL:
+		ret = set_context_busy_poll(context, value, len);
+		break;
 	}
 
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return ret;
 }
@@ -2405,7 +2637,7 @@ int net_context_get_option(struct net_context *context,
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&context->lock, K_FOREVER);
+	context_state_lock(context);
 
 	switch (option) {
 	case NET_OPT_PRIORITY:
@@ -2432,9 +2664,12 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_DSCP_ECN:
 		ret = get_context_dscp_ecn(context, value, len);
 		break;
+	case NET_OPT_BUSY_POLL:
+		ret = get_context_busy_poll(context, value, len);
+		break;
 	}
 
-	k_mutex_unlock(&context->lock);
+	context_state_unlock(context);
 
 	return ret;
 }
@@ -2450,11 +2685,11 @@ void net_context_foreach(net_context_cb_t cb, void *user_data)
 			continue;
 		}
 
-		k_mutex_lock(&contexts[i].lock, K_FOREVER);
+		context_state_lock(&contexts[i]);
 
 		cb(&contexts[i], user_data);
 
-		k_mutex_unlock(&contexts[i].lock);
+		context_state_unlock(&contexts[i]);
 	}
 
 	k_sem_give(&contexts_lock);
@@ -2478,5 +2713,14 @@ const char *net_context_state(struct net_context *context)
 
 void net_context_init(void)
 {
+	int i;
+
 	k_sem_init(&contexts_lock, 1, K_SEM_MAX_LIMIT);
+
+	/* Seed the free list in reverse so that contexts are handed out
+	 * in table order.
+	 */
+	for (i = NET_MAX_CONTEXT - 1; i >= 0; i--) {
+		context_mark_free(i);
+	}
 }
@@ -389,6 +389,14 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 	uint8_t prio = net_pkt_priority(pkt);
 	uint8_t tc = net_rx_priority2tc(prio);
 
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+	int flow_tc = net_rx_flow2tc(pkt);
+
+	if (flow_tc >= 0) {
+		tc = (uint8_t)flow_tc;
+	}
+#endif
+
 #if defined(CONFIG_NET_STATISTICS)
 	net_stats_update_tc_recv_pkt(iface, tc);
 	net_stats_update_tc_recv_bytes(iface, tc, net_pkt_get_len(pkt));
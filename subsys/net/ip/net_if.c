@@ -335,6 +335,106 @@ void net_process_tx_packet(struct net_pkt *pkt)
 #endif
 }
 
+#if defined(CONFIG_NET_TC_TX_BATCH)
+static bool net_if_tx_batch(struct net_if *iface, struct net_pkt **pkts,
+			    int count)
+{
+	struct net_context *contexts[CONFIG_NET_TC_TX_BATCH_SIZE];
+	int status[CONFIG_NET_TC_TX_BATCH_SIZE];
+	int i;
+
+	/* The batch path does not track per packet TX times or link
+	 * layer destination addresses, so serve those configurations
+	 * one packet at a time.
+	 */
+	if (IS_ENABLED(CONFIG_NET_PKT_TXTIME_STATS) ||
+	    !sys_slist_is_empty(&link_callbacks)) {
+		return false;
+	}
+
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    !net_if_flag_is_set(iface, NET_IF_LOWER_UP)) {
+		return false;
+	}
+
+	/* The packet is gone once the driver has accepted it, so collect
+	 * everything needed for the completion handling beforehand.
+	 */
+	for (i = 0; i < count; i++) {
+		debug_check_packet(pkts[i]);
+
+		contexts[i] = net_pkt_context(pkts[i]);
+
+		if (IS_ENABLED(CONFIG_NET_TCP) &&
+		    net_pkt_family(pkts[i]) != AF_UNSPEC) {
+			net_pkt_set_queued(pkts[i], false);
+		}
+	}
+
+	if (net_eth_send_batch(iface, pkts, status, count) < 0) {
+		return false;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (status[i] < 0) {
+			net_pkt_unref(pkts[i]);
+		} else {
+			net_stats_update_bytes_sent(iface, status[i]);
+		}
+
+		if (contexts[i]) {
+			NET_DBG("Calling context send cb %p status %d",
+				contexts[i], status[i]);
+
+			net_context_send_cb(contexts[i], status[i]);
+		}
+	}
+
+	return true;
+}
+
+void net_process_tx_packets(struct net_pkt **pkts, int count)
+{
+	int i = 0;
+
+	while (i < count) {
+		struct net_if *iface = net_pkt_iface(pkts[i]);
+		int n = 1;
+
+		/* Collect the longest run of consecutive packets going
+		 * out through the same interface.
+		 */
+		if (!net_pkt_is_l2_bridged(pkts[i])) {
+			while (i + n < count &&
+			       net_pkt_iface(pkts[i + n]) == iface &&
+			       !net_pkt_is_l2_bridged(pkts[i + n])) {
+				n++;
+			}
+		}
+
+		for (int j = 0; j < n; j++) {
+			net_pkt_set_tx_stats_tick(pkts[i + j],
+						  k_cycle_get_32());
+		}
+
+		if (n > 1 && net_if_tx_batch(iface, &pkts[i], n)) {
+#if defined(CONFIG_NET_POWER_MANAGEMENT)
+			iface->tx_pending -= n;
+#endif
+		} else {
+			for (int j = 0; j < n; j++) {
+				net_if_tx(iface, pkts[i + j]);
+#if defined(CONFIG_NET_POWER_MANAGEMENT)
+				iface->tx_pending--;
+#endif
+			}
+		}
+
+		i += n;
+	}
+}
+#endif /* CONFIG_NET_TC_TX_BATCH */
+
 void net_if_queue_tx(struct net_if *iface, struct net_pkt *pkt)
 {
 	if (!net_pkt_filter_send_ok(pkt)) {
@@ -3983,30 +4083,81 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 	k_mutex_unlock(&lock);
 }
 
-static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps)
+static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
+			       enum net_if_checksum_type chksum_type)
 {
 #if defined(CONFIG_NET_L2_ETHERNET)
+	const struct device *dev;
+	const struct ethernet_api *api;
+	struct ethernet_config config;
+	enum ethernet_config_type config_type;
+
 	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
 		return true;
 	}
 
-	return !(net_eth_get_hw_capabilities(iface) & caps);
+	if (!(net_eth_get_hw_capabilities(iface) & caps)) {
+		return true;
+	}
+
+	if (caps == ETHERNET_HW_TX_CHKSUM_OFFLOAD) {
+		config_type = ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT;
+	} else {
+		config_type = ETHERNET_CONFIG_TYPE_RX_CHECKSUM_SUPPORT;
+	}
+
+	dev = net_if_get_device(iface);
+	api = dev->api;
+
+	if (api->get_config == NULL ||
+	    api->get_config(dev, config_type, &config) != 0) {
+		/* The driver does not report the supported checksums in
+		 * detail: the coarse capability is taken to cover all of
+		 * them.
+		 */
+		return false;
+	}
+
+	switch (chksum_type) {
+	case NET_IF_CHECKSUM_IPV4_HEADER:
+		return !(config.chksum_support &
+			 ETHERNET_CHECKSUM_SUPPORT_IPV4_HEADER);
+	case NET_IF_CHECKSUM_IPV4_ICMP:
+		return !(config.chksum_support &
+			 ETHERNET_CHECKSUM_SUPPORT_IPV4_ICMP);
+	case NET_IF_CHECKSUM_IPV6_ICMP:
+		return !(config.chksum_support &
+			 ETHERNET_CHECKSUM_SUPPORT_IPV6_ICMP);
+	case NET_IF_CHECKSUM_TCP:
+		return !(config.chksum_support &
+			 ETHERNET_CHECKSUM_SUPPORT_TCP);
+	case NET_IF_CHECKSUM_UDP:
+		return !(config.chksum_support &
+			 ETHERNET_CHECKSUM_SUPPORT_UDP);
+	}
+
+	return true;
 #else
 	ARG_UNUSED(iface);
 	ARG_UNUSED(caps);
+	ARG_UNUSED(chksum_type);
 
 	return true;
 #endif
 }
 
-bool net_if_need_calc_tx_checksum(struct net_if *iface)
+bool net_if_need_calc_tx_checksum(struct net_if *iface,
+				  enum net_if_checksum_type chksum_type)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_TX_CHKSUM_OFFLOAD);
+	return need_calc_checksum(iface, ETHERNET_HW_TX_CHKSUM_OFFLOAD,
+				  chksum_type);
 }
 
-bool net_if_need_calc_rx_checksum(struct net_if *iface)
+bool net_if_need_calc_rx_checksum(struct net_if *iface,
+				  enum net_if_checksum_type chksum_type)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD);
+	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD,
+				  chksum_type);
 }
 
 int net_if_get_by_iface(struct net_if *iface)
@@ -4484,6 +4635,18 @@ void net_if_call_timestamp_cb(struct net_pkt *pkt)
 
 void net_if_add_tx_timestamp(struct net_pkt *pkt)
 {
+#if defined(CONFIG_NET_PKT_TIMESTAMP_DIRECT)
+	/* Call the callbacks in the context of the driver when possible
+	 * so that the timestamp does not wait for the timestamp thread
+	 * to be scheduled. The queue is still used when the driver
+	 * reports the timestamp from an interrupt handler.
+	 */
+	if (!k_is_in_isr()) {
+		net_if_call_timestamp_cb(pkt);
+		return;
+	}
+#endif
+
 	k_fifo_put(&tx_ts_queue, pkt);
 }
 #endif /* CONFIG_NET_PKT_TIMESTAMP_THREAD */
@@ -437,6 +437,31 @@ struct net_buf *net_pkt_get_frag(struct net_pkt *pkt, size_t min_len,
 	}
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	struct net_if *iface = net_pkt_iface(pkt);
+
+	if (iface != NULL) {
+		struct net_buf_pool *pool = NULL;
+
+		if (iface->tx_slab && pkt->slab == iface->tx_slab()) {
+			pool = iface->tx_pool ? iface->tx_pool() : NULL;
+		} else if (iface->rx_slab && pkt->slab == iface->rx_slab()) {
+			pool = iface->rx_pool ? iface->rx_pool() : NULL;
+		}
+
+		if (pool != NULL) {
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+			return net_pkt_get_reserve_data_debug(pool, min_len,
+							      timeout,
+							      caller, line);
+#else
+			return net_pkt_get_reserve_data(pool, min_len,
+							timeout);
+#endif /* NET_LOG_LEVEL >= LOG_LEVEL_DBG */
+		}
+	}
+#endif /* CONFIG_NET_IFACE_NET_PKT_POOL */
+
 	if (pkt->slab == &rx_pkts) {
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 		return net_pkt_get_reserve_rx_data_debug(min_len, timeout,
@@ -504,6 +529,54 @@ static inline struct net_buf_pool *get_data_pool(struct net_context *context)
 #define get_data_pool(...) NULL
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 
+static inline struct k_mem_slab *get_iface_tx_slab(struct net_if *iface)
+{
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	if (iface && iface->tx_slab) {
+		return iface->tx_slab();
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+	return NULL;
+}
+
+static inline struct k_mem_slab *get_iface_rx_slab(struct net_if *iface)
+{
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	if (iface && iface->rx_slab) {
+		return iface->rx_slab();
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+	return NULL;
+}
+
+static inline struct net_buf_pool *get_iface_tx_pool(struct net_if *iface)
+{
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	if (iface && iface->tx_pool) {
+		return iface->tx_pool();
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+	return NULL;
+}
+
+static inline struct net_buf_pool *get_iface_rx_pool(struct net_if *iface)
+{
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	if (iface && iface->rx_pool) {
+		return iface->rx_pool();
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+	return NULL;
+}
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 void net_pkt_unref_debug(struct net_pkt *pkt, const char *caller, int line)
 {
@@ -1182,6 +1255,16 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 		pool = get_data_pool(pkt->context);
 	}
 
+	if (!pool) {
+		struct net_if *iface = net_pkt_iface(pkt);
+
+		if (pkt->slab == get_iface_tx_slab(iface)) {
+			pool = get_iface_tx_pool(iface);
+		} else if (pkt->slab == get_iface_rx_slab(iface)) {
+			pool = get_iface_rx_pool(iface);
+		}
+	}
+
 	if (!pool) {
 		pool = pkt->slab == &tx_pkts ? &tx_bufs : &rx_bufs;
 	}
@@ -1348,16 +1431,33 @@ static struct net_pkt *pkt_alloc_on_iface(struct k_mem_slab *slab,
 
 #endif
 {
+	struct k_mem_slab *iface_slab = NULL;
 	struct net_pkt *pkt;
 
+	if (slab == &tx_pkts) {
+		iface_slab = get_iface_tx_slab(iface);
+	} else if (slab == &rx_pkts) {
+		iface_slab = get_iface_rx_slab(iface);
+	}
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
-	pkt = pkt_alloc(slab, timeout, caller, line);
+	pkt = pkt_alloc(iface_slab != NULL ? iface_slab : slab, timeout,
+			caller, line);
 #else
-	pkt = pkt_alloc(slab, timeout);
+	pkt = pkt_alloc(iface_slab != NULL ? iface_slab : slab, timeout);
 #endif
 
 	if (pkt) {
 		net_pkt_set_iface(pkt, iface);
+
+		if (iface_slab != NULL) {
+			/* pkt_alloc() only applies the TX/RX default
+			 * priorities when allocating from the global slabs.
+			 */
+			net_pkt_set_priority(pkt, slab == &tx_pkts ?
+					     TX_DEFAULT_PRIORITY :
+					     RX_DEFAULT_PRIORITY);
+		}
 	}
 
 	return pkt;
@@ -49,6 +49,9 @@ extern void net_if_stats_reset(struct net_if *iface);
 extern void net_if_stats_reset_all(void);
 extern void net_process_rx_packet(struct net_pkt *pkt);
 extern void net_process_tx_packet(struct net_pkt *pkt);
+#if defined(CONFIG_NET_TC_TX_BATCH)
+extern void net_process_tx_packets(struct net_pkt **pkts, int count);
+#endif
 
 #if defined(CONFIG_NET_NATIVE) || defined(CONFIG_NET_OFFLOAD)
 extern void net_context_init(void);
@@ -90,6 +93,9 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+extern int net_rx_flow2tc(struct net_pkt *pkt);
+#endif
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
 char *net_sprint_addr(sa_family_t af, const void *addr);
@@ -1190,6 +1190,8 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	struct net_shell_user_data *data = user_data;
 	const struct shell *sh = data->sh;
 
+	net_stats_aggregate();
+
 	if (iface) {
 		const char *extra;
 
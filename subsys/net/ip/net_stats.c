@@ -29,6 +29,196 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+/* Per-CPU copies of the global statistics. The hot path only ever
+ * writes the copy of the executing CPU, the copies are summed into
+ * net_stats by net_stats_aggregate() when the statistics are read.
+ */
+struct net_stats_cpu net_stats_per_cpu[CONFIG_MP_MAX_NUM_CPUS];
+
+static void stats_add_ip(struct net_stats_ip *dst,
+			 const struct net_stats_ip *src)
+{
+	dst->recv += src->recv;
+	dst->sent += src->sent;
+	dst->forwarded += src->forwarded;
+	dst->drop += src->drop;
+}
+
+static void stats_add_tx_time(struct net_stats_tx_time *dst,
+			      const struct net_stats_tx_time *src)
+{
+	dst->sum += src->sum;
+	dst->count += src->count;
+}
+
+static void stats_add_rx_time(struct net_stats_rx_time *dst,
+			      const struct net_stats_rx_time *src)
+{
+	dst->sum += src->sum;
+	dst->count += src->count;
+}
+
+static void stats_add(struct net_stats *dst, const struct net_stats *src)
+{
+	int i;
+
+	ARG_UNUSED(i);
+
+	dst->processing_error += src->processing_error;
+
+	dst->bytes.sent += src->bytes.sent;
+	dst->bytes.received += src->bytes.received;
+
+	dst->ip_errors.vhlerr += src->ip_errors.vhlerr;
+	dst->ip_errors.hblenerr += src->ip_errors.hblenerr;
+	dst->ip_errors.lblenerr += src->ip_errors.lblenerr;
+	dst->ip_errors.fragerr += src->ip_errors.fragerr;
+	dst->ip_errors.chkerr += src->ip_errors.chkerr;
+	dst->ip_errors.protoerr += src->ip_errors.protoerr;
+
+#if defined(CONFIG_NET_STATISTICS_IPV6)
+	stats_add_ip(&dst->ipv6, &src->ipv6);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV4)
+	stats_add_ip(&dst->ipv4, &src->ipv4);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_ICMP)
+	dst->icmp.recv += src->icmp.recv;
+	dst->icmp.sent += src->icmp.sent;
+	dst->icmp.drop += src->icmp.drop;
+	dst->icmp.typeerr += src->icmp.typeerr;
+	dst->icmp.chkerr += src->icmp.chkerr;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_TCP)
+	dst->tcp.bytes.sent += src->tcp.bytes.sent;
+	dst->tcp.bytes.received += src->tcp.bytes.received;
+	dst->tcp.resent += src->tcp.resent;
+	dst->tcp.drop += src->tcp.drop;
+	dst->tcp.recv += src->tcp.recv;
+	dst->tcp.sent += src->tcp.sent;
+	dst->tcp.seg_drop += src->tcp.seg_drop;
+	dst->tcp.chkerr += src->tcp.chkerr;
+	dst->tcp.ackerr += src->tcp.ackerr;
+	dst->tcp.rsterr += src->tcp.rsterr;
+	dst->tcp.rst += src->tcp.rst;
+	dst->tcp.rexmit += src->tcp.rexmit;
+	dst->tcp.conndrop += src->tcp.conndrop;
+	dst->tcp.connrst += src->tcp.connrst;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_UDP)
+	dst->udp.drop += src->udp.drop;
+	dst->udp.recv += src->udp.recv;
+	dst->udp.sent += src->udp.sent;
+	dst->udp.chkerr += src->udp.chkerr;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_ND)
+	dst->ipv6_nd.drop += src->ipv6_nd.drop;
+	dst->ipv6_nd.recv += src->ipv6_nd.recv;
+	dst->ipv6_nd.sent += src->ipv6_nd.sent;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_MLD)
+	dst->ipv6_mld.recv += src->ipv6_mld.recv;
+	dst->ipv6_mld.sent += src->ipv6_mld.sent;
+	dst->ipv6_mld.drop += src->ipv6_mld.drop;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IGMP)
+	dst->ipv4_igmp.recv += src->ipv4_igmp.recv;
+	dst->ipv4_igmp.sent += src->ipv4_igmp.sent;
+	dst->ipv4_igmp.drop += src->ipv4_igmp.drop;
+#endif
+
+#if NET_TC_COUNT > 1
+	for (i = 0; i < NET_TC_TX_STATS_COUNT; i++) {
+		stats_add_tx_time(&dst->tc.sent[i].tx_time,
+				  &src->tc.sent[i].tx_time);
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+		for (int j = 0; j < NET_PKT_DETAIL_STATS_COUNT; j++) {
+			stats_add_tx_time(&dst->tc.sent[i].tx_time_detail[j],
+					  &src->tc.sent[i].tx_time_detail[j]);
+		}
+#endif
+		dst->tc.sent[i].pkts += src->tc.sent[i].pkts;
+		dst->tc.sent[i].bytes += src->tc.sent[i].bytes;
+
+		/* The priority is not a counter, take it from any CPU
+		 * that has seen traffic in this traffic class.
+		 */
+		if (src->tc.sent[i].pkts) {
+			dst->tc.sent[i].priority = src->tc.sent[i].priority;
+		}
+	}
+
+	for (i = 0; i < NET_TC_RX_STATS_COUNT; i++) {
+		stats_add_rx_time(&dst->tc.recv[i].rx_time,
+				  &src->tc.recv[i].rx_time);
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+		for (int j = 0; j < NET_PKT_DETAIL_STATS_COUNT; j++) {
+			stats_add_rx_time(&dst->tc.recv[i].rx_time_detail[j],
+					  &src->tc.recv[i].rx_time_detail[j]);
+		}
+#endif
+		dst->tc.recv[i].pkts += src->tc.recv[i].pkts;
+		dst->tc.recv[i].bytes += src->tc.recv[i].bytes;
+
+		if (src->tc.recv[i].pkts) {
+			dst->tc.recv[i].priority = src->tc.recv[i].priority;
+		}
+	}
+#endif /* NET_TC_COUNT > 1 */
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS)
+	stats_add_tx_time(&dst->tx_time, &src->tx_time);
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+	stats_add_rx_time(&dst->rx_time, &src->rx_time);
+#endif
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		stats_add_tx_time(&dst->tx_time_detail[i],
+				  &src->tx_time_detail[i]);
+	}
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		stats_add_rx_time(&dst->rx_time_detail[i],
+				  &src->rx_time_detail[i]);
+	}
+#endif
+}
+
+void net_stats_aggregate(void)
+{
+#if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
+	/* The power management statistics update the global copy
+	 * directly, so carry them over to the new snapshot.
+	 */
+	struct net_stats_pm pm = net_stats.pm;
+#endif
+	int cpu;
+
+	memset(&net_stats, 0, sizeof(net_stats));
+
+#if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
+	net_stats.pm = pm;
+#endif
+
+	for (cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		stats_add(&net_stats, &net_stats_per_cpu[cpu].stats);
+	}
+}
+#endif /* CONFIG_NET_STATISTICS_PER_CPU */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
@@ -72,6 +262,8 @@ static inline void stats(struct net_if *iface)
 	int i;
 
 	if (!next_print || (abs(cmp) > PRINT_STATISTICS_INTERVAL)) {
+		net_stats_aggregate();
+
 		if (iface) {
 			NET_INFO("Interface %p [%d]", iface,
 				 net_if_get_by_iface(iface));
@@ -240,6 +432,8 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 	size_t len_chk = 0;
 	void *src = NULL;
 
+	net_stats_aggregate();
+
 	switch (NET_MGMT_GET_COMMAND(mgmt_request)) {
 	case NET_REQUEST_STATS_CMD_GET_ALL:
 		len_chk = sizeof(struct net_stats);
@@ -372,4 +566,8 @@ void net_stats_reset(struct net_if *iface)
 
 	net_if_stats_reset_all();
 	memset(&net_stats, 0, sizeof(net_stats));
+
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+	memset(net_stats_per_cpu, 0, sizeof(net_stats_per_cpu));
+#endif
 }
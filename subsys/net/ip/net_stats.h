@@ -17,6 +17,23 @@
 
 extern struct net_stats net_stats;
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+/* Each CPU updates its own copy of the statistics so that the hot path
+ * does not bounce shared counter cache lines between the CPUs. The
+ * global net_stats variable is just a snapshot that net_stats_aggregate()
+ * refreshes from the per-CPU copies when the statistics are read.
+ */
+struct net_stats_cpu {
+	struct net_stats stats;
+};
+
+extern struct net_stats_cpu net_stats_per_cpu[CONFIG_MP_MAX_NUM_CPUS];
+
+void net_stats_aggregate(void);
+#else
+#define net_stats_aggregate()
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_PER_INTERFACE)
 #define SET_STAT(cmd) (cmd)
 #define GET_STAT(iface, s) (iface ? iface->stats.s : net_stats.s)
@@ -27,10 +44,26 @@ extern struct net_stats net_stats;
 #define GET_STAT_ADDR(iface, s) (&GET_STAT(iface, s))
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+/* The per-CPU update is not atomic against preemption and CPU migration,
+ * but a rarely misaccounted increment is an acceptable price for keeping
+ * the hot path lock free.
+ */
+#define UPDATE_STAT_GLOBAL(cmd) (net_stats_per_cpu[_current_cpu->id].cmd)
+#else
 #define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
+#endif
 #define UPDATE_STAT(_iface, _cmd) \
 	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL(_cmd)); \
 	  SET_STAT(_iface->_cmd); }
+
+/* Like UPDATE_STAT() but always updates the global copy directly. Used
+ * for values like timestamps that cannot be summed over the per-CPU
+ * copies and that are not updated at packet rate.
+ */
+#define UPDATE_STAT_COLD(_iface, _cmd) \
+	{ NET_ASSERT(_iface); (net_##_cmd); \
+	  SET_STAT(_iface->_cmd); }
 /* Core stats */
 
 static inline void net_stats_update_processing_error(struct net_if *iface)
@@ -60,6 +93,7 @@ static inline void net_stats_update_bytes_sent(struct net_if *iface,
 	UPDATE_STAT(iface, stats.bytes.sent += bytes);
 }
 #else
+#define net_stats_aggregate()
 #define net_stats_update_processing_error(iface)
 #define net_stats_update_ip_errors_protoerr(iface)
 #define net_stats_update_ip_errors_vhlerr(iface)
@@ -600,7 +634,7 @@ static inline void net_stats_update_tc_rx_time_detail(struct net_if *iface,
 static inline void net_stats_add_suspend_start_time(struct net_if *iface,
 						    uint32_t time)
 {
-	UPDATE_STAT(iface, stats.pm.start_time = time);
+	UPDATE_STAT_COLD(iface, stats.pm.start_time = time);
 }
 
 static inline void net_stats_add_suspend_end_time(struct net_if *iface,
@@ -609,10 +643,10 @@ static inline void net_stats_add_suspend_end_time(struct net_if *iface,
 	uint32_t diff_time =
 		k_cyc_to_ms_floor32(time - GET_STAT(iface, pm.start_time));
 
-	UPDATE_STAT(iface, stats.pm.start_time = 0);
-	UPDATE_STAT(iface, stats.pm.last_suspend_time = diff_time);
-	UPDATE_STAT(iface, stats.pm.suspend_count++);
-	UPDATE_STAT(iface, stats.pm.overall_suspend_time += diff_time);
+	UPDATE_STAT_COLD(iface, stats.pm.start_time = 0);
+	UPDATE_STAT_COLD(iface, stats.pm.last_suspend_time = diff_time);
+	UPDATE_STAT_COLD(iface, stats.pm.suspend_count++);
+	UPDATE_STAT_COLD(iface, stats.pm.overall_suspend_time += diff_time);
 }
 #else
 #define net_stats_add_suspend_start_time(iface, time)
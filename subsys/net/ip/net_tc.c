@@ -18,6 +18,12 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include "net_stats.h"
 #include "net_tc_mapping.h"
 
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+#include <zephyr/net/ethernet.h>
+
+#include "connection.h"
+#endif
+
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
@@ -253,6 +259,39 @@ static void tc_rx_handler(struct k_fifo *fifo)
 #endif
 
 #if NET_TC_TX_COUNT > 0
+#if defined(CONFIG_NET_TC_TX_BATCH)
+static void tc_tx_handler(struct k_fifo *fifo)
+{
+	struct net_pkt *pkts[CONFIG_NET_TC_TX_BATCH_SIZE];
+	struct net_pkt *pkt;
+	int count;
+
+	while (1) {
+		pkt = k_fifo_get(fifo, K_FOREVER);
+		if (pkt == NULL) {
+			continue;
+		}
+
+		/* Drain whatever has piled up in the queue, up to the
+		 * batch limit, so that the driver can send the packets
+		 * in one go.
+		 */
+		pkts[0] = pkt;
+		count = 1;
+
+		while (count < CONFIG_NET_TC_TX_BATCH_SIZE) {
+			pkt = k_fifo_get(fifo, K_NO_WAIT);
+			if (pkt == NULL) {
+				break;
+			}
+
+			pkts[count++] = pkt;
+		}
+
+		net_process_tx_packets(pkts, count);
+	}
+}
+#else
 static void tc_tx_handler(struct k_fifo *fifo)
 {
 	struct net_pkt *pkt;
@@ -266,8 +305,98 @@ static void tc_tx_handler(struct k_fifo *fifo)
 		net_process_tx_packet(pkt);
 	}
 }
+#endif /* CONFIG_NET_TC_TX_BATCH */
 #endif
 
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+/* Classify a received frame to an RX queue from a hash of its flow
+ * tuple, so that all packets of a flow are processed by the same
+ * (optionally CPU pinned) RX thread and the per-flow state stays
+ * cache-hot on one core. The frame has not been through L2 processing
+ * yet, so a minimal Ethernet/IP parse is done here. Returns the RX
+ * traffic class, or a negative value telling the caller to fall back
+ * to the priority based mapping.
+ */
+int net_rx_flow2tc(struct net_pkt *pkt)
+{
+	struct net_pkt_cursor backup;
+	struct net_eth_hdr eth;
+	uint16_t ports[2] = { 0U, 0U };
+	uint16_t type;
+	uint32_t hash;
+	int tc = -1;
+
+	if (net_if_l2(net_pkt_iface(pkt)) != &NET_L2_GET_NAME(ETHERNET)) {
+		return -1;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_read(pkt, &eth, sizeof(eth)) < 0) {
+		goto out;
+	}
+
+	type = ntohs(eth.type);
+
+	if (IS_ENABLED(CONFIG_NET_VLAN) && type == NET_ETH_PTYPE_VLAN) {
+		uint8_t vlan[4];
+
+		if (net_pkt_read(pkt, vlan, sizeof(vlan)) < 0) {
+			goto out;
+		}
+
+		type = (vlan[2] << 8) | vlan[3];
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && type == NET_ETH_PTYPE_IP) {
+		struct net_ipv4_hdr ip;
+
+		if (net_pkt_read(pkt, &ip, sizeof(ip)) < 0) {
+			goto out;
+		}
+
+		if ((ip.vhl & 0x0F) >= 5U &&
+		    (ip.proto == IPPROTO_TCP || ip.proto == IPPROTO_UDP)) {
+			size_t opts_len = (ip.vhl & 0x0F) * 4U - sizeof(ip);
+
+			if (opts_len == 0U ||
+			    net_pkt_skip(pkt, opts_len) == 0) {
+				(void)net_pkt_read(pkt, ports, sizeof(ports));
+			}
+		}
+
+		hash = net_conn_tuple_hash(AF_INET, ip.proto, ip.src, ip.dst,
+					   sizeof(ip.src),
+					   ports[0], ports[1]);
+		tc = hash % NET_TC_RX_COUNT;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && type == NET_ETH_PTYPE_IPV6) {
+		struct net_ipv6_hdr ip;
+
+		if (net_pkt_read(pkt, &ip, sizeof(ip)) < 0) {
+			goto out;
+		}
+
+		/* Extension headers are not walked; the addresses alone
+		 * still keep the flow on one queue.
+		 */
+		if (ip.nexthdr == IPPROTO_TCP || ip.nexthdr == IPPROTO_UDP) {
+			(void)net_pkt_read(pkt, ports, sizeof(ports));
+		}
+
+		hash = net_conn_tuple_hash(AF_INET6, ip.nexthdr,
+					   ip.src, ip.dst, sizeof(ip.src),
+					   ports[0], ports[1]);
+		tc = hash % NET_TC_RX_COUNT;
+	}
+
+ out:
+	net_pkt_cursor_restore(pkt, &backup);
+
+	return tc;
+}
+#endif /* CONFIG_NET_TC_RX_FLOW_STEERING */
+
 /* Create a fifo for each traffic class we are using. All the network
  * traffic goes through these classes.
  */
@@ -324,6 +453,15 @@ void net_tc_tx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_THREAD_CPU_PIN)
+		/* The thread has not been started yet, so the mask can
+		 * still be modified.
+		 */
+		if (k_thread_cpu_pin(tid, i % CONFIG_MP_NUM_CPUS) < 0) {
+			NET_ERR("Cannot pin TC handler thread %d", i);
+		}
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -382,6 +520,15 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_THREAD_CPU_PIN)
+		/* The thread has not been started yet, so the mask can
+		 * still be modified.
+		 */
+		if (k_thread_cpu_pin(tid, i % CONFIG_MP_NUM_CPUS) < 0) {
+			NET_ERR("Cannot pin TC handler thread %d", i);
+		}
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -106,10 +106,7 @@ static void net_route_entry_remove(struct net_nbr *nbr)
 	NET_DBG("Route %p removed", nbr);
 }
 
-static void net_route_entries_table_clear(struct net_nbr_table *table)
-{
-	NET_DBG("Route table %p cleared", table);
-}
+static void net_route_entries_table_clear(struct net_nbr_table *table);
 
 /*
  * This pool contains routing table entries.
@@ -133,6 +130,299 @@ static inline struct net_route_entry *net_route_data(struct net_nbr *nbr)
 	return (struct net_route_entry *)nbr->data;
 }
 
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+/* Path compressed binary trie for longest prefix matching. Only the first
+ * bit_len bits of the stored prefix are significant in each node. Every
+ * insertion creates at most two nodes (one split node and one leaf) and
+ * the root is allocated separately, so the pool below cannot run out.
+ */
+struct route_trie_node {
+	struct route_trie_node *parent;
+	struct route_trie_node *child[2];
+	struct net_route_entry *route;
+	struct in6_addr prefix;
+	uint8_t bit_len;
+	bool in_use;
+};
+
+static struct route_trie_node route_trie_pool[2 * CONFIG_NET_MAX_ROUTES + 1];
+static struct route_trie_node *route_trie_root;
+
+static inline int trie_get_bit(const uint8_t *addr, uint8_t bit)
+{
+	return (addr[bit >> 3] >> (7 - (bit & 7))) & 1;
+}
+
+static uint8_t trie_common_prefix_len(const uint8_t *a, const uint8_t *b,
+				      uint8_t max_len)
+{
+	uint8_t len = 0U;
+	int i;
+
+	for (i = 0; len < max_len && i < NET_IPV6_ADDR_SIZE; i++) {
+		uint8_t diff = a[i] ^ b[i];
+
+		if (diff == 0U) {
+			len += 8U;
+			continue;
+		}
+
+		while (!(diff & 0x80)) {
+			diff <<= 1;
+			len++;
+		}
+
+		break;
+	}
+
+	return MIN(len, max_len);
+}
+
+static struct route_trie_node *trie_node_alloc(const uint8_t *prefix,
+					       uint8_t bit_len)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(route_trie_pool); i++) {
+		struct route_trie_node *node = &route_trie_pool[i];
+
+		if (node->in_use) {
+			continue;
+		}
+
+		(void)memset(node, 0, sizeof(*node));
+
+		memcpy(node->prefix.s6_addr, prefix, NET_IPV6_ADDR_SIZE);
+		node->bit_len = bit_len;
+		node->in_use = true;
+
+		return node;
+	}
+
+	return NULL;
+}
+
+static inline void trie_node_free(struct route_trie_node *node)
+{
+	node->in_use = false;
+}
+
+static int trie_insert(struct net_route_entry *route)
+{
+	struct route_trie_node *node = route_trie_root;
+	const uint8_t *addr = route->addr.s6_addr;
+	uint8_t len = route->prefix_len;
+
+	while (true) {
+		uint8_t common = trie_common_prefix_len(
+			addr, node->prefix.s6_addr, MIN(len, node->bit_len));
+		struct route_trie_node **slot, *split, *leaf;
+
+		if (common == node->bit_len) {
+			if (node->bit_len == len) {
+				/* A route with the same prefix on another
+				 * interface may already sit here. The new
+				 * one wins and the shadowed route is
+				 * promoted back when this one is deleted.
+				 */
+				node->route = route;
+				return 0;
+			}
+
+			slot = &node->child[trie_get_bit(addr, node->bit_len)];
+			if (*slot == NULL) {
+				leaf = trie_node_alloc(addr, len);
+				if (leaf == NULL) {
+					return -ENOMEM;
+				}
+
+				leaf->parent = node;
+				leaf->route = route;
+				*slot = leaf;
+				return 0;
+			}
+
+			node = *slot;
+			continue;
+		}
+
+		/* The prefixes diverge inside this node, so split it at
+		 * the common prefix length. The root has zero length so
+		 * it is never split.
+		 */
+		split = trie_node_alloc(node->prefix.s6_addr, common);
+		if (split == NULL) {
+			return -ENOMEM;
+		}
+
+		split->parent = node->parent;
+		if (node->parent->child[0] == node) {
+			node->parent->child[0] = split;
+		} else {
+			node->parent->child[1] = split;
+		}
+
+		split->child[trie_get_bit(node->prefix.s6_addr, common)] = node;
+		node->parent = split;
+
+		if (common == len) {
+			split->route = route;
+			return 0;
+		}
+
+		leaf = trie_node_alloc(addr, len);
+		if (leaf == NULL) {
+			/* Undo the split */
+			if (split->parent->child[0] == split) {
+				split->parent->child[0] = node;
+			} else {
+				split->parent->child[1] = node;
+			}
+
+			node->parent = split->parent;
+			trie_node_free(split);
+
+			return -ENOMEM;
+		}
+
+		leaf->parent = split;
+		leaf->route = route;
+		split->child[trie_get_bit(addr, common)] = leaf;
+
+		return 0;
+	}
+}
+
+static struct route_trie_node *trie_find_exact(const uint8_t *addr,
+					       uint8_t len)
+{
+	struct route_trie_node *node = route_trie_root;
+
+	while (node && node->bit_len < len) {
+		node = node->child[trie_get_bit(addr, node->bit_len)];
+	}
+
+	if (!node || node->bit_len != len ||
+	    trie_common_prefix_len(addr, node->prefix.s6_addr, len) != len) {
+		return NULL;
+	}
+
+	return node;
+}
+
+/* Remove nodes that carry neither a route nor a branch, and splice out
+ * single child nodes that no longer carry a route.
+ */
+static void trie_prune(struct route_trie_node *node)
+{
+	while (node != route_trie_root && !node->route) {
+		struct route_trie_node *parent = node->parent;
+		struct route_trie_node *child;
+
+		if (node->child[0] && node->child[1]) {
+			break;
+		}
+
+		child = node->child[0] ? node->child[0] : node->child[1];
+
+		if (parent->child[0] == node) {
+			parent->child[0] = child;
+		} else {
+			parent->child[1] = child;
+		}
+
+		if (child) {
+			child->parent = parent;
+		}
+
+		trie_node_free(node);
+		node = parent;
+	}
+}
+
+static void trie_remove(struct net_route_entry *route)
+{
+	struct route_trie_node *node;
+	int i;
+
+	node = trie_find_exact(route->addr.s6_addr, route->prefix_len);
+	if (!node || node->route != route) {
+		/* This route was shadowed by another route with the same
+		 * prefix, so there is nothing to fix in the trie.
+		 */
+		return;
+	}
+
+	node->route = NULL;
+
+	/* Promote a remaining route with the same prefix, if any. */
+	for (i = 0; i < CONFIG_NET_MAX_ROUTES; i++) {
+		struct net_nbr *nbr = get_nbr(i);
+		struct net_route_entry *other;
+
+		if (!nbr->ref) {
+			continue;
+		}
+
+		other = net_route_data(nbr);
+		if (other != route &&
+		    other->prefix_len == route->prefix_len &&
+		    net_ipv6_is_prefix(other->addr.s6_addr,
+				       route->addr.s6_addr,
+				       route->prefix_len)) {
+			node->route = other;
+			return;
+		}
+	}
+
+	trie_prune(node);
+}
+
+static struct net_route_entry *trie_lookup(const uint8_t *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *best = NULL;
+
+	while (node) {
+		if (trie_common_prefix_len(dst, node->prefix.s6_addr,
+					   node->bit_len) != node->bit_len) {
+			break;
+		}
+
+		if (node->route) {
+			best = node->route;
+		}
+
+		if (node->bit_len >= 128) {
+			break;
+		}
+
+		node = node->child[trie_get_bit(dst, node->bit_len)];
+	}
+
+	return best;
+}
+
+static void trie_clear(void)
+{
+	(void)memset(route_trie_pool, 0, sizeof(route_trie_pool));
+
+	route_trie_root = trie_node_alloc(
+		net_ipv6_unspecified_address()->s6_addr, 0);
+}
+#else
+#define trie_insert(...) 0
+#define trie_remove(...)
+#define trie_clear(...)
+#endif /* CONFIG_NET_ROUTE_LPM_TRIE */
+
+static void net_route_entries_table_clear(struct net_nbr_table *table)
+{
+	NET_DBG("Route table %p cleared", table);
+
+	trie_clear();
+}
+
 struct net_nbr *net_route_get_nbr(struct net_route_entry *route)
 {
 	int i;
@@ -283,6 +573,26 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 	uint8_t longest_match = 0U;
 	int i;
 
+#if defined(CONFIG_NET_ROUTE_LPM_TRIE)
+	/* The trie keeps one route per prefix, so it can only serve
+	 * interface agnostic lookups. This covers the forwarding path
+	 * which always passes a NULL interface.
+	 */
+	if (iface == NULL) {
+		k_mutex_lock(&lock, K_FOREVER);
+
+		found = trie_lookup(dst->s6_addr);
+		if (found) {
+			net_route_info("Found", found, dst);
+
+			update_route_access(found);
+		}
+
+		k_mutex_unlock(&lock);
+		return found;
+	}
+#endif
+
 	k_mutex_lock(&lock, K_FOREVER);
 
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
@@ -455,6 +765,11 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	sys_slist_prepend(&routes, &route->node);
 
+	if (trie_insert(route) < 0) {
+		NET_ERR("Cannot index route %s/%d for lookup",
+			net_sprint_ipv6_addr(addr), prefix_len);
+	}
+
 	tmp = nbr_nexthop_get(iface, nexthop);
 
 	NET_ASSERT(tmp == nbr_nexthop);
@@ -597,6 +912,8 @@ int net_route_del(struct net_route_entry *route)
 
 	sys_slist_find_and_remove(&routes, &route->node);
 
+	trie_remove(route);
+
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
 		k_mutex_unlock(&lock);
@@ -1100,5 +1417,7 @@ void net_route_init(void)
 	NET_DBG("Allocated %d nexthop entries (%zu bytes)",
 		CONFIG_NET_MAX_NEXTHOPS, sizeof(net_route_nexthop_pool));
 
+	trie_clear();
+
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
@@ -467,6 +467,13 @@ static int tcp_conn_unref(struct tcp *conn, int status)
 	(void)k_work_cancel_delayable(&conn->persist_timer);
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 
+#ifdef CONFIG_NET_TCP_RX_COALESCE
+	(void)k_work_cancel_delayable(&conn->rx_coalesce_timer);
+	if (conn->rx_coalesce_pkt != NULL) {
+		tcp_pkt_unref(conn->rx_coalesce_pkt);
+	}
+#endif
+
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 
 	memset(conn, 0, sizeof(*conn));
@@ -712,8 +719,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			/* RFC 7323 ch 2.3 limits the shift count to 14 */
+			recv_options->window = MIN(options[2], 14);
 			recv_options->wnd_found = true;
+			NET_DBG("window scale=%hu", recv_options->window);
 			break;
 		default:
 			continue;
@@ -754,7 +763,7 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 	bool short_win_after;
 
 	new_win = conn->recv_win + delta;
-	if (new_win < 0 || new_win > UINT16_MAX) {
+	if (new_win < 0 || new_win > (int32_t)conn->recv_win_max) {
 		return -EINVAL;
 	}
 
@@ -871,6 +880,137 @@ static enum net_verdict tcp_data_get(struct tcp *conn, struct net_pkt *pkt, size
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_RX_COALESCE
+static void tcp_rx_coalesce_flush(struct tcp *conn)
+{
+	struct net_pkt *pkt;
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	(void)k_work_cancel_delayable(&conn->rx_coalesce_timer);
+
+	pkt = conn->rx_coalesce_pkt;
+	conn->rx_coalesce_pkt = NULL;
+	conn->rx_coalesce_len = 0;
+
+	k_mutex_unlock(&conn->lock);
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	if (tcp_in(conn, pkt) == NET_DROP) {
+		tcp_pkt_unref(pkt);
+	}
+}
+
+static void tcp_rx_coalesce_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, rx_coalesce_timer);
+
+	tcp_rx_coalesce_flush(conn);
+}
+
+/* Merge trains of consecutive in-order data segments into one virtual
+ * segment before they hit the state machine, amortizing the per-segment
+ * processing cost of a bulk transfer. Only plain data segments of an
+ * established connection (no flags besides ACK/PSH, no TCP options) are
+ * eligible; anything else flushes the pending train first so that the
+ * segment order seen by tcp_in() is preserved. Returns true if the
+ * segment was consumed.
+ */
+static bool tcp_rx_coalesce(struct tcp *conn, struct net_pkt *pkt)
+{
+	struct tcphdr *th = th_get(pkt);
+	struct tcphdr *held_th;
+	uint32_t new_ack_raw;
+	uint16_t new_win_raw;
+	uint8_t new_flags;
+	bool consumed = false;
+	size_t len;
+
+	if (th == NULL) {
+		return false;
+	}
+
+	new_ack_raw = UNALIGNED_GET(&th->th_ack);
+	new_win_raw = UNALIGNED_GET(&th->th_win);
+	new_flags = th_flags(th) & ~(ECN | CWR);
+	len = tcp_data_len(pkt);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state != TCP_ESTABLISHED || th_off(th) != 5 ||
+	    (new_flags & ~PSH) != ACK || len == 0) {
+		goto flush;
+	}
+
+	if (conn->rx_coalesce_pkt == NULL) {
+		/* Only start a train for the expected in-order segment,
+		 * and only when more of the same burst can still follow.
+		 */
+		if (th_seq(th) != conn->ack || (new_flags & PSH)) {
+			goto out;
+		}
+
+		conn->rx_coalesce_pkt = pkt;
+		conn->rx_coalesce_len = len;
+
+		(void)k_work_reschedule_for_queue(
+			&tcp_work_q, &conn->rx_coalesce_timer,
+			K_MSEC(CONFIG_NET_TCP_RX_COALESCE_TIMEOUT));
+
+		consumed = true;
+		goto out;
+	}
+
+	held_th = th_get(conn->rx_coalesce_pkt);
+
+	if (th_seq(th) != th_seq(held_th) + conn->rx_coalesce_len ||
+	    conn->rx_coalesce_len + len > CONFIG_NET_TCP_RX_COALESCE_SIZE) {
+		goto flush;
+	}
+
+	/* Strip the headers and graft the payload onto the held segment.
+	 * tcp_data_len() sums the whole buffer chain, so the train looks
+	 * like one large segment to the state machine.
+	 */
+	net_pkt_cursor_init(pkt);
+	if (net_pkt_pull(pkt, net_pkt_get_len(pkt) - len) < 0) {
+		goto flush;
+	}
+
+	net_buf_frag_add(conn->rx_coalesce_pkt->buffer, pkt->buffer);
+	pkt->buffer = NULL;
+	tcp_pkt_unref(pkt);
+
+	conn->rx_coalesce_len += len;
+	consumed = true;
+
+	/* Adopt the newest acknowledgment and window advertisement, as
+	 * the merged headers are no longer seen individually.
+	 */
+	UNALIGNED_PUT(new_ack_raw, &held_th->th_ack);
+	UNALIGNED_PUT(new_win_raw, &held_th->th_win);
+
+	if (new_flags & PSH) {
+		held_th->th_flags |= PSH;
+		goto flush;
+	}
+
+	goto out;
+
+ flush:
+	k_mutex_unlock(&conn->lock);
+	tcp_rx_coalesce_flush(conn);
+	return consumed;
+ out:
+	k_mutex_unlock(&conn->lock);
+	return consumed;
+}
+#endif /* CONFIG_NET_TCP_RX_COALESCE */
+
 static int tcp_finalize_pkt(struct net_pkt *pkt)
 {
 	net_pkt_cursor_init(pkt);
@@ -886,6 +1026,22 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+static uint16_t tcp_get_recv_wnd_advert(struct tcp *conn, uint8_t flags)
+{
+	uint32_t recv_win = conn->recv_win;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+	/* The window field of a SYN segment is never scaled */
+	if (conn->win_scale_enabled && !(flags & SYN)) {
+		recv_win >>= conn->recv_win_scale;
+	}
+#else
+	ARG_UNUSED(flags);
+#endif
+
+	return MIN(recv_win, UINT16_MAX);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -907,8 +1063,12 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+	if (conn->send_options.wnd_found) {
+		th->th_off++;
+	}
+
 	UNALIGNED_PUT(flags, &th->th_flags);
-	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
+	UNALIGNED_PUT(htons(tcp_get_recv_wnd_advert(conn, flags)), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
 
 	if (ACK & flags) {
@@ -985,6 +1145,45 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+static int net_tcp_set_wnd_scale_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(wnd_opt_access, struct tcp_mss_option);
+	struct tcp_mss_option *wnd;
+	uint32_t wnd_scale;
+
+	wnd = net_pkt_get_data(pkt, &wnd_opt_access);
+	if (!wnd) {
+		return -ENOBUFS;
+	}
+
+	/* NOP + kind + length + shift count, padded to one 32-bit word */
+	wnd_scale = ((uint32_t)NET_TCP_NOP_OPT << 24) |
+		    ((uint32_t)NET_TCP_WINDOW_SCALE_OPT << 16) |
+		    ((uint32_t)NET_TCP_WINDOW_SCALE_SIZE << 8) |
+		    conn->recv_win_scale;
+
+	UNALIGNED_PUT(htonl(wnd_scale), (uint32_t *)wnd);
+
+	return net_pkt_set_data(pkt, &wnd_opt_access);
+}
+
+/* Pick the shift count for our advertised window and offer the window
+ * scale option in the SYN. Called just before sending a SYN segment.
+ */
+static void tcp_setup_wnd_scale_opt(struct tcp *conn)
+{
+	conn->recv_win_scale = 0;
+
+	while (((conn->recv_win_max >> conn->recv_win_scale) > UINT16_MAX) &&
+	       (conn->recv_win_scale < 14)) {
+		conn->recv_win_scale++;
+	}
+
+	conn->send_options.wnd_found = true;
+}
+#endif /* CONFIG_NET_TCP_WINDOW_SCALING */
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1019,6 +1218,10 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+	if (conn->send_options.wnd_found) {
+		alloc_len += sizeof(uint32_t);
+	}
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1051,6 +1254,16 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+	if (conn->send_options.wnd_found) {
+		ret = net_tcp_set_wnd_scale_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1117,9 +1330,202 @@ static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 	return net_pkt_copy(to, from, len);
 }
 
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+
+/* CUBIC constants in fixed point: C = 0.4, beta = 0.7 */
+#define TCP_CUBIC_LOSS_NUM 7
+#define TCP_CUBIC_LOSS_DEN 10
+
+/* Maximum congestion window, to keep the fixed point math in range */
+#define TCP_CUBIC_CWND_MAX (1U << 30)
+
+static uint32_t tcp_cubic_root(uint64_t x)
+{
+	uint64_t lo = 0U;
+	uint64_t hi = BIT64(21); /* (2^21)^3 == 2^63 covers the input range */
+
+	while (lo < hi) {
+		uint64_t mid = (lo + hi + 1U) / 2U;
+
+		if ((mid * mid * mid) <= x) {
+			lo = mid;
+		} else {
+			hi = mid - 1U;
+		}
+	}
+
+	return (uint32_t)lo;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	/* RFC 5681 initial window */
+	conn->cc.cwnd = MIN(4U * mss, MAX(2U * mss, 4380U));
+	conn->cc.ssthresh = UINT32_MAX;
+	conn->cc.w_max = 0U;
+	conn->cc.k = 0U;
+	conn->cc.epoch_start = 0U;
+	conn->cc.acked_bytes = 0U;
+}
+
+static void tcp_cubic_new_ack(struct tcp *conn, uint32_t len_acked)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd_seg;
+	int64_t t, d, target;
+
+	if (mss == 0U) {
+		return;
+	}
+
+	if (conn->cc.cwnd < conn->cc.ssthresh) {
+		/* Slow start */
+		conn->cc.cwnd += MIN(len_acked, mss);
+		goto clamp;
+	}
+
+	if (conn->cc.epoch_start == 0U) {
+		/* First ACK of a new congestion avoidance epoch */
+		conn->cc.epoch_start = k_uptime_get_32() | 1U;
+
+		if (conn->cc.cwnd < conn->cc.w_max) {
+			/* K = cbrt(W_max * (1 - beta) / C) seconds, i.e.
+			 * cbrt(w_max_seg * 0.75) converted to milliseconds.
+			 */
+			conn->cc.k = tcp_cubic_root(
+				(uint64_t)(conn->cc.w_max / mss) *
+				750000000ULL);
+		} else {
+			conn->cc.k = 0U;
+			conn->cc.w_max = conn->cc.cwnd;
+		}
+	}
+
+	cwnd_seg = MAX(conn->cc.cwnd / mss, 1U);
+
+	t = (int64_t)(uint32_t)(k_uptime_get_32() - conn->cc.epoch_start);
+	d = t - (int64_t)conn->cc.k;
+
+	/* W_cubic(t) = C * (t - K)^3 + W_max with t in seconds, so with
+	 * d in milliseconds the cubic term is 0.4 * d^3 / 10^9 segments.
+	 */
+	target = (int64_t)(conn->cc.w_max / mss) +
+		 (d * d * d * 4) / 10000000000LL;
+
+	if (target > (int64_t)cwnd_seg) {
+		/* Below the curve, climb towards it */
+		conn->cc.cwnd +=
+			MAX(1U, (uint32_t)((target - cwnd_seg) * mss /
+					   cwnd_seg));
+	} else {
+		/* At or above the curve, grow by at most one segment per
+		 * window's worth of acknowledged data.
+		 */
+		conn->cc.acked_bytes += len_acked;
+		if (conn->cc.acked_bytes >= conn->cc.cwnd) {
+			conn->cc.acked_bytes = 0U;
+			conn->cc.cwnd += mss;
+		}
+	}
+
+clamp:
+	conn->cc.cwnd = MIN(conn->cc.cwnd, TCP_CUBIC_CWND_MAX);
+
+	NET_DBG("conn: %p cwnd=%u ssthresh=%u", conn, conn->cc.cwnd,
+		conn->cc.ssthresh);
+}
+
+static void tcp_cubic_pkt_loss(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	conn->cc.w_max = conn->cc.cwnd;
+	conn->cc.ssthresh = MAX(conn->cc.cwnd / TCP_CUBIC_LOSS_DEN *
+				TCP_CUBIC_LOSS_NUM, 2U * mss);
+	conn->cc.cwnd = conn->cc.ssthresh;
+	conn->cc.epoch_start = 0U;
+	conn->cc.acked_bytes = 0U;
+
+	NET_DBG("conn: %p fast retransmit, cwnd=%u", conn, conn->cc.cwnd);
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	conn->cc.w_max = conn->cc.cwnd;
+	conn->cc.ssthresh = MAX(conn->cc.cwnd / TCP_CUBIC_LOSS_DEN *
+				TCP_CUBIC_LOSS_NUM, 2U * mss);
+	/* Restart from one segment after a retransmission timeout */
+	conn->cc.cwnd = MAX(mss, 1U);
+	conn->cc.epoch_start = 0U;
+	conn->cc.acked_bytes = 0U;
+
+	NET_DBG("conn: %p RTO, cwnd=%u", conn, conn->cc.cwnd);
+}
+
+static const struct tcp_cong_ops tcp_cong_cubic = {
+	.init = tcp_cubic_init,
+	.new_ack = tcp_cubic_new_ack,
+	.pkt_loss = tcp_cubic_pkt_loss,
+	.timeout = tcp_cubic_timeout,
+};
+
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+static void tcp_cc_init(struct tcp *conn)
+{
+	if (conn->cong && conn->cong->init) {
+		conn->cong->init(conn);
+	}
+}
+
+static void tcp_cc_new_ack(struct tcp *conn, uint32_t len_acked)
+{
+	if (conn->cong && conn->cong->new_ack) {
+		conn->cong->new_ack(conn, len_acked);
+	}
+}
+
+static void tcp_cc_pkt_loss(struct tcp *conn)
+{
+	if (conn->cong && conn->cong->pkt_loss) {
+		conn->cong->pkt_loss(conn);
+	}
+}
+
+static void tcp_cc_timeout(struct tcp *conn)
+{
+	if (conn->cong && conn->cong->timeout) {
+		conn->cong->timeout(conn);
+	}
+}
+#else
+#define tcp_cc_init(conn)
+#define tcp_cc_new_ack(conn, len_acked)
+#define tcp_cc_pkt_loss(conn)
+#define tcp_cc_timeout(conn)
+#endif /* CONFIG_NET_TCP_CONGESTION_CONTROL */
+
+/* Effective send window: the peer's flow control window, additionally
+ * limited by the congestion window when congestion control is enabled.
+ */
+static uint32_t tcp_effective_send_win(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+	if (conn->cong != NULL) {
+		return MIN(conn->send_win, conn->cc.cwnd);
+	}
+#endif
+	return conn->send_win;
+}
+
 static bool tcp_window_full(struct tcp *conn)
 {
-	bool window_full = (conn->send_data_total >= conn->send_win);
+	bool window_full = (conn->send_data_total >= tcp_effective_send_win(conn));
 
 	NET_DBG("conn: %p window_full=%hu", conn, window_full);
 
@@ -1138,10 +1544,11 @@ static int tcp_unsent_len(struct tcp *conn)
 	}
 
 	unsent_len = conn->send_data_total - conn->unacked_len;
-	if (conn->unacked_len >= conn->send_win) {
+	if ((uint32_t)conn->unacked_len >= tcp_effective_send_win(conn)) {
 		unsent_len = 0;
 	} else {
-		unsent_len = MIN(unsent_len, conn->send_win - conn->unacked_len);
+		unsent_len = MIN(unsent_len, tcp_effective_send_win(conn) -
+				 conn->unacked_len);
 	}
  out:
 	NET_DBG("unsent_len=%d", unsent_len);
@@ -1156,7 +1563,7 @@ static int tcp_send_data(struct tcp *conn)
 	struct net_pkt *pkt;
 
 	len = MIN3(conn->send_data_total - conn->unacked_len,
-		   conn->send_win - conn->unacked_len,
+		   tcp_effective_send_win(conn) - conn->unacked_len,
 		   conn_mss(conn));
 	if (len == 0) {
 		NET_DBG("conn: %p no data to send", conn);
@@ -1289,6 +1696,8 @@ static void tcp_resend_data(struct k_work *work)
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
+	tcp_cc_timeout(conn);
+
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
 	if (ret == 0) {
@@ -1466,6 +1875,9 @@ static struct tcp *tcp_conn_alloc(struct net_context *context)
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	conn->cong = &tcp_cong_cubic;
+#endif
 
 	/* Set the recv_win with the rcvbuf configured for the socket. */
 	if (IS_ENABLED(CONFIG_NET_CONTEXT_RCVBUF) &&
@@ -1491,6 +1903,9 @@ static struct tcp *tcp_conn_alloc(struct net_context *context)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#ifdef CONFIG_NET_TCP_RX_COALESCE
+	k_work_init_delayable(&conn->rx_coalesce_timer, tcp_rx_coalesce_timeout);
+#endif
 
 	tcp_conn_ref(conn);
 
@@ -1583,6 +1998,11 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 
 	conn = tcp_conn_search(pkt);
 	if (conn) {
+#ifdef CONFIG_NET_TCP_RX_COALESCE
+		if (tcp_rx_coalesce(conn, pkt)) {
+			return NET_OK;
+		}
+#endif
 		goto in;
 	}
 
@@ -2108,6 +2528,13 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 		conn->send_win = ntohs(th_win(th));
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+		/* The window field of a SYN segment is never scaled */
+		if (conn->win_scale_enabled && !(th_flags(th) & SYN)) {
+			conn->send_win <<= conn->send_win_scale;
+		}
+#endif
+
 #if defined(CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE)
 		if (CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE) {
 			max_win = CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE;
@@ -2163,9 +2590,18 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+			/* Only scale if the peer offered it in its SYN */
+			if (conn->recv_options.wnd_found) {
+				tcp_setup_wnd_scale_opt(conn);
+				conn->send_win_scale = conn->recv_options.window;
+				conn->win_scale_enabled = true;
+			}
+#endif
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
+			conn->send_options.wnd_found = false;
 			conn_seq(conn, + 1);
 			next = TCP_SYN_RECEIVED;
 
@@ -2176,8 +2612,12 @@ next_state:
 						    ACK_TIMEOUT);
 		} else {
 			conn->send_options.mss_found = true;
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+			tcp_setup_wnd_scale_opt(conn);
+#endif
 			tcp_out(conn, SYN);
 			conn->send_options.mss_found = false;
+			conn->send_options.wnd_found = false;
 			conn_seq(conn, + 1);
 			next = TCP_SYN_SENT;
 		}
@@ -2187,6 +2627,7 @@ next_state:
 				th_seq(th) == conn->ack)) {
 			k_work_cancel_delayable(&conn->establish_timer);
 			tcp_send_timer_cancel(conn);
+			tcp_cc_init(conn);
 			next = TCP_ESTABLISHED;
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -2220,6 +2661,15 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+			/* We offered scaling in our SYN, the option takes
+			 * effect only if the peer answered with its own.
+			 */
+			if (conn->recv_options.wnd_found) {
+				conn->send_win_scale = conn->recv_options.window;
+				conn->win_scale_enabled = true;
+			}
+#endif
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -2227,6 +2677,7 @@ next_state:
 				conn_ack(conn, + len);
 			}
 
+			tcp_cc_init(conn);
 			next = TCP_ESTABLISHED;
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -2293,6 +2744,8 @@ next_state:
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
+				tcp_cc_pkt_loss(conn);
+
 				conn->unacked_len = 0;
 
 				(void)tcp_send_data(conn);
@@ -2340,6 +2793,8 @@ next_state:
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+			tcp_cc_new_ack(conn, len_acked);
+
 			conn_send_data_dump(conn);
 
 			if (!k_work_delayable_remaining_get(
@@ -2984,8 +3439,11 @@ int net_tcp_finalize(struct net_pkt *pkt)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_TCP)) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
+	} else {
+		net_pkt_set_l4_chksum_offloaded(pkt, true);
 	}
 
 	return net_pkt_set_data(pkt, &tcp_access);
@@ -2997,7 +3455,9 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	struct net_tcp_hdr *tcp_hdr;
 
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
-	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt)) &&
+	    !net_pkt_is_l4_chksum_offloaded(pkt) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_TCP) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
@@ -217,11 +217,42 @@ union tcp_endpoint {
 
 struct tcp_options {
 	uint16_t mss;
-	uint16_t window;
+	uint16_t window; /* window scale shift count */
 	bool mss_found : 1;
 	bool wnd_found : 1;
 };
 
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+struct tcp;
+
+/* Congestion control state. The cwnd/ssthresh fields are in bytes,
+ * the CUBIC fields keep the state of the cubic window growth function
+ * between loss events.
+ */
+struct tcp_cc {
+	uint32_t cwnd;		/* congestion window */
+	uint32_t ssthresh;	/* slow start threshold */
+	uint32_t w_max;		/* window size before the last reduction */
+	uint32_t k;		/* time to reach w_max again, in ms */
+	uint32_t epoch_start;	/* start of the current growth epoch, in ms */
+	uint32_t acked_bytes;	/* bytes acked since the last cwnd increase */
+};
+
+/* Pluggable congestion control algorithm. All callbacks are invoked
+ * with the connection lock held.
+ */
+struct tcp_cong_ops {
+	/* Connection reached ESTABLISHED, MSS is known */
+	void (*init)(struct tcp *conn);
+	/* An ACK advanced the send window by len_acked bytes */
+	void (*new_ack)(struct tcp *conn, uint32_t len_acked);
+	/* Loss detected through duplicate ACKs (fast retransmit) */
+	void (*pkt_loss)(struct tcp *conn);
+	/* Retransmission timeout expired */
+	void (*timeout)(struct tcp *conn);
+};
+#endif /* CONFIG_NET_TCP_CONGESTION_CONTROL */
+
 struct tcp { /* TCP connection */
 	sys_snode_t next;
 	struct net_context *context;
@@ -265,11 +296,27 @@ struct tcp { /* TCP connection */
 	enum tcp_data_mode data_mode;
 	uint32_t seq;
 	uint32_t ack;
-	uint16_t recv_win_max;
-	uint16_t recv_win;
-	uint16_t send_win;
+	uint32_t recv_win_max;
+	uint32_t recv_win;
+	uint32_t send_win;
+#ifdef CONFIG_NET_TCP_RX_COALESCE
+	/* Train of consecutive in-order data segments held back so that
+	 * they can be run through the state machine as one virtual segment.
+	 */
+	struct net_pkt *rx_coalesce_pkt;
+	size_t rx_coalesce_len;
+	struct k_work_delayable rx_coalesce_timer;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+	const struct tcp_cong_ops *cong;
+	struct tcp_cc cc;
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
+#endif
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+	uint8_t send_win_scale; /* shift for the window the peer advertises */
+	uint8_t recv_win_scale; /* shift for the window we advertise */
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -280,6 +327,9 @@ struct tcp { /* TCP connection */
 	bool in_connect : 1;
 	bool in_close : 1;
 	bool tcp_nodelay : 1;
+#ifdef CONFIG_NET_TCP_WINDOW_SCALING
+	bool win_scale_enabled : 1; /* both ends sent the option */
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -51,8 +51,11 @@ int net_udp_finalize(struct net_pkt *pkt)
 
 	udp_hdr->len = htons(length);
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_UDP)) {
 		udp_hdr->chksum = net_calc_chksum_udp(pkt);
+	} else {
+		net_pkt_set_l4_chksum_offloaded(pkt, true);
 	}
 
 	return net_pkt_set_data(pkt, &udp_access);
@@ -163,7 +166,9 @@ struct net_udp_hdr *net_udp_input(struct net_pkt *pkt,
 	}
 
 	if (IS_ENABLED(CONFIG_NET_UDP_CHECKSUM) &&
-	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+	    !net_pkt_is_l4_chksum_offloaded(pkt) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+					 NET_IF_CHECKSUM_UDP)) {
 		if (!udp_hdr->chksum) {
 			if (IS_ENABLED(CONFIG_NET_UDP_MISSING_CHECKSUM) &&
 			    net_pkt_family(pkt) == AF_INET) {
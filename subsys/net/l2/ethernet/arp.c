@@ -34,6 +34,66 @@ static struct k_work_delayable arp_request_timer;
 
 static struct k_mutex arp_mutex;
 
+#if defined(CONFIG_NET_ARP_HASH)
+/* The ARP table is additionally indexed by a hash of the next-hop IPv4
+ * address so that the lookup done for every outgoing packet does not
+ * need to scan the whole table. The buckets chain entries together by
+ * their index in arp_entries.
+ */
+#define ARP_HASH_END 0xff
+
+BUILD_ASSERT(CONFIG_NET_ARP_TABLE_SIZE < ARP_HASH_END,
+	     "ARP hash index needs the table size to fit into one byte");
+
+static uint8_t arp_hash_head[CONFIG_NET_ARP_HASH_BUCKETS];
+
+/* FNV-1a over the IPv4 address */
+static inline uint8_t arp_hash_bucket(const struct in_addr *addr)
+{
+	uint32_t hash = 0x811c9dc5U;
+	size_t i;
+
+	for (i = 0U; i < sizeof(addr->s4_addr); i++) {
+		hash = (hash ^ addr->s4_addr[i]) * 0x01000193U;
+	}
+
+	return hash % CONFIG_NET_ARP_HASH_BUCKETS;
+}
+
+static void arp_hash_insert(struct arp_entry *entry)
+{
+	uint8_t bucket = arp_hash_bucket(&entry->ip);
+
+	entry->hash_next = arp_hash_head[bucket];
+	arp_hash_head[bucket] = entry - arp_entries;
+}
+
+static void arp_hash_remove(struct arp_entry *entry)
+{
+	uint8_t bucket = arp_hash_bucket(&entry->ip);
+	uint8_t idx = entry - arp_entries;
+	uint8_t *slot = &arp_hash_head[bucket];
+
+	while (*slot != ARP_HASH_END) {
+		if (*slot == idx) {
+			*slot = entry->hash_next;
+			return;
+		}
+
+		slot = &arp_entries[*slot].hash_next;
+	}
+}
+
+static void arp_hash_clear(void)
+{
+	(void)memset(arp_hash_head, ARP_HASH_END, sizeof(arp_hash_head));
+}
+#else
+#define arp_hash_insert(entry)
+#define arp_hash_remove(entry)
+#define arp_hash_clear()
+#endif /* CONFIG_NET_ARP_HASH */
+
 static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 {
 	NET_DBG("%p", entry);
@@ -83,6 +143,28 @@ static struct arp_entry *arp_entry_find(sys_slist_t *list,
 static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 							  struct in_addr *dst)
 {
+#if defined(CONFIG_NET_ARP_HASH)
+	uint8_t idx = arp_hash_head[arp_hash_bucket(dst)];
+
+	NET_DBG("dst %s", net_sprint_ipv4_addr(dst));
+
+	/* With the hash index there is no need to move the entry to the
+	 * front of the table as the lookup cost does not depend on the
+	 * position of the entry.
+	 */
+	while (idx != ARP_HASH_END) {
+		struct arp_entry *entry = &arp_entries[idx];
+
+		if (entry->iface == iface &&
+		    net_ipv4_addr_cmp(&entry->ip, dst)) {
+			return entry;
+		}
+
+		idx = entry->hash_next;
+	}
+
+	return NULL;
+#else
 	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
@@ -102,6 +184,7 @@ static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 	}
 
 	return entry;
+#endif /* CONFIG_NET_ARP_HASH */
 }
 
 static inline
@@ -151,6 +234,7 @@ static struct arp_entry *arp_entry_get_free(void)
 
 static struct arp_entry *arp_entry_get_last_from_table(void)
 {
+	struct arp_entry *entry;
 	sys_snode_t *node;
 
 	/* We assume last entry is the oldest one,
@@ -164,7 +248,11 @@ static struct arp_entry *arp_entry_get_last_from_table(void)
 
 	sys_slist_find_and_remove(&arp_table, node);
 
-	return CONTAINER_OF(node, struct arp_entry, node);
+	entry = CONTAINER_OF(node, struct arp_entry, node);
+
+	arp_hash_remove(entry);
+
+	return entry;
 }
 
 
@@ -492,6 +580,7 @@ static void arp_update(struct net_if *iface,
 					net_ipaddr_copy(&entry->ip, src);
 					memcpy(&entry->eth, hwaddr, sizeof(entry->eth));
 					sys_slist_prepend(&arp_table, &entry->node);
+					arp_hash_insert(entry);
 				}
 			}
 		}
@@ -504,7 +593,42 @@ static void arp_update(struct net_if *iface,
 
 	/* Inserting entry into the table */
 	sys_slist_prepend(&arp_table, &entry->node);
+	arp_hash_insert(entry);
+
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	/* Flush the pending packets a batch at a time so that they end
+	 * up back-to-back in the traffic class queue and the TX batch
+	 * handler can hand them to the driver in one go.
+	 */
+	do {
+		struct net_pkt *pkts[CONFIG_NET_TC_TX_BATCH_SIZE];
+		int count = 0;
+		int i;
+
+		while (count < CONFIG_NET_TC_TX_BATCH_SIZE) {
+			pkt = k_fifo_get(&entry->pending_queue, K_NO_WAIT);
+			if (!pkt) {
+				break;
+			}
 
+			/* Set the dst in the pending packet */
+			net_pkt_lladdr_dst(pkt)->len =
+				sizeof(struct net_eth_addr);
+			net_pkt_lladdr_dst(pkt)->addr =
+				(uint8_t *) &NET_ETH_HDR(pkt)->dst.addr;
+
+			NET_DBG("dst %s pending %p frag %p",
+				net_sprint_ipv4_addr(&entry->ip),
+				pkt, pkt->frags);
+
+			pkts[count++] = pkt;
+		}
+
+		for (i = 0; i < count; i++) {
+			net_if_queue_tx(iface, pkts[i]);
+		}
+	} while (!k_fifo_is_empty(&entry->pending_queue));
+#else
 	while (!k_fifo_is_empty(&entry->pending_queue)) {
 		pkt = k_fifo_get(&entry->pending_queue, K_FOREVER);
 
@@ -519,6 +643,7 @@ static void arp_update(struct net_if *iface,
 
 		net_if_queue_tx(iface, pkt);
 	}
+#endif /* CONFIG_NET_TC_TX_BATCH */
 
 	k_mutex_unlock(&arp_mutex);
 }
@@ -718,6 +843,7 @@ void net_arp_clear_cache(struct net_if *iface)
 			continue;
 		}
 
+		arp_hash_remove(entry);
 		arp_entry_cleanup(entry, false);
 
 		sys_slist_remove(&arp_table, prev, &entry->node);
@@ -777,6 +903,8 @@ void net_arp_init(void)
 	sys_slist_init(&arp_pending_entries);
 	sys_slist_init(&arp_table);
 
+	arp_hash_clear();
+
 	for (i = 0; i < CONFIG_NET_ARP_TABLE_SIZE; i++) {
 		/* Inserting entry as free with initialised packet queue */
 		k_fifo_init(&arp_entries[i].pending_queue);
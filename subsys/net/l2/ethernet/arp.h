@@ -56,6 +56,10 @@ struct arp_entry {
 	struct in_addr ip;
 	struct net_eth_addr eth;
 	struct k_fifo pending_queue;
+#if defined(CONFIG_NET_ARP_HASH)
+	/** Index of the next entry in the same hash bucket. */
+	uint8_t hash_next;
+#endif
 };
 
 typedef void (*net_arp_cb_t)(struct arp_entry *entry,
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_eth_rx_poll, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/ethernet.h>
+
+/* All pollers share one work queue so that a driver only pays for the
+ * extra thread once, no matter how many interfaces use polled RX.
+ */
+static struct k_work_q rx_poll_q;
+
+K_KERNEL_STACK_DEFINE(rx_poll_stack, CONFIG_NET_ETHERNET_RX_POLL_STACK_SIZE);
+
+static void rx_poll_work_handler(struct k_work *work)
+{
+	struct net_eth_rx_poller *poller =
+		CONTAINER_OF(work, struct net_eth_rx_poller, work);
+	int count;
+
+	count = poller->poll(poller->iface,
+			     CONFIG_NET_ETHERNET_RX_POLL_BUDGET);
+
+	if (count >= CONFIG_NET_ETHERNET_RX_POLL_BUDGET) {
+		/* The budget was exhausted so more frames are likely
+		 * pending. Keep the RX interrupt masked and resubmit
+		 * ourselves, processing the backlog one budget at a time.
+		 */
+		(void)k_work_submit_to_queue(&rx_poll_q, work);
+	} else {
+		/* The queue ran dry, go back to interrupt driven RX. */
+		poller->irq_enable(poller->iface);
+	}
+}
+
+void net_eth_rx_poller_init(struct net_eth_rx_poller *poller,
+			    struct net_if *iface,
+			    net_eth_rx_poll_cb_t poll,
+			    net_eth_rx_irq_enable_cb_t irq_enable)
+{
+	/* Pollers are registered from driver init context which runs
+	 * single threaded, so plain guarding is enough here.
+	 */
+	static bool queue_started;
+
+	NET_ASSERT(poll);
+	NET_ASSERT(irq_enable);
+
+	if (!queue_started) {
+#if defined(CONFIG_NET_TC_THREAD_COOPERATIVE)
+#define THREAD_PRIORITY K_PRIO_COOP(CONFIG_NET_ETHERNET_RX_POLL_PRIO)
+#else
+#define THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_NET_ETHERNET_RX_POLL_PRIO)
+#endif
+		k_work_queue_start(&rx_poll_q, rx_poll_stack,
+				   K_KERNEL_STACK_SIZEOF(rx_poll_stack),
+				   THREAD_PRIORITY, NULL);
+
+		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+			k_thread_name_set(&rx_poll_q.thread, "eth_rx_poll");
+		}
+
+		queue_started = true;
+	}
+
+	poller->iface = iface;
+	poller->poll = poll;
+	poller->irq_enable = irq_enable;
+
+	k_work_init(&poller->work, rx_poll_work_handler);
+}
+
+void net_eth_rx_schedule(struct net_eth_rx_poller *poller)
+{
+	(void)k_work_submit_to_queue(&rx_poll_q, &poller->work);
+}
@@ -597,31 +597,14 @@ static void ethernet_remove_l2_header(struct net_pkt *pkt)
 	net_pkt_frag_unref(buf);
 }
 
-static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
+static int ethernet_prepare_tx(struct ethernet_context *ctx,
+			       struct net_if *iface,
+			       struct net_pkt **pkt_ref)
 {
-	const struct ethernet_api *api = net_if_get_device(iface)->api;
-	struct ethernet_context *ctx = net_if_l2_data(iface);
+	struct net_pkt *pkt = *pkt_ref;
 	uint16_t ptype;
-	int ret;
 
-	if (!api) {
-		ret = -ENOENT;
-		goto error;
-	}
-
-	if (IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE) &&
-	    net_pkt_is_l2_bridged(pkt)) {
-		net_pkt_cursor_init(pkt);
-		ret = net_l2_send(api->send, net_if_get_device(iface), iface, pkt);
-		if (ret != 0) {
-			eth_stats_update_errors_tx(iface);
-			goto error;
-		}
-		ethernet_update_tx_stats(iface, pkt);
-		ret = net_pkt_get_len(pkt);
-		net_pkt_unref(pkt);
-		return ret;
-	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+	if (IS_ENABLED(CONFIG_NET_IPV4) &&
 	    net_pkt_family(pkt) == AF_INET) {
 		struct net_pkt *tmp;
 
@@ -630,8 +613,7 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		} else {
 			tmp = ethernet_ll_prepare_on_ipv4(iface, pkt);
 			if (!tmp) {
-				ret = -ENOMEM;
-				goto error;
+				return -ENOMEM;
 			} else if (IS_ENABLED(CONFIG_NET_ARP) && tmp != pkt) {
 				/* Original pkt got queued and is replaced
 				 * by an ARP request packet.
@@ -639,6 +621,8 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 				pkt = tmp;
 				ptype = htons(NET_ETH_PTYPE_ARP);
 				net_pkt_set_family(pkt, AF_INET);
+
+				*pkt_ref = pkt;
 			} else {
 				ptype = htons(NET_ETH_PTYPE_IP);
 			}
@@ -668,7 +652,8 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 						sizeof(struct net_eth_addr);
 			ptype = dst_addr->sll_protocol;
 		} else {
-			goto send;
+			/* The raw frame is sent as is, no header is added. */
+			return 0;
 		}
 	} else if (IS_ENABLED(CONFIG_NET_L2_PTP) && net_pkt_is_ptp(pkt)) {
 		ptype = htons(NET_ETH_PTYPE_PTP);
@@ -680,8 +665,7 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		ptype = htons(NET_ETH_PTYPE_ARP);
 		net_pkt_set_family(pkt, AF_INET);
 	} else {
-		ret = -ENOTSUP;
-		goto error;
+		return -ENOTSUP;
 	}
 
 	/* If the ll dst addr has not been set before, let's assume
@@ -696,8 +680,7 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 	if (IS_ENABLED(CONFIG_NET_VLAN) &&
 	    net_eth_is_vlan_enabled(ctx, iface)) {
 		if (set_vlan_tag(ctx, iface, pkt) == NET_DROP) {
-			ret = -EINVAL;
-			goto error;
+			return -EINVAL;
 		}
 
 		set_vlan_priority(ctx, pkt);
@@ -706,13 +689,44 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 	/* Then set the ethernet header.
 	 */
 	if (!ethernet_fill_header(ctx, pkt, ptype)) {
-		ret = -ENOMEM;
-		goto error;
+		return -ENOMEM;
 	}
 
 	net_pkt_cursor_init(pkt);
 
-send:
+	return 0;
+}
+
+static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	const struct ethernet_api *api = net_if_get_device(iface)->api;
+	struct ethernet_context *ctx = net_if_l2_data(iface);
+	int ret;
+
+	if (!api) {
+		ret = -ENOENT;
+		goto error;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE) &&
+	    net_pkt_is_l2_bridged(pkt)) {
+		net_pkt_cursor_init(pkt);
+		ret = net_l2_send(api->send, net_if_get_device(iface), iface, pkt);
+		if (ret != 0) {
+			eth_stats_update_errors_tx(iface);
+			goto error;
+		}
+		ethernet_update_tx_stats(iface, pkt);
+		ret = net_pkt_get_len(pkt);
+		net_pkt_unref(pkt);
+		return ret;
+	}
+
+	ret = ethernet_prepare_tx(ctx, iface, &pkt);
+	if (ret < 0) {
+		goto error;
+	}
+
 	ret = net_l2_send(api->send, net_if_get_device(iface), iface, pkt);
 	if (ret != 0) {
 		eth_stats_update_errors_tx(iface);
@@ -730,6 +744,63 @@ error:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TC_TX_BATCH)
+int net_eth_send_batch(struct net_if *iface, struct net_pkt **pkts,
+		       int *status, int count)
+{
+	const struct ethernet_api *api = net_if_get_device(iface)->api;
+	struct ethernet_context *ctx = net_if_l2_data(iface);
+	struct net_pkt *ready[CONFIG_NET_TC_TX_BATCH_SIZE];
+	int idx[CONFIG_NET_TC_TX_BATCH_SIZE];
+	int i, n = 0, accepted;
+
+	if (!api || !api->send_batch ||
+	    count > CONFIG_NET_TC_TX_BATCH_SIZE) {
+		return -ENOTSUP;
+	}
+
+	for (i = 0; i < count; i++) {
+		struct net_pkt *pkt = pkts[i];
+		int ret = ethernet_prepare_tx(ctx, iface, &pkt);
+
+		if (ret < 0) {
+			eth_stats_update_errors_tx(iface);
+			status[i] = ret;
+			continue;
+		}
+
+		idx[n] = i;
+		ready[n++] = pkt;
+	}
+
+	if (n == 0) {
+		return 0;
+	}
+
+	accepted = api->send_batch(net_if_get_device(iface), ready, n);
+
+	for (i = 0; i < n; i++) {
+		struct net_pkt *pkt = ready[i];
+
+		if (i < accepted) {
+			ethernet_update_tx_stats(iface, pkt);
+
+			status[idx[i]] = net_pkt_get_len(pkt);
+			ethernet_remove_l2_header(pkt);
+
+			net_pkt_unref(pkt);
+		} else {
+			eth_stats_update_errors_tx(iface);
+			ethernet_remove_l2_header(pkt);
+
+			status[idx[i]] = accepted < 0 ? accepted : -ENOBUFS;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_TC_TX_BATCH */
+
 static inline int ethernet_enable(struct net_if *iface, bool state)
 {
 	const struct ethernet_api *eth =
@@ -730,6 +730,63 @@ static void gptp_mi_clk_slave_sync_compute(void)
 }
 
 #if defined(CONFIG_NET_GPTP_USE_DEFAULT_CLOCK_UPDATE)
+#if defined(CONFIG_NET_GPTP_CLOCK_SERVO_PI)
+/* Offsets larger than this are corrected by stepping the clock instead
+ * of slewing it through the servo.
+ */
+#define GPTP_PI_STEP_THRESHOLD_NS 5000
+
+/* Limit for the frequency correction (in ppb) the servo may request
+ * from the clock so that one bad offset measurement cannot run the
+ * clock away.
+ */
+#define GPTP_PI_MAX_FREQ_PPB 100000.0
+
+static double servo_freq_integral;
+
+static void gptp_clock_servo_reset(void)
+{
+	servo_freq_integral = 0.0;
+}
+
+/* Proportional-integral servo disciplining the local clock frequency.
+ * The sync offset is measured in nanoseconds once per sync interval so
+ * the gains translate the offset directly into a frequency correction
+ * in parts per billion.
+ */
+static void gptp_clock_servo_pi(const struct device *clk,
+				struct gptp_port_ds *port_ds,
+				int64_t offset_ns)
+{
+	double ppb;
+
+	servo_freq_integral += (double)offset_ns *
+		((double)CONFIG_NET_GPTP_CLOCK_SERVO_PI_KI / 1000.0);
+
+	if (servo_freq_integral > GPTP_PI_MAX_FREQ_PPB) {
+		servo_freq_integral = GPTP_PI_MAX_FREQ_PPB;
+	} else if (servo_freq_integral < -GPTP_PI_MAX_FREQ_PPB) {
+		servo_freq_integral = -GPTP_PI_MAX_FREQ_PPB;
+	}
+
+	ppb = (double)offset_ns *
+		((double)CONFIG_NET_GPTP_CLOCK_SERVO_PI_KP / 1000.0) +
+		servo_freq_integral;
+
+	if (ppb > GPTP_PI_MAX_FREQ_PPB) {
+		ppb = GPTP_PI_MAX_FREQ_PPB;
+	} else if (ppb < -GPTP_PI_MAX_FREQ_PPB) {
+		ppb = -GPTP_PI_MAX_FREQ_PPB;
+	}
+
+	/* A positive offset means the local clock is behind the master
+	 * so it must run faster, on top of the neighbor rate ratio.
+	 */
+	ptp_clock_rate_adjust(clk, port_ds->neighbor_rate_ratio *
+			      (1.0 + (ppb / 1e9)));
+}
+#endif /* CONFIG_NET_GPTP_CLOCK_SERVO_PI */
+
 static void gptp_update_local_port_clock(void)
 {
 	struct gptp_clk_slave_sync_state *state;
@@ -777,7 +834,22 @@ static void gptp_update_local_port_clock(void)
 		nanosecond_diff = -(int64_t)NSEC_PER_SEC + nanosecond_diff;
 	}
 
+#if defined(CONFIG_NET_GPTP_CLOCK_SERVO_PI)
+	if (second_diff == 0 &&
+	    nanosecond_diff >= -GPTP_PI_STEP_THRESHOLD_NS &&
+	    nanosecond_diff <= GPTP_PI_STEP_THRESHOLD_NS) {
+		gptp_clock_servo_pi(clk, port_ds, nanosecond_diff);
+		return;
+	}
+
+	/* The offset is too large for the servo so the clock is stepped
+	 * below and the servo starts over.
+	 */
+	gptp_clock_servo_reset();
 	ptp_clock_rate_adjust(clk, port_ds->neighbor_rate_ratio);
+#else
+	ptp_clock_rate_adjust(clk, port_ds->neighbor_rate_ratio);
+#endif
 
 	/* If time difference is too high, set the clock value.
 	 * Otherwise, adjust it.
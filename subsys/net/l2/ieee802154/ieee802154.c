@@ -208,6 +208,29 @@ static enum net_verdict ieee802154_recv(struct net_if *iface, struct net_pkt *pk
 	struct ieee802154_mpdu mpdu;
 	size_t hdr_len;
 
+#ifdef CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE
+	switch (ieee802154_parse_cache_lookup(net_pkt_data(pkt), net_pkt_get_len(pkt), &mpdu)) {
+	case IEEE802154_PARSE_CACHE_DUPLICATE:
+		/* Retransmission of an already accepted frame: acknowledge
+		 * it again but do not deliver it twice.
+		 */
+		ieee802154_acknowledge(iface, &mpdu);
+		return NET_DROP;
+	case IEEE802154_PARSE_CACHE_HIT:
+		/* The frame repeats the header of a recently accepted data
+		 * frame, so destination filtering and frame type dispatch
+		 * were already done when the cache entry was created.
+		 */
+		if (ieee802154_is_scanning(iface)) {
+			return NET_DROP;
+		}
+
+		goto data_frame;
+	case IEEE802154_PARSE_CACHE_MISS:
+		break;
+	}
+#endif /* CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE */
+
 	if (!ieee802154_validate_frame(net_pkt_data(pkt), net_pkt_get_len(pkt), &mpdu)) {
 		return NET_DROP;
 	}
@@ -236,6 +259,14 @@ static enum net_verdict ieee802154_recv(struct net_if *iface, struct net_pkt *pk
 
 	/* At this point the frame has to be a DATA one */
 
+	/* Cache the header layout before set_pkt_ll_addr() swaps the
+	 * address bytes in place.
+	 */
+	ieee802154_parse_cache_insert(net_pkt_data(pkt), &mpdu);
+
+#ifdef CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE
+data_frame:
+#endif
 	ieee802154_acknowledge(iface, &mpdu);
 
 	net_pkt_set_ll_proto_type(pkt, ETH_P_IEEE802154);
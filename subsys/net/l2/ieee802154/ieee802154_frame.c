@@ -409,6 +409,114 @@ static inline bool validate_payload_and_mfr(struct ieee802154_mpdu *mpdu, uint8_
 	return true;
 }
 
+#ifdef CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE
+
+/* Cached MAC header layout of recently accepted, unsecured data frames.
+ * The cache is only touched from the RX path, see ieee802154_recv(),
+ * hence no locking.
+ */
+struct parse_cache_entry {
+	uint8_t mhr[IEEE802154_FCF_SEQ_LENGTH +
+		    2 * (IEEE802154_PAN_ID_LENGTH + IEEE802154_EXT_ADDR_LENGTH)];
+	uint8_t mhr_len;
+	uint8_t dst_offset; /* 0 when no destination address is present */
+	uint8_t src_offset;
+	uint8_t seq; /* sequence number of the last accepted frame */
+	bool valid;
+};
+
+static struct parse_cache_entry parse_cache[CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE_ENTRIES];
+static uint8_t parse_cache_next;
+
+static bool parse_cache_match(struct parse_cache_entry *entry, uint8_t *buf, uint8_t length)
+{
+	if (!entry->valid || length <= entry->mhr_len) {
+		return false;
+	}
+
+	/* Byte 2 holds the sequence number which changes with every
+	 * frame, the rest of the MAC header has to match exactly.
+	 */
+	return memcmp(buf, entry->mhr, IEEE802154_FCF_SEQ_LENGTH - 1) == 0 &&
+	       memcmp(buf + IEEE802154_FCF_SEQ_LENGTH,
+		      entry->mhr + IEEE802154_FCF_SEQ_LENGTH,
+		      entry->mhr_len - IEEE802154_FCF_SEQ_LENGTH) == 0;
+}
+
+enum ieee802154_parse_cache_result
+ieee802154_parse_cache_lookup(uint8_t *buf, uint8_t length, struct ieee802154_mpdu *mpdu)
+{
+	int i;
+
+	if (length > IEEE802154_MTU || length < IEEE802154_MIN_LENGTH) {
+		return IEEE802154_PARSE_CACHE_MISS;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(parse_cache); i++) {
+		struct parse_cache_entry *entry = &parse_cache[i];
+
+		if (!parse_cache_match(entry, buf, length)) {
+			continue;
+		}
+
+		/* The header bytes are identical to the ones parsed when
+		 * the entry was created, so the cached offsets apply as is.
+		 */
+		mpdu->mhr.fs = (struct ieee802154_fcf_seq *)buf;
+		mpdu->mhr.dst_addr = entry->dst_offset ?
+			(struct ieee802154_address_field *)(buf + entry->dst_offset) : NULL;
+		mpdu->mhr.src_addr =
+			(struct ieee802154_address_field *)(buf + entry->src_offset);
+#ifdef CONFIG_NET_L2_IEEE802154_SECURITY
+		mpdu->mhr.aux_sec = NULL;
+#endif
+		mpdu->payload = buf + entry->mhr_len;
+		mpdu->mfr = (struct ieee802154_mfr *)(buf + length);
+
+		if (buf[2] == entry->seq) {
+			return IEEE802154_PARSE_CACHE_DUPLICATE;
+		}
+
+		entry->seq = buf[2];
+
+		return IEEE802154_PARSE_CACHE_HIT;
+	}
+
+	return IEEE802154_PARSE_CACHE_MISS;
+}
+
+void ieee802154_parse_cache_insert(uint8_t *buf, struct ieee802154_mpdu *mpdu)
+{
+	struct ieee802154_fcf_seq *fs = mpdu->mhr.fs;
+	size_t mhr_len = (uint8_t *)mpdu->payload - buf;
+	struct parse_cache_entry *entry;
+
+	/* Only plain data frames are cached: secured frames carry a
+	 * changing auxiliary security header and must always go through
+	 * the full parser so that replay protection and key selection
+	 * stay in one place, and without a source address there is no
+	 * peer to key the entry on.
+	 */
+	if (fs->fc.security_enabled || fs->fc.seq_num_suppr ||
+	    fs->fc.src_addr_mode == IEEE802154_ADDR_MODE_NONE ||
+	    mhr_len > sizeof(entry->mhr)) {
+		return;
+	}
+
+	entry = &parse_cache[parse_cache_next];
+	parse_cache_next = (parse_cache_next + 1) % ARRAY_SIZE(parse_cache);
+
+	memcpy(entry->mhr, buf, mhr_len);
+	entry->mhr_len = mhr_len;
+	entry->dst_offset = mpdu->mhr.dst_addr ?
+		(uint8_t *)mpdu->mhr.dst_addr - buf : 0;
+	entry->src_offset = (uint8_t *)mpdu->mhr.src_addr - buf;
+	entry->seq = fs->sequence;
+	entry->valid = true;
+}
+
+#endif /* CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE */
+
 bool ieee802154_validate_frame(uint8_t *buf, uint8_t length, struct ieee802154_mpdu *mpdu)
 {
 	uint8_t *p_buf = NULL;
@@ -480,6 +480,21 @@ struct ieee802154_fcf_seq *ieee802154_validate_fc_seq(uint8_t *buf, uint8_t **p_
 
 bool ieee802154_validate_frame(uint8_t *buf, uint8_t length, struct ieee802154_mpdu *mpdu);
 
+#ifdef CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE
+enum ieee802154_parse_cache_result {
+	IEEE802154_PARSE_CACHE_MISS,
+	IEEE802154_PARSE_CACHE_HIT,
+	IEEE802154_PARSE_CACHE_DUPLICATE,
+};
+
+enum ieee802154_parse_cache_result
+ieee802154_parse_cache_lookup(uint8_t *buf, uint8_t length, struct ieee802154_mpdu *mpdu);
+
+void ieee802154_parse_cache_insert(uint8_t *buf, struct ieee802154_mpdu *mpdu);
+#else
+#define ieee802154_parse_cache_insert(...)
+#endif /* CONFIG_NET_L2_IEEE802154_RX_PARSE_CACHE */
+
 uint8_t ieee802154_compute_header_and_authtag_size(struct net_if *iface, struct net_linkaddr *dst,
 						   struct net_linkaddr *src);
 
@@ -499,10 +499,155 @@ static int capture_disable(const struct device *dev)
 	return 0;
 }
 
+#if defined(CONFIG_NET_CAPTURE_SNAPSHOT)
+/* In snapshot mode the packet path only copies the packet metadata and
+ * the first bytes of the packet into this preallocated ring buffer.
+ * The drain thread then builds the tunnel packets from the snapshots
+ * outside the packet path. Snapshots are dropped if the ring is full.
+ */
+struct capture_snapshot {
+	struct net_capture *ctx;
+	struct net_if *orig_iface;
+	uint16_t orig_len;
+	uint16_t len;
+	uint8_t data[CONFIG_NET_CAPTURE_SNAPSHOT_LEN];
+};
+
+static struct capture_snapshot snapshots[CONFIG_NET_CAPTURE_SNAPSHOT_COUNT];
+static struct k_spinlock snapshot_lock;
+static uint16_t snapshot_head;
+static uint16_t snapshot_tail;
+static uint16_t snapshot_count;
+static uint32_t snapshot_dropped;
+static K_SEM_DEFINE(snapshot_sem, 0, K_SEM_MAX_LIMIT);
+
+static void snapshot_pkt(struct net_capture *ctx, struct net_if *iface,
+			 struct net_pkt *pkt)
+{
+	k_spinlock_key_t key = k_spin_lock(&snapshot_lock);
+	struct capture_snapshot *snap;
+	struct net_buf *buf;
+	size_t copied = 0;
+
+	if (snapshot_count == ARRAY_SIZE(snapshots)) {
+		snapshot_dropped++;
+		k_spin_unlock(&snapshot_lock, key);
+
+		NET_DBG("Captured pkt dropped (%u total)", snapshot_dropped);
+		return;
+	}
+
+	snap = &snapshots[snapshot_head];
+	snapshot_head = (snapshot_head + 1) % ARRAY_SIZE(snapshots);
+	snapshot_count++;
+
+	snap->ctx = ctx;
+	snap->orig_iface = iface;
+	snap->orig_len = net_pkt_get_len(pkt);
+
+	/* Copy directly from the buffer chain so that the packet cursor
+	 * is not disturbed.
+	 */
+	for (buf = pkt->buffer; buf != NULL && copied < sizeof(snap->data);
+	     buf = buf->frags) {
+		size_t chunk = MIN(buf->len, sizeof(snap->data) - copied);
+
+		memcpy(&snap->data[copied], buf->data, chunk);
+		copied += chunk;
+	}
+
+	snap->len = copied;
+
+	k_spin_unlock(&snapshot_lock, key);
+
+	k_sem_give(&snapshot_sem);
+}
+
+static void snapshot_send(struct capture_snapshot *snap)
+{
+	struct net_capture *ctx = snap->ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	/* The capture device might have been disabled or cleaned up
+	 * while the snapshot was waiting in the ring buffer.
+	 */
+	if (!ctx->in_use || !ctx->is_enabled) {
+		goto out;
+	}
+
+	pkt = net_pkt_alloc_from_slab(get_net_pkt(), PKT_ALLOC_TIME);
+	if (pkt == NULL) {
+		goto out;
+	}
+
+	net_pkt_set_context(pkt, ctx->context);
+	net_pkt_set_orig_iface(pkt, snap->orig_iface);
+	net_pkt_set_iface(pkt, ctx->tunnel_iface);
+
+	ret = net_pkt_alloc_buffer(pkt, snap->len, 0, PKT_ALLOC_TIME);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+		goto out;
+	}
+
+	ret = net_pkt_write(pkt, snap->data, snap->len);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+		goto out;
+	}
+
+	ret = net_capture_send(ctx->dev, ctx->tunnel_iface, pkt);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+	}
+
+out:
+	k_mutex_unlock(&lock);
+}
+
+static void snapshot_drain(void *p1, void *p2, void *p3)
+{
+	struct capture_snapshot snap;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&snapshot_sem, K_FOREVER);
+
+		key = k_spin_lock(&snapshot_lock);
+
+		if (snapshot_count == 0) {
+			k_spin_unlock(&snapshot_lock, key);
+			continue;
+		}
+
+		memcpy(&snap, &snapshots[snapshot_tail], sizeof(snap));
+		snapshot_tail = (snapshot_tail + 1) % ARRAY_SIZE(snapshots);
+		snapshot_count--;
+
+		k_spin_unlock(&snapshot_lock, key);
+
+		snapshot_send(&snap);
+	}
+}
+
+K_THREAD_DEFINE(capture_snapshot_thread, CONFIG_NET_CAPTURE_SNAPSHOT_STACK_SIZE,
+		snapshot_drain, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_NET_CAPTURE_SNAPSHOT */
+
 void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 {
+#if !defined(CONFIG_NET_CAPTURE_SNAPSHOT)
 	struct k_mem_slab *orig_slab;
 	struct net_pkt *captured;
+#endif
 	sys_snode_t *sn, *sns;
 
 	/* We must prevent to capture network packet that is already captured
@@ -517,13 +662,19 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 	SYS_SLIST_FOR_EACH_NODE_SAFE(&net_capture_devlist, sn, sns) {
 		struct net_capture *ctx = CONTAINER_OF(sn, struct net_capture,
 						       node);
-		int ret;
 
 		if (!ctx->in_use || !ctx->is_enabled ||
 		    ctx->capture_iface != iface) {
 			continue;
 		}
 
+#if defined(CONFIG_NET_CAPTURE_SNAPSHOT)
+		/* Only take a snapshot of the packet here, the drain
+		 * thread does the tunnel transmission.
+		 */
+		snapshot_pkt(ctx, iface, pkt);
+		net_pkt_set_captured(pkt, true);
+#else
 		orig_slab = pkt->slab;
 		pkt->slab = get_net_pkt();
 
@@ -541,10 +692,11 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 		net_pkt_set_iface(captured, ctx->tunnel_iface);
 		net_pkt_set_captured(pkt, true);
 
-		ret = net_capture_send(ctx->dev, ctx->tunnel_iface, captured);
-		if (ret < 0) {
+		if (net_capture_send(ctx->dev, ctx->tunnel_iface,
+				     captured) < 0) {
 			net_pkt_unref(captured);
 		}
+#endif /* CONFIG_NET_CAPTURE_SNAPSHOT */
 
 		goto out;
 	}
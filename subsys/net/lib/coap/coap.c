@@ -1131,6 +1131,154 @@ size_t coap_next_block(const struct coap_packet *cpkt,
 	return MAX(ret, 0);
 }
 
+#if defined(CONFIG_COAP_BLOCK_WINDOW)
+
+int coap_block_window_init(struct coap_block_window *window,
+			   enum coap_option_num option,
+			   enum coap_block_size block_size,
+			   size_t total_size)
+{
+	if (option != COAP_OPTION_BLOCK1 && option != COAP_OPTION_BLOCK2) {
+		return -EINVAL;
+	}
+
+	memset(window, 0, sizeof(*window));
+
+	window->option = option;
+
+	return coap_block_transfer_init(&window->ctx, block_size, total_size);
+}
+
+int coap_block_window_next(struct coap_block_window *window,
+			   struct coap_block_context *block_ctx)
+{
+	if (window->ctx.total_size > 0 &&
+	    window->next >= window->ctx.total_size) {
+		return -ENOENT;
+	}
+
+	if (!coap_pending_next_unused(window->pendings,
+				      ARRAY_SIZE(window->pendings))) {
+		return -EAGAIN;
+	}
+
+	*block_ctx = window->ctx;
+	block_ctx->current = window->next;
+
+	return 0;
+}
+
+struct coap_pending *coap_block_window_register(
+	struct coap_block_window *window,
+	const struct coap_packet *request,
+	const struct sockaddr *addr,
+	uint8_t retries)
+{
+	struct coap_pending *pending;
+	size_t offset;
+	int block;
+	int r;
+
+	block = coap_get_option_int(request, window->option);
+	if (block < 0) {
+		return NULL;
+	}
+
+	pending = coap_pending_next_unused(window->pendings,
+					   ARRAY_SIZE(window->pendings));
+	if (!pending) {
+		return NULL;
+	}
+
+	r = coap_pending_init(pending, request, addr, retries);
+	if (r < 0) {
+		return NULL;
+	}
+
+	offset = (size_t)GET_NUM(block) << (GET_BLOCK_SIZE(block) + 4);
+	window->offsets[pending - window->pendings] = offset;
+
+	/* Open the window further only when the next unrequested block
+	 * was taken, a retransmission does not move it.
+	 */
+	if (offset == window->next) {
+		window->next +=
+			coap_block_size_to_bytes(GET_BLOCK_SIZE(block));
+	}
+
+	return pending;
+}
+
+int coap_block_window_received(struct coap_block_window *window,
+			       const struct coap_packet *response,
+			       size_t *offset)
+{
+	struct coap_pending *pending;
+	uint16_t payload_len = 0U;
+	int block;
+	int size;
+
+	pending = coap_pending_received(response, window->pendings,
+					ARRAY_SIZE(window->pendings));
+	if (!pending) {
+		return -ENOENT;
+	}
+
+	*offset = window->offsets[pending - window->pendings];
+
+	coap_pending_clear(pending);
+
+	size = coap_get_option_int(response,
+				   window->option == COAP_OPTION_BLOCK2 ?
+				   COAP_OPTION_SIZE2 : COAP_OPTION_SIZE1);
+	if (size > 0 && window->ctx.total_size == 0) {
+		window->ctx.total_size = size;
+	}
+
+	block = coap_get_option_int(response, window->option);
+
+	(void)coap_packet_get_payload(response, &payload_len);
+
+	if (payload_len > 0U) {
+		/* Descriptive block (download), the payload is the data */
+		window->received += payload_len;
+
+		if (block >= 0 && !GET_MORE(block) &&
+		    window->ctx.total_size == 0) {
+			/* Last block tells us the size of the transfer */
+			window->ctx.total_size = *offset + payload_len;
+		}
+	} else {
+		/* Control block (upload), the block we sent is confirmed */
+		size_t bytes = coap_block_size_to_bytes(window->ctx.block_size);
+
+		if (window->ctx.total_size > 0) {
+			bytes = MIN(bytes, window->ctx.total_size - *offset);
+		}
+
+		window->received += bytes;
+	}
+
+	window->ctx.current = window->received;
+
+	return 0;
+}
+
+struct coap_pending *coap_block_window_next_to_expire(
+	struct coap_block_window *window)
+{
+	return coap_pending_next_to_expire(window->pendings,
+					   ARRAY_SIZE(window->pendings));
+}
+
+bool coap_block_window_is_complete(struct coap_block_window *window)
+{
+	return window->ctx.total_size > 0 &&
+		window->received >= window->ctx.total_size;
+}
+
+#endif /* CONFIG_COAP_BLOCK_WINDOW */
+
 int coap_pending_init(struct coap_pending *pending,
 		      const struct coap_packet *request,
 		      const struct sockaddr *addr,
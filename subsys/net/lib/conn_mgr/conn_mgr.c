@@ -65,6 +65,91 @@ static enum net_conn_mgr_state conn_mgr_ipv4_status(int index)
 #define conn_mgr_ipv4_status(...) NET_CONN_MGR_STATE_CONNECTED
 #endif /* CONFIG_NET_IPV4 */
 
+#if defined(CONFIG_NET_CONNECTION_MANAGER_EPOCH)
+struct conn_mgr_endpoint_cache {
+	uint32_t epoch;
+	bool valid;
+#if defined(CONFIG_NET_IPV6)
+	struct in6_addr ipv6;
+#endif
+#if defined(CONFIG_NET_IPV4)
+	struct in_addr ipv4;
+#endif
+};
+
+static struct conn_mgr_endpoint_cache endpoint_cache[CONN_MGR_IFACE_MAX];
+
+/* Compare the current addressing against the snapshot taken when the
+ * interface was last connected. If it is unchanged, the interface came
+ * back on the same network and consumers are told to resume, otherwise
+ * the epoch is incremented and the snapshot updated.
+ */
+static void conn_mgr_resume_check(int index, struct net_if *iface)
+{
+	struct conn_mgr_endpoint_cache *cache = &endpoint_cache[index];
+	struct net_event_l4_connectivity info = { 0 };
+	bool same = cache->valid;
+
+#if defined(CONFIG_NET_IPV6)
+	struct net_if *tmp6 = iface;
+	struct in6_addr *addr6;
+
+	addr6 = net_if_ipv6_get_global_addr(NET_ADDR_PREFERRED, &tmp6);
+	if (addr6 != NULL) {
+		net_ipaddr_copy(&info.ipv6, addr6);
+	}
+
+	same = same && net_ipv6_addr_cmp(&info.ipv6, &cache->ipv6);
+#endif
+
+#if defined(CONFIG_NET_IPV4)
+	struct in_addr *addr4;
+
+	addr4 = net_if_ipv4_get_global_addr(iface, NET_ADDR_PREFERRED);
+	if (addr4 != NULL) {
+		net_ipaddr_copy(&info.ipv4, addr4);
+	}
+
+	same = same && net_ipv4_addr_cmp(&info.ipv4, &cache->ipv4);
+#endif
+
+	if (!same) {
+		cache->epoch++;
+#if defined(CONFIG_NET_IPV6)
+		net_ipaddr_copy(&cache->ipv6, &info.ipv6);
+#endif
+#if defined(CONFIG_NET_IPV4)
+		net_ipaddr_copy(&cache->ipv4, &info.ipv4);
+#endif
+		cache->valid = true;
+
+		NET_DBG("Iface %d new network (epoch %u)", index + 1,
+			cache->epoch);
+		return;
+	}
+
+	info.epoch = cache->epoch;
+
+	NET_DBG("Iface %d resumed on same network (epoch %u)", index + 1,
+		cache->epoch);
+	net_mgmt_event_notify_with_info(NET_EVENT_L4_RESUMED, iface,
+					&info, sizeof(info));
+}
+
+uint32_t net_conn_mgr_if_epoch(struct net_if *iface)
+{
+	int idx = net_if_get_by_iface(iface) - 1;
+
+	if (idx < 0 || idx >= ARRAY_SIZE(endpoint_cache)) {
+		return 0;
+	}
+
+	return endpoint_cache[idx].epoch;
+}
+#else
+#define conn_mgr_resume_check(...)
+#endif /* CONFIG_NET_CONNECTION_MANAGER_EPOCH */
+
 static void conn_mgr_notify_status(int index)
 {
 	struct net_if *iface = net_if_get_by_index(index + 1);
@@ -74,6 +159,8 @@ static void conn_mgr_notify_status(int index)
 	}
 
 	if (iface_states[index] & NET_STATE_CONNECTED) {
+		conn_mgr_resume_check(index, iface);
+
 		NET_DBG("Iface %d (%p) connected",
 			net_if_get_by_iface(iface), iface);
 		net_mgmt_event_notify(NET_EVENT_L4_CONNECTED, iface);
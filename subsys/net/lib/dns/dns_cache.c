@@ -0,0 +1,222 @@
+/** @file
+ * @brief DNS resolver cache
+ *
+ * Caches resolved addresses together with their record TTL so that
+ * repeated queries for the same name can be answered without network
+ * traffic.
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+
+#include "dns_cache.h"
+
+/* Same value as DNS_MAX_NAME_LEN in resolve.c */
+#define DNS_CACHE_MAX_NAME_LEN 255
+
+struct dns_cache_entry {
+	char query[DNS_CACHE_MAX_NAME_LEN + 1];
+	struct dns_addrinfo info;
+	int64_t expiry; /* uptime in ms when the entry becomes stale */
+	enum dns_query_type query_type;
+	bool negative;
+	bool in_use;
+};
+
+static struct dns_cache_entry cache[CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES];
+
+static K_MUTEX_DEFINE(cache_lock);
+
+/* Must be invoked with cache lock held */
+static bool entry_is_valid(struct dns_cache_entry *entry, int64_t now)
+{
+	if (!entry->in_use) {
+		return false;
+	}
+
+	if (entry->expiry <= now) {
+		entry->in_use = false;
+		return false;
+	}
+
+	return true;
+}
+
+/* Must be invoked with cache lock held */
+static bool entry_matches(struct dns_cache_entry *entry, const char *query,
+			  enum dns_query_type query_type, int64_t now)
+{
+	return entry_is_valid(entry, now) &&
+		entry->query_type == query_type &&
+		strcmp(entry->query, query) == 0;
+}
+
+/* Find a free slot, evicting the entry closest to expiry if the cache
+ * is full. Must be invoked with cache lock held.
+ */
+static struct dns_cache_entry *entry_alloc(int64_t now)
+{
+	struct dns_cache_entry *victim = NULL;
+	int i;
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES; i++) {
+		if (!entry_is_valid(&cache[i], now)) {
+			return &cache[i];
+		}
+
+		if (victim == NULL || cache[i].expiry < victim->expiry) {
+			victim = &cache[i];
+		}
+	}
+
+	NET_DBG("Cache full, evicting %s", victim->query);
+
+	return victim;
+}
+
+static int entry_set(const char *query, enum dns_query_type query_type,
+		     const struct dns_addrinfo *info, uint32_t ttl,
+		     bool negative)
+{
+	struct dns_cache_entry *entry;
+	int64_t now;
+	int i;
+
+	if (query == NULL || strlen(query) > DNS_CACHE_MAX_NAME_LEN) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+	entry = NULL;
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES; i++) {
+		if (!entry_matches(&cache[i], query, query_type, now)) {
+			continue;
+		}
+
+		/* A positive answer replaces a negative entry and
+		 * refreshes an entry holding the same address. A
+		 * negative answer replaces everything we know about
+		 * the name.
+		 */
+		if (negative || cache[i].negative ||
+		    (cache[i].info.ai_addrlen == info->ai_addrlen &&
+		     memcmp(&cache[i].info.ai_addr, &info->ai_addr,
+			    info->ai_addrlen) == 0)) {
+			if (negative) {
+				cache[i].in_use = false;
+			} else {
+				entry = &cache[i];
+			}
+		}
+	}
+
+	if (entry == NULL) {
+		entry = entry_alloc(now);
+	}
+
+	strcpy(entry->query, query);
+	entry->query_type = query_type;
+	entry->expiry = now + MSEC_PER_SEC * (int64_t)ttl;
+	entry->negative = negative;
+	entry->in_use = true;
+
+	if (info != NULL) {
+		memcpy(&entry->info, info, sizeof(entry->info));
+	} else {
+		memset(&entry->info, 0, sizeof(entry->info));
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return 0;
+}
+
+int dns_cache_add(const char *query, enum dns_query_type query_type,
+		  const struct dns_addrinfo *info, uint32_t ttl)
+{
+	if (info == NULL) {
+		return -EINVAL;
+	}
+
+	/* A zero TTL tells us not to cache the answer (RFC 1035 ch. 3.2.1) */
+	if (ttl == 0U) {
+		return 0;
+	}
+
+	NET_DBG("Caching %s type %d TTL %u", query, query_type, ttl);
+
+	return entry_set(query, query_type, info, ttl, false);
+}
+
+int dns_cache_add_negative(const char *query, enum dns_query_type query_type)
+{
+	if (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL == 0) {
+		return 0;
+	}
+
+	NET_DBG("Caching negative answer for %s type %d", query, query_type);
+
+	return entry_set(query, query_type, NULL,
+			 CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL, true);
+}
+
+int dns_cache_find(const char *query, enum dns_query_type query_type,
+		   struct dns_addrinfo *info, size_t max_count)
+{
+	int64_t now;
+	int found = 0;
+	int i;
+
+	if (query == NULL || info == NULL || max_count == 0) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES; i++) {
+		if (!entry_matches(&cache[i], query, query_type, now)) {
+			continue;
+		}
+
+		if (cache[i].negative) {
+			if (found == 0) {
+				found = -ENOENT;
+			}
+
+			break;
+		}
+
+		memcpy(&info[found], &cache[i].info, sizeof(info[found]));
+
+		if (++found == (int)max_count) {
+			break;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return found;
+}
+
+void dns_cache_flush(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	memset(cache, 0, sizeof(cache));
+	k_mutex_unlock(&cache_lock);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DNS_CACHE_H_
+#define DNS_CACHE_H_
+
+#include <zephyr/net/dns_resolve.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+
+/**
+ * @brief Add a resolved address to the DNS cache.
+ *
+ * The entry expires after ttl seconds, after which it is no longer
+ * returned by dns_cache_find(). An answer with a zero TTL is not
+ * cached. If the cache is full, the entry closest to expiry is
+ * evicted.
+ *
+ * @param query Query name that was resolved.
+ * @param query_type Query type (A or AAAA).
+ * @param info Resolved address information.
+ * @param ttl Record time to live in seconds.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dns_cache_add(const char *query, enum dns_query_type query_type,
+		  const struct dns_addrinfo *info, uint32_t ttl);
+
+/**
+ * @brief Add a negative entry to the DNS cache.
+ *
+ * Records that a query returned no data so that subsequent lookups
+ * can fail quickly without querying the network. The entry expires
+ * after CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL seconds. If that
+ * option is 0, negative caching is disabled and this is a no-op.
+ *
+ * @param query Query name that failed to resolve.
+ * @param query_type Query type (A or AAAA).
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dns_cache_add_negative(const char *query,
+			   enum dns_query_type query_type);
+
+/**
+ * @brief Look up a query in the DNS cache.
+ *
+ * @param query Query name to look for.
+ * @param query_type Query type (A or AAAA).
+ * @param info Array where found addresses are stored.
+ * @param max_count Size of the info array.
+ *
+ * @return Number of addresses copied to info on a positive hit,
+ *         0 if the query is not cached, -ENOENT if a fresh negative
+ *         entry exists for the query.
+ */
+int dns_cache_find(const char *query, enum dns_query_type query_type,
+		   struct dns_addrinfo *info, size_t max_count);
+
+/**
+ * @brief Remove all entries from the DNS cache.
+ */
+void dns_cache_flush(void);
+
+#else /* CONFIG_DNS_RESOLVER_CACHE */
+
+static inline int dns_cache_add(const char *query,
+				enum dns_query_type query_type,
+				const struct dns_addrinfo *info,
+				uint32_t ttl)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(query_type);
+	ARG_UNUSED(info);
+	ARG_UNUSED(ttl);
+
+	return 0;
+}
+
+static inline int dns_cache_add_negative(const char *query,
+					 enum dns_query_type query_type)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(query_type);
+
+	return 0;
+}
+
+static inline int dns_cache_find(const char *query,
+				 enum dns_query_type query_type,
+				 struct dns_addrinfo *info,
+				 size_t max_count)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(query_type);
+	ARG_UNUSED(info);
+	ARG_UNUSED(max_count);
+
+	return 0;
+}
+
+static inline void dns_cache_flush(void)
+{
+}
+
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DNS_CACHE_H_ */
@@ -701,6 +701,207 @@ static inline bool port_in_use(uint16_t proto, uint16_t port, const struct in_ad
 #endif /* CONFIG_NET_TEST */
 
 
+#if defined(CONFIG_MDNS_RESPONDER_DNS_SD_ANSWER_CACHE)
+
+/* This value is recommended by RFC 1035 */
+#define DNS_SD_ANSWER_BUF_SIZE 512
+
+/* A pre-serialized PTR query response. The buffer holds the DNS
+ * header, PTR, TXT and SRV records (base_len bytes), followed by the
+ * AAAA and A record shells. The record shells only use message
+ * compression pointers into the base part, so they can be appended to
+ * a response in any combination. The address rdata is at the end of
+ * each shell and is patched in when the response is assembled.
+ */
+struct dns_sd_answer {
+	const struct dns_sd_rec *rec;
+	uint16_t port; /* port the answer was compiled with */
+	uint16_t base_len;
+	uint16_t aaaa_len;
+	uint16_t a_len;
+	uint8_t buf[DNS_SD_ANSWER_BUF_SIZE];
+};
+
+static struct dns_sd_answer answers[CONFIG_MDNS_RESPONDER_DNS_SD_ANSWER_CACHE_ENTRIES];
+
+static K_MUTEX_DEFINE(answers_lock);
+
+/* Must be invoked with answers lock held */
+static int answer_compile(struct dns_sd_answer *answer,
+			  const struct dns_sd_rec *inst)
+{
+	static const uint8_t addr_zero[16];
+	struct dns_header *rsp = (struct dns_header *)answer->buf;
+	uint16_t instance_offset;
+	uint16_t service_offset;
+	uint16_t domain_offset;
+	uint16_t host_offset;
+	uint16_t offset = sizeof(struct dns_header);
+	int r;
+
+	memset(rsp, 0, sizeof(*rsp));
+
+	r = add_ptr_record(inst, DNS_SD_PTR_TTL, answer->buf, offset,
+			   sizeof(answer->buf) - offset, &service_offset,
+			   &instance_offset, &domain_offset);
+	if (r < 0) {
+		return r;
+	}
+
+	offset += r;
+
+	r = add_txt_record(inst, DNS_SD_TXT_TTL, instance_offset, answer->buf,
+			   offset, sizeof(answer->buf) - offset);
+	if (r < 0) {
+		return r;
+	}
+
+	offset += r;
+
+	r = add_srv_record(inst, DNS_SD_SRV_TTL, instance_offset,
+			   domain_offset, answer->buf, offset,
+			   sizeof(answer->buf) - offset, &host_offset);
+	if (r < 0) {
+		return r;
+	}
+
+	offset += r;
+	answer->base_len = offset;
+
+	/* Compile the address record shells with placeholder rdata */
+	r = add_aaaa_record(inst, DNS_SD_AAAA_TTL, host_offset, addr_zero,
+			    answer->buf, offset, sizeof(answer->buf) - offset);
+	if (r < 0) {
+		return r;
+	}
+
+	answer->aaaa_len = r;
+	offset += r;
+
+	r = add_a_record(inst, DNS_SD_A_TTL, host_offset, 0, answer->buf,
+			 offset, sizeof(answer->buf) - offset);
+	if (r < 0) {
+		return r;
+	}
+
+	answer->a_len = r;
+
+	/* The answer count is always 1 (the PTR record), the
+	 * additional record count is set when the response is
+	 * assembled.
+	 */
+	rsp->flags = htons(BIT(15) | BIT(10));
+	rsp->ancount = htons(1);
+
+	answer->port = *(inst->port);
+	answer->rec = inst;
+
+	NET_DBG("Compiled answer for %s.%s.%s.%s (%u bytes)",
+		inst->instance, inst->service, inst->proto, inst->domain,
+		answer->base_len);
+
+	return 0;
+}
+
+/* Get the compiled answer for a service, (re)compiling it on the
+ * first query and whenever the registered port has changed (e.g. an
+ * ephemeral port that was bound after registration). Must be invoked
+ * with answers lock held.
+ */
+static struct dns_sd_answer *answer_get(const struct dns_sd_rec *inst)
+{
+	struct dns_sd_answer *answer = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(answers); i++) {
+		if (answers[i].rec == inst) {
+			answer = &answers[i];
+			break;
+		}
+
+		if (answer == NULL && answers[i].rec == NULL) {
+			answer = &answers[i];
+		}
+	}
+
+	if (answer == NULL) {
+		NET_WARN("No answer cache slot for %s.%s.%s.%s",
+			 inst->instance, inst->service, inst->proto,
+			 inst->domain);
+		return NULL;
+	}
+
+	if (answer->rec != inst || answer->port != *(inst->port)) {
+		if (answer_compile(answer, inst) < 0) {
+			answer->rec = NULL;
+			return NULL;
+		}
+	}
+
+	return answer;
+}
+
+static int answer_assemble(const struct dns_sd_rec *inst,
+			   const struct in_addr *addr4,
+			   const struct in6_addr *addr6,
+			   uint8_t *buf, uint16_t buf_size)
+{
+	struct dns_sd_answer *answer;
+	uint16_t arcount = 2; /* TXT and SRV */
+	uint16_t offset;
+	int ret;
+
+	k_mutex_lock(&answers_lock, K_FOREVER);
+
+	answer = answer_get(inst);
+	if (answer == NULL) {
+		ret = -ENOENT;
+		goto unlock;
+	}
+
+	offset = answer->base_len +
+		(addr6 != NULL ? answer->aaaa_len : 0) +
+		(addr4 != NULL ? answer->a_len : 0);
+	if (offset > buf_size) {
+		ret = -ENOSPC;
+		goto unlock;
+	}
+
+	memcpy(buf, answer->buf, answer->base_len);
+	offset = answer->base_len;
+
+	if (addr6 != NULL) {
+		memcpy(buf + offset, answer->buf + answer->base_len,
+		       answer->aaaa_len);
+		memcpy(buf + offset + answer->aaaa_len -
+		       sizeof(struct in6_addr),
+		       addr6->s6_addr, sizeof(struct in6_addr));
+		offset += answer->aaaa_len;
+		arcount++;
+	}
+
+	if (addr4 != NULL) {
+		memcpy(buf + offset,
+		       answer->buf + answer->base_len + answer->aaaa_len,
+		       answer->a_len);
+		memcpy(buf + offset + answer->a_len - sizeof(struct in_addr),
+		       &addr4->s_addr, sizeof(struct in_addr));
+		offset += answer->a_len;
+		arcount++;
+	}
+
+	((struct dns_header *)buf)->arcount = htons(arcount);
+
+	ret = offset;
+
+unlock:
+	k_mutex_unlock(&answers_lock);
+
+	return ret;
+}
+
+#endif /* CONFIG_MDNS_RESPONDER_DNS_SD_ANSWER_CACHE */
+
 int dns_sd_handle_ptr_query(const struct dns_sd_rec *inst, const struct in_addr *addr4,
 			    const struct in6_addr *addr6, uint8_t *buf, uint16_t buf_size)
 {
@@ -755,6 +956,15 @@ int dns_sd_handle_ptr_query(const struct dns_sd_rec *inst, const struct in_addr
 		return -EHOSTDOWN;
 	}
 
+#if defined(CONFIG_MDNS_RESPONDER_DNS_SD_ANSWER_CACHE)
+	r = answer_assemble(inst, addr4, addr6, buf, buf_size);
+	if (r >= 0) {
+		return r;
+	}
+
+	/* Otherwise build the response from scratch below */
+#endif
+
 	/* first add the answer record */
 	r = add_ptr_record(inst, DNS_SD_PTR_TTL, buf, offset, buf_size - offset, &service_offset,
 			   &instance_offset, &domain_offset);
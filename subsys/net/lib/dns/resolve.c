@@ -26,6 +26,7 @@ LOG_MODULE_REGISTER(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 #include <zephyr/net/dns_resolve.h>
 #include "dns_pack.h"
 #include "dns_internal.h"
+#include "dns_cache.h"
 
 #define DNS_SERVER_COUNT CONFIG_DNS_RESOLVER_MAX_SERVERS
 #define SERVER_COUNT     (DNS_SERVER_COUNT + DNS_MAX_MCAST_SERVERS)
@@ -472,7 +473,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     uint16_t *query_hash)
 {
 	struct dns_addrinfo info = { 0 };
-	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t ttl; /* RR ttl, passed to the resolver cache */
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -633,6 +634,10 @@ query_known:
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
+			dns_cache_add(ctx->queries[*query_idx].query,
+				      ctx->queries[*query_idx].query_type,
+				      &info, ttl);
+
 			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
 					      &ctx->queries[*query_idx]);
 			items++;
@@ -748,6 +753,11 @@ static int dns_read(struct dns_resolve_context *ctx,
 		goto quit;
 	}
 
+	if (ret == DNS_EAI_NODATA) {
+		dns_cache_add_negative(ctx->queries[query_idx].query,
+				       ctx->queries[query_idx].query_type);
+	}
+
 	invoke_query_callback(ret, NULL, &ctx->queries[query_idx]);
 
 	/* Marks the end of the results */
@@ -1118,7 +1128,7 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	struct net_buf *dns_qname = NULL;
 	struct sockaddr addr;
 	int ret, i = -1, j = 0;
-	int failure = 0;
+	int failure = 0, sent = 0;
 	bool mdns_query = false;
 	uint8_t hop_limit;
 
@@ -1181,6 +1191,41 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 		return 0;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	{
+		struct dns_addrinfo cached[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+		int found, k;
+
+		found = dns_cache_find(query, type, cached,
+				       ARRAY_SIZE(cached));
+		if (found > 0) {
+			NET_DBG("Cache hit for %s", query);
+
+			for (k = 0; k < found; k++) {
+				cb(DNS_EAI_INPROGRESS, &cached[k], user_data);
+			}
+
+			cb(DNS_EAI_ALLDONE, NULL, user_data);
+
+			if (dns_id) {
+				*dns_id = 0U;
+			}
+
+			return 0;
+		} else if (found == -ENOENT) {
+			NET_DBG("Negative cache hit for %s", query);
+
+			cb(DNS_EAI_NODATA, NULL, user_data);
+
+			if (dns_id) {
+				*dns_id = 0U;
+			}
+
+			return 0;
+		}
+	}
+#endif
+
 try_resolve:
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
@@ -1281,17 +1326,24 @@ try_resolve:
 			continue;
 		}
 
-		/* Do one concurrent query only for each name resolve.
-		 * TODO: Change the i (query index) to do multiple concurrent
-		 *       to each server.
+		sent++;
+
+		/* The same query can be sent to all eligible servers at
+		 * once as they share the query id and hash. The first
+		 * answer releases the query and any late duplicate is
+		 * then dropped by the response matching.
 		 */
-		break;
+		if (!IS_ENABLED(CONFIG_DNS_RESOLVER_QUERY_FANOUT)) {
+			/* Do one concurrent query only for each name resolve.
+			 */
+			break;
+		}
 	}
 
 	if (failure) {
 		NET_DBG("DNS query failed %d times", failure);
 
-		if (failure == j) {
+		if (sent == 0) {
 			ret = -ENOENT;
 			goto quit;
 		}
@@ -1412,6 +1464,9 @@ int dns_resolve_reconfigure(struct dns_resolve_context *ctx,
 		}
 	}
 
+	/* Cached answers from the old servers may no longer be valid */
+	dns_cache_flush();
+
 	err = dns_resolve_init_locked(ctx, servers, servers_sa);
 
 unlock:
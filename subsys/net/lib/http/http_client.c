@@ -715,3 +715,298 @@ int http_client_req(int sock, struct http_request *req,
 out:
 	return ret;
 }
+
+#if defined(CONFIG_HTTP_CLIENT_CONNECTION_POOL)
+
+#define POOL_IDLE_TIMEOUT_MS \
+	(MSEC_PER_SEC * CONFIG_HTTP_CLIENT_CONNECTION_POOL_IDLE_TIMEOUT)
+#define POOL_MAX_HOST_LEN 64
+#define POOL_MAX_PORT_LEN 8
+
+struct pool_conn {
+	char host[POOL_MAX_HOST_LEN];
+	char port[POOL_MAX_PORT_LEN];
+	const sec_tag_t *sec_tag_list;
+	size_t sec_tag_count;
+	int64_t last_used;
+	int sock;
+	bool in_use;
+};
+
+/* Connections kept open between requests, a free slot has an empty host */
+static struct pool_conn conn_pool[CONFIG_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+static K_MUTEX_DEFINE(pool_lock);
+
+static void pool_conn_close(struct pool_conn *conn)
+{
+	if (conn->sock >= 0) {
+		(void)zsock_close(conn->sock);
+	}
+
+	conn->sock = -1;
+	conn->host[0] = '\0';
+}
+
+static bool pool_conn_alive(struct pool_conn *conn)
+{
+	struct zsock_pollfd pfd = {
+		.fd = conn->sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	if (k_uptime_get() - conn->last_used > POOL_IDLE_TIMEOUT_MS) {
+		NET_DBG("Pooled connection to %s:%s idled out",
+			conn->host, conn->port);
+		return false;
+	}
+
+	/* Anything pending on an idle connection means that the server has
+	 * closed it or sent data we did not ask for.
+	 */
+	if (zsock_poll(&pfd, 1, 0) != 0) {
+		NET_DBG("Pooled connection to %s:%s closed by peer",
+			conn->host, conn->port);
+		return false;
+	}
+
+	return true;
+}
+
+static int pool_connect(const char *host, const char *port,
+			const struct http_pool_sec_config *sec)
+{
+	struct zsock_addrinfo hints = {
+		.ai_socktype = SOCK_STREAM,
+	};
+	struct zsock_addrinfo *res, *ai;
+	int sock = -1;
+	int ret;
+
+	ret = zsock_getaddrinfo(host, port, &hints, &res);
+	if (ret != 0) {
+		NET_DBG("Cannot resolve %s (%d)", host, ret);
+		return -EHOSTUNREACH;
+	}
+
+	ret = -ECONNREFUSED;
+
+	for (ai = res; ai != NULL; ai = ai->ai_next) {
+		if (sec != NULL) {
+			sock = zsock_socket(ai->ai_family, SOCK_STREAM,
+					    IPPROTO_TLS_1_2);
+		} else {
+			sock = zsock_socket(ai->ai_family, SOCK_STREAM,
+					    ai->ai_protocol);
+		}
+
+		if (sock < 0) {
+			ret = -errno;
+			continue;
+		}
+
+		if (sec != NULL) {
+			const char *hostname =
+				sec->hostname != NULL ? sec->hostname : host;
+			int cache = TLS_SESSION_CACHE_ENABLED;
+
+			if (zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST,
+					     sec->sec_tag_list,
+					     sec->sec_tag_count *
+						sizeof(sec_tag_t)) < 0 ||
+			    zsock_setsockopt(sock, SOL_TLS, TLS_HOSTNAME,
+					     hostname,
+					     strlen(hostname) + 1) < 0) {
+				ret = -errno;
+				(void)zsock_close(sock);
+				sock = -1;
+				continue;
+			}
+
+			/* Allow an abbreviated handshake when the connection
+			 * needs to be re-established later. Optional, so a
+			 * failure is ignored.
+			 */
+			(void)zsock_setsockopt(sock, SOL_TLS, TLS_SESSION_CACHE,
+					       &cache, sizeof(cache));
+		}
+
+		if (zsock_connect(sock, ai->ai_addr, ai->ai_addrlen) == 0) {
+			break;
+		}
+
+		ret = -errno;
+		(void)zsock_close(sock);
+		sock = -1;
+	}
+
+	zsock_freeaddrinfo(res);
+
+	if (sock < 0) {
+		NET_DBG("Cannot connect to %s:%s (%d)", host, port, ret);
+		return ret;
+	}
+
+	return sock;
+}
+
+/* Reserve a connection for the request, reusing a live pooled one when
+ * possible. A reserved slot with a negative sock still needs connecting.
+ */
+static int pool_get(const struct http_request *req,
+		    const struct http_pool_sec_config *sec,
+		    struct pool_conn **result)
+{
+	struct pool_conn *free_conn = NULL;
+	struct pool_conn *lru = NULL;
+	struct pool_conn *conn;
+	int i;
+
+	if (strlen(req->host) >= POOL_MAX_HOST_LEN ||
+	    strlen(req->port) >= POOL_MAX_PORT_LEN) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		conn = &conn_pool[i];
+
+		if (conn->in_use) {
+			continue;
+		}
+
+		if (conn->host[0] == '\0') {
+			if (free_conn == NULL) {
+				free_conn = conn;
+			}
+
+			continue;
+		}
+
+		if (strcmp(conn->host, req->host) == 0 &&
+		    strcmp(conn->port, req->port) == 0 &&
+		    conn->sec_tag_list ==
+			(sec != NULL ? sec->sec_tag_list : NULL)) {
+			if (pool_conn_alive(conn)) {
+				conn->in_use = true;
+				*result = conn;
+				return 0;
+			}
+
+			/* Stale, reconnect in its place */
+			pool_conn_close(conn);
+			free_conn = conn;
+			continue;
+		}
+
+		if (lru == NULL || conn->last_used < lru->last_used) {
+			lru = conn;
+		}
+	}
+
+	if (free_conn == NULL) {
+		if (lru == NULL) {
+			/* Every connection is serving a request */
+			return -EAGAIN;
+		}
+
+		NET_DBG("Evicting pooled connection to %s:%s",
+			lru->host, lru->port);
+		pool_conn_close(lru);
+		free_conn = lru;
+	}
+
+	strcpy(free_conn->host, req->host);
+	strcpy(free_conn->port, req->port);
+	free_conn->sec_tag_list = sec != NULL ? sec->sec_tag_list : NULL;
+	free_conn->sec_tag_count = sec != NULL ? sec->sec_tag_count : 0;
+	free_conn->sock = -1;
+	free_conn->in_use = true;
+	*result = free_conn;
+
+	return 0;
+}
+
+int http_client_pool_req(struct http_request *req,
+			 const struct http_pool_sec_config *sec,
+			 int32_t timeout, void *user_data)
+{
+	struct pool_conn *conn;
+	bool reused;
+	bool keep;
+	int ret;
+
+	if (req == NULL || req->host == NULL || req->port == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+	ret = pool_get(req, sec, &conn);
+	k_mutex_unlock(&pool_lock);
+	if (ret < 0) {
+		return ret;
+	}
+
+	reused = conn->sock >= 0;
+
+	if (!reused) {
+		ret = pool_connect(req->host, req->port, sec);
+		if (ret < 0) {
+			goto release;
+		}
+
+		conn->sock = ret;
+	}
+
+	ret = http_client_req(conn->sock, req, timeout, user_data);
+
+	if (ret < 0 && reused) {
+		/* The server may have closed the connection while it sat
+		 * idle, retry once on a fresh one.
+		 */
+		NET_DBG("Retrying on a fresh connection to %s:%s (%d)",
+			req->host, req->port, ret);
+
+		(void)zsock_close(conn->sock);
+		conn->sock = -1;
+
+		ret = pool_connect(req->host, req->port, sec);
+		if (ret < 0) {
+			goto release;
+		}
+
+		conn->sock = ret;
+		ret = http_client_req(conn->sock, req, timeout, user_data);
+	}
+
+release:
+	keep = ret >= 0 && req->internal.response.message_complete &&
+	       http_should_keep_alive(&req->internal.parser);
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+	if (keep) {
+		conn->last_used = k_uptime_get();
+	} else {
+		pool_conn_close(conn);
+	}
+
+	conn->in_use = false;
+	k_mutex_unlock(&pool_lock);
+
+	return ret;
+}
+
+void http_client_pool_purge(void)
+{
+	int i;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		if (!conn_pool[i].in_use && conn_pool[i].host[0] != '\0') {
+			pool_conn_close(&conn_pool[i]);
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+#endif /* CONFIG_HTTP_CLIENT_CONNECTION_POOL */
@@ -172,6 +172,230 @@ static void free_block_ctx(struct lwm2m_block_context *ctx)
 	ctx->tkl = 0U;
 }
 
+#if defined(CONFIG_LWM2M_COAP_BLOCK_TRANSFER)
+/* Outgoing bodies that do not fit into the message buffer are encoded into
+ * a shared buffer and split into CoAP blocks. The encoded body is retained
+ * so that the blocks the peer requests afterwards can be served without
+ * running the readers again.
+ */
+static uint8_t body_buf[CONFIG_LWM2M_COAP_ENCODE_BUFFER_SIZE];
+
+BUILD_ASSERT(CONFIG_LWM2M_COAP_ENCODE_BUFFER_SIZE >= CONFIG_LWM2M_COAP_MAX_MSG_SIZE,
+	     "Encode buffer can't be smaller than the message buffer!");
+
+/* Message currently being encoded into body_buf and its original packet */
+static struct lwm2m_message *body_encode_msg;
+static struct coap_packet body_encode_pkt;
+
+/* Retained over-sized body, served one BLOCK2 block at a time */
+static struct {
+	struct lwm2m_obj_path path;
+	uint16_t content_format;
+	uint16_t offset; /* start of the payload in body_buf */
+	uint16_t len;
+	int64_t timestamp;
+	bool last_sent;
+	bool active;
+} body_out;
+
+static void body_encode_begin(struct lwm2m_message *msg)
+{
+	if (body_out.active && !body_out.last_sent &&
+	    k_uptime_get() - body_out.timestamp <= TIMEOUT_BLOCKWISE_TRANSFER_MS) {
+		/* A previous body is still being fetched, encode into the
+		 * message buffer as usual so it is not overwritten.
+		 */
+		return;
+	}
+
+	body_out.active = false;
+
+	/* Continue in the larger buffer after the header built so far */
+	memcpy(body_buf, msg->cpkt.data, msg->cpkt.offset);
+	body_encode_pkt = msg->cpkt;
+	msg->cpkt.data = body_buf;
+	msg->cpkt.max_len = sizeof(body_buf);
+	body_encode_msg = msg;
+	body_out.path = msg->path;
+}
+
+static int body_append_block(struct lwm2m_message *msg, uint32_t block_num,
+			     enum coap_block_size block_size)
+{
+	struct coap_block_context ctx = {
+		.block_size = block_size,
+		.total_size = body_out.len,
+		.current = block_num * coap_block_size_to_bytes(block_size),
+	};
+	uint16_t len;
+	int r;
+
+	if (ctx.current >= body_out.len) {
+		return -ENOENT;
+	}
+
+	r = coap_append_block2_option(&msg->cpkt, &ctx);
+	if (r < 0) {
+		return r;
+	}
+
+	if (block_num == 0U) {
+		r = coap_append_size2_option(&msg->cpkt, &ctx);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	r = coap_packet_append_payload_marker(&msg->cpkt);
+	if (r < 0) {
+		return r;
+	}
+
+	len = MIN(coap_block_size_to_bytes(block_size), body_out.len - ctx.current);
+	r = coap_packet_append_payload(&msg->cpkt, &body_buf[body_out.offset + ctx.current],
+				       len);
+	if (r < 0) {
+		return r;
+	}
+
+	if (ctx.current + len >= body_out.len) {
+		/* Keep the body around until it times out so that a lost
+		 * last block can be requested again.
+		 */
+		body_out.last_sent = true;
+	}
+
+	return 0;
+}
+
+static int body_encode_end(struct lwm2m_message *msg, uint16_t content_format, int ret)
+{
+	struct coap_packet body_pkt;
+	const uint8_t *payload;
+	uint16_t payload_len;
+	int r;
+
+	if (body_encode_msg != msg) {
+		return ret;
+	}
+
+	body_encode_msg = NULL;
+	body_pkt = msg->cpkt;
+
+	/* Move back to the message buffer */
+	msg->cpkt.data = body_encode_pkt.data;
+	msg->cpkt.max_len = body_encode_pkt.max_len;
+
+	if (ret < 0) {
+		/* Drop the encoded body and restore the pre-encode state */
+		msg->cpkt.offset = body_encode_pkt.offset;
+		msg->cpkt.hdr_len = body_encode_pkt.hdr_len;
+		msg->cpkt.opt_len = body_encode_pkt.opt_len;
+		msg->cpkt.delta = body_encode_pkt.delta;
+		return ret;
+	}
+
+	if (body_pkt.offset <= msg->cpkt.max_len) {
+		/* The whole message fits in the message buffer after all */
+		memcpy(msg->cpkt.data, body_buf, body_pkt.offset);
+		msg->cpkt.offset = body_pkt.offset;
+		msg->cpkt.hdr_len = body_pkt.hdr_len;
+		msg->cpkt.opt_len = body_pkt.opt_len;
+		msg->cpkt.delta = body_pkt.delta;
+		return ret;
+	}
+
+	payload = coap_packet_get_payload(&body_pkt, &payload_len);
+	if (!payload || payload_len == 0U) {
+		/* Header and options alone do not fit */
+		return -ENOMEM;
+	}
+
+	body_out.content_format = content_format;
+	body_out.offset = payload - body_buf;
+	body_out.len = payload_len;
+	body_out.timestamp = k_uptime_get();
+	body_out.last_sent = false;
+	body_out.active = true;
+
+	/* Rebuild the message as the first block: reuse the header and the
+	 * options as they were encoded, then append the BLOCK2 and SIZE2
+	 * options and the first block of the payload.
+	 */
+	memcpy(msg->cpkt.data, body_buf, body_pkt.hdr_len + body_pkt.opt_len);
+	msg->cpkt.offset = body_pkt.hdr_len + body_pkt.opt_len;
+	msg->cpkt.hdr_len = body_pkt.hdr_len;
+	msg->cpkt.opt_len = body_pkt.opt_len;
+	msg->cpkt.delta = body_pkt.delta;
+
+	r = body_append_block(msg, 0U, lwm2m_default_block_size());
+	if (r < 0) {
+		body_out.active = false;
+		return r;
+	}
+
+	LOG_DBG("Body of %u bytes sent as %d byte blocks", payload_len,
+		coap_block_size_to_bytes(lwm2m_default_block_size()));
+
+	return ret;
+}
+
+static int body_reply_block(struct lwm2m_message *msg)
+{
+	uint32_t block_num;
+	int block_opt;
+	int r;
+
+	block_opt = coap_get_option_int(msg->in.in_cpkt, COAP_OPTION_BLOCK2);
+	if (block_opt < 0) {
+		return -ENODATA;
+	}
+
+	block_num = GET_BLOCK_NUM(block_opt);
+	if (block_num == 0U) {
+		/* The first block is built from a fresh read */
+		return -ENODATA;
+	}
+
+	if (!body_out.active ||
+	    k_uptime_get() - body_out.timestamp > TIMEOUT_BLOCKWISE_TRANSFER_MS ||
+	    memcmp(&body_out.path, &msg->path, sizeof(msg->path)) != 0) {
+		LOG_WRN("No retained body for requested block %u", block_num);
+		return -ENOENT;
+	}
+
+	r = coap_append_option_int(msg->out.out_cpkt, COAP_OPTION_CONTENT_FORMAT,
+				   body_out.content_format);
+	if (r < 0) {
+		return r;
+	}
+
+	body_out.timestamp = k_uptime_get();
+
+	return body_append_block(msg, block_num, GET_BLOCK_SIZE(block_opt));
+}
+#else /* !CONFIG_LWM2M_COAP_BLOCK_TRANSFER */
+static inline void body_encode_begin(struct lwm2m_message *msg)
+{
+	ARG_UNUSED(msg);
+}
+
+static inline int body_encode_end(struct lwm2m_message *msg, uint16_t content_format, int ret)
+{
+	ARG_UNUSED(msg);
+	ARG_UNUSED(content_format);
+
+	return ret;
+}
+
+static inline int body_reply_block(struct lwm2m_message *msg)
+{
+	ARG_UNUSED(msg);
+
+	return -ENODATA;
+}
+#endif /* CONFIG_LWM2M_COAP_BLOCK_TRANSFER */
+
 void lwm2m_engine_context_close(struct lwm2m_ctx *client_ctx)
 {
 	struct lwm2m_message *msg;
@@ -1267,44 +1491,57 @@ static int lwm2m_delete_handler(struct lwm2m_message *msg)
 
 static int do_read_op(struct lwm2m_message *msg, uint16_t content_format)
 {
+	int ret;
+
+	body_encode_begin(msg);
+
 	switch (content_format) {
 
 	case LWM2M_FORMAT_APP_OCTET_STREAM:
 	case LWM2M_FORMAT_PLAIN_TEXT:
 	case LWM2M_FORMAT_OMA_PLAIN_TEXT:
-		return do_read_op_plain_text(msg, content_format);
+		ret = do_read_op_plain_text(msg, content_format);
+		break;
 
 #if defined(CONFIG_LWM2M_RW_OMA_TLV_SUPPORT)
 	case LWM2M_FORMAT_OMA_TLV:
 	case LWM2M_FORMAT_OMA_OLD_TLV:
-		return do_read_op_tlv(msg, content_format);
+		ret = do_read_op_tlv(msg, content_format);
+		break;
 #endif
 
 #if defined(CONFIG_LWM2M_RW_JSON_SUPPORT)
 	case LWM2M_FORMAT_OMA_JSON:
 	case LWM2M_FORMAT_OMA_OLD_JSON:
-		return do_read_op_json(msg, content_format);
+		ret = do_read_op_json(msg, content_format);
+		break;
 #endif
 
 #if defined(CONFIG_LWM2M_RW_SENML_JSON_SUPPORT)
 	case LWM2M_FORMAT_APP_SEML_JSON:
-		return do_read_op_senml_json(msg);
+		ret = do_read_op_senml_json(msg);
+		break;
 #endif
 
 #if defined(CONFIG_LWM2M_RW_CBOR_SUPPORT)
 	case LWM2M_FORMAT_APP_CBOR:
-		return do_read_op_cbor(msg);
+		ret = do_read_op_cbor(msg);
+		break;
 #endif
 
 #if defined(CONFIG_LWM2M_RW_SENML_CBOR_SUPPORT)
 	case LWM2M_FORMAT_APP_SENML_CBOR:
-		return do_read_op_senml_cbor(msg);
+		ret = do_read_op_senml_cbor(msg);
+		break;
 #endif
 
 	default:
 		LOG_ERR("Unsupported content-format: %u", content_format);
-		return -ENOMSG;
+		ret = -ENOMSG;
+		break;
 	}
+
+	return body_encode_end(msg, content_format, ret);
 }
 
 static int do_composite_read_op(struct lwm2m_message *msg, uint16_t content_format)
@@ -2096,7 +2333,11 @@ int handle_request(struct coap_packet *request, struct lwm2m_message *msg)
 				}
 			} else {
 				if ((code & COAP_REQUEST_MASK) == COAP_METHOD_GET) {
-					r = do_read_op(msg, accept);
+					/* Serve blocks of a retained body directly */
+					r = body_reply_block(msg);
+					if (r == -ENODATA) {
+						r = do_read_op(msg, accept);
+					}
 				} else {
 					r = do_composite_read_op(msg, accept);
 				}
@@ -20,6 +20,10 @@ LOG_MODULE_REGISTER(net_sock_addr, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/net/socket_offload.h>
 #include <zephyr/syscall_handler.h>
 
+#if defined(CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC)
+#include <zephyr/posix/sys/eventfd.h>
+#endif
+
 #if defined(CONFIG_DNS_RESOLVER) || defined(CONFIG_NET_IP)
 #define ANY_RESOLVER
 
@@ -402,6 +406,271 @@ static int try_resolve_literal_addr(const char *host, const char *service,
 }
 #endif /* CONFIG_NET_IP */
 
+#if defined(CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC)
+
+static void dns_resolve_async_cb(enum dns_resolve_status status,
+				 struct dns_addrinfo *info, void *user_data)
+{
+	struct zsock_addrinfo_async_query *query = user_data;
+	struct zsock_addrinfo_async *req = query->req;
+	struct zsock_addrinfo *ai;
+	int socktype = SOCK_STREAM;
+	k_spinlock_key_t key;
+
+	NET_DBG("dns status: %d", status);
+
+	if (info == NULL) {
+		if (status == DNS_EAI_ALLDONE) {
+			status = 0;
+		}
+
+		query->status = status;
+
+		/* Signal the eventfd when the last outstanding query is
+		 * done.
+		 */
+		if (atomic_dec(&req->pending) == 1) {
+			(void)eventfd_write(req->fd, 1);
+		}
+
+		return;
+	}
+
+	/* IPv4 and IPv6 queries run in parallel so the result array needs
+	 * to be protected.
+	 */
+	key = k_spin_lock(&req->lock);
+
+	if (req->idx >= AI_ARR_MAX) {
+		k_spin_unlock(&req->lock, key);
+		NET_DBG("getaddrinfo entries overflow");
+		return;
+	}
+
+	ai = &req->ai_arr[req->idx];
+	if (req->idx > 0) {
+		req->ai_arr[req->idx - 1].ai_next = ai;
+	}
+
+	memcpy(&ai->_ai_addr, &info->ai_addr, info->ai_addrlen);
+	net_sin(&ai->_ai_addr)->sin_port = req->port;
+	ai->ai_addr = &ai->_ai_addr;
+	ai->ai_addrlen = info->ai_addrlen;
+	memcpy(&ai->_ai_canonname, &info->ai_canonname,
+	       sizeof(ai->_ai_canonname));
+	ai->ai_canonname = ai->_ai_canonname;
+	ai->ai_family = info->ai_family;
+
+	if (req->hints && req->hints->ai_socktype) {
+		socktype = req->hints->ai_socktype;
+	}
+
+	ai->ai_socktype = socktype;
+	ai->ai_protocol = (socktype == SOCK_DGRAM) ? IPPROTO_UDP : IPPROTO_TCP;
+
+	req->idx++;
+
+	k_spin_unlock(&req->lock, key);
+}
+
+static int exec_query_async(const char *host, int family,
+			    struct zsock_addrinfo_async_query *query)
+{
+	enum dns_query_type qtype = DNS_QUERY_TYPE_A;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		qtype = DNS_QUERY_TYPE_AAAA;
+	}
+
+	return dns_get_addr_info(host, qtype, &query->dns_id,
+				 dns_resolve_async_cb, query,
+				 CONFIG_NET_SOCKETS_DNS_TIMEOUT);
+}
+
+static void getaddrinfo_async_release(struct zsock_addrinfo_async *req)
+{
+	(void)zsock_close(req->fd);
+	req->fd = -1;
+
+	free(req->ai_arr);
+	req->ai_arr = NULL;
+}
+
+int zsock_getaddrinfo_async(const char *host, const char *service,
+			    const struct zsock_addrinfo *hints,
+			    struct zsock_addrinfo_async *req)
+{
+	int family = AF_UNSPEC;
+	int ai_flags = 0;
+	long int port = 0;
+	int launched = 0;
+	int ret;
+
+	if (hints) {
+		family = hints->ai_family;
+		ai_flags = hints->ai_flags;
+	}
+
+	if (service) {
+		port = strtol(service, NULL, 10);
+		if (port < 1 || port > 65535) {
+			return DNS_EAI_NONAME;
+		}
+	}
+
+	if (host == NULL && service == NULL) {
+		/* Per POSIX, both can't be NULL. */
+		errno = EINVAL;
+		return DNS_EAI_SYSTEM;
+	}
+
+	memset(req, 0, sizeof(*req));
+	req->hints = hints;
+	req->port = htons(port);
+	req->queries[0].req = req;
+	req->queries[0].status = DNS_EAI_ADDRFAMILY;
+	req->queries[1].req = req;
+	req->queries[1].status = DNS_EAI_ADDRFAMILY;
+
+	req->fd = eventfd(0, 0);
+	if (req->fd < 0) {
+		return DNS_EAI_SYSTEM;
+	}
+
+	req->ai_arr = calloc(AI_ARR_MAX, sizeof(struct zsock_addrinfo));
+	if (req->ai_arr == NULL) {
+		(void)zsock_close(req->fd);
+		req->fd = -1;
+		return DNS_EAI_MEMORY;
+	}
+
+	/* Literal addresses and the NULL host case resolve immediately,
+	 * the eventfd is signalled right away so that the caller can use
+	 * one code path for all results.
+	 */
+	if (host == NULL) {
+		ret = getaddrinfo_null_host(port, hints, req->ai_arr);
+	} else {
+		ret = try_resolve_literal_addr(host, service, hints,
+					       req->ai_arr);
+	}
+
+	if (ret == 0) {
+		req->queries[0].status = 0;
+		req->idx = 1U;
+		(void)eventfd_write(req->fd, 1);
+		return 0;
+	}
+
+	if (host == NULL || (ai_flags & AI_NUMERICHOST)) {
+		getaddrinfo_async_release(req);
+		return (host == NULL) ? ret : DNS_EAI_FAIL;
+	}
+
+	/* In case IPv4 is not supported, force to check only for IPv6 */
+	if (family == AF_UNSPEC && !IS_ENABLED(CONFIG_NET_IPV4)) {
+		family = AF_INET6;
+	}
+
+	/* Hold one reference over the launch phase so that queries
+	 * completing synchronously (e.g. from the resolver cache) cannot
+	 * signal completion before all of them have been sent.
+	 */
+	atomic_set(&req->pending, 1);
+
+	atomic_inc(&req->pending);
+	ret = exec_query_async(host, (family == AF_UNSPEC) ? AF_INET : family,
+			       &req->queries[0]);
+	if (ret == 0) {
+		launched++;
+	} else {
+		atomic_dec(&req->pending);
+
+		if (ret == -EPFNOSUPPORT) {
+			errno = EINVAL;
+			req->queries[0].status = DNS_EAI_ADDRFAMILY;
+		} else {
+			errno = -ret;
+			req->queries[0].status = DNS_EAI_SYSTEM;
+		}
+	}
+
+	if (family == AF_UNSPEC && IS_ENABLED(CONFIG_NET_IPV6)) {
+		atomic_inc(&req->pending);
+		ret = exec_query_async(host, AF_INET6, &req->queries[1]);
+		if (ret == 0) {
+			launched++;
+		} else {
+			atomic_dec(&req->pending);
+			errno = -ret;
+			req->queries[1].status = DNS_EAI_SYSTEM;
+		}
+	}
+
+	if (launched == 0) {
+		ret = (req->queries[0].status != DNS_EAI_ADDRFAMILY) ?
+			req->queries[0].status : req->queries[1].status;
+		getaddrinfo_async_release(req);
+		return ret;
+	}
+
+	/* Drop the launch phase reference. */
+	if (atomic_dec(&req->pending) == 1) {
+		(void)eventfd_write(req->fd, 1);
+	}
+
+	return 0;
+}
+
+int zsock_getaddrinfo_async_finish(struct zsock_addrinfo_async *req,
+				   struct zsock_addrinfo **res)
+{
+	int st1 = req->queries[0].status;
+	int st2 = req->queries[1].status;
+
+	/* If both attempts failed, it's error */
+	if (st1 && st2) {
+		*res = NULL;
+		getaddrinfo_async_release(req);
+
+		if (st1 != DNS_EAI_ADDRFAMILY) {
+			return st1;
+		}
+
+		return st2;
+	}
+
+	if (req->idx == 0U) {
+		*res = NULL;
+		getaddrinfo_async_release(req);
+		return DNS_EAI_NODATA;
+	}
+
+	/* Mark entry as last */
+	req->ai_arr[req->idx - 1].ai_next = NULL;
+
+	*res = req->ai_arr;
+	req->ai_arr = NULL;
+
+	(void)zsock_close(req->fd);
+	req->fd = -1;
+
+	return 0;
+}
+
+void zsock_getaddrinfo_async_cancel(struct zsock_addrinfo_async *req)
+{
+	for (int i = 0; i < ARRAY_SIZE(req->queries); i++) {
+		if (req->queries[i].dns_id != 0U) {
+			(void)dns_cancel_addr_info(req->queries[i].dns_id);
+		}
+	}
+
+	getaddrinfo_async_release(req);
+}
+
+#endif /* CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC */
+
 int zsock_getaddrinfo(const char *host, const char *service,
 		      const struct zsock_addrinfo *hints,
 		      struct zsock_addrinfo **res)
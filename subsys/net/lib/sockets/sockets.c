@@ -1087,6 +1087,35 @@ void net_socket_update_tc_rx_time(struct net_pkt *pkt, uint32_t end_tick)
 	}
 }
 
+#if defined(CONFIG_NET_CONTEXT_BUSY_POLL)
+static bool zsock_busy_poll(struct net_context *ctx)
+{
+	uint32_t busy_poll = 0U;
+	uint32_t start, window;
+
+	(void)net_context_get_option(ctx, NET_OPT_BUSY_POLL, &busy_poll, NULL);
+	if (busy_poll == 0U) {
+		return false;
+	}
+
+	start = k_cycle_get_32();
+	window = k_us_to_cyc_ceil32(busy_poll);
+
+	while (k_fifo_is_empty(&ctx->recv_q)) {
+		if ((k_cycle_get_32() - start) >= window) {
+			return false;
+		}
+
+		/* Give equal priority threads, in particular the RX
+		 * thread feeding the receive queue, a chance to run.
+		 */
+		k_yield();
+	}
+
+	return true;
+}
+#endif /* CONFIG_NET_CONTEXT_BUSY_POLL */
+
 int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout)
 {
 	if (ctx->cond.lock == NULL) {
@@ -1100,6 +1129,14 @@ int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout)
 	}
 
 	if (k_fifo_is_empty(&ctx->recv_q)) {
+#if defined(CONFIG_NET_CONTEXT_BUSY_POLL)
+		/* Spin on the receive queue for the configured window
+		 * before paying the cost of a scheduler round trip.
+		 */
+		if (zsock_busy_poll(ctx)) {
+			return 0;
+		}
+#endif
 		/* Wait for the data to arrive but without holding a lock */
 		return k_condvar_wait(&ctx->cond.recv, ctx->cond.lock,
 				      *timeout);
@@ -1873,6 +1910,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 			break;
+
+		case SO_BUSY_POLL:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_BUSY_POLL)) {
+				ret = net_context_get_option(ctx,
+							     NET_OPT_BUSY_POLL,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+			break;
 		}
 
 		break;
@@ -2008,6 +2059,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 			break;
 
+		case SO_BUSY_POLL:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_BUSY_POLL)) {
+				ret = net_context_set_option(ctx,
+							     NET_OPT_BUSY_POLL,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case SO_REUSEADDR:
 			/* Ignore for now. Provided to let port
 			 * existing apps.
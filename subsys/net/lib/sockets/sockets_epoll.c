@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/fdtable.h>
+
+#include "sockets_internal.h"
+
+/* A registered socket. The k_poll events created for it at registration
+ * time live in the instance wide poll_events array, starting at pev_base.
+ */
+struct epoll_entry {
+	int fd;
+	uint32_t events;
+	union zsock_epoll_data data;
+	uint16_t pev_base;
+	uint8_t num_pev;
+	/* POLL_PREPARE short-circuited with -EALREADY at registration
+	 * time, so the readiness of this socket cannot be fully tracked
+	 * by k_poll and must be rechecked on every wait.
+	 */
+	bool always_check;
+	bool in_use;
+};
+
+struct epoll_instance {
+	struct k_mutex lock;
+	struct epoll_entry entries[CONFIG_NET_SOCKETS_EPOLL_MAX_EVENTS];
+	/* Persistent, packed k_poll event array covering all entries */
+	struct k_poll_event poll_events[2 *
+					CONFIG_NET_SOCKETS_EPOLL_MAX_EVENTS];
+	uint16_t num_pev;
+	bool in_use;
+};
+
+static struct epoll_instance instances[CONFIG_NET_SOCKETS_EPOLL_MAX_INSTANCES];
+static K_MUTEX_DEFINE(instances_lock);
+
+/* Register the entry's socket with the kernel poll mechanism. This is
+ * the expensive part that plain zsock_poll() redoes on every call and
+ * epoll does only here, at registration time.
+ */
+static int entry_register(struct epoll_instance *ep, struct epoll_entry *entry)
+{
+	struct zsock_pollfd pfd = {
+		.fd = entry->fd,
+		.events = entry->events & (ZSOCK_POLLIN | ZSOCK_POLLOUT),
+	};
+	struct k_poll_event *pev = &ep->poll_events[ep->num_pev];
+	struct k_poll_event *pev_start = pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = z_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE,
+				   &pfd, &pev,
+				   &ep->poll_events[ARRAY_SIZE(ep->poll_events)]);
+
+	k_mutex_unlock(lock);
+
+	entry->always_check = false;
+
+	if (ret == -EALREADY) {
+		/* Something is ready right now: datagram sockets are
+		 * always writable, or the socket is at EOF or in error.
+		 * Note that events may still have been added before the
+		 * short-circuit, so fall through to account for them.
+		 */
+		entry->always_check = true;
+	} else if (ret == -EXDEV) {
+		/* Offloaded sockets poll through the offload engine and
+		 * cannot be registered persistently.
+		 */
+		return -ENOTSUP;
+	} else if (ret < 0) {
+		return ret;
+	}
+
+	entry->pev_base = pev_start - ep->poll_events;
+	entry->num_pev = pev - pev_start;
+	ep->num_pev += entry->num_pev;
+
+	return 0;
+}
+
+/* Release the entry's slice of the poll_events array, repacking the
+ * array and the base indexes of the other entries.
+ */
+static void entry_unregister(struct epoll_instance *ep,
+			     struct epoll_entry *entry)
+{
+	int i;
+
+	if (entry->num_pev == 0U) {
+		return;
+	}
+
+	memmove(&ep->poll_events[entry->pev_base],
+		&ep->poll_events[entry->pev_base + entry->num_pev],
+		(ep->num_pev - entry->pev_base - entry->num_pev) *
+						sizeof(struct k_poll_event));
+
+	for (i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].in_use &&
+		    ep->entries[i].pev_base > entry->pev_base) {
+			ep->entries[i].pev_base -= entry->num_pev;
+		}
+	}
+
+	ep->num_pev -= entry->num_pev;
+	entry->num_pev = 0U;
+}
+
+static int epoll_fd_close(void *obj)
+{
+	struct epoll_instance *ep = obj;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	memset(ep->entries, 0, sizeof(ep->entries));
+	ep->num_pev = 0U;
+	ep->in_use = false;
+
+	k_mutex_unlock(&ep->lock);
+
+	return 0;
+}
+
+static ssize_t epoll_fd_read(void *obj, void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static ssize_t epoll_fd_write(void *obj, const void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static int epoll_fd_ioctl(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	return -EOPNOTSUPP;
+}
+
+static const struct fd_op_vtable epoll_fd_op_vtable = {
+	.read = epoll_fd_read,
+	.write = epoll_fd_write,
+	.close = epoll_fd_close,
+	.ioctl = epoll_fd_ioctl,
+};
+
+int zsock_epoll_create(int size)
+{
+	struct epoll_instance *ep = NULL;
+	int fd, i;
+
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		errno = ENFILE;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&instances_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(instances); i++) {
+		if (!instances[i].in_use) {
+			ep = &instances[i];
+			ep->in_use = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&instances_lock);
+
+	if (ep == NULL) {
+		z_free_fd(fd);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	k_mutex_init(&ep->lock);
+	memset(ep->entries, 0, sizeof(ep->entries));
+	ep->num_pev = 0U;
+
+	z_finalize_fd(fd, ep, &epoll_fd_op_vtable);
+
+	return fd;
+}
+
+static struct epoll_entry *find_entry(struct epoll_instance *ep, int fd)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].in_use && ep->entries[i].fd == fd) {
+			return &ep->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+int zsock_epoll_ctl(int epfd, int op, int fd, struct zsock_epoll_event *event)
+{
+	struct epoll_instance *ep;
+	struct epoll_entry *entry;
+	int i, ret = 0;
+
+	ep = z_get_fd_obj(epfd, &epoll_fd_op_vtable, EBADF);
+	if (ep == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (fd < 0 || (event == NULL && op != ZSOCK_EPOLL_CTL_DEL)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	entry = find_entry(ep, fd);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		for (i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+			if (!ep->entries[i].in_use) {
+				entry = &ep->entries[i];
+				break;
+			}
+		}
+
+		if (entry == NULL) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		entry->fd = fd;
+		entry->events = event->events;
+		entry->data = event->data;
+		entry->num_pev = 0U;
+		entry->in_use = true;
+
+		ret = entry_register(ep, entry);
+		if (ret < 0) {
+			entry->in_use = false;
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		entry_unregister(ep, entry);
+
+		entry->events = event->events;
+		entry->data = event->data;
+
+		ret = entry_register(ep, entry);
+		if (ret < 0) {
+			entry->in_use = false;
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		entry_unregister(ep, entry);
+		entry->in_use = false;
+
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Report the ready sockets. Only entries whose k_poll events fired (or
+ * which short-circuited at registration time) are rechecked, so the
+ * cost is proportional to the number of ready sockets, not to the
+ * number of registered ones.
+ */
+static int epoll_collect(struct epoll_instance *ep,
+			 struct zsock_epoll_event *events, int maxevents)
+{
+	int i, j, n = 0;
+
+	for (i = 0; i < ARRAY_SIZE(ep->entries) && n < maxevents; i++) {
+		struct epoll_entry *entry = &ep->entries[i];
+		const struct fd_op_vtable *vtable;
+		struct k_poll_event *pev;
+		struct zsock_pollfd pfd;
+		struct k_mutex *lock;
+		bool fired;
+		void *obj;
+		int ret;
+
+		if (!entry->in_use) {
+			continue;
+		}
+
+		fired = entry->always_check;
+
+		for (j = 0; !fired && j < entry->num_pev; j++) {
+			fired = ep->poll_events[entry->pev_base + j].state !=
+							K_POLL_STATE_NOT_READY;
+		}
+
+		if (!fired) {
+			continue;
+		}
+
+		obj = z_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+		if (obj == NULL) {
+			/* The socket was closed while still registered.
+			 * Report it once and drop the registration.
+			 */
+			events[n].events = ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP;
+			events[n].data = entry->data;
+			n++;
+
+			entry_unregister(ep, entry);
+			entry->in_use = false;
+			continue;
+		}
+
+		pfd.fd = entry->fd;
+		pfd.events = entry->events & (ZSOCK_POLLIN | ZSOCK_POLLOUT);
+		pfd.revents = 0;
+
+		pev = &ep->poll_events[entry->pev_base];
+
+		(void)k_mutex_lock(lock, K_FOREVER);
+
+		ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_UPDATE,
+					   &pfd, &pev);
+
+		k_mutex_unlock(lock);
+
+		if (ret == -EAGAIN) {
+			/* Not actually ready (e.g. a TLS socket in
+			 * handshake), wait again.
+			 */
+			continue;
+		} else if (ret < 0) {
+			return ret;
+		}
+
+		pfd.revents &= entry->events |
+			       ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP;
+
+		if (pfd.revents != 0) {
+			events[n].events = pfd.revents;
+			events[n].data = entry->data;
+			n++;
+		}
+	}
+
+	return n;
+}
+
+int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+		     int maxevents, int timeout)
+{
+	k_timeout_t wait = K_NO_WAIT;
+	struct epoll_instance *ep;
+	k_timeout_t full_timeout;
+	uint64_t end;
+	int i, ret;
+
+	ep = z_get_fd_obj(epfd, &epoll_fd_op_vtable, EBADF);
+	if (ep == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	full_timeout = timeout < 0 ? K_FOREVER : K_MSEC(timeout);
+	end = sys_clock_timeout_end_calc(full_timeout);
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	while (true) {
+		for (i = 0; i < ep->num_pev; i++) {
+			ep->poll_events[i].state = K_POLL_STATE_NOT_READY;
+		}
+
+		/* The first pass just picks up what is ready right now,
+		 * subsequent ones block until something fires.
+		 */
+		ret = k_poll(ep->poll_events, ep->num_pev, wait);
+		/* EAGAIN when timeout expired, EINTR when cancelled
+		 * (i.e. EOF)
+		 */
+		if (ret != 0 && ret != -EAGAIN && ret != -EINTR) {
+			break;
+		}
+
+		ret = epoll_collect(ep, events, maxevents);
+		if (ret != 0) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(full_timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(full_timeout, K_FOREVER)) {
+			wait = K_FOREVER;
+		} else {
+			int64_t remaining = end - sys_clock_tick_get();
+
+			if (remaining <= 0) {
+				break;
+			}
+
+			wait = Z_TIMEOUT_TICKS(remaining);
+		}
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return ret;
+}
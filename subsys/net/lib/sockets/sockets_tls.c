@@ -168,6 +168,11 @@ __net_socket struct tls_context {
 		/** Session cache enabled on a socket. */
 		bool cache_enabled;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+		/** Small writes are being coalesced on this socket. */
+		bool cork;
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 		/* DTLS handshake timeout */
 		uint32_t dtls_handshake_timeout_min;
@@ -175,6 +180,14 @@ __net_socket struct tls_context {
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 	} options;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+	/** Coalescing buffer for corked writes. */
+	uint8_t cork_buf[CONFIG_NET_SOCKETS_TLS_CORK_BUFFER_SIZE];
+
+	/** Amount of data pending in the coalescing buffer. */
+	size_t cork_len;
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	/** Context information for DTLS timing. */
 	struct dtls_timing_context dtls_timing;
@@ -1611,6 +1624,50 @@ static int tls_opt_session_cache_purge_set(struct tls_context *context,
 	return 0;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+static int tls_opt_send_cork_set(struct tls_context *context,
+				 const void *optval, socklen_t optlen)
+{
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (sizeof(int) != optlen) {
+		return -EINVAL;
+	}
+
+	if (context->type != SOCK_STREAM) {
+		return -EINVAL;
+	}
+
+	context->options.cork = (*val != 0);
+
+	/* Disabling the option releases the coalesced data. */
+	if (!context->options.cork && context->cork_len > 0 &&
+	    tls_cork_flush(context, context->flags) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+static int tls_opt_send_cork_get(struct tls_context *context,
+				 void *optval, socklen_t *optlen)
+{
+	int cork = context->options.cork ? 1 : 0;
+
+	if (*optlen != sizeof(cork)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = cork;
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK */
+
 static int tls_opt_peer_verify_set(struct tls_context *context,
 				   const void *optval, socklen_t optlen)
 {
@@ -1769,6 +1826,13 @@ int ztls_close_ctx(struct tls_context *ctx)
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+	/* Flush any coalesced data still pending, best effort. */
+	if (ctx->cork_len > 0) {
+		(void)tls_cork_flush(ctx, 0);
+	}
+#endif
+
 	(void)mbedtls_ssl_close_notify(&ctx->ssl);
 
 	err = tls_release(ctx);
@@ -1920,6 +1984,64 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+static ssize_t tls_cork_flush(struct tls_context *ctx, int flags)
+{
+	size_t off = 0;
+
+	while (off < ctx->cork_len) {
+		ssize_t ret = send_tls(ctx, ctx->cork_buf + off,
+				       ctx->cork_len - off, flags);
+		if (ret < 0) {
+			/* Keep the unsent part for the next flush, errno
+			 * is already set by send_tls().
+			 */
+			memmove(ctx->cork_buf, ctx->cork_buf + off,
+				ctx->cork_len - off);
+			ctx->cork_len -= off;
+			return -1;
+		}
+
+		off += ret;
+	}
+
+	ctx->cork_len = 0;
+
+	return 0;
+}
+
+static ssize_t send_tls_corked(struct tls_context *ctx, const void *buf,
+			       size_t len, int flags)
+{
+	/* Writes that fill a buffer on their own gain nothing from
+	 * coalescing, pass them through once pending data is out so
+	 * that ordering is kept.
+	 */
+	if (len > sizeof(ctx->cork_buf) - ctx->cork_len) {
+		if (tls_cork_flush(ctx, flags) < 0) {
+			return -1;
+		}
+
+		if (len >= sizeof(ctx->cork_buf)) {
+			return send_tls(ctx, buf, len, flags);
+		}
+	}
+
+	memcpy(ctx->cork_buf + ctx->cork_len, buf, len);
+	ctx->cork_len += len;
+
+	if (ctx->cork_len == sizeof(ctx->cork_buf) &&
+	    tls_cork_flush(ctx, flags) < 0) {
+		/* The data was accepted into the buffer, only the
+		 * transmission is pending.
+		 */
+		return len;
+	}
+
+	return len;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 				  size_t len, int flags,
@@ -2007,6 +2129,11 @@ ssize_t ztls_sendto_ctx(struct tls_context *ctx, const void *buf, size_t len,
 
 	/* TLS */
 	if (ctx->type == SOCK_STREAM) {
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+		if (ctx->options.cork) {
+			return send_tls_corked(ctx, buf, len, flags);
+		}
+#endif
 		return send_tls(ctx, buf, len, flags);
 	}
 
@@ -2771,6 +2898,12 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_get(ctx, optval, optlen);
 		break;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+	case TLS_SEND_CORK:
+		err = tls_opt_send_cork_get(ctx, optval, optlen);
+		break;
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_get(ctx, optval,
@@ -2844,6 +2977,12 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_purge_set(ctx, optval, optlen);
 		break;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK)
+	case TLS_SEND_CORK:
+		err = tls_opt_send_cork_set(ctx, optval, optlen);
+		break;
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_set(ctx, optval,
@@ -610,6 +610,53 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* XOR the payload with the mask, a word at a time where possible. The
+ * offset tells how far into the message the payload starts, as the mask
+ * bytes rotate over the whole message.
+ */
+static void websocket_mask_payload(uint8_t *payload, size_t payload_len,
+				   uint32_t masking_value, size_t offset)
+{
+	size_t i = 0;
+
+	/* Head bytes until the buffer is word aligned */
+	while (i < payload_len &&
+	       ((uintptr_t)&payload[i] % sizeof(uint32_t)) != 0) {
+		payload[i] ^= masking_value >> (8 * (3 - offset % 4));
+		i++;
+		offset++;
+	}
+
+	if (payload_len - i >= sizeof(uint32_t)) {
+		uint8_t mask_bytes[sizeof(uint32_t)];
+		uint32_t mask_word;
+
+		/* The same four mask bytes repeat over the message, so one
+		 * word holds the mask for any word aligned position.
+		 */
+		for (size_t j = 0; j < sizeof(mask_bytes); j++) {
+			mask_bytes[j] =
+				masking_value >> (8 * (3 - (offset + j) % 4));
+		}
+
+		memcpy(&mask_word, mask_bytes, sizeof(mask_word));
+
+		for (; payload_len - i >= sizeof(uint32_t);
+		     i += sizeof(uint32_t)) {
+			*(uint32_t *)&payload[i] ^= mask_word;
+		}
+
+		/* The word loop advances in multiples of four bytes so the
+		 * mask rotation of the offset is unchanged.
+		 */
+	}
+
+	/* Tail bytes */
+	for (; i < payload_len; i++, offset++) {
+		payload[i] ^= masking_value >> (8 * (3 - offset % 4));
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -680,8 +727,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -690,6 +735,13 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		header[hdr_len++] |= ctx->masking_value;
 
 		if ((payload != NULL) && (payload_len > 0)) {
+#if defined(CONFIG_WEBSOCKET_SEND_MASK_IN_PLACE)
+			/* Mask directly in the caller's buffer, it is
+			 * restored before returning.
+			 */
+			websocket_mask_payload(data_to_send, payload_len,
+					       ctx->masking_value, 0);
+#else
 			data_to_send = k_malloc(payload_len);
 			if (!data_to_send) {
 				return -ENOMEM;
@@ -697,9 +749,9 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 			memcpy(data_to_send, payload, payload_len);
 
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask_payload(data_to_send, payload_len,
+					       ctx->masking_value, 0);
+#endif /* CONFIG_WEBSOCKET_SEND_MASK_IN_PLACE */
 		}
 	}
 
@@ -711,6 +763,16 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 	}
 
 quit:
+#if defined(CONFIG_WEBSOCKET_SEND_MASK_IN_PLACE)
+	if (mask && (payload != NULL) && (payload_len > 0)) {
+		/* Masking again with the same value restores the original
+		 * payload for the caller.
+		 */
+		websocket_mask_payload(data_to_send, payload_len,
+				       ctx->masking_value, 0);
+	}
+#endif /* CONFIG_WEBSOCKET_SEND_MASK_IN_PLACE */
+
 	if (data_to_send != payload) {
 		k_free(data_to_send);
 	}
@@ -957,15 +1019,10 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask_payload(payload.buf, payload.count,
+				       ctx->masking_value, data_buf_offset);
 	}
 
 	return payload.count;
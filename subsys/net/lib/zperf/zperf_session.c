@@ -121,6 +121,89 @@ struct session *get_tcp_session(int sock)
 	return free;
 }
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+/* Buckets 0-3 hold 0-3 us as is, after that each power of two is split
+ * into four sub-buckets, which keeps the bucket error below 25 percent.
+ */
+static size_t latency_bucket(uint32_t usec)
+{
+	unsigned int msb;
+	size_t idx;
+
+	if (usec < 4) {
+		return usec;
+	}
+
+	msb = find_msb_set(usec) - 1;
+	idx = (msb - 1) * 4 + ((usec >> (msb - 2)) & 3);
+
+	return MIN(idx, ZPERF_LAT_HIST_BUCKETS - 1);
+}
+
+/* Upper bound of the values falling into a bucket */
+static uint32_t latency_bucket_value(size_t idx)
+{
+	unsigned int msb;
+	uint32_t sub;
+
+	if (idx < 4) {
+		return idx;
+	}
+
+	msb = idx / 4 + 1;
+	sub = idx & 3;
+
+	return BIT(msb) + (sub + 1) * BIT(msb - 2) - 1;
+}
+
+void zperf_session_latency_record(struct session *session,
+				  int32_t transit_time)
+{
+	int32_t relative;
+
+	/* The peer clock is not synchronized with ours, so measure
+	 * relative to the fastest packet seen so far.
+	 */
+	if (session->lat_samples == 0U || transit_time < session->lat_base) {
+		session->lat_base = transit_time;
+	}
+
+	relative = transit_time - session->lat_base;
+
+	session->lat_hist[latency_bucket((uint32_t)relative)]++;
+	session->lat_samples++;
+}
+
+static uint32_t latency_percentile(struct session *session,
+				   uint32_t num, uint32_t den)
+{
+	uint64_t rank = ((uint64_t)session->lat_samples * num + den - 1) / den;
+	uint32_t seen = 0U;
+	size_t i;
+
+	for (i = 0; i < ZPERF_LAT_HIST_BUCKETS; i++) {
+		seen += session->lat_hist[i];
+		if (seen >= rank) {
+			return latency_bucket_value(i);
+		}
+	}
+
+	return 0U;
+}
+
+void zperf_session_latency_report(struct session *session,
+				  struct zperf_results *results)
+{
+	if (session->lat_samples == 0U) {
+		return;
+	}
+
+	results->latency_p50_us = latency_percentile(session, 50, 100);
+	results->latency_p99_us = latency_percentile(session, 99, 100);
+	results->latency_p999_us = latency_percentile(session, 999, 1000);
+}
+#endif /* CONFIG_NET_ZPERF_LATENCY_HISTOGRAM */
+
 void zperf_reset_session_stats(struct session *session)
 {
 	if (!session) {
@@ -135,6 +218,11 @@ void zperf_reset_session_stats(struct session *session)
 	session->error = 0U;
 	session->jitter = 0;
 	session->last_transit_time = 0;
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+	(void)memset(session->lat_hist, 0, sizeof(session->lat_hist));
+	session->lat_samples = 0U;
+	session->lat_base = 0;
+#endif
 }
 
 void zperf_session_init(void)
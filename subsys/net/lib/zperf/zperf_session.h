@@ -14,9 +14,13 @@
 
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/net_core.h>
+#include <zephyr/net/zperf.h>
 
 #include "zperf_internal.h"
 
+/* Four sub-buckets per power of two, covering up to ~32 s in microseconds */
+#define ZPERF_LAT_HIST_BUCKETS 96
+
 /* Type definition */
 enum state {
 	STATE_NULL, /* Session has not yet started */
@@ -52,6 +56,13 @@ struct session {
 	int32_t jitter;
 	int32_t last_transit_time;
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+	/* Latency histogram, relative to the fastest packet */
+	uint32_t lat_hist[ZPERF_LAT_HIST_BUCKETS];
+	uint32_t lat_samples;
+	int32_t lat_base;
+#endif
+
 	/* Stats packet*/
 	struct zperf_server_hdr stat;
 };
@@ -62,4 +73,25 @@ struct session *get_tcp_session(int sock);
 void zperf_session_init(void);
 void zperf_reset_session_stats(struct session *session);
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+void zperf_session_latency_record(struct session *session,
+				  int32_t transit_time);
+void zperf_session_latency_report(struct session *session,
+				  struct zperf_results *results);
+#else
+static inline void zperf_session_latency_record(struct session *session,
+						int32_t transit_time)
+{
+	ARG_UNUSED(session);
+	ARG_UNUSED(transit_time);
+}
+
+static inline void zperf_session_latency_report(struct session *session,
+						struct zperf_results *results)
+{
+	ARG_UNUSED(session);
+	ARG_UNUSED(results);
+}
+#endif /* CONFIG_NET_ZPERF_LATENCY_HISTOGRAM */
+
 #endif /* __ZPERF_SESSION_H */
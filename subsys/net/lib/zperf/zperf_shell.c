@@ -297,6 +297,23 @@ static void udp_session_cb(enum zperf_status status,
 		print_number(sh, result->jitter_in_us, TIME_US, TIME_US_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		if (IS_ENABLED(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)) {
+			shell_fprintf(sh, SHELL_NORMAL, " latency p50:\t\t");
+			print_number(sh, result->latency_p50_us, TIME_US,
+				     TIME_US_UNIT);
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+
+			shell_fprintf(sh, SHELL_NORMAL, " latency p99:\t\t");
+			print_number(sh, result->latency_p99_us, TIME_US,
+				     TIME_US_UNIT);
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+
+			shell_fprintf(sh, SHELL_NORMAL, " latency p99.9:\t\t");
+			print_number(sh, result->latency_p999_us, TIME_US,
+				     TIME_US_UNIT);
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+		}
+
 		shell_fprintf(sh, SHELL_NORMAL, " rate:\t\t\t");
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
@@ -665,6 +682,23 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			break;
 		}
 
+		case 'P': {
+			int streams = parse_arg(&i, argc, argv);
+
+			if (streams < 1 ||
+			    streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Invalid stream count: %s "
+					      "(max %d)\n", argv[i],
+					      CONFIG_NET_ZPERF_MAX_STREAMS);
+				return -ENOEXEC;
+			}
+
+			param.options.num_streams = streams;
+			opt_cnt += 2;
+			break;
+		}
+
 		case 'a':
 			async = true;
 			opt_cnt += 1;
@@ -828,6 +862,23 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			break;
 		}
 
+		case 'P': {
+			int streams = parse_arg(&i, argc, argv);
+
+			if (streams < 1 ||
+			    streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Invalid stream count: %s "
+					      "(max %d)\n", argv[i],
+					      CONFIG_NET_ZPERF_MAX_STREAMS);
+				return -ENOEXEC;
+			}
+
+			param.options.num_streams = streams;
+			opt_cnt += 2;
+			break;
+		}
+
 		case 'a':
 			async = true;
 			opt_cnt += 1;
@@ -1116,7 +1167,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp_download,
 SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> <dest port> <duration> <packet size>[K]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P streams]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds\n"
@@ -1124,19 +1175,21 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 							"(with suffix K)\n"
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
+		  "-P streams: Number of parallel streams to run\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "Example: tcp upload 192.0.2.2 1111 1 1K\n"
 		  "Example: tcp upload 2001:db8::2\n",
 		  cmd_tcp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 <duration> <packet size>[K] <baud rate>[K|M]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P streams]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    Duration of the test in seconds\n"
 		  "<packet size> Size of the packet in byte or kilobyte "
 							"(with suffix K)\n"
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
+		  "-P streams: Number of parallel streams to run\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "Example: tcp upload2 v6 1 1K\n"
 		  "Example: tcp upload2 v4\n"
@@ -1166,7 +1219,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> [<dest port> <duration> <packet size>[K] "
 							"<baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P streams]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds\n"
@@ -1175,13 +1228,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "<baud rate>   Baudrate in kilobyte or megabyte\n"
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
+		  "-P streams: Number of parallel streams to run\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 [<duration> <packet size>[K] <baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P streams]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    Duration of the test in seconds\n"
 		  "<packet size> Size of the packet in byte or kilobyte "
@@ -1189,6 +1243,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "<baud rate>   Baudrate in kilobyte or megabyte\n"
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
+		  "-P streams: Number of parallel streams to run\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
@@ -20,15 +20,17 @@ static char sample_packet[PACKET_SIZE_MAX];
 
 static struct zperf_async_upload_context tcp_async_upload_ctx;
 
-static int tcp_upload(int sock,
+static int tcp_upload(int *socks, size_t n_streams,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
 		      struct zperf_results *results)
 {
 	int64_t duration = sys_clock_timeout_end_calc(K_MSEC(duration_in_ms));
 	int64_t start_time, last_print_time, end_time, remaining;
-	uint32_t nb_packets = 0U, nb_errors = 0U;
+	uint32_t nb_packets[CONFIG_NET_ZPERF_MAX_STREAMS] = { 0 };
+	uint32_t nb_total = 0U, nb_errors = 0U;
 	uint32_t alloc_errors = 0U;
+	size_t s;
 	int ret = 0;
 
 	if (packet_size > PACKET_SIZE_MAX) {
@@ -50,28 +52,33 @@ static int tcp_upload(int sock,
 	(void)memset(sample_packet, 0, sizeof(uint32_t));
 
 	do {
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			if (nb_errors == 0 && ret != -ENOMEM) {
-				NET_ERR("Failed to send the packet (%d)", errno);
-			}
-
-			nb_errors++;
-
-			if (errno == -ENOMEM) {
-				/* Ignore memory errors as we just run out of
-				 * buffers which is kind of expected if the
-				 * buffer count is not optimized for the test
-				 * and device.
-				 */
-				alloc_errors++;
+		/* Send one packet per stream */
+		for (s = 0; s < n_streams; s++) {
+			ret = zsock_send(socks[s], sample_packet,
+					 packet_size, 0);
+			if (ret < 0) {
+				if (nb_errors == 0 && ret != -ENOMEM) {
+					NET_ERR("Failed to send the packet (%d)",
+						errno);
+				}
+
+				nb_errors++;
+
+				if (errno == -ENOMEM) {
+					/* Ignore memory errors as we just run
+					 * out of buffers which is kind of
+					 * expected if the buffer count is not
+					 * optimized for the test and device.
+					 */
+					alloc_errors++;
+				} else {
+					ret = -errno;
+					goto done;
+				}
 			} else {
-				ret = -errno;
-				break;
+				nb_packets[s]++;
+				nb_total++;
 			}
-		} else {
-			nb_packets++;
 		}
 
 #if defined(CONFIG_ARCH_POSIX)
@@ -83,10 +90,18 @@ static int tcp_upload(int sock,
 		remaining = duration - k_uptime_ticks();
 	} while (remaining > 0);
 
+done:
 	end_time = k_uptime_ticks();
 
+	if (n_streams > 1) {
+		for (s = 0; s < n_streams; s++) {
+			NET_INFO("Stream %zu: %u packets sent",
+				 s + 1, nb_packets[s]);
+		}
+	}
+
 	/* Add result coming from the client */
-	results->nb_packets_sent = nb_packets;
+	results->nb_packets_sent = nb_total;
 	results->client_time_in_us =
 				k_ticks_to_us_ceil32(end_time - start_time);
 	results->packet_size = packet_size;
@@ -111,22 +126,36 @@ static int tcp_upload(int sock,
 int zperf_tcp_upload(const struct zperf_upload_params *param,
 		     struct zperf_results *result)
 {
-	int sock;
+	int socks[CONFIG_NET_ZPERF_MAX_STREAMS];
+	size_t n_streams;
+	size_t i = 0;
 	int ret;
 
 	if (param == NULL || result == NULL) {
 		return -EINVAL;
 	}
 
-	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
-					 IPPROTO_TCP);
-	if (sock < 0) {
-		return sock;
+	n_streams = CLAMP(param->options.num_streams, 1,
+			  CONFIG_NET_ZPERF_MAX_STREAMS);
+
+	while (i < n_streams) {
+		ret = zperf_prepare_upload_sock(&param->peer_addr,
+						param->options.tos,
+						IPPROTO_TCP);
+		if (ret < 0) {
+			goto cleanup;
+		}
+
+		socks[i++] = ret;
 	}
 
-	ret = tcp_upload(sock, param->duration_ms, param->packet_size, result);
+	ret = tcp_upload(socks, n_streams, param->duration_ms,
+			 param->packet_size, result);
 
-	zsock_close(sock);
+cleanup:
+	while (i > 0) {
+		zsock_close(socks[--i]);
+	}
 
 	return ret;
 }
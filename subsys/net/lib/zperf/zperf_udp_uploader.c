@@ -131,7 +131,19 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
-static int udp_upload(int sock, int port,
+/* Sum the per-stream statistics of a multi stream upload */
+static void udp_upload_aggregate(struct zperf_results *agg,
+				 const struct zperf_results *one)
+{
+	agg->nb_packets_rcvd += one->nb_packets_rcvd;
+	agg->nb_packets_lost += one->nb_packets_lost;
+	agg->nb_packets_outorder += one->nb_packets_outorder;
+	agg->total_len += one->total_len;
+	agg->time_in_us = MAX(agg->time_in_us, one->time_in_us);
+	agg->jitter_in_us = MAX(agg->jitter_in_us, one->jitter_in_us);
+}
+
+static int udp_upload(int *socks, size_t n_streams, int port,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
 		      unsigned int rate_in_kbps,
@@ -140,10 +152,11 @@ static int udp_upload(int sock, int port,
 	uint32_t packet_duration = zperf_packet_duration(packet_size, rate_in_kbps);
 	uint64_t duration = sys_clock_timeout_end_calc(K_MSEC(duration_in_ms));
 	uint64_t delay = packet_duration;
-	uint32_t nb_packets = 0U;
+	uint32_t nb_packets[CONFIG_NET_ZPERF_MAX_STREAMS] = { 0 };
 	int64_t start_time, end_time;
 	int64_t last_print_time, last_loop_time;
 	int64_t remaining;
+	size_t s;
 	int ret;
 
 	if (packet_size > PACKET_SIZE_MAX) {
@@ -197,30 +210,35 @@ static int udp_upload(int sock, int port,
 		secs = k_ticks_to_ms_ceil32(loop_time) / 1000U;
 		usecs = k_ticks_to_us_ceil32(loop_time) - secs * USEC_PER_SEC;
 
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = htonl(nb_packets);
-		datagram->tv_sec = htonl(secs);
-		datagram->tv_usec = htonl(usecs);
-
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
-
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			NET_ERR("Failed to send the packet (%d)", errno);
-			return -errno;
-		} else {
-			nb_packets++;
+		/* Send one packet per stream */
+		for (s = 0; s < n_streams; s++) {
+			/* Fill the packet header */
+			datagram = (struct zperf_udp_datagram *)sample_packet;
+
+			datagram->id = htonl(nb_packets[s]);
+			datagram->tv_sec = htonl(secs);
+			datagram->tv_usec = htonl(usecs);
+
+			hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
+							     sizeof(*datagram));
+			hdr->flags = 0;
+			hdr->num_of_threads = htonl(n_streams);
+			hdr->port = htonl(port);
+			hdr->buffer_len = sizeof(sample_packet) -
+				sizeof(*datagram) - sizeof(*hdr);
+			hdr->bandwidth = htonl(rate_in_kbps);
+			hdr->num_of_bytes = htonl(packet_size);
+
+			/* Send the packet */
+			ret = zsock_send(socks[s], sample_packet,
+					 packet_size, 0);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packet (%d)",
+					errno);
+				return -errno;
+			} else {
+				nb_packets[s]++;
+			}
 		}
 
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
@@ -230,7 +248,7 @@ static int udp_upload(int sock, int port,
 
 			if (print_info <= 0) {
 				NET_DBG("nb_packets=%u\tdelay=%u\tadjust=%d",
-					nb_packets, (unsigned int)delay,
+					nb_packets[0], (unsigned int)delay,
 					(int)adjust);
 				print_interval = sys_clock_timeout_end_calc(K_SECONDS(1));
 			}
@@ -254,14 +272,32 @@ static int udp_upload(int sock, int port,
 
 	end_time = k_uptime_ticks();
 
-	ret = zperf_upload_fin(sock, nb_packets, end_time, packet_size,
-			       results);
-	if (ret < 0) {
-		return ret;
+	/* Close the streams and aggregate the server statistics */
+	(void)memset(results, 0, sizeof(*results));
+
+	for (s = 0; s < n_streams; s++) {
+		struct zperf_results stream_results = { 0 };
+
+		ret = zperf_upload_fin(socks[s], nb_packets[s], end_time,
+				       packet_size, &stream_results);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (n_streams > 1) {
+			NET_INFO("Stream %zu: %u/%u packets, %u lost, "
+				 "%u out of order",
+				 s + 1, stream_results.nb_packets_rcvd,
+				 nb_packets[s],
+				 stream_results.nb_packets_lost,
+				 stream_results.nb_packets_outorder);
+		}
+
+		udp_upload_aggregate(results, &stream_results);
+		results->nb_packets_sent += nb_packets[s];
 	}
 
 	/* Add result coming from the client */
-	results->nb_packets_sent = nb_packets;
 	results->client_time_in_us =
 				k_ticks_to_us_ceil32(end_time - start_time);
 	results->packet_size = packet_size;
@@ -272,8 +308,10 @@ static int udp_upload(int sock, int port,
 int zperf_udp_upload(const struct zperf_upload_params *param,
 		     struct zperf_results *result)
 {
+	int socks[CONFIG_NET_ZPERF_MAX_STREAMS];
+	size_t n_streams;
+	size_t i = 0;
 	int port = 0;
-	int sock;
 	int ret;
 
 	if (param == NULL || result == NULL) {
@@ -290,16 +328,30 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 		return -EINVAL;
 	}
 
-	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
-					 IPPROTO_UDP);
-	if (sock < 0) {
-		return sock;
+	n_streams = CLAMP(param->options.num_streams, 1,
+			  CONFIG_NET_ZPERF_MAX_STREAMS);
+
+	/* Each stream gets its own socket, so the server sees one
+	 * session per stream.
+	 */
+	while (i < n_streams) {
+		ret = zperf_prepare_upload_sock(&param->peer_addr,
+						param->options.tos,
+						IPPROTO_UDP);
+		if (ret < 0) {
+			goto cleanup;
+		}
+
+		socks[i++] = ret;
 	}
 
-	ret = udp_upload(sock, port, param->duration_ms, param->packet_size,
-			 param->rate_kbps, result);
+	ret = udp_upload(socks, n_streams, port, param->duration_ms,
+			 param->packet_size, param->rate_kbps, result);
 
-	zsock_close(sock);
+cleanup:
+	while (i > 0) {
+		zsock_close(socks[--i]);
+	}
 
 	return ret;
 }
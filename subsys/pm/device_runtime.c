@@ -36,7 +36,10 @@ LOG_MODULE_DECLARE(pm_device, CONFIG_PM_DEVICE_LOG_LEVEL);
  * @param dev Device instance.
  * @param async Perform operation asynchronously.
  *
- * @retval 0 If device has been suspended or queued for suspend.
+ * @retval 0 If device has been suspended.
+ * @retval 1 If device suspension has been queued, either because the operation
+ * was asynchronous or because an autosuspend delay is configured. The work item
+ * takes care of putting the power domain once the device is suspended.
  * @retval -EALREADY If device is already suspended (can only happen if get/put
  * calls are unbalanced).
  * @retval -EBUSY If the device is busy.
@@ -71,10 +74,19 @@ static int runtime_suspend(const struct device *dev, bool async)
 		goto unlock;
 	}
 
+	/*
+	 * Deferring the suspend gives bursty users a chance to come back
+	 * before the device is actually suspended, skipping the resume cost.
+	 */
+	if (pm->autosuspend_delay > 0U) {
+		async = true;
+	}
+
 	if (async && !k_is_pre_kernel()) {
 		/* queue suspend */
 		pm->state = PM_DEVICE_STATE_SUSPENDING;
-		(void)k_work_schedule(&pm->work, K_NO_WAIT);
+		(void)k_work_schedule(&pm->work, K_MSEC(pm->autosuspend_delay));
+		ret = 1;
 	} else {
 		/* suspend now */
 		ret = pm->action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
@@ -162,6 +174,25 @@ int pm_device_runtime_get(const struct device *dev)
 	pm->usage++;
 
 	if (!k_is_pre_kernel()) {
+		/*
+		 * Abort a pending suspend (e.g. one deferred by the
+		 * autosuspend delay) if the work item has not started yet: the
+		 * device never left the active state, so there is no need to
+		 * suspend and resume it again.
+		 */
+		if ((pm->state == PM_DEVICE_STATE_SUSPENDING) &&
+		    (k_work_cancel_delayable(&pm->work) == 0)) {
+			pm->state = PM_DEVICE_STATE_ACTIVE;
+			k_event_set(&pm->event, EVENT_STATE_ACTIVE);
+
+			/* settle the domain put owed by the cancelled work */
+			if (PM_DOMAIN(pm) != NULL) {
+				(void)pm_device_runtime_put(PM_DOMAIN(pm));
+			}
+
+			goto unlock;
+		}
+
 		/* wait until possible async suspend is completed */
 		while (pm->state == PM_DEVICE_STATE_SUSPENDING) {
 			k_sem_give(&pm->lock);
@@ -207,10 +238,16 @@ int pm_device_runtime_put(const struct device *dev)
 	SYS_PORT_TRACING_FUNC_ENTER(pm, device_runtime_put, dev);
 	ret = runtime_suspend(dev, false);
 
-	/*
-	 * Now put the domain
-	 */
-	if ((ret == 0) && PM_DOMAIN(dev->pm) != NULL) {
+	if (ret == 1) {
+		/*
+		 * The suspend was deferred by the autosuspend delay. The work
+		 * item puts the domain once the device is actually suspended.
+		 */
+		ret = 0;
+	} else if ((ret == 0) && PM_DOMAIN(dev->pm) != NULL) {
+		/*
+		 * Now put the domain
+		 */
 		ret = pm_device_runtime_put(PM_DOMAIN(dev->pm));
 	}
 	SYS_PORT_TRACING_FUNC_EXIT(pm, device_runtime_put, dev, ret);
@@ -228,11 +265,36 @@ int pm_device_runtime_put_async(const struct device *dev)
 
 	SYS_PORT_TRACING_FUNC_ENTER(pm, device_runtime_put_async, dev);
 	ret = runtime_suspend(dev, true);
+	if (ret == 1) {
+		ret = 0;
+	}
 	SYS_PORT_TRACING_FUNC_EXIT(pm, device_runtime_put_async, dev, ret);
 
 	return ret;
 }
 
+int pm_device_runtime_autosuspend_delay_set(const struct device *dev,
+					    uint32_t delay_ms)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (pm == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (!k_is_pre_kernel()) {
+		(void)k_sem_take(&pm->lock, K_FOREVER);
+	}
+
+	pm->autosuspend_delay = delay_ms;
+
+	if (!k_is_pre_kernel()) {
+		k_sem_give(&pm->lock);
+	}
+
+	return 0;
+}
+
 int pm_device_runtime_enable(const struct device *dev)
 {
 	int ret = 0;
@@ -304,8 +366,20 @@ int pm_device_runtime_disable(const struct device *dev)
 		goto unlock;
 	}
 
-	/* wait until possible async suspend is completed */
 	if (!k_is_pre_kernel()) {
+		/* abort a pending suspend that has not started yet */
+		if ((pm->state == PM_DEVICE_STATE_SUSPENDING) &&
+		    (k_work_cancel_delayable(&pm->work) == 0)) {
+			pm->state = PM_DEVICE_STATE_ACTIVE;
+			k_event_set(&pm->event, EVENT_STATE_ACTIVE);
+
+			/* settle the domain put owed by the cancelled work */
+			if (PM_DOMAIN(pm) != NULL) {
+				(void)pm_device_runtime_put(PM_DOMAIN(pm));
+			}
+		}
+
+		/* wait until possible async suspend is completed */
 		while (pm->state == PM_DEVICE_STATE_SUSPENDING) {
 			k_sem_give(&pm->lock);
 
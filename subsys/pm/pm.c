@@ -265,11 +265,18 @@ bool pm_system_suspend(int32_t ticks)
 	 */
 	k_sched_lock();
 	pm_stats_start();
+#ifdef CONFIG_PM_POLICY_RESIDENCY_PREDICTOR
+	uint32_t sleep_start_cyc = k_cycle_get_32();
+#endif
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
 	state_set(&z_cpus_pm_state[id]);
 	pm_stats_stop();
+#ifdef CONFIG_PM_POLICY_RESIDENCY_PREDICTOR
+	pm_policy_residency_record(id, k_cyc_to_ticks_floor32(k_cycle_get_32() -
+							      sleep_start_cyc));
+#endif
 
 	/* Wake up sequence starts here */
 #if defined(CONFIG_PM_DEVICE) && !defined(CONFIG_PM_DEVICE_RUNTIME_EXCLUSIVE)
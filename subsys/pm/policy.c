@@ -81,12 +81,51 @@ static void update_max_latency(void)
 	}
 }
 
+#ifdef CONFIG_PM_POLICY_RESIDENCY_PREDICTOR
+/** Weight of the newest sample, as a 1/PREDICTOR_WEIGHT fraction. */
+#define PREDICTOR_WEIGHT 4
+
+/**
+ * Exponentially weighted moving average of the observed sleep residencies per
+ * CPU, in ticks. Zero means no history has been recorded yet.
+ */
+static uint32_t predicted_residency[CONFIG_MP_MAX_NUM_CPUS];
+
+void pm_policy_residency_record(uint8_t cpu, uint32_t ticks)
+{
+	int32_t pred = (int32_t)predicted_residency[cpu];
+
+	if (pred == 0) {
+		pred = (int32_t)ticks;
+	} else {
+		pred += ((int32_t)ticks - pred) / PREDICTOR_WEIGHT;
+	}
+
+	predicted_residency[cpu] = MAX(pred, 1);
+}
+#endif /* CONFIG_PM_POLICY_RESIDENCY_PREDICTOR */
+
 #ifdef CONFIG_PM_POLICY_DEFAULT
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 {
 	uint8_t num_cpu_states;
 	const struct pm_state_info *cpu_states;
 
+#ifdef CONFIG_PM_POLICY_RESIDENCY_PREDICTOR
+	uint32_t predicted = predicted_residency[cpu];
+
+	/*
+	 * When wakeups keep arriving earlier than the next scheduled event,
+	 * trust the measured history rather than the scheduled timeout, so
+	 * that states whose break-even residency will likely not be met are
+	 * skipped.
+	 */
+	if ((predicted != 0U) &&
+	    ((ticks == K_TICKS_FOREVER) || (predicted < (uint32_t)ticks))) {
+		ticks = (int32_t)predicted;
+	}
+#endif
+
 	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
 
 	for (int16_t i = (int16_t)num_cpu_states - 1; i >= 0; i--) {
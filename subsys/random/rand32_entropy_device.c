@@ -21,6 +21,13 @@ uint32_t z_impl_sys_rand32_get(void)
 	__ASSERT(device_is_ready(entropy_dev), "Entropy device %s not ready",
 		 entropy_dev->name);
 
+#if defined(CONFIG_ENTROPY_POOL)
+	if (entropy_pool_get((uint8_t *)&random_num, sizeof(random_num)) ==
+	    sizeof(random_num)) {
+		return random_num;
+	}
+#endif
+
 	ret = entropy_get_entropy(entropy_dev, (uint8_t *)&random_num,
 				  sizeof(random_num));
 	if (unlikely(ret < 0)) {
@@ -45,6 +52,20 @@ static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 	__ASSERT(device_is_ready(entropy_dev), "Entropy device %s not ready",
 		 entropy_dev->name);
 
+#if defined(CONFIG_ENTROPY_POOL)
+	/* Serve what the pool holds without waiting for the peripheral
+	 * and only go to the device for the remainder.
+	 */
+	size_t pooled = entropy_pool_get(dst, outlen);
+
+	if (pooled == outlen) {
+		return 0;
+	}
+
+	dst += pooled;
+	outlen -= pooled;
+#endif
+
 	ret = entropy_get_entropy(entropy_dev, dst, outlen);
 
 	if (unlikely(ret < 0)) {
@@ -34,9 +34,27 @@
 
 static const struct device *const entropy_driver =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
-static uint32_t state[4];
+#ifdef CONFIG_XOSHIRO_PER_CPU_STATE
+/* One state per CPU, aligned so two states never share a cache line */
+static uint32_t state[CONFIG_MP_NUM_CPUS][4] __aligned(64);
+#else
+static uint32_t state[1][4];
+#endif
 static bool initialized;
 
+static inline uint32_t *xoshiro128_state(void)
+{
+#ifdef CONFIG_XOSHIRO_PER_CPU_STATE
+	/* A migration between reading the CPU id and updating the state
+	 * just mixes two states, which is as harmless as the pre-existing
+	 * race between two threads on the same state.
+	 */
+	return state[arch_curr_cpu()->id];
+#else
+	return state[0];
+#endif
+}
+
 static inline uint32_t rotl(const uint32_t x, int k)
 {
 	return (x << k) | (x >> (32 - k));
@@ -66,27 +84,29 @@ static void xoshiro128_init_state(void)
 		 * be properly seeded. This may be needed if random numbers are
 		 * requested before the backing entropy device has been enabled.
 		 */
-		state[0] = k_cycle_get_32();
-		state[1] = k_cycle_get_32() ^ 0x9b64c2b0;
-		state[2] = k_cycle_get_32() ^ 0x86d3d2d4;
-		state[3] = k_cycle_get_32() ^ 0xa00ae278;
+		for (size_t i = 0; i < ARRAY_SIZE(state); i++) {
+			state[i][0] = k_cycle_get_32();
+			state[i][1] = k_cycle_get_32() ^ 0x9b64c2b0;
+			state[i][2] = k_cycle_get_32() ^ 0x86d3d2d4;
+			state[i][3] = k_cycle_get_32() ^ 0xa00ae278;
+		}
 	}
 }
 
-static uint32_t xoshiro128_next(void)
+static uint32_t xoshiro128_next(uint32_t *s)
 {
-	const uint32_t result = rotl(state[0] + state[3], 7) + state[0];
+	const uint32_t result = rotl(s[0] + s[3], 7) + s[0];
 
-	const uint32_t t = state[1] << 9;
+	const uint32_t t = s[1] << 9;
 
-	state[2] ^= state[0];
-	state[3] ^= state[1];
-	state[1] ^= state[2];
-	state[0] ^= state[3];
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
 
-	state[2] ^= t;
+	s[2] ^= t;
 
-	state[3] = rotl(state[3], 11);
+	s[3] = rotl(s[3], 11);
 
 	return result;
 }
@@ -97,7 +117,7 @@ uint32_t z_impl_sys_rand32_get(void)
 		xoshiro128_init_state();
 	}
 
-	return xoshiro128_next();
+	return xoshiro128_next(xoshiro128_state());
 }
 
 void z_impl_sys_rand_get(void *dst, size_t outlen)
@@ -105,19 +125,22 @@ void z_impl_sys_rand_get(void *dst, size_t outlen)
 	size_t blocks = outlen / sizeof(uint32_t);
 	size_t rem = (outlen - (blocks * sizeof(uint32_t)));
 	uint32_t *unaligned = dst;
+	uint32_t *s;
 	uint32_t ret;
 
 	if (unlikely(!initialized)) {
 		xoshiro128_init_state();
 	}
 
+	s = xoshiro128_state();
+
 	/* Write all full 32bit chunks */
 	while (blocks--) {
-		UNALIGNED_PUT(xoshiro128_next(), unaligned++);
+		UNALIGNED_PUT(xoshiro128_next(s), unaligned++);
 	}
 	/* Write trailing bytes */
 	if (rem) {
-		ret = xoshiro128_next();
+		ret = xoshiro128_next(s);
 		memcpy(unaligned, &ret, rem);
 	}
 }
@@ -97,7 +97,7 @@ static void conex_resume(struct rtio *r, struct rtio_concurrent_executor *exc)
 	for (uint16_t task_id = exc->task_out; task_id < exc->task_in; task_id++) {
 		if (exc->task_status[task_id & exc->task_mask] & CONEX_TASK_SUSPENDED) {
 			LOG_INF("resuming suspended task %d", task_id);
-			exc->task_status[task_id] &= ~CONEX_TASK_SUSPENDED;
+			exc->task_status[task_id & exc->task_mask] &= ~CONEX_TASK_SUSPENDED;
 			rtio_iodev_submit(exc->task_cur[task_id], r);
 		}
 	}
@@ -215,14 +215,20 @@ void rtio_concurrent_ok(struct rtio *r, const struct rtio_sqe *sqe, int result)
 	/* Determine the task id : O(n) */
 	uint16_t task_id = conex_task_id(exc, sqe);
 
-	if (sqe->flags & RTIO_SQE_CHAINED) {
+	if ((sqe->flags & RTIO_SQE_MULTISHOT) &&
+	    !(sqe->flags & RTIO_SQE_CANCELED)) {
+		/* Re-arm the same submission; the task stays live and the
+		 * SQE stays in the queue until the submission is cancelled.
+		 */
+		rtio_iodev_submit(sqe, r);
+	} else if (sqe->flags & RTIO_SQE_CHAINED) {
 		next_sqe = rtio_spsc_next(r->sq, sqe);
 
 		rtio_iodev_submit(next_sqe, r);
 
-		exc->task_cur[task_id] = next_sqe;
+		exc->task_cur[task_id & exc->task_mask] = next_sqe;
 	} else {
-		exc->task_status[task_id]  |= CONEX_TASK_COMPLETE;
+		exc->task_status[task_id & exc->task_mask] |= CONEX_TASK_COMPLETE;
 	}
 
 
@@ -260,17 +266,24 @@ void rtio_concurrent_err(struct rtio *r, const struct rtio_sqe *sqe, int result)
 	uint16_t task_id = conex_task_id(exc, sqe);
 
 
-	/* Fail the remaining sqe's in the chain */
+	/* Fail the remaining sqe's in the chain, including the tail
+	 * which does not carry the chained flag itself
+	 */
 	if (sqe->flags & RTIO_SQE_CHAINED) {
 		nsqe = rtio_spsc_next(r->sq, sqe);
 		while (nsqe != NULL && nsqe->flags & RTIO_SQE_CHAINED) {
 			rtio_cqe_submit(r, -ECANCELED, nsqe->userdata);
 			nsqe = rtio_spsc_next(r->sq, nsqe);
 		}
+		if (nsqe != NULL) {
+			rtio_cqe_submit(r, -ECANCELED, nsqe->userdata);
+		}
 	}
 
-	/* Task is complete (failed) */
-	exc->task_status[task_id] |= CONEX_TASK_COMPLETE;
+	/* Task is complete (failed), a failed multishot submission is not
+	 * re-armed
+	 */
+	exc->task_status[task_id & exc->task_mask] |= CONEX_TASK_COMPLETE;
 
 	conex_sweep_resume(r, exc);
 
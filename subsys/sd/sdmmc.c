@@ -1367,6 +1367,36 @@ static int sdmmc_query_written(struct sd_card *card, uint32_t *num_written)
 	return 0;
 }
 
+#ifdef CONFIG_SD_WRITE_PRE_ERASE
+/*
+ * Sends ACMD23 (set write block erase count) so the card can pre-erase
+ * the blocks an upcoming multiple block write will cover. The hint is
+ * purely advisory, so errors are only logged.
+ */
+static void sdmmc_pre_erase(struct sd_card *card, uint32_t num_blocks)
+{
+	int ret;
+	struct sdhc_command cmd = {0};
+
+	ret = sdmmc_app_command(card, card->relative_addr);
+	if (ret) {
+		LOG_DBG("App CMD for ACMD23 failed");
+		return;
+	}
+
+	cmd.opcode = SD_APP_SET_WRITE_BLK_ERASE_CNT;
+	/* ACMD23 carries the block count in its lower 23 bits */
+	cmd.arg = MIN(num_blocks, BIT_MASK(23));
+	cmd.response_type = (SD_RSP_TYPE_R1 | SD_SPI_RSP_TYPE_R1);
+	cmd.timeout_ms = CONFIG_SD_CMD_TIMEOUT;
+
+	ret = sdhc_request(card->sdhc, &cmd, NULL);
+	if (ret) {
+		LOG_DBG("ACMD23 failed: %d", ret);
+	}
+}
+#endif /* CONFIG_SD_WRITE_PRE_ERASE */
+
 static int sdmmc_write(struct sd_card *card, const uint8_t *wbuf,
 	uint32_t start_block, uint32_t num_blocks)
 {
@@ -1377,8 +1407,15 @@ static int sdmmc_write(struct sd_card *card, const uint8_t *wbuf,
 
 	/*
 	 * See the note in sdmmc_read() above. We will not issue CMD23
-	 * or CMD12, and expect the host to handle those details.
+	 * or CMD12, and expect the host to handle those details. ACMD23
+	 * is different from CMD23: it is a pre-erase hint rather than a
+	 * block count, and is not covered by host auto command support.
 	 */
+#ifdef CONFIG_SD_WRITE_PRE_ERASE
+	if (num_blocks > 1U) {
+		sdmmc_pre_erase(card, num_blocks);
+	}
+#endif
 	cmd.opcode = (num_blocks == 1) ? SD_WRITE_SINGLE_BLOCK : SD_WRITE_MULTIPLE_BLOCK;
 	if (!(card->flags & SD_HIGH_CAPACITY_FLAG)) {
 		/* SDSC cards require block size in bytes, not blocks */
@@ -46,6 +46,15 @@ struct settings_nvs {
 
 	uint16_t cache_next;
 #endif
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+	struct {
+		uint16_t name_id;
+		uint16_t subtree_hash;
+	} index[CONFIG_SETTINGS_NVS_SUBTREE_INDEX_SIZE];
+
+	uint16_t index_cnt;
+	bool index_valid;
+#endif
 };
 
 /* register nvs to be a source of settings */
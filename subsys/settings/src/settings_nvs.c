@@ -118,6 +118,93 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+
+/* Hash of the first path component; names sharing a subtree always share
+ * their first component, so an entry with a different hash can never
+ * belong to the subtree being loaded.
+ */
+static uint16_t settings_nvs_subtree_hash(const char *name)
+{
+	const char *end = strchr(name, '/');
+	size_t len = (end != NULL) ? (size_t)(end - name) : strlen(name);
+
+	return crc16_ccitt(0xffff, name, len);
+}
+
+static void settings_nvs_index_add(struct settings_nvs *cf, uint16_t name_id,
+				   const char *name)
+{
+	if (!cf->index_valid) {
+		return;
+	}
+
+	if (cf->index_cnt >= ARRAY_SIZE(cf->index)) {
+		cf->index_valid = false;
+		return;
+	}
+
+	cf->index[cf->index_cnt].name_id = name_id;
+	cf->index[cf->index_cnt].subtree_hash = settings_nvs_subtree_hash(name);
+	cf->index_cnt++;
+}
+
+static void settings_nvs_index_remove(struct settings_nvs *cf,
+				      uint16_t name_id)
+{
+	for (uint16_t i = 0; i < cf->index_cnt; i++) {
+		if (cf->index[i].name_id == name_id) {
+			cf->index[i] = cf->index[cf->index_cnt - 1];
+			cf->index_cnt--;
+			return;
+		}
+	}
+}
+
+static int settings_nvs_load_indexed(struct settings_nvs *cf,
+				     const struct settings_load_arg *arg)
+{
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	char buf;
+	ssize_t rc1, rc2;
+	uint16_t subtree_hash = settings_nvs_subtree_hash(arg->subtree);
+	int ret = 0;
+
+	for (uint16_t i = 0; i < cf->index_cnt; i++) {
+		if (cf->index[i].subtree_hash != subtree_hash) {
+			continue;
+		}
+
+		rc1 = nvs_read(&cf->cf_nvs, cf->index[i].name_id, &name,
+			       sizeof(name));
+		rc2 = nvs_read(&cf->cf_nvs,
+			       cf->index[i].name_id + NVS_NAME_ID_OFFSET,
+			       &buf, sizeof(buf));
+
+		if ((rc1 <= 0) || (rc2 <= 0)) {
+			/* Leave dirty entry cleanup to the full walk */
+			continue;
+		}
+
+		name[rc1] = '\0';
+		read_fn_arg.fs = &cf->cf_nvs;
+		read_fn_arg.id = cf->index[i].name_id + NVS_NAME_ID_OFFSET;
+
+		ret = settings_call_set_handler(
+			name, rc2,
+			settings_nvs_read_fn, &read_fn_arg,
+			(void *)arg);
+		if (ret) {
+			break;
+		}
+	}
+
+	return ret;
+}
+
+#endif /* CONFIG_SETTINGS_NVS_SUBTREE_INDEX */
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -129,6 +216,18 @@ static int settings_nvs_load(struct settings_store *cs,
 	ssize_t rc1, rc2;
 	uint16_t name_id = NVS_NAMECNT_ID;
 
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+	if ((arg->subtree != NULL) && cf->index_valid) {
+		return settings_nvs_load_indexed(cf, arg);
+	}
+
+	/* A full walk sees every stored name, so rebuild the index along
+	 * the way.
+	 */
+	cf->index_cnt = 0;
+	cf->index_valid = true;
+#endif
+
 	name_id = cf->last_name_id + 1;
 
 	while (1) {
@@ -175,11 +274,19 @@ static int settings_nvs_load(struct settings_store *cs,
 		settings_nvs_cache_add(cf, name, name_id);
 #endif
 
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+		settings_nvs_index_add(cf, name_id, name);
+#endif
+
 		ret = settings_call_set_handler(
 			name, rc2,
 			settings_nvs_read_fn, &read_fn_arg,
 			(void *)arg);
 		if (ret) {
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+			/* The walk did not complete */
+			cf->index_valid = false;
+#endif
 			break;
 		}
 	}
@@ -277,6 +384,10 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+		settings_nvs_index_remove(cf, name_id);
+#endif
+
 		return 0;
 	}
 
@@ -298,6 +409,10 @@ found:
 		if (rc < 0) {
 			return rc;
 		}
+
+#if CONFIG_SETTINGS_NVS_SUBTREE_INDEX
+		settings_nvs_index_add(cf, write_name_id, name);
+#endif
 	}
 
 	/* update the last_name_id and write to flash if required*/
@@ -162,6 +162,115 @@ static void uart_callback(const struct device *dev, void *user_data)
 }
 #endif /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+/* Start a transfer of the longest contiguous chunk of the TX ring buffer
+ * if no transfer is ongoing and there is anything to send.
+ */
+static void async_tx_try(const struct shell_uart *sh_uart)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	if (ring_buf_is_empty(sh_uart->tx_ringbuf)) {
+		return;
+	}
+
+	if (atomic_set(&ctrl_blk->tx_busy, 1) != 0) {
+		/* Transfer ongoing, TX done handler picks the data up. */
+		return;
+	}
+
+	len = ring_buf_get_claim(sh_uart->tx_ringbuf, &data,
+				 sh_uart->tx_ringbuf->size);
+	err = uart_tx(ctrl_blk->dev, data, len, SYS_FOREVER_US);
+	if (err < 0) {
+		(void)ring_buf_get_finish(sh_uart->tx_ringbuf, 0);
+		ctrl_blk->tx_busy = 0;
+	}
+}
+
+static void async_rx_rdy_handle(const struct shell_uart *sh_uart,
+				struct uart_event_rx *rx)
+{
+	uint8_t *data = &rx->buf[rx->offset];
+	size_t len = rx->len;
+
+#ifdef CONFIG_MCUMGR_TRANSPORT_SHELL
+	/* Divert bytes from shell handling if they are part of an mcumgr
+	 * frame.
+	 */
+	size_t i = smp_shell_rx_bytes(&sh_uart->ctrl_blk->smp, data, len);
+
+	data += i;
+	len -= i;
+#endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
+
+	if ((len > 0U) && (ring_buf_put(sh_uart->rx_ringbuf, data, len) != len)) {
+		LOG_WRN("RX ring buffer full.");
+	}
+
+	sh_uart->ctrl_blk->handler(SHELL_TRANSPORT_EVT_RX_RDY,
+				   sh_uart->ctrl_blk->context);
+}
+
+static void async_callback(const struct device *dev, struct uart_event *evt,
+			   void *user_data)
+{
+	const struct shell_uart *sh_uart = (const struct shell_uart *)user_data;
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		(void)ring_buf_get_finish(sh_uart->tx_ringbuf, evt->data.tx.len);
+		ctrl_blk->tx_busy = 0;
+		async_tx_try(sh_uart);
+		ctrl_blk->handler(SHELL_TRANSPORT_EVT_TX_RDY, ctrl_blk->context);
+		break;
+	case UART_RX_RDY:
+		async_rx_rdy_handle(sh_uart, &evt->data.rx);
+		break;
+	case UART_RX_BUF_REQUEST:
+		(void)uart_rx_buf_rsp(dev, sh_uart->rx_bufs[ctrl_blk->rx_buf_idx],
+			CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE);
+		ctrl_blk->rx_buf_idx ^= 1;
+		break;
+	case UART_RX_DISABLED:
+		ctrl_blk->rx_buf_idx = 1;
+		(void)uart_rx_enable(dev, sh_uart->rx_bufs[0],
+			CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE,
+			CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_TIMEOUT);
+		break;
+	default:
+		break;
+	}
+}
+
+static void async_init(const struct shell_uart *sh_uart)
+{
+	const struct device *dev = sh_uart->ctrl_blk->dev;
+
+	ring_buf_reset(sh_uart->tx_ringbuf);
+	ring_buf_reset(sh_uart->rx_ringbuf);
+	sh_uart->ctrl_blk->tx_busy = 0;
+	sh_uart->ctrl_blk->rx_buf_idx = 1;
+	(void)uart_callback_set(dev, async_callback, (void *)sh_uart);
+	(void)uart_rx_enable(dev, sh_uart->rx_bufs[0],
+			     CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE,
+			     CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_TIMEOUT);
+}
+
+static void async_write(const struct shell_uart *sh_uart, const void *data,
+			size_t length, size_t *cnt)
+{
+	*cnt = ring_buf_put(sh_uart->tx_ringbuf, data, length);
+
+	async_tx_try(sh_uart);
+}
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API */
+
 static void uart_irq_init(const struct shell_uart *sh_uart)
 {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
@@ -206,6 +315,9 @@ static int init(const struct shell_transport *transport,
 	k_fifo_init(&sh_uart->ctrl_blk->smp.buf_ready);
 #endif
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+	async_init(sh_uart);
+#else
 	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		uart_irq_init(sh_uart);
 	} else {
@@ -213,6 +325,7 @@ static int init(const struct shell_transport *transport,
 		k_timer_user_data_set(sh_uart->timer, (void *)sh_uart);
 		k_timer_start(sh_uart->timer, RX_POLL_PERIOD, RX_POLL_PERIOD);
 	}
+#endif
 
 	return 0;
 }
@@ -221,6 +334,10 @@ static int uninit(const struct shell_transport *transport)
 {
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+	(void)uart_tx_abort(sh_uart->ctrl_blk->dev);
+	(void)uart_rx_disable(sh_uart->ctrl_blk->dev);
+#else
 	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		const struct device *dev = sh_uart->ctrl_blk->dev;
 
@@ -229,6 +346,7 @@ static int uninit(const struct shell_transport *transport)
 	} else {
 		k_timer_stop(sh_uart->timer);
 	}
+#endif
 
 	return 0;
 }
@@ -242,6 +360,12 @@ static int enable(const struct shell_transport *transport, bool blocking_tx)
 	if (blocking_tx) {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
 		uart_irq_tx_disable(sh_uart->ctrl_blk->dev);
+#endif
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+		/* Stop the ongoing transfer so that blocking polling
+		 * writes do not interleave with it.
+		 */
+		(void)uart_tx_abort(sh_uart->ctrl_blk->dev);
 #endif
 	}
 
@@ -266,8 +390,13 @@ static int write(const struct shell_transport *transport,
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 	const uint8_t *data8 = (const uint8_t *)data;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) &&
-		!sh_uart->ctrl_blk->blocking_tx) {
+	if (!sh_uart->ctrl_blk->blocking_tx &&
+	    IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API)) {
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_API
+		async_write(sh_uart, data, length, cnt);
+#endif
+	} else if (!sh_uart->ctrl_blk->blocking_tx &&
+		   IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		irq_write(sh_uart, data, length, cnt);
 	} else {
 		for (size_t i = 0; i < length; i++) {
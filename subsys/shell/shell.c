@@ -330,11 +330,21 @@ static void find_completion_candidates(const struct shell *shell,
 	struct shell_static_entry dloc;
 	size_t incompl_cmd_len;
 	size_t idx = 0;
+	bool sorted = IS_ENABLED(CONFIG_SHELL_CMDS_SORTED_LOOKUP) &&
+		      z_shell_cmd_is_sorted(cmd);
 
 	incompl_cmd_len = z_shell_strlen(incompl_cmd);
 	*longest = 0U;
 	*cnt = 0;
 
+	if (sorted) {
+		/* Candidates form one contiguous index range, jump straight
+		 * to its first element.
+		 */
+		idx = z_shell_cmd_lower_bound(cmd, incompl_cmd,
+					      incompl_cmd_len);
+	}
+
 	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
@@ -345,6 +355,9 @@ static void find_completion_candidates(const struct shell *shell,
 				*first_idx = idx;
 			}
 			(*cnt)++;
+		} else if (sorted) {
+			/* End of the contiguous candidate range. */
+			break;
 		}
 
 		idx++;
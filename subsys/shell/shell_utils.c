@@ -264,12 +264,94 @@ static inline uint32_t shell_root_cmd_count(void)
 				sizeof(union shell_cmd_entry);
 }
 
+bool z_shell_cmd_is_sorted(const struct shell_static_entry *parent)
+{
+	if (parent == NULL) {
+		return true;
+	}
+
+	return (parent->subcmd != NULL) && is_section_cmd(parent->subcmd);
+}
+
+/* Find any past-the-end index of a command set with galloping probes.
+ * Only the root command array has a known length up front.
+ */
+static size_t cmd_end_find(const struct shell_static_entry *parent,
+			   struct shell_static_entry *dloc)
+{
+	size_t end = 1;
+
+	while (z_shell_cmd_get(parent, end - 1, dloc) != NULL) {
+		end *= 2;
+	}
+
+	return end;
+}
+
+/* Binary search for a command in an alphabetically sorted set. Indexes
+ * past the end of the set compare as greater than any syntax string.
+ */
+static const struct shell_static_entry *cmd_bsearch(
+					const struct shell_static_entry *parent,
+					const char *cmd_str,
+					struct shell_static_entry *dloc)
+{
+	const struct shell_static_entry *entry;
+	size_t lo = 0;
+	size_t hi = cmd_end_find(parent, dloc);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		int cmp;
+
+		entry = z_shell_cmd_get(parent, mid, dloc);
+		cmp = (entry == NULL) ? -1 : strcmp(cmd_str, entry->syntax);
+		if (cmp == 0) {
+			return entry;
+		} else if (cmp < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	return NULL;
+}
+
+size_t z_shell_cmd_lower_bound(const struct shell_static_entry *parent,
+			       const char *prefix, size_t prefix_len)
+{
+	const struct shell_static_entry *entry;
+	struct shell_static_entry dloc;
+	size_t lo = 0;
+	size_t hi = cmd_end_find(parent, &dloc);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		entry = z_shell_cmd_get(parent, mid, &dloc);
+		if ((entry != NULL) &&
+		    (strncmp(entry->syntax, prefix, prefix_len) < 0)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
 	const size_t cmd_count = shell_root_cmd_count();
 	const union shell_cmd_entry *cmd;
 
+	if (IS_ENABLED(CONFIG_SHELL_CMDS_SORTED_LOOKUP)) {
+		/* dloc is only used for dynamic commands. */
+		return cmd_bsearch(NULL, syntax, NULL);
+	}
+
 	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->entry->syntax) == 0) {
@@ -352,6 +434,11 @@ const struct shell_static_entry *z_shell_find_cmd(
 		parent = &parent_cpy;
 	}
 
+	if (IS_ENABLED(CONFIG_SHELL_CMDS_SORTED_LOOKUP) &&
+	    z_shell_cmd_is_sorted(parent)) {
+		return cmd_bsearch(parent, cmd_str, dloc);
+	}
+
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
 		if (strcmp(cmd_str, entry->syntax) == 0) {
 			return entry;
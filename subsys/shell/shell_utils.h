@@ -58,6 +58,34 @@ const struct shell_static_entry *z_shell_find_cmd(
 					const char *cmd_str,
 					struct shell_static_entry *dloc);
 
+/** @brief Check if subcommands of given parent are sorted alphabetically.
+ *
+ * Root commands and subcommands registered in dedicated memory sections
+ * are sorted by name at link time. Subcommand arrays created with
+ * @ref SHELL_STATIC_SUBCMD_SET_CREATE keep the declaration order and not
+ * all dynamic command providers return entries in alphabetical order.
+ *
+ * @param parent	Parent entry. Null for root commands.
+ *
+ * @return True if entries of the set are sorted alphabetically.
+ */
+bool z_shell_cmd_is_sorted(const struct shell_static_entry *parent);
+
+/** @brief Get index of the first command not less than given prefix.
+ *
+ * Valid only for sorted command sets (see @ref z_shell_cmd_is_sorted),
+ * where commands matching the prefix form one contiguous index range
+ * starting at the returned index.
+ *
+ * @param parent	Parent entry. Null for root commands.
+ * @param prefix	Command prefix.
+ * @param prefix_len	Number of prefix characters to compare.
+ *
+ * @return Index of the first command not preceding the prefix.
+ */
+size_t z_shell_cmd_lower_bound(const struct shell_static_entry *parent,
+			       const char *prefix, size_t prefix_len);
+
 /* @internal @brief Function returns pointer to a shell's subcommands array
  * for a level given by argc and matching command patter provided in argv.
  *
@@ -12,6 +12,13 @@
 
 #define STATS_GEN_NAME_MAX_LEN  (sizeof("s255"))
 
+/* Number of copies of the entry block backing a group. */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_NUM_COPIES	CONFIG_MP_NUM_CPUS
+#else
+#define STATS_NUM_COPIES	1
+#endif
+
 /* The global list of registered statistic groups. */
 static struct stats_hdr *stats_list;
 
@@ -280,5 +287,43 @@ stats_init_and_reg(struct stats_hdr *shdr, uint8_t size, uint16_t cnt,
 void
 stats_reset(struct stats_hdr *hdr)
 {
-	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0, hdr->s_size * hdr->s_cnt);
+	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0,
+		     hdr->s_size * hdr->s_cnt * STATS_NUM_COPIES);
+}
+
+/**
+ * Reads the value of the statistic entry at the given offset.  When
+ * per-CPU backing is enabled, the copies of the entry are summed up.
+ *
+ * @param hdr The group containing the entry to read.
+ * @param off The offset of the entry, from `hdr`.
+ *
+ * @return The (aggregated) value of the entry.
+ */
+uint64_t
+stats_entry_get(const struct stats_hdr *hdr, uint16_t off)
+{
+	const uint8_t *cur;
+	uint64_t val;
+	int i;
+
+	val = 0;
+	for (i = 0; i < STATS_NUM_COPIES; i++) {
+		cur = (const uint8_t *)hdr + off +
+		      i * hdr->s_size * hdr->s_cnt;
+
+		switch (hdr->s_size) {
+		case sizeof(uint16_t):
+			val += *(const uint16_t *)cur;
+			break;
+		case sizeof(uint32_t):
+			val += *(const uint32_t *)cur;
+			break;
+		case sizeof(uint64_t):
+			val += *(const uint64_t *)cur;
+			break;
+		}
+	}
+
+	return val;
 }
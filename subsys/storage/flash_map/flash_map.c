@@ -109,3 +109,26 @@ uint8_t flash_area_erased_val(const struct flash_area *fa)
 
 	return param->erase_value;
 }
+
+int flash_area_get_pointer(const struct flash_area *fa, off_t off, size_t len,
+			   const void **ptr)
+{
+	if (!is_in_flash_area_bounds(fa, off, len)) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_FLASH_BASE_ADDRESS) && DT_HAS_CHOSEN(zephyr_flash_controller)
+	/* The SoC flash the image executes from is the one flash known to
+	 * be memory mapped; its contents appear in the address space at
+	 * CONFIG_FLASH_BASE_ADDRESS.
+	 */
+	if (fa->fa_dev ==
+	    DEVICE_DT_GET_OR_NULL(DT_CHOSEN(zephyr_flash_controller))) {
+		*ptr = (const void *)(CONFIG_FLASH_BASE_ADDRESS +
+				      fa->fa_off + off);
+		return 0;
+	}
+#endif
+
+	return -ENOTSUP;
+}
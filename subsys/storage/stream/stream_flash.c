@@ -61,8 +61,14 @@ static int settings_direct_loader(const char *key, size_t len,
 				return rc;
 			}
 			ctx->last_erased_page_start_offset = page.start_offset;
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+			ctx->erased_until = page.start_offset + page.size;
+#endif
 		} else {
 			ctx->last_erased_page_start_offset = -1;
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+			ctx->erased_until = ctx->offset;
+#endif
 		}
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 	}
@@ -74,11 +80,91 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+
+/* Erases pages until the contiguously erased region extends past last_byte. */
+static int erase_to(struct stream_flash_ctx *ctx, off_t last_byte)
+{
+	struct flash_pages_info page;
+	int rc;
+
+	while (ctx->erased_until <= last_byte) {
+		rc = flash_get_page_info_by_offs(ctx->fdev, ctx->erased_until,
+						 &page);
+		if (rc != 0) {
+			LOG_ERR("Error %d while getting page info", rc);
+			return rc;
+		}
+
+		LOG_DBG("Erasing page at offset 0x%08lx",
+			(long)page.start_offset);
+
+		rc = flash_erase(ctx->fdev, page.start_offset, page.size);
+		if (rc != 0) {
+			LOG_ERR("Error %d while erasing page", rc);
+			return rc;
+		}
+
+		ctx->last_erased_page_start_offset = page.start_offset;
+		ctx->erased_until = page.start_offset + page.size;
+	}
+
+	return 0;
+}
+
+static void erase_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, erase_work);
+	off_t end = ctx->offset + ctx->available;
+	off_t target = ctx->erase_from;
+	int rc = 0;
+
+	for (int i = 0; i < CONFIG_STREAM_FLASH_ERASE_AHEAD_PAGES; i++) {
+		if (target >= end) {
+			break;
+		}
+
+		rc = erase_to(ctx, target);
+		if (rc != 0) {
+			break;
+		}
+
+		/* One further page per round. */
+		target = ctx->erased_until;
+	}
+
+	ctx->erase_rc = rc;
+	k_sem_give(&ctx->erase_done);
+}
+
+/* Wait for a handed over erase-ahead run to finish and report its result. */
+static int erase_work_join(struct stream_flash_ctx *ctx)
+{
+	if (!ctx->erase_pending) {
+		return 0;
+	}
+
+	k_sem_take(&ctx->erase_done, K_FOREVER);
+	ctx->erase_pending = false;
+
+	return ctx->erase_rc;
+}
+
+#endif /* CONFIG_STREAM_FLASH_ERASE_AHEAD */
+
 int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 {
 	int rc;
 	struct flash_pages_info page;
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	rc = erase_work_join(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+#endif
+
 	rc = flash_get_page_info_by_offs(ctx->fdev, off, &page);
 	if (rc != 0) {
 		LOG_ERR("Error %d while getting page info", rc);
@@ -104,23 +190,27 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+static int flash_sync_buf(struct stream_flash_ctx *ctx, uint8_t *buf,
+			  size_t buf_bytes, size_t write_addr)
 {
 	int rc = 0;
-	size_t write_addr = ctx->offset + ctx->bytes_written;
 	size_t buf_bytes_aligned;
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
-
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+		/* The pages are normally already erased by the work item;
+		 * catch up synchronously if it has fallen behind.
+		 */
+		rc = erase_work_join(ctx);
+		if (rc == 0) {
+			rc = erase_to(ctx, write_addr + buf_bytes - 1);
+		}
+#else
 		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+					     write_addr + buf_bytes - 1);
+#endif
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -129,17 +219,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	fill_length = flash_get_write_block_size(ctx->fdev);
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = flash_get_parameters(ctx->fdev)->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -151,47 +241,179 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf,
+				buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
-	ctx->bytes_written += ctx->buf_bytes;
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	/* Erase the next pages from the workqueue while the stream source
+	 * produces the next buffer of data.
+	 */
+	ctx->erase_from = write_addr + buf_bytes_aligned;
+	if (ctx->erase_from < (off_t)(ctx->offset + ctx->available)) {
+		ctx->erase_pending = true;
+		k_work_submit(&ctx->erase_work);
+	}
+#endif
+
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+
+static void write_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, wr_work);
+
+	ctx->wr_rc = flash_sync_buf(ctx, ctx->wr_buf, ctx->wr_bytes,
+				    ctx->wr_addr);
+	k_sem_give(&ctx->wr_done);
+}
+
+/* Wait for a handed over buffer half to reach the flash and account
+ * for it.
+ */
+static int write_work_join(struct stream_flash_ctx *ctx)
+{
+	if (!ctx->wr_pending) {
+		return 0;
+	}
+
+	k_sem_take(&ctx->wr_done, K_FOREVER);
+	ctx->wr_pending = false;
+
+	if (ctx->wr_rc == 0) {
+		ctx->bytes_written += ctx->wr_bytes;
+	}
+
+	return ctx->wr_rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	uint8_t *full_buf;
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = write_work_join(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* Hand the filled half over to the work item and keep filling
+	 * the other one while it is being written.
+	 */
+	full_buf = ctx->buf;
+	ctx->buf = ctx->wr_buf;
+	ctx->wr_buf = full_buf;
+	ctx->wr_bytes = ctx->buf_bytes;
+	ctx->wr_addr = ctx->offset + ctx->bytes_written;
 	ctx->buf_bytes = 0U;
+	ctx->wr_pending = true;
+	k_work_submit(&ctx->wr_work);
+
+	return 0;
+}
+
+#else /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_sync_buf(ctx, ctx->buf, ctx->buf_bytes,
+			    ctx->offset + ctx->bytes_written);
+	if (rc == 0) {
+		ctx->bytes_written += ctx->buf_bytes;
+		ctx->buf_bytes = 0U;
+	}
 
 	return rc;
 }
 
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
+#ifdef CONFIG_STREAM_FLASH_DIRECT_WRITE
+
+static int flash_sync_direct(struct stream_flash_ctx *ctx, const uint8_t *data)
+{
+	int rc;
+
+	/* ctx->buf_len is a multiple of the write block size, so
+	 * flash_sync_buf() does not pad the buffer and, with no callback
+	 * set, does not modify it either; the cast is safe.
+	 */
+	rc = flash_sync_buf(ctx, (uint8_t *)data, ctx->buf_len,
+			    ctx->offset + ctx->bytes_written);
+	if (rc == 0) {
+		ctx->bytes_written += ctx->buf_len;
+	}
+
+	return rc;
+}
+
+#endif /* CONFIG_STREAM_FLASH_DIRECT_WRITE */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
 	int processed = 0;
 	int rc = 0;
 	int buf_empty_bytes;
+	size_t unwritten;
 
 	if (!ctx) {
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	unwritten = ctx->bytes_written + ctx->buf_bytes;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (ctx->wr_pending) {
+		unwritten += ctx->wr_bytes;
+	}
+#endif
+	if (unwritten + len > ctx->available) {
 		return -ENOMEM;
 	}
 
 	while ((len - processed) >=
 	       (buf_empty_bytes = ctx->buf_len - ctx->buf_bytes)) {
+#ifdef CONFIG_STREAM_FLASH_DIRECT_WRITE
+		/* Full buffers bypass ctx->buf when nothing is staged in it
+		 * and no read-back callback needs a modifiable buffer.
+		 */
+		if (ctx->buf_bytes == 0U && ctx->callback == NULL) {
+			rc = flash_sync_direct(ctx, data + processed);
+			if (rc != 0) {
+				return rc;
+			}
+
+			processed += ctx->buf_len;
+			continue;
+		}
+#endif
 		memcpy(ctx->buf + ctx->buf_bytes, data + processed,
 		       buf_empty_bytes);
 
@@ -216,6 +438,15 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	/* Make sure all handed over data has reached the flash before
+	 * reporting the stream as flushed.
+	 */
+	if (flush && rc == 0) {
+		rc = write_work_join(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -300,6 +531,31 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->last_erased_page_start_offset = -1;
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	ctx->erased_until = offset;
+	ctx->erase_from = offset;
+	ctx->erase_rc = 0;
+	ctx->erase_pending = false;
+	k_work_init(&ctx->erase_work, erase_work_handler);
+	k_sem_init(&ctx->erase_done, 0, 1);
+#endif
+
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (buf_len % (2 * flash_get_write_block_size(fdev))) {
+		LOG_ERR("Buffer can not be split into two aligned halves");
+		return -EFAULT;
+	}
+
+	/* Fill one half while the other is being written */
+	ctx->buf_len = buf_len / 2;
+	ctx->wr_buf = buf + ctx->buf_len;
+	ctx->wr_bytes = 0U;
+	ctx->wr_rc = 0;
+	ctx->wr_pending = false;
+	k_work_init(&ctx->wr_work, write_work_handler);
+	k_sem_init(&ctx->wr_done, 0, 1);
+#endif
+
 	return 0;
 }
 
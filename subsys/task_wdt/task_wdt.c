@@ -8,6 +8,7 @@
 
 #include <zephyr/drivers/watchdog.h>
 #include <zephyr/sys/reboot.h>
+#include <zephyr/sys/rb.h>
 #include <zephyr/device.h>
 #include <errno.h>
 
@@ -35,6 +36,12 @@ struct task_wdt_channel {
 	void *user_data;
 	/* function to be called when watchdog timer expired */
 	task_wdt_callback_t callback;
+#ifdef CONFIG_TASK_WDT_SORTED_DEADLINES
+	/* node in the deadline tree */
+	struct rbnode node;
+	/* this channel is currently linked into the deadline tree */
+	bool in_tree;
+#endif
 };
 
 /* array of all task watchdog channels */
@@ -50,6 +57,49 @@ static int hw_wdt_channel;
 static bool hw_wdt_started;
 #endif
 
+#ifdef CONFIG_TASK_WDT_SORTED_DEADLINES
+static bool channel_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct task_wdt_channel *ch_a =
+		CONTAINER_OF(a, struct task_wdt_channel, node);
+	struct task_wdt_channel *ch_b =
+		CONTAINER_OF(b, struct task_wdt_channel, node);
+
+	if (ch_a->timeout_abs_ticks != ch_b->timeout_abs_ticks) {
+		return ch_a->timeout_abs_ticks < ch_b->timeout_abs_ticks;
+	}
+
+	/* tie-break so that equal deadlines still sort strictly */
+	return a < b;
+}
+
+/* active channels ordered by expiration, earliest deadline leftmost */
+static struct rbtree deadline_tree = {
+	.lessthan_fn = channel_lessthan,
+};
+
+/* The scheduler lock taken in task_wdt_feed() does not mask interrupts,
+ * so the timer callback could observe the tree in the middle of a
+ * rebalance. All tree accesses take this lock; they are O(log n) at
+ * most.
+ */
+static struct k_spinlock deadline_lock;
+
+static void channel_set_deadline(int channel_id, int64_t deadline)
+{
+	k_spinlock_key_t key = k_spin_lock(&deadline_lock);
+
+	if (channels[channel_id].in_tree) {
+		rb_remove(&deadline_tree, &channels[channel_id].node);
+	}
+
+	channels[channel_id].timeout_abs_ticks = deadline;
+	rb_insert(&deadline_tree, &channels[channel_id].node);
+	channels[channel_id].in_tree = true;
+	k_spin_unlock(&deadline_lock, key);
+}
+#endif /* CONFIG_TASK_WDT_SORTED_DEADLINES */
+
 static void schedule_next_timeout(int64_t current_ticks)
 {
 	uintptr_t next_channel_id;	/* channel which will time out next */
@@ -64,6 +114,22 @@ static void schedule_next_timeout(int64_t current_ticks)
 	next_timeout = INT64_MAX;
 #endif
 
+#ifdef CONFIG_TASK_WDT_SORTED_DEADLINES
+	/* earliest deadline is the leftmost node of the tree */
+	k_spinlock_key_t key = k_spin_lock(&deadline_lock);
+	struct rbnode *min_node = rb_get_min(&deadline_tree);
+
+	if (min_node != NULL) {
+		struct task_wdt_channel *ch =
+			CONTAINER_OF(min_node, struct task_wdt_channel, node);
+
+		if (ch->timeout_abs_ticks < next_timeout) {
+			next_channel_id = (uintptr_t)(ch - channels);
+			next_timeout = ch->timeout_abs_ticks;
+		}
+	}
+	k_spin_unlock(&deadline_lock, key);
+#else
 	/* find minimum timeout of all channels */
 	for (int id = 0; id < ARRAY_SIZE(channels); id++) {
 		if (channels[id].reload_period != 0 &&
@@ -72,6 +138,7 @@ static void schedule_next_timeout(int64_t current_ticks)
 			next_timeout = channels[id].timeout_abs_ticks;
 		}
 	}
+#endif
 
 	/* update task wdt kernel timer */
 	k_timer_user_data_set(&timer, (void *)next_channel_id);
@@ -191,6 +258,16 @@ int task_wdt_delete(int channel_id)
 
 	channels[channel_id].reload_period = 0;
 
+#ifdef CONFIG_TASK_WDT_SORTED_DEADLINES
+	k_spinlock_key_t key = k_spin_lock(&deadline_lock);
+
+	if (channels[channel_id].in_tree) {
+		rb_remove(&deadline_tree, &channels[channel_id].node);
+		channels[channel_id].in_tree = false;
+	}
+	k_spin_unlock(&deadline_lock, key);
+#endif
+
 	return 0;
 }
 
@@ -213,8 +290,13 @@ int task_wdt_feed(int channel_id)
 	current_ticks = sys_clock_tick_get();
 
 	/* feed the specified channel */
+#ifdef CONFIG_TASK_WDT_SORTED_DEADLINES
+	channel_set_deadline(channel_id, current_ticks +
+		k_ms_to_ticks_ceil64(channels[channel_id].reload_period));
+#else
 	channels[channel_id].timeout_abs_ticks = current_ticks +
 		k_ms_to_ticks_ceil64(channels[channel_id].reload_period);
+#endif
 
 	schedule_next_timeout(current_ticks);
 
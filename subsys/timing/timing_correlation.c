@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#ifdef CONFIG_PTP_CLOCK
+#include <zephyr/drivers/ptp_clock.h>
+#endif
+
+/*
+ * Per-CPU correlation between the timing counter, the system uptime and
+ * PTP time. The base point anchors the counter to the uptime, the rate
+ * converts counter deltas to nanoseconds and gets refined from the
+ * elapsed uptime between two calibrations, which absorbs the drift of a
+ * counter that does not run at exactly its nominal frequency.
+ */
+struct timing_corr {
+	/* Counter value captured at the last calibration */
+	timing_t base;
+	/* System uptime at the last calibration, in nanoseconds */
+	uint64_t uptime_ns;
+	/* Nanoseconds per counter cycle, as a Q32 fixed point value */
+	uint64_t rate;
+	/* PTP time minus system uptime at the last calibration */
+	int64_t ptp_offset_ns;
+	/* A calibration point has been captured */
+	bool valid;
+	/* The PTP offset has been captured */
+	bool ptp_valid;
+};
+
+static struct timing_corr corr[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Multiply a cycle delta with a Q32 rate without overflowing 64 bits */
+static uint64_t cycles_mul_rate(uint64_t cycles, uint64_t rate)
+{
+	return ((cycles >> 32) * rate) +
+	       (((cycles & BIT64_MASK(32)) * rate) >> 32);
+}
+
+static struct timing_corr *this_cpu_corr(void)
+{
+	return &corr[arch_curr_cpu()->id];
+}
+
+int timing_correlation_calibrate(const struct device *ptp_clock)
+{
+	struct timing_corr *c;
+	uint64_t uptime_ns;
+	timing_t now;
+	unsigned int key;
+	int ret = 0;
+
+	key = irq_lock();
+	c = this_cpu_corr();
+	now = timing_counter_get();
+	uptime_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+
+	if (c->valid) {
+		uint64_t dcycles = timing_cycles_get(&c->base, &now);
+		uint64_t dns = uptime_ns - c->uptime_ns;
+
+		/* Refine the rate from the elapsed time, unless the
+		 * window is too small to be meaningful or so large that
+		 * the quotient would overflow.
+		 */
+		if (dcycles > 0 && dns > 0 && (dns >> 32) == 0) {
+			c->rate = (dns << 32) / dcycles;
+		}
+	} else {
+		/* First point, start from the nominal frequency */
+		c->rate = ((uint64_t)NSEC_PER_SEC << 32) / timing_freq_get();
+	}
+
+	c->base = now;
+	c->uptime_ns = uptime_ns;
+	c->valid = true;
+	irq_unlock(key);
+
+#ifdef CONFIG_PTP_CLOCK
+	if (ptp_clock != NULL) {
+		struct net_ptp_time tm;
+
+		ret = ptp_clock_get(ptp_clock, &tm);
+		if (ret == 0) {
+			c->ptp_offset_ns = (int64_t)(tm.second * NSEC_PER_SEC +
+						     tm.nanosecond) -
+					   (int64_t)uptime_ns;
+			c->ptp_valid = true;
+		}
+	}
+#else
+	ARG_UNUSED(ptp_clock);
+#endif
+
+	return ret;
+}
+
+uint64_t timing_counter_to_uptime_ns(timing_t ts)
+{
+	struct timing_corr *c = this_cpu_corr();
+
+	if (!c->valid) {
+		/* Not calibrated, fall back to the nominal frequency */
+		return timing_cycles_to_ns(ts);
+	}
+
+	return c->uptime_ns +
+	       cycles_mul_rate(timing_cycles_get(&c->base, &ts), c->rate);
+}
+
+int timing_counter_to_ptp_ns(timing_t ts, uint64_t *ptp_ns)
+{
+	struct timing_corr *c = this_cpu_corr();
+
+	if (!c->valid || !c->ptp_valid) {
+		return -EAGAIN;
+	}
+
+	*ptp_ns = (uint64_t)((int64_t)timing_counter_to_uptime_ns(ts) +
+			     c->ptp_offset_ns);
+
+	return 0;
+}
@@ -104,6 +104,16 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+/**
+ * @brief Make room in the tracing buffer by discarding oldest packets.
+ *
+ * Only available in flight recorder mode, where the tracing buffer
+ * works as a continuously overwritten history of the latest packets.
+ *
+ * @param size Number of bytes of free space needed.
+ */
+void tracing_buffer_room_make(uint32_t size);
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
@@ -60,6 +60,44 @@ void tracing_trigger_output(bool before_put_is_empty);
  */
 bool is_tracing_thread(void);
 
+/**
+ * @brief Enable tracing an event class at runtime.
+ *
+ * Only available with the runtime filter. Event classes are the
+ * SYS_PORT_TRACE_FILTER_* bit indexes.
+ *
+ * @param event_class Event class to enable.
+ */
+void tracing_filter_enable(uint32_t event_class);
+
+/**
+ * @brief Disable tracing an event class at runtime.
+ *
+ * Only available with the runtime filter. Event classes are the
+ * SYS_PORT_TRACE_FILTER_* bit indexes.
+ *
+ * @param event_class Event class to disable.
+ */
+void tracing_filter_disable(uint32_t event_class);
+
+/**
+ * @brief Check if an event class is traced at runtime.
+ *
+ * @param event_class Event class to check.
+ *
+ * @return True if events of that class are traced; False if not.
+ */
+bool tracing_filter_is_enabled(uint32_t event_class);
+
+/**
+ * @brief Freeze the tracing flight recorder and dump its content.
+ *
+ * Only available in flight recorder mode. Disables tracing so that the
+ * captured window is no longer overwritten and hands the buffered
+ * packets to the tracing backend.
+ */
+void tracing_flight_recorder_dump(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2022 Intel corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Disable syscall tracing for all calls from this compilation unit to avoid
+ * undefined symbols as the macros are not expanded recursively
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <zephyr/sys/util.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_context.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+#define TRACING_NET_DEFAULT_PORT 4242
+
+static struct net_context *tracing_net_ctx;
+static struct sockaddr server_addr;
+static bool net_connect_done;
+
+NET_PKT_SLAB_DEFINE(tracing_tx_pkts, CONFIG_TRACING_NET_MAX_BUF);
+NET_PKT_DATA_POOL_DEFINE(tracing_tx_bufs,
+			 ROUND_UP(CONFIG_TRACING_NET_MAX_PACKET_SIZE /
+				  CONFIG_NET_BUF_DATA_SIZE, 1) *
+			 CONFIG_TRACING_NET_MAX_BUF);
+
+static struct k_mem_slab *get_tx_slab(void)
+{
+	return &tracing_tx_pkts;
+}
+
+static struct net_buf_pool *get_data_pool(void)
+{
+	return &tracing_tx_bufs;
+}
+
+static int tracing_net_connect(void)
+{
+	struct sockaddr_in6 local_addr6 = {0};
+	struct sockaddr_in local_addr4 = {0};
+	struct sockaddr *local_addr = NULL;
+	socklen_t server_addr_len = 0;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && server_addr.sa_family == AF_INET) {
+		local_addr = (struct sockaddr *)&local_addr4;
+		server_addr_len = sizeof(struct sockaddr_in);
+		local_addr4.sin_port = 0U;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && server_addr.sa_family == AF_INET6) {
+		local_addr = (struct sockaddr *)&local_addr6;
+		server_addr_len = sizeof(struct sockaddr_in6);
+		local_addr6.sin6_port = 0U;
+	}
+
+	if (local_addr == NULL) {
+		return -EINVAL;
+	}
+
+	local_addr->sa_family = server_addr.sa_family;
+
+	ret = net_context_get(server_addr.sa_family, SOCK_DGRAM, IPPROTO_UDP,
+			      &tracing_net_ctx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = net_context_bind(tracing_net_ctx, local_addr, server_addr_len);
+	if (ret < 0) {
+		goto release;
+	}
+
+	ret = net_context_connect(tracing_net_ctx, &server_addr,
+				  server_addr_len, NULL, K_FOREVER, NULL);
+	if (ret < 0) {
+		goto release;
+	}
+
+	net_context_setup_pools(tracing_net_ctx, get_tx_slab, get_data_pool);
+
+	return 0;
+
+release:
+	net_context_put(tracing_net_ctx);
+	tracing_net_ctx = NULL;
+
+	return ret;
+}
+
+static void tracing_backend_net_output(
+		const struct tracing_backend *backend,
+		uint8_t *data, uint32_t length)
+{
+	int ret;
+
+	/*
+	 * Networking is not up when the tracing subsystem initializes,
+	 * so the context is set up lazily on first output.
+	 */
+	if (!net_connect_done) {
+		if (tracing_net_connect() < 0) {
+			tracing_packet_drop_handle();
+			return;
+		}
+
+		net_connect_done = true;
+	}
+
+	while (length > 0) {
+		uint32_t send_len = MIN(length,
+					CONFIG_TRACING_NET_MAX_PACKET_SIZE);
+
+		ret = net_context_send(tracing_net_ctx, data, send_len,
+				       NULL, K_FOREVER, NULL);
+		if (ret < 0) {
+			tracing_packet_drop_handle();
+			return;
+		}
+
+		data += send_len;
+		length -= send_len;
+	}
+}
+
+static void tracing_backend_net_init(void)
+{
+	net_sin(&server_addr)->sin_port = htons(TRACING_NET_DEFAULT_PORT);
+
+	/* On parse failure the address family stays unspecified and
+	 * connecting fails, so all tracing data is counted as dropped.
+	 */
+	(void)net_ipaddr_parse(CONFIG_TRACING_NET_SERVER,
+			       sizeof(CONFIG_TRACING_NET_SERVER) - 1,
+			       &server_addr);
+}
+
+const struct tracing_backend_api tracing_backend_net_api = {
+	.init = tracing_backend_net_init,
+	.output = tracing_backend_net_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_net, tracing_backend_net_api);
@@ -10,6 +10,50 @@ static struct ring_buf tracing_ring_buf;
 static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+/* Lengths of committed packets, kept so that the oldest data can be
+ * discarded in whole packet units and a dumped stream always starts at
+ * a packet boundary.
+ */
+static uint16_t packet_lens[CONFIG_TRACING_BUFFER_SIZE / 8];
+static uint32_t packet_put_idx;
+static uint32_t packet_count;
+
+static void oldest_packet_discard(void)
+{
+	uint32_t get_idx;
+
+	if (packet_count == 0) {
+		return;
+	}
+
+	get_idx = (packet_put_idx + ARRAY_SIZE(packet_lens) - packet_count) %
+		  ARRAY_SIZE(packet_lens);
+
+	(void)ring_buf_get(&tracing_ring_buf, NULL, packet_lens[get_idx]);
+	packet_count--;
+}
+
+static void packet_len_store(uint32_t size)
+{
+	if (packet_count == ARRAY_SIZE(packet_lens)) {
+		oldest_packet_discard();
+	}
+
+	packet_lens[packet_put_idx] = (uint16_t)size;
+	packet_put_idx = (packet_put_idx + 1) % ARRAY_SIZE(packet_lens);
+	packet_count++;
+}
+
+void tracing_buffer_room_make(uint32_t size)
+{
+	while ((ring_buf_space_get(&tracing_ring_buf) < size) &&
+	       (packet_count > 0)) {
+		oldest_packet_discard();
+	}
+}
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER */
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,17 +63,36 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	tracing_buffer_room_make(size);
+#endif
 	return ring_buf_put_claim(&tracing_ring_buf, data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	if (size > 0) {
+		packet_len_store(size);
+	}
+#endif
 	return ring_buf_put_finish(&tracing_ring_buf, size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	uint32_t put_size;
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	tracing_buffer_room_make(size);
+#endif
+	put_size = ring_buf_put(&tracing_ring_buf, data, size);
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	if (put_size > 0) {
+		packet_len_store(put_size);
+	}
+#endif
+	return put_size;
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
@@ -51,6 +114,11 @@ void tracing_buffer_init(void)
 {
 	ring_buf_init(&tracing_ring_buf,
 		      sizeof(tracing_buffer), tracing_buffer);
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	packet_put_idx = 0;
+	packet_count = 0;
+#endif
 }
 
 bool tracing_buffer_is_empty(void)
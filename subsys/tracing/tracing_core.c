@@ -18,6 +18,12 @@
 #include <tracing_buffer.h>
 #include <tracing_backend.h>
 
+#if defined(CONFIG_SHELL) && \
+	(defined(CONFIG_TRACING_FLIGHT_RECORDER) || \
+	 defined(CONFIG_TRACING_RUNTIME_FILTER))
+#include <zephyr/shell/shell.h>
+#endif
+
 #define TRACING_CMD_ENABLE  "enable"
 #define TRACING_CMD_DISABLE "disable"
 
@@ -25,6 +31,8 @@
 #define TRACING_BACKEND_NAME "tracing_backend_uart"
 #elif defined CONFIG_TRACING_BACKEND_USB
 #define TRACING_BACKEND_NAME "tracing_backend_usb"
+#elif defined CONFIG_TRACING_BACKEND_NET
+#define TRACING_BACKEND_NAME "tracing_backend_net"
 #elif defined CONFIG_TRACING_BACKEND_POSIX
 #define TRACING_BACKEND_NAME "tracing_backend_posix"
 #elif defined CONFIG_TRACING_BACKEND_RAM
@@ -62,6 +70,24 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 	tracing_buffer_max_length = tracing_buffer_capacity_get();
 
 	while (true) {
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+		/* Packets stay in the tracing buffer, overwriting the oldest
+		 * ones, until a dump is requested.
+		 */
+		k_sem_take(&tracing_thread_sem, K_FOREVER);
+
+		while (!tracing_buffer_is_empty()) {
+			transferring_length =
+				tracing_buffer_get_claim(
+						&transferring_buf,
+						tracing_buffer_max_length);
+			tracing_buffer_handle(transferring_buf,
+					      transferring_length);
+			tracing_buffer_get_finish(transferring_length);
+		}
+
+		tracing_buffer_init();
+#else
 		if (tracing_buffer_is_empty()) {
 			k_sem_take(&tracing_thread_sem, K_FOREVER);
 		} else {
@@ -73,6 +99,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 					      transferring_length);
 			tracing_buffer_get_finish(transferring_length);
 		}
+#endif
 	}
 }
 
@@ -123,6 +150,11 @@ SYS_INIT(tracing_init, APPLICATION, 0);
 #ifdef CONFIG_TRACING_ASYNC
 void tracing_trigger_output(bool before_put_is_empty)
 {
+	if (IS_ENABLED(CONFIG_TRACING_FLIGHT_RECORDER)) {
+		/* Buffer content is only output on dump request. */
+		return;
+	}
+
 	if (before_put_is_empty) {
 		k_timer_start(&tracing_thread_timer,
 			      K_MSEC(CONFIG_TRACING_THREAD_WAIT_THRESHOLD),
@@ -159,3 +191,171 @@ void tracing_packet_drop_handle(void)
 {
 	atomic_inc(&tracing_packet_drop_num);
 }
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+void tracing_flight_recorder_dump(void)
+{
+	/* Freeze first so that no new packets overwrite the captured
+	 * window while it is handed to the backend.
+	 */
+	tracing_set_state(TRACING_DISABLE);
+	k_sem_give(&tracing_thread_sem);
+}
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER */
+
+#ifdef CONFIG_TRACING_RUNTIME_FILTER
+/* All event classes start enabled. Hook sites test a single bit of this
+ * word before marshalling any event argument.
+ */
+uint32_t sys_port_trace_filter_mask = BIT_MASK(SYS_PORT_TRACE_FILTER_COUNT);
+
+void tracing_filter_enable(uint32_t event_class)
+{
+	if (event_class < SYS_PORT_TRACE_FILTER_COUNT) {
+		sys_port_trace_filter_mask |= BIT(event_class);
+	}
+}
+
+void tracing_filter_disable(uint32_t event_class)
+{
+	if (event_class < SYS_PORT_TRACE_FILTER_COUNT) {
+		sys_port_trace_filter_mask &= ~BIT(event_class);
+	}
+}
+
+bool tracing_filter_is_enabled(uint32_t event_class)
+{
+	return (sys_port_trace_filter_mask & BIT(event_class)) != 0;
+}
+#endif /* CONFIG_TRACING_RUNTIME_FILTER */
+
+#ifdef CONFIG_SHELL
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+static int cmd_trace_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	tracing_flight_recorder_dump();
+	shell_print(sh, "Tracing frozen, dumping flight recorder buffer");
+
+	return 0;
+}
+
+#define TRACE_SHELL_CMD_DUMP					\
+	SHELL_CMD_ARG(dump, NULL,				\
+		"Freeze tracing and dump the flight recorder buffer.", \
+		cmd_trace_dump, 1, 0),
+#else
+#define TRACE_SHELL_CMD_DUMP
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER */
+
+#ifdef CONFIG_TRACING_RUNTIME_FILTER
+static const char * const filter_class_names[] = {
+	[SYS_PORT_TRACE_FILTER_THREAD] = "thread",
+	[SYS_PORT_TRACE_FILTER_WORK] = "work",
+	[SYS_PORT_TRACE_FILTER_SEMAPHORE] = "semaphore",
+	[SYS_PORT_TRACE_FILTER_MUTEX] = "mutex",
+	[SYS_PORT_TRACE_FILTER_CONDVAR] = "condvar",
+	[SYS_PORT_TRACE_FILTER_QUEUE] = "queue",
+	[SYS_PORT_TRACE_FILTER_FIFO] = "fifo",
+	[SYS_PORT_TRACE_FILTER_LIFO] = "lifo",
+	[SYS_PORT_TRACE_FILTER_STACK] = "stack",
+	[SYS_PORT_TRACE_FILTER_MSGQ] = "msgq",
+	[SYS_PORT_TRACE_FILTER_MBOX] = "mbox",
+	[SYS_PORT_TRACE_FILTER_PIPE] = "pipe",
+	[SYS_PORT_TRACE_FILTER_HEAP] = "heap",
+	[SYS_PORT_TRACE_FILTER_MEM_SLAB] = "mem_slab",
+	[SYS_PORT_TRACE_FILTER_TIMER] = "timer",
+	[SYS_PORT_TRACE_FILTER_EVENT] = "event",
+	[SYS_PORT_TRACE_FILTER_POLL] = "poll",
+	[SYS_PORT_TRACE_FILTER_PM] = "pm",
+};
+
+static int filter_class_find(const char *name)
+{
+	for (int i = 0; i < ARRAY_SIZE(filter_class_names); i++) {
+		if (strcmp(name, filter_class_names[i]) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int cmd_trace_filter_list(const struct shell *sh, size_t argc,
+				 char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (int i = 0; i < ARRAY_SIZE(filter_class_names); i++) {
+		shell_print(sh, "%-10s %s", filter_class_names[i],
+			    tracing_filter_is_enabled(i) ?
+			    "enabled" : "disabled");
+	}
+
+	return 0;
+}
+
+static int cmd_trace_filter_set(const struct shell *sh, size_t argc,
+				char **argv, bool enable)
+{
+	int event_class = filter_class_find(argv[1]);
+
+	if (event_class < 0) {
+		shell_error(sh, "Unknown event class: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	if (enable) {
+		tracing_filter_enable(event_class);
+	} else {
+		tracing_filter_disable(event_class);
+	}
+
+	return 0;
+}
+
+static int cmd_trace_filter_enable(const struct shell *sh, size_t argc,
+				   char **argv)
+{
+	return cmd_trace_filter_set(sh, argc, argv, true);
+}
+
+static int cmd_trace_filter_disable(const struct shell *sh, size_t argc,
+				    char **argv)
+{
+	return cmd_trace_filter_set(sh, argc, argv, false);
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_trace_filter,
+	SHELL_CMD_ARG(list, NULL, "List event classes and their state.",
+		      cmd_trace_filter_list, 1, 0),
+	SHELL_CMD_ARG(enable, NULL, "Enable tracing an event class.",
+		      cmd_trace_filter_enable, 2, 0),
+	SHELL_CMD_ARG(disable, NULL, "Disable tracing an event class.",
+		      cmd_trace_filter_disable, 2, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+#define TRACE_SHELL_CMD_FILTER					\
+	SHELL_CMD(filter, &sub_trace_filter,			\
+		  "Runtime event class filter control.", NULL),
+#else
+#define TRACE_SHELL_CMD_FILTER
+#endif /* CONFIG_TRACING_RUNTIME_FILTER */
+
+#if defined(CONFIG_TRACING_FLIGHT_RECORDER) || \
+	defined(CONFIG_TRACING_RUNTIME_FILTER)
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_trace,
+	TRACE_SHELL_CMD_DUMP
+	TRACE_SHELL_CMD_FILTER
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(trace, &sub_trace, "Tracing commands", NULL);
+#endif
+
+#endif /* CONFIG_SHELL */
@@ -5,6 +5,7 @@
  */
 
 #include <string.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/sys/cbprintf.h>
 #include <tracing_buffer.h>
 #include <tracing_format_common.h>
@@ -46,8 +47,14 @@ bool tracing_format_string_put(const char *str, va_list args)
 
 bool tracing_format_raw_data_put(uint8_t *data, uint32_t size)
 {
-	uint32_t space = tracing_buffer_space_get();
+	uint32_t space;
 
+	if (IS_ENABLED(CONFIG_TRACING_FLIGHT_RECORDER)) {
+		/* Room is made by discarding the oldest packets. */
+		return tracing_buffer_put(data, size) == size;
+	}
+
+	space = tracing_buffer_space_get();
 	if (space >= size) {
 		tracing_buffer_put(data, size);
 		return true;
@@ -28,7 +28,14 @@ LOG_MODULE_REGISTER(usb_ecm, CONFIG_USB_DEVICE_NETWORK_LOG_LEVEL);
 #define ECM_IN_EP_IDX			2
 
 
-static uint8_t tx_buf[NET_ETH_MAX_FRAME_SIZE], rx_buf[NET_ETH_MAX_FRAME_SIZE];
+static uint8_t tx_buf[NET_ETH_MAX_FRAME_SIZE];
+
+#ifdef CONFIG_USB_DEVICE_NETWORK_ECM_ZERO_COPY
+/* Packet whose fragment is submitted as the OUT endpoint buffer */
+static struct net_pkt *rx_pkt;
+#else
+static uint8_t rx_buf[NET_ETH_MAX_FRAME_SIZE];
+#endif
 
 struct usb_cdc_ecm_config {
 #ifdef CONFIG_USB_COMPOSITE_DEVICE
@@ -250,6 +257,7 @@ static size_t ecm_eth_size(void *ecm_pkt, size_t len)
 static int ecm_send(struct net_pkt *pkt)
 {
 	size_t len = net_pkt_get_len(pkt);
+	uint8_t *data = tx_buf;
 	int ret;
 
 	if (VERBOSE_DEBUG) {
@@ -261,13 +269,20 @@ static int ecm_send(struct net_pkt *pkt)
 		return -ENOMEM;
 	}
 
-	if (net_pkt_read(pkt, tx_buf, len)) {
+	if (IS_ENABLED(CONFIG_USB_DEVICE_NETWORK_ECM_ZERO_COPY) &&
+	    (pkt->buffer != NULL) && (pkt->buffer->frags == NULL)) {
+		/*
+		 * Single contiguous fragment, hand it to the controller
+		 * directly instead of assembling a copy in tx_buf.
+		 */
+		data = pkt->buffer->data;
+	} else if (net_pkt_read(pkt, tx_buf, len)) {
 		return -ENOBUFS;
 	}
 
 	/* transfer data to host */
 	ret = usb_transfer_sync(ecm_ep_data[ECM_IN_EP_IDX].ep_addr,
-				tx_buf, len, USB_TRANS_WRITE);
+				data, len, USB_TRANS_WRITE);
 	if (ret != len) {
 		LOG_ERR("Transfer failure");
 		return -EINVAL;
@@ -276,6 +291,47 @@ static int ecm_send(struct net_pkt *pkt)
 	return 0;
 }
 
+#ifdef CONFIG_USB_DEVICE_NETWORK_ECM_ZERO_COPY
+static void ecm_read_cb(uint8_t ep, int size, void *priv)
+{
+	struct net_pkt *pkt = rx_pkt;
+
+	if ((pkt != NULL) && (size > 0)) {
+		uint8_t *data = pkt->buffer->data;
+
+		/* Drop the short-packet delimiter byte appended by the host,
+		 * see the copy path below for the rationale.
+		 */
+		if (data[size - 1] == 0U &&
+		    (ecm_eth_size(data, size) == (size - 1))) {
+			size--;
+		}
+
+		net_buf_add(pkt->buffer, size);
+
+		if (VERBOSE_DEBUG) {
+			net_pkt_hexdump(pkt, ">");
+		}
+
+		rx_pkt = NULL;
+		netusb_recv(pkt);
+	}
+
+	if (rx_pkt == NULL) {
+		rx_pkt = net_pkt_rx_alloc_with_buffer(netusb_net_iface(),
+						      NET_ETH_MAX_FRAME_SIZE,
+						      AF_UNSPEC, 0, K_FOREVER);
+		if (rx_pkt == NULL) {
+			LOG_ERR("no memory for network packet");
+			return;
+		}
+	}
+
+	usb_transfer(ecm_ep_data[ECM_OUT_EP_IDX].ep_addr, rx_pkt->buffer->data,
+		     net_buf_tailroom(rx_pkt->buffer), USB_TRANS_READ,
+		     ecm_read_cb, NULL);
+}
+#else
 static void ecm_read_cb(uint8_t ep, int size, void *priv)
 {
 	struct net_pkt *pkt;
@@ -319,6 +375,7 @@ done:
 	usb_transfer(ecm_ep_data[ECM_OUT_EP_IDX].ep_addr, rx_buf,
 		     sizeof(rx_buf), USB_TRANS_READ, ecm_read_cb, NULL);
 }
+#endif /* CONFIG_USB_DEVICE_NETWORK_ECM_ZERO_COPY */
 
 static int ecm_connect(bool connected)
 {
@@ -328,6 +385,13 @@ static int ecm_connect(bool connected)
 		/* Cancel any transfer */
 		usb_cancel_transfer(ecm_ep_data[ECM_OUT_EP_IDX].ep_addr);
 		usb_cancel_transfer(ecm_ep_data[ECM_IN_EP_IDX].ep_addr);
+
+#ifdef CONFIG_USB_DEVICE_NETWORK_ECM_ZERO_COPY
+		if (rx_pkt != NULL) {
+			net_pkt_unref(rx_pkt);
+			rx_pkt = NULL;
+		}
+#endif
 	}
 
 	return 0;
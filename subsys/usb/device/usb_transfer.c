@@ -90,13 +90,34 @@ static void usb_transfer_work(struct k_work *item)
 		if (!trans->bsize) {
 			if (!(trans->flags & USB_TRANS_NO_ZLP)) {
 				LOG_DBG("Transfer ZLP");
-				usb_write(ep, NULL, 0, NULL);
+				if (k_is_in_isr()) {
+					usb_dc_ep_write(ep, NULL, 0, NULL);
+				} else {
+					usb_write(ep, NULL, 0, NULL);
+				}
 			}
 			trans->status = 0;
 			goto done;
 		}
 
-		ret = usb_write(ep, trans->buffer, trans->bsize, &bytes);
+		if (k_is_in_isr()) {
+			/*
+			 * Write the next chunk directly from the completion
+			 * interrupt. usb_write() cannot be used here because
+			 * it yields while retrying a busy endpoint.
+			 */
+			ret = usb_dc_ep_write(ep, trans->buffer, trans->bsize,
+					      &bytes);
+			if (ret == -EAGAIN) {
+				/* Endpoint busy, retry in thread context */
+				k_work_submit_to_queue(&USB_WORK_Q,
+						       &trans->work);
+				return;
+			}
+		} else {
+			ret = usb_write(ep, trans->buffer, trans->bsize,
+					&bytes);
+		}
 		if (ret) {
 			LOG_ERR("Transfer error %d, ep 0x%02x", ret, ep);
 			/* transfer error */
@@ -189,6 +210,14 @@ void usb_transfer_ep_callback(uint8_t ep, enum usb_dc_ep_cb_status_code status)
 		/* If we are not in IRQ context, no need to defer work */
 		/* Read (out) needs to be done from ep_callback */
 		usb_transfer_work(&trans->work);
+	} else if (IS_ENABLED(CONFIG_USB_TRANSFER_WRITE_FROM_ISR) &&
+		   (trans->flags & USB_TRANS_WRITE)) {
+		/*
+		 * Hand the controller the next chunk straight from the
+		 * completion interrupt, so controllers able to packetize a
+		 * whole buffer are not left idle for a workqueue round trip.
+		 */
+		usb_transfer_work(&trans->work);
 	} else {
 		k_work_submit_to_queue(&USB_WORK_Q, &trans->work);
 	}
@@ -16,6 +16,64 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks)
 	return K_TICKS((k_ticks_t)MAX(end_ticks - now_ticks, 0));
 }
 
+static int _zbus_sub_deliver(const struct zbus_observer *obs, const struct zbus_channel *chan,
+			     uint64_t end_ticks)
+{
+#if defined(CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY)
+	struct zbus_delivery_policy *policy = obs->policy;
+
+	if (policy != NULL) {
+		switch (policy->type) {
+		case ZBUS_DELIVERY_COALESCE: {
+			int err = k_msgq_put(obs->queue, &chan, K_NO_WAIT);
+
+			if (err != 0) {
+				const struct zbus_channel *stale;
+
+				/* Queue full. Drop the oldest pending notification
+				 * instead of blocking the publisher, the subscriber
+				 * will wake with the freshest message
+				 */
+				(void)k_msgq_get(obs->queue, &stale, K_NO_WAIT);
+
+				err = k_msgq_put(obs->queue, &chan, K_NO_WAIT);
+			}
+
+			return err;
+		}
+		case ZBUS_DELIVERY_RATE_LIMIT: {
+			int64_t now = sys_clock_tick_get();
+
+			if ((now - policy->last_tick) < k_ms_to_ticks_ceil64(policy->param)) {
+				/* Inside the delivery interval, skip the wakeup. The
+				 * subscriber reads the freshest message on the next
+				 * delivery
+				 */
+				return 0;
+			}
+
+			policy->last_tick = now;
+			break;
+		}
+		case ZBUS_DELIVERY_BATCH:
+			++policy->count;
+
+			if (policy->count < policy->param) {
+				return 0;
+			}
+
+			policy->count = 0;
+			break;
+		case ZBUS_DELIVERY_IMMEDIATE:
+		default:
+			break;
+		}
+	}
+#endif /* CONFIG_ZBUS_OBSERVER_DELIVERY_POLICY */
+
+	return k_msgq_put(obs->queue, &chan, _zbus_timeout_remainder(end_ticks));
+}
+
 #if (CONFIG_ZBUS_RUNTIME_OBSERVERS_POOL_SIZE > 0)
 static inline void _zbus_notify_runtime_listeners(const struct zbus_channel *chan)
 {
@@ -46,8 +104,7 @@ static inline int _zbus_notify_runtime_subscribers(const struct zbus_channel *ch
 		__ASSERT(obs_nd != NULL, "observer node is NULL");
 
 		if (obs_nd->obs->enabled && (obs_nd->obs->queue != NULL)) {
-			err = k_msgq_put(obs_nd->obs->queue, &chan,
-					 _zbus_timeout_remainder(end_ticks));
+			err = _zbus_sub_deliver(obs_nd->obs, chan, end_ticks);
 
 			_ZBUS_ASSERT(err == 0,
 				     "could not deliver notification to observer %s. Error code %d",
@@ -80,7 +137,7 @@ static int _zbus_notify_observers(const struct zbus_channel *chan, uint64_t end_
 	/* Notify static subscribers */
 	for (const struct zbus_observer *const *obs = chan->observers; *obs != NULL; ++obs) {
 		if ((*obs)->enabled && ((*obs)->queue != NULL)) {
-			err = k_msgq_put((*obs)->queue, &chan, _zbus_timeout_remainder(end_ticks));
+			err = _zbus_sub_deliver(*obs, chan, end_ticks);
 			_ZBUS_ASSERT(err == 0, "could not deliver notification to observer %s.",
 				     _ZBUS_OBS_NAME(*obs));
 			if (err) {
@@ -100,6 +157,44 @@ static int _zbus_notify_observers(const struct zbus_channel *chan, uint64_t end_
 	return last_error;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+static void _zbus_seq_pub(const struct zbus_channel *chan, const void *msg)
+{
+	/* Odd value flags the publication in progress. The channel has a single
+	 * publisher, so no other writer can race with the counter here.
+	 */
+	atomic_inc(chan->seq);
+
+	memcpy(chan->message, msg, chan->message_size);
+
+	atomic_inc(chan->seq);
+}
+
+static int _zbus_seq_read(const struct zbus_channel *chan, void *msg, uint64_t end_ticks)
+{
+	atomic_val_t seq;
+
+	for (;;) {
+		seq = atomic_get(chan->seq);
+
+		if ((seq & 1) == 0) {
+			memcpy(msg, chan->message, chan->message_size);
+
+			if (atomic_get(chan->seq) == seq) {
+				return 0;
+			}
+		}
+
+		/* The copy raced with a publication, retry until the timeout */
+		if ((uint64_t)sys_clock_tick_get() >= end_ticks) {
+			return -EAGAIN;
+		}
+
+		k_yield();
+	}
+}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -113,6 +208,14 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 		return -ENOMSG;
 	}
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan->seq != NULL) {
+		_zbus_seq_pub(chan, msg);
+
+		return _zbus_notify_observers(chan, end_ticks);
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	err = k_mutex_lock(chan->mutex, timeout);
 	if (err) {
 		return err;
@@ -135,6 +238,12 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(msg != NULL, "msg is required");
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan->seq != NULL) {
+		return _zbus_seq_read(chan, msg, sys_clock_timeout_end_calc(timeout));
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	err = k_mutex_lock(chan->mutex, timeout);
 	if (err) {
 		return err;
@@ -153,6 +262,13 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan->seq != NULL) {
+		/* Notifications come only from the single publisher thread */
+		return _zbus_notify_observers(chan, end_ticks);
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	err = k_mutex_lock(chan->mutex, timeout);
 	if (err) {
 		return err;
@@ -170,6 +286,15 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan->seq != NULL) {
+		/* The publisher does not take the mutex, so claiming cannot
+		 * stop it from changing the message
+		 */
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	int err = k_mutex_lock(chan->mutex, timeout);
 
 	if (err) {
@@ -184,6 +309,12 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan->seq != NULL) {
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	int err = k_mutex_unlock(chan->mutex);
 
 	return err;
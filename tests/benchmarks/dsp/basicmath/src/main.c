@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measures the per-call cycle cost of zdsp kernels so the DSP path can
+ * be qualified per SoC and backend: the same binary reports the
+ * CMSIS-DSP numbers by default and the numbers of any per-family vendor
+ * override (CONFIG_DSP_BACKEND_CMSIS_OVERRIDES) when one is in place.
+ * The dot product is the MAC-bound kernel, the element-wise operations
+ * cover the load/store-bound family. Results are printed one metric per
+ * line in the machine-readable format the latency_measure benchmark
+ * uses, so twister collects them as records.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/printk.h>
+
+/* Iterations dropped before sampling starts, to warm the caches */
+#define BENCH_WARMUP  4
+/* Number of samples each percentile is computed from */
+#define BENCH_SAMPLES 64
+
+#define BLOCK_SIZE       256
+#define BLOCK_SIZE_SHORT 32
+
+static q7_t src_a_q7[BLOCK_SIZE], src_b_q7[BLOCK_SIZE];
+static q15_t src_a_q15[BLOCK_SIZE], src_b_q15[BLOCK_SIZE], dst_q15[BLOCK_SIZE];
+static q31_t src_a_q31[BLOCK_SIZE], src_b_q31[BLOCK_SIZE], dst_q31[BLOCK_SIZE];
+static float32_t src_a_f32[BLOCK_SIZE], src_b_f32[BLOCK_SIZE], dst_f32[BLOCK_SIZE];
+
+static q31_t result_q31;
+static q63_t result_q63;
+static float32_t result_f32;
+
+static uint32_t samples[BENCH_SAMPLES];
+
+static void report(const char *name)
+{
+	char metric[64];
+
+	/* insertion sort, the sample count is small */
+	for (int i = 1; i < BENCH_SAMPLES; i++) {
+		uint32_t val = samples[i];
+		int j = i - 1;
+
+		while (j >= 0 && samples[j] > val) {
+			samples[j + 1] = samples[j];
+			j--;
+		}
+		samples[j + 1] = val;
+	}
+
+	uint32_t p50 = samples[BENCH_SAMPLES / 2];
+	uint32_t p99 = samples[BENCH_SAMPLES - 1 - BENCH_SAMPLES / 100];
+
+	snprintk(metric, sizeof(metric), "%s.p50", name);
+	printk("%-60s:%8u cycles , %8u ns\n", metric, p50,
+	       (uint32_t)timing_cycles_to_ns(p50));
+	snprintk(metric, sizeof(metric), "%s.p99", name);
+	printk("%-60s:%8u cycles , %8u ns\n", metric, p99,
+	       (uint32_t)timing_cycles_to_ns(p99));
+}
+
+#define BENCH(name, call)                                                      \
+	do {                                                                   \
+		for (int i = 0; i < BENCH_WARMUP; i++) {                       \
+			call;                                                  \
+		}                                                              \
+		for (int i = 0; i < BENCH_SAMPLES; i++) {                      \
+			timing_t start = timing_counter_get();                 \
+			call;                                                  \
+			timing_t end = timing_counter_get();                   \
+			samples[i] = (uint32_t)timing_cycles_get(&start, &end);\
+		}                                                              \
+		report(name);                                                  \
+	} while (0)
+
+void main(void)
+{
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		src_a_q7[i] = (q7_t)(i * 7);
+		src_b_q7[i] = (q7_t)(i * 13);
+		src_a_q15[i] = (q15_t)(i * 181);
+		src_b_q15[i] = (q15_t)(i * 379);
+		src_a_q31[i] = (q31_t)(i * 1234567);
+		src_b_q31[i] = (q31_t)(i * 7654321);
+		src_a_f32[i] = 0.25f * (float32_t)i;
+		src_b_f32[i] = 1.0f - 0.125f * (float32_t)i;
+	}
+
+	timing_init();
+	timing_start();
+
+	BENCH("dsp.dot_prod.q7.256",
+	      zdsp_dot_prod_q7(src_a_q7, src_b_q7, BLOCK_SIZE, &result_q31));
+	BENCH("dsp.dot_prod.q15.256",
+	      zdsp_dot_prod_q15(src_a_q15, src_b_q15, BLOCK_SIZE, &result_q63));
+	BENCH("dsp.dot_prod.q31.256",
+	      zdsp_dot_prod_q31(src_a_q31, src_b_q31, BLOCK_SIZE, &result_q63));
+	BENCH("dsp.dot_prod.f32.256",
+	      zdsp_dot_prod_f32(src_a_f32, src_b_f32, BLOCK_SIZE, &result_f32));
+	BENCH("dsp.dot_prod.f32.32",
+	      zdsp_dot_prod_f32(src_a_f32, src_b_f32, BLOCK_SIZE_SHORT,
+				&result_f32));
+
+	BENCH("dsp.mult.q15.256",
+	      zdsp_mult_q15(src_a_q15, src_b_q15, dst_q15, BLOCK_SIZE));
+	BENCH("dsp.mult.f32.256",
+	      zdsp_mult_f32(src_a_f32, src_b_f32, dst_f32, BLOCK_SIZE));
+	BENCH("dsp.add.q31.256",
+	      zdsp_add_q31(src_a_q31, src_b_q31, dst_q31, BLOCK_SIZE));
+	BENCH("dsp.scale.f32.256",
+	      zdsp_scale_f32(src_a_f32, 0.5f, dst_f32, BLOCK_SIZE));
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_ctrl.h>
+#include "bench_utils.h"
+
+LOG_MODULE_REGISTER(bench_log, LOG_LEVEL_INF);
+
+static struct bench emit_bench;
+
+void bench_log(void)
+{
+	timing_t start, end;
+	uint32_t processed = 0;
+	uint32_t sum = 0;
+
+	bench_reset(&emit_bench);
+
+	/* Cost of emitting a message in deferred mode */
+	for (uint32_t i = 0; i < BENCH_WARMUP + BENCH_SAMPLES; i++) {
+		start = timing_counter_get();
+		LOG_INF("benchmark message %u", i);
+		end = timing_counter_get();
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&emit_bench, &start, &end);
+		}
+
+		/* Drain so the message buffer never fills up and every
+		 * iteration takes the same path.
+		 */
+		start = timing_counter_get();
+		while (log_process()) {
+		}
+		end = timing_counter_get();
+
+		if (i >= BENCH_WARMUP) {
+			sum += (uint32_t)timing_cycles_get(&start, &end);
+			processed++;
+		}
+	}
+
+	bench_report(&emit_bench, "log.emit");
+	PRINT_F("log.process.avg", sum / processed,
+		(uint32_t)timing_cycles_to_ns_avg(sum, processed));
+}
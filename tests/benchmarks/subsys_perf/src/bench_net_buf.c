@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include "bench_utils.h"
+
+NET_BUF_POOL_DEFINE(bench_pool, 8, 128, 0, NULL);
+
+static struct bench alloc_bench;
+static struct bench unref_bench;
+
+void bench_net_buf(void)
+{
+	timing_t start, end;
+	struct net_buf *buf;
+
+	bench_reset(&alloc_bench);
+	bench_reset(&unref_bench);
+
+	for (uint32_t i = 0; i < BENCH_WARMUP + BENCH_SAMPLES; i++) {
+		start = timing_counter_get();
+		buf = net_buf_alloc(&bench_pool, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (buf == NULL) {
+			printk("Error: net_buf allocation failed\n");
+			return;
+		}
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&alloc_bench, &start, &end);
+		}
+
+		start = timing_counter_get();
+		net_buf_unref(buf);
+		end = timing_counter_get();
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&unref_bench, &start, &end);
+		}
+	}
+
+	bench_report(&alloc_bench, "net_buf.alloc");
+	bench_report(&unref_bench, "net_buf.unref");
+}
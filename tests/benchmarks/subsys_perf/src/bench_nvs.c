@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include "bench_utils.h"
+
+#if DT_NODE_EXISTS(DT_NODELABEL(storage_partition))
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/fs/nvs.h>
+
+#define NVS_FLASH_AREA		storage_partition
+#define NVS_FLASH_AREA_OFFSET	FIXED_PARTITION_OFFSET(NVS_FLASH_AREA)
+#define NVS_FLASH_AREA_ID	FIXED_PARTITION_ID(NVS_FLASH_AREA)
+#define NVS_SECTOR_COUNT	4U
+#define NVS_DATA_ID		1
+
+/* Fewer iterations than the RAM based benchmarks, every write hits flash */
+#define NVS_SAMPLES		32
+
+static struct nvs_fs fs;
+static struct bench write_bench;
+static struct bench read_bench;
+
+void bench_nvs(void)
+{
+	timing_t start, end;
+	const struct flash_area *fa;
+	struct flash_pages_info info;
+	uint32_t data;
+	int err;
+
+	err = flash_area_open(NVS_FLASH_AREA_ID, &fa);
+	if (err != 0) {
+		printk("Error: flash_area_open() failed (%d)\n", err);
+		return;
+	}
+
+	fs.offset = NVS_FLASH_AREA_OFFSET;
+	err = flash_get_page_info_by_offs(flash_area_get_device(fa),
+					  fs.offset, &info);
+	if (err != 0) {
+		printk("Error: unable to get page info (%d)\n", err);
+		return;
+	}
+
+	fs.sector_size = info.size;
+	fs.sector_count = NVS_SECTOR_COUNT;
+	fs.flash_device = flash_area_get_device(fa);
+
+	err = nvs_mount(&fs);
+	if (err != 0) {
+		printk("Error: nvs_mount() failed (%d)\n", err);
+		return;
+	}
+
+	bench_reset(&write_bench);
+	bench_reset(&read_bench);
+
+	for (uint32_t i = 0; i < BENCH_WARMUP + NVS_SAMPLES; i++) {
+		/* Changing data, identical data would skip the write */
+		data = i;
+
+		start = timing_counter_get();
+		err = nvs_write(&fs, NVS_DATA_ID, &data, sizeof(data));
+		end = timing_counter_get();
+
+		if (err < 0) {
+			printk("Error: nvs_write() failed (%d)\n", err);
+			return;
+		}
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&write_bench, &start, &end);
+		}
+
+		start = timing_counter_get();
+		err = nvs_read(&fs, NVS_DATA_ID, &data, sizeof(data));
+		end = timing_counter_get();
+
+		if (err < 0) {
+			printk("Error: nvs_read() failed (%d)\n", err);
+			return;
+		}
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&read_bench, &start, &end);
+		}
+	}
+
+	bench_report(&write_bench, "nvs.write");
+	bench_report(&read_bench, "nvs.read");
+}
+
+#else
+
+void bench_nvs(void)
+{
+	printk("Skipping NVS benchmark, no storage partition\n");
+}
+
+#endif /* DT_NODE_EXISTS(DT_NODELABEL(storage_partition)) */
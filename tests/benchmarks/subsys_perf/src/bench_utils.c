@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bench_utils.h"
+
+static void sort_samples(uint32_t *samples, uint32_t count)
+{
+	/* Insertion sort, the sample sets are small */
+	for (uint32_t i = 1; i < count; i++) {
+		uint32_t val = samples[i];
+		uint32_t j = i;
+
+		while (j > 0 && samples[j - 1] > val) {
+			samples[j] = samples[j - 1];
+			j--;
+		}
+
+		samples[j] = val;
+	}
+}
+
+void bench_report(struct bench *bench, const char *name)
+{
+	char metric[80];
+
+	if (bench->count == 0) {
+		printk("Error: no samples collected for %s\n", name);
+		return;
+	}
+
+	sort_samples(bench->samples, bench->count);
+
+	snprintk(metric, sizeof(metric), "%s.p50", name);
+	PRINT_STATS(metric, bench->samples[bench->count / 2]);
+
+	snprintk(metric, sizeof(metric), "%s.p99", name);
+	PRINT_STATS(metric, bench->samples[(bench->count * 99) / 100]);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _SUBSYS_PERF_BENCH_UTILS_H
+#define _SUBSYS_PERF_BENCH_UTILS_H
+/*
+ * @brief Common sample collection and reporting helpers used by the
+ * subsystem benchmarks. Results are printed one metric per line in the
+ * same machine-readable format the latency_measure benchmark uses, with
+ * the 50th and 99th percentile reported per operation.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/printk.h>
+
+/* Iterations dropped before sampling starts, to warm caches and pools */
+#define BENCH_WARMUP  8
+/* Number of samples each percentile is computed from */
+#define BENCH_SAMPLES 128
+
+struct bench {
+	uint32_t samples[BENCH_SAMPLES];
+	uint32_t count;
+};
+
+#ifdef CSV_FORMAT_OUTPUT
+#define FORMAT "%-60s,%8u,%8u\n"
+#else
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+#endif
+
+#define PRINT_F(...)						\
+	{							\
+		char sline[256];				\
+		snprintk(sline, 254, FORMAT, ##__VA_ARGS__);	\
+		printk("%s", sline);				\
+	}
+
+#define PRINT_STATS(x, y) \
+	PRINT_F(x, y, (uint32_t)timing_cycles_to_ns(y))
+
+static inline void bench_reset(struct bench *bench)
+{
+	bench->count = 0;
+}
+
+static inline void bench_add(struct bench *bench, timing_t *start,
+			     timing_t *end)
+{
+	if (bench->count < BENCH_SAMPLES) {
+		bench->samples[bench->count++] =
+			(uint32_t)timing_cycles_get(start, end);
+	}
+}
+
+/* Report the p50 and p99 of the collected samples as "<name>.p50" etc. */
+void bench_report(struct bench *bench, const char *name);
+
+void bench_work(void);
+void bench_net_buf(void);
+void bench_zbus(void);
+void bench_log(void);
+void bench_nvs(void);
+
+#endif /* _SUBSYS_PERF_BENCH_UTILS_H */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include "bench_utils.h"
+
+static K_SEM_DEFINE(work_done_sem, 0, 1);
+
+static void work_handler(struct k_work *work)
+{
+	k_sem_give(&work_done_sem);
+}
+
+static K_WORK_DEFINE(bench_work_item, work_handler);
+
+static struct bench submit_bench;
+
+void bench_work(void)
+{
+	timing_t start, end;
+
+	bench_reset(&submit_bench);
+
+	for (uint32_t i = 0; i < BENCH_WARMUP + BENCH_SAMPLES; i++) {
+		start = timing_counter_get();
+		k_work_submit(&bench_work_item);
+		end = timing_counter_get();
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&submit_bench, &start, &end);
+		}
+
+		/* Let the handler run so the next submission queues an
+		 * idle work item again.
+		 */
+		k_sem_take(&work_done_sem, K_FOREVER);
+	}
+
+	bench_report(&submit_bench, "work.submit");
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include "bench_utils.h"
+
+struct bench_msg {
+	uint32_t seq;
+	uint32_t payload[3];
+};
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+}
+
+ZBUS_LISTENER_DEFINE(bench_listener, listener_cb);
+
+ZBUS_CHAN_DEFINE(bench_chan, struct bench_msg, NULL, NULL,
+		 ZBUS_OBSERVERS(bench_listener), ZBUS_MSG_INIT(0));
+
+static struct bench pub_bench;
+static struct bench read_bench;
+
+void bench_zbus(void)
+{
+	timing_t start, end;
+	struct bench_msg msg = {0};
+	int err;
+
+	bench_reset(&pub_bench);
+	bench_reset(&read_bench);
+
+	for (uint32_t i = 0; i < BENCH_WARMUP + BENCH_SAMPLES; i++) {
+		msg.seq = i;
+
+		/* Publication latency includes the listener notification */
+		start = timing_counter_get();
+		err = zbus_chan_pub(&bench_chan, &msg, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (err != 0) {
+			printk("Error: zbus publication failed (%d)\n", err);
+			return;
+		}
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&pub_bench, &start, &end);
+		}
+
+		start = timing_counter_get();
+		err = zbus_chan_read(&bench_chan, &msg, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (err != 0) {
+			printk("Error: zbus read failed (%d)\n", err);
+			return;
+		}
+
+		if (i >= BENCH_WARMUP) {
+			bench_add(&read_bench, &start, &end);
+		}
+	}
+
+	bench_report(&pub_bench, "zbus.chan_pub");
+	bench_report(&read_bench, "zbus.chan_read");
+}
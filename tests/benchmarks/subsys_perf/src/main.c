@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @brief Measure the per-operation cost of frequently used subsystem
+ * primitives: k_work submission, net_buf allocation, zbus publication,
+ * log message emission and processing, and NVS read/write.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "bench_utils.h"
+
+void main(void)
+{
+	printk("START subsystem benchmarks\n");
+
+	timing_init();
+	timing_start();
+
+	bench_work();
+	bench_net_buf();
+	bench_zbus();
+	bench_log();
+	bench_nvs();
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
@@ -114,6 +114,40 @@ ZTEST(object_validation, test_generic_object)
 	}
 }
 
+static struct k_sem list_sems[3];
+
+static K_OBJECT_ACCESS_LIST_DEFINE(sem_access_list,
+				   &list_sems[0], &list_sems[1],
+				   &list_sems[2]);
+
+/**
+ * @brief Test granting object access from a pre-defined object list
+ *
+ * @details
+ * - Verify the current thread has no permissions on any object in the list.
+ * - Apply the whole list with a single k_thread_access_grant_list() call.
+ * - Verify every object in the list is now accessible.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_object_access_grant_list()
+ */
+ZTEST(object_validation, test_access_grant_list)
+{
+	for (int i = 0; i < ARRAY_SIZE(list_sems); i++) {
+		zassert_false(test_object(&list_sems[i], -EPERM),
+			      "object should not have had permission granted");
+	}
+
+	k_thread_access_grant_list(k_current_get(), sem_access_list);
+
+	for (int i = 0; i < ARRAY_SIZE(list_sems); i++) {
+		k_sem_init(&list_sems[i], 0, 1);
+		zassert_false(test_object(&list_sems[i], 0),
+			      "object should have had sufficient permissions");
+	}
+}
+
 /**
  * @brief Test requestor thread will implicitly be assigned permission on the
  * dynamically allocated object
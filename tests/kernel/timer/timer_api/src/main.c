@@ -64,6 +64,7 @@ static struct k_timer status_timer;
 static struct k_timer status_anytime_timer;
 static struct k_timer status_sync_timer;
 static struct k_timer remain_timer;
+static struct k_timer boundary_timer;
 
 static ZTEST_BMEM struct timer_data tdata;
 
@@ -809,6 +810,50 @@ ZTEST_USER(timer_api, test_sleep_abs)
 		     start + sleep_ticks, end, late);
 }
 
+static ZTEST_BMEM uint64_t boundary_fired_tick;
+
+static void boundary_expire(struct k_timer *timer)
+{
+	boundary_fired_tick = k_uptime_ticks();
+}
+
+ZTEST_USER(timer_api, test_boundary_expiry_abs)
+{
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		/* k_timer_status_sync blocks, needs threading */
+		return;
+	}
+
+#ifdef CONFIG_TIMEOUT_64BIT
+	/* An expiry landing exactly on a power-of-two tick boundary is
+	 * the corner case for hierarchical timer wheel backends
+	 * (CONFIG_TIMEOUT_WHEEL): the entry cascades to a lower level
+	 * in the very announcement that must also fire it.  The expiry
+	 * handler runs from the announcement of the expiry tick itself,
+	 * so the uptime it observes must match exactly with any
+	 * backend, on any platform, with no slop.
+	 */
+#ifdef CONFIG_TIMEOUT_WHEEL_SLOT_BITS
+	const uint64_t window = BIT(CONFIG_TIMEOUT_WHEEL_SLOT_BITS);
+#else
+	const uint64_t window = 32;
+#endif
+
+	for (int i = 0; i < 3; i++) {
+		uint64_t boundary = ROUND_UP(k_uptime_ticks() + 2, window);
+
+		boundary_fired_tick = 0;
+		k_timer_start(&boundary_timer, K_TIMEOUT_ABS_TICKS(boundary),
+			      K_FOREVER);
+		k_timer_status_sync(&boundary_timer);
+
+		zassert_equal(boundary_fired_tick, boundary,
+			      "expiry at boundary %llu fired at %llu",
+			      boundary, boundary_fired_tick);
+	}
+#endif
+}
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
@@ -830,6 +875,7 @@ void *setup_timer_api(void)
 	timer_init(&status_anytime_timer, NULL, NULL);
 	timer_init(&status_sync_timer, duration_expire, duration_stop);
 	timer_init(&remain_timer, duration_expire, duration_stop);
+	timer_init(&boundary_timer, boundary_expire, NULL);
 
 	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
 		k_thread_access_grant(k_current_get(), &ktimer, &timer0, &timer1,
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/mpmc_ring.h>
+#include <zephyr/random/rand32.h>
+
+#define RING_SIZE 8
+#define STRESS_TIMEOUT_MS ((CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) ? 1000 : 15000)
+
+static struct mpmc_ring ring;
+static uint32_t ring_data[RING_SIZE];
+static atomic_val_t ring_seq[RING_SIZE];
+
+static void init_ring(void)
+{
+	int err;
+
+	err = mpmc_ring_init(&ring, ring_data, ring_seq, RING_SIZE,
+			     sizeof(uint32_t));
+	zassert_equal(err, 0);
+}
+
+ZTEST(test_mpmc_ring, test_init)
+{
+	int err;
+
+	err = mpmc_ring_init(&ring, ring_data, ring_seq, RING_SIZE - 1,
+			     sizeof(uint32_t));
+	zassert_equal(err, -EINVAL, "Non power of two count accepted");
+
+	init_ring();
+}
+
+ZTEST(test_mpmc_ring, test_fill_and_drain)
+{
+	uint32_t item;
+	int err;
+
+	init_ring();
+
+	/* Empty ring */
+	err = mpmc_ring_get(&ring, &item);
+	zassert_equal(err, -EAGAIN);
+
+	for (uint32_t i = 0; i < RING_SIZE; i++) {
+		item = 0xa5a50000 + i;
+		err = mpmc_ring_put(&ring, &item);
+		zassert_equal(err, 0, "Put %u failed", i);
+	}
+
+	/* Full ring */
+	item = 0xdeadbeef;
+	err = mpmc_ring_put(&ring, &item);
+	zassert_equal(err, -ENOMEM);
+	zassert_is_null(mpmc_ring_put_claim(&ring));
+
+	for (uint32_t i = 0; i < RING_SIZE; i++) {
+		err = mpmc_ring_get(&ring, &item);
+		zassert_equal(err, 0, "Get %u failed", i);
+		zassert_equal(item, 0xa5a50000 + i, "Items out of order");
+	}
+
+	err = mpmc_ring_get(&ring, &item);
+	zassert_equal(err, -EAGAIN);
+}
+
+ZTEST(test_mpmc_ring, test_wrap_around)
+{
+	uint32_t item;
+	int err;
+
+	init_ring();
+
+	/* Keep the ring partially filled while the positions and the
+	 * slot stamps lap the ring several times.
+	 */
+	for (uint32_t i = 0; i < 5 * RING_SIZE + 3; i++) {
+		item = i;
+		err = mpmc_ring_put(&ring, &item);
+		zassert_equal(err, 0);
+
+		item = i + 0x10000;
+		err = mpmc_ring_put(&ring, &item);
+		zassert_equal(err, 0);
+
+		err = mpmc_ring_get(&ring, &item);
+		zassert_equal(err, 0);
+		zassert_equal(item, i, "Items out of order");
+
+		err = mpmc_ring_get(&ring, &item);
+		zassert_equal(err, 0);
+		zassert_equal(item, i + 0x10000, "Items out of order");
+	}
+
+	err = mpmc_ring_get(&ring, &item);
+	zassert_equal(err, -EAGAIN);
+}
+
+ZTEST(test_mpmc_ring, test_out_of_order_publish)
+{
+	uint32_t *first;
+	uint32_t *second;
+	uint32_t item;
+	int err;
+
+	init_ring();
+
+	first = mpmc_ring_put_claim(&ring);
+	zassert_not_null(first);
+	second = mpmc_ring_put_claim(&ring);
+	zassert_not_null(second);
+	zassert_not_equal(first, second, "Same slot claimed twice");
+
+	*first = 1;
+	*second = 2;
+
+	/* Publishing out of claim order must not expose the later item
+	 * before the earlier one.
+	 */
+	mpmc_ring_put_finish(&ring, second);
+	err = mpmc_ring_get(&ring, &item);
+	zassert_equal(err, -EAGAIN, "Item visible before claim order");
+
+	mpmc_ring_put_finish(&ring, first);
+
+	err = mpmc_ring_get(&ring, &item);
+	zassert_equal(err, 0);
+	zassert_equal(item, 1U);
+
+	err = mpmc_ring_get(&ring, &item);
+	zassert_equal(err, 0);
+	zassert_equal(item, 2U);
+}
+
+struct stress_data {
+	atomic_t produced_cnt;
+	atomic_t produced_sum;
+	atomic_t consumed_cnt;
+	atomic_t consumed_sum;
+	atomic_t put_err;
+};
+
+static bool stress_produce(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	struct stress_data *ctx = user_data;
+	uint32_t item = sys_rand32_get() & 0xffff;
+
+	if (mpmc_ring_put(&ring, &item) == 0) {
+		atomic_inc(&ctx->produced_cnt);
+		atomic_add(&ctx->produced_sum, item);
+	} else {
+		atomic_inc(&ctx->put_err);
+	}
+
+	return true;
+}
+
+static bool stress_consume(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	struct stress_data *ctx = user_data;
+	uint32_t item;
+
+	if (mpmc_ring_get(&ring, &item) == 0) {
+		atomic_inc(&ctx->consumed_cnt);
+		atomic_add(&ctx->consumed_sum, item);
+	}
+
+	return true;
+}
+
+ZTEST(test_mpmc_ring, test_stress)
+{
+	struct stress_data ctx = { 0 };
+	uint32_t repeat = 10000;
+	uint32_t item;
+
+	init_ring();
+
+	ztress_set_timeout(K_MSEC(STRESS_TIMEOUT_MS));
+
+	/* Two producers and two consumers preempting each other. */
+	ZTRESS_EXECUTE(ZTRESS_THREAD(stress_produce, &ctx, repeat, 0,
+				     Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_consume, &ctx, repeat, 0,
+				     Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_produce, &ctx, repeat, 1000,
+				     Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_consume, &ctx, repeat, 1000,
+				     Z_TIMEOUT_TICKS(4)));
+
+	/* Drain what the consumers did not pick up before the test
+	 * stopped, then production and consumption must match exactly.
+	 */
+	while (mpmc_ring_get(&ring, &item) == 0) {
+		atomic_inc(&ctx.consumed_cnt);
+		atomic_add(&ctx.consumed_sum, item);
+	}
+
+	TC_PRINT("Produced: %ld (%ld full), consumed: %ld\n",
+		 atomic_get(&ctx.produced_cnt), atomic_get(&ctx.put_err),
+		 atomic_get(&ctx.consumed_cnt));
+
+	zassert_equal(atomic_get(&ctx.produced_cnt),
+		      atomic_get(&ctx.consumed_cnt),
+		      "Items lost or duplicated");
+	zassert_equal(atomic_get(&ctx.produced_sum),
+		      atomic_get(&ctx.consumed_sum),
+		      "Item contents corrupted");
+}
+
+ZTEST_SUITE(test_mpmc_ring, NULL, NULL, NULL, NULL, NULL);
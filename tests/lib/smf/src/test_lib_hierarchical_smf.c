@@ -336,6 +336,34 @@ static void state_d_exit(void *obj)
 	/* Do nothing */
 }
 
+#ifdef CONFIG_SMF_STATE_CHAINS
+static const struct smf_state test_states[] = {
+	[PARENT_AB] = SMF_CREATE_STATE_CHAINED(parent_ab_entry, parent_ab_run,
+					       parent_ab_exit, NULL,
+					       &test_states[PARENT_AB]),
+	[PARENT_C] = SMF_CREATE_STATE_CHAINED(parent_c_entry, parent_c_run,
+					      parent_c_exit, NULL,
+					      &test_states[PARENT_C]),
+	[STATE_A] = SMF_CREATE_STATE_CHAINED(state_a_entry, state_a_run,
+					     state_a_exit,
+					     &test_states[PARENT_AB],
+					     &test_states[PARENT_AB],
+					     &test_states[STATE_A]),
+	[STATE_B] = SMF_CREATE_STATE_CHAINED(state_b_entry, state_b_run,
+					     state_b_exit,
+					     &test_states[PARENT_AB],
+					     &test_states[PARENT_AB],
+					     &test_states[STATE_B]),
+	[STATE_C] = SMF_CREATE_STATE_CHAINED(state_c_entry, state_c_run,
+					     state_c_exit,
+					     &test_states[PARENT_C],
+					     &test_states[PARENT_C],
+					     &test_states[STATE_C]),
+	[STATE_D] = SMF_CREATE_STATE_CHAINED(state_d_entry, state_d_run,
+					     state_d_exit, NULL,
+					     &test_states[STATE_D]),
+};
+#else
 static const struct smf_state test_states[] = {
 	[PARENT_AB] = SMF_CREATE_STATE(parent_ab_entry, parent_ab_run,
 				       parent_ab_exit, NULL),
@@ -350,6 +378,7 @@ static const struct smf_state test_states[] = {
 	[STATE_D] = SMF_CREATE_STATE(state_d_entry, state_d_run, state_d_exit,
 				     NULL),
 };
+#endif
 
 ZTEST(smf_tests, test_smf_hierarchical)
 {
@@ -757,6 +757,125 @@ ZTEST(coap, test_block2_size)
 	}
 }
 
+#define BLOCK_WINDOW_TRANSFER_SIZE 160
+
+static void window_request(struct coap_block_window *window,
+			   struct coap_packet *req, uint8_t *data,
+			   size_t expected)
+{
+	struct coap_block_context blk;
+	struct coap_pending *pending;
+	int r;
+
+	r = coap_block_window_next(window, &blk);
+	zassert_equal(r, 0, "No block to request");
+	zassert_equal(blk.current, expected,
+		      "Unexpected block offset requested");
+
+	r = coap_packet_init(req, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET,
+			     coap_next_id());
+	zassert_equal(r, 0, "Unable to initialize request");
+
+	r = coap_append_block2_option(req, &blk);
+	zassert_equal(r, 0, "Unable to append block2 option");
+
+	pending = coap_block_window_register(window, req,
+					     (struct sockaddr *)&dummy_addr,
+					     0);
+	zassert_not_null(pending, "Unable to track block request");
+	zassert_true(coap_pending_cycle(pending), "Unable to arm block");
+}
+
+static void window_respond(struct coap_block_window *window,
+			   struct coap_packet *req, size_t expected)
+{
+	struct coap_block_context rsp_ctx;
+	struct coap_packet rsp;
+	uint8_t payload[64] = { 0 };
+	uint8_t *data = data_buf[1];
+	size_t offset = 0;
+	int payload_len;
+	int r;
+
+	coap_block_transfer_init(&rsp_ctx, COAP_BLOCK_64,
+				 BLOCK_WINDOW_TRANSFER_SIZE);
+	rsp_ctx.current = expected;
+
+	r = coap_packet_init(&rsp, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_ACK, 0, NULL,
+			     COAP_RESPONSE_CODE_CONTENT,
+			     coap_header_get_id(req));
+	zassert_equal(r, 0, "Unable to initialize response");
+
+	r = coap_append_block2_option(&rsp, &rsp_ctx);
+	zassert_equal(r, 0, "Unable to append block2 option");
+
+	if (expected == 0) {
+		r = coap_append_size2_option(&rsp, &rsp_ctx);
+		zassert_equal(r, 0, "Unable to append size2 option");
+	}
+
+	r = coap_packet_append_payload_marker(&rsp);
+	zassert_equal(r, 0, "Unable to append payload marker");
+
+	payload_len = MIN(sizeof(payload),
+			  BLOCK_WINDOW_TRANSFER_SIZE - expected);
+
+	r = coap_packet_append_payload(&rsp, payload, payload_len);
+	zassert_equal(r, 0, "Unable to append payload");
+
+	r = coap_block_window_received(window, &rsp, &offset);
+	zassert_equal(r, 0, "Response did not match a block in flight");
+	zassert_equal(offset, expected, "Unexpected block offset confirmed");
+}
+
+ZTEST(coap, test_block2_window)
+{
+	uint8_t req_data[CONFIG_COAP_BLOCK_WINDOW_SIZE][COAP_BUF_SIZE];
+	struct coap_packet req[CONFIG_COAP_BLOCK_WINDOW_SIZE];
+	struct coap_block_window window;
+	struct coap_block_context blk;
+	int r;
+
+	/* Total size is not known up front, it is learned from the
+	 * size2 option of the first response.
+	 */
+	r = coap_block_window_init(&window, COAP_OPTION_BLOCK2,
+				   COAP_BLOCK_64, 0);
+	zassert_equal(r, 0, "Unable to initialize window");
+
+	/* Fill the window */
+	window_request(&window, &req[0], req_data[0], 0);
+	window_request(&window, &req[1], req_data[1], 64);
+
+	r = coap_block_window_next(&window, &blk);
+	zassert_equal(r, -EAGAIN, "Window should be full");
+
+	zassert_not_null(coap_block_window_next_to_expire(&window),
+			 "Blocks in flight should be tracked for expiry");
+
+	/* Confirming the first block opens the window for the last one */
+	window_respond(&window, &req[0], 0);
+	zassert_false(coap_block_window_is_complete(&window),
+		      "Transfer should not be complete");
+
+	window_request(&window, &req[0], req_data[0], 128);
+
+	/* Blocks may be confirmed in any order */
+	window_respond(&window, &req[1], 64);
+	window_respond(&window, &req[0], 128);
+
+	zassert_true(coap_block_window_is_complete(&window),
+		     "Transfer should be complete");
+
+	r = coap_block_window_next(&window, &blk);
+	zassert_equal(r, -ENOENT, "No more blocks should be requested");
+
+	zassert_is_null(coap_block_window_next_to_expire(&window),
+			"No block should be in flight");
+}
+
 ZTEST(coap, test_retransmit_second_round)
 {
 	struct coap_packet cpkt;
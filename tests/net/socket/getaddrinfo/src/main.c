@@ -662,4 +662,76 @@ ZTEST(net_socket_getaddrinfo, test_getaddrinfo_null_host)
 	zsock_freeaddrinfo(res);
 }
 
+ZTEST(net_socket_getaddrinfo, test_getaddrinfo_async_num_ipv4)
+{
+#if defined(CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC)
+	struct zsock_addrinfo_async req;
+	struct zsock_addrinfo *res = NULL;
+	struct sockaddr_in *saddr;
+	struct pollfd pfd;
+	int ret;
+
+	/* A literal address completes without any DNS query so the
+	 * eventfd must be readable right away.
+	 */
+	ret = zsock_getaddrinfo_async("1.2.3.255", "65534", NULL, &req);
+	zassert_equal(ret, 0, "Invalid result");
+
+	pfd.fd = req.fd;
+	pfd.events = POLLIN;
+	ret = poll(&pfd, 1, 0);
+	zassert_equal(ret, 1, "Request not completed");
+
+	ret = zsock_getaddrinfo_async_finish(&req, &res);
+	zassert_equal(ret, 0, "Invalid result");
+	zassert_not_null(res, "");
+	zassert_is_null(res->ai_next, "");
+	zassert_equal(res->ai_family, AF_INET, "");
+
+	saddr = (struct sockaddr_in *)res->ai_addr;
+	zassert_equal(saddr->sin_family, AF_INET, "");
+	zassert_equal(saddr->sin_port, htons(65534), "");
+	zsock_freeaddrinfo(res);
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(net_socket_getaddrinfo, test_getaddrinfo_async_cancel)
+{
+#if defined(CONFIG_NET_SOCKETS_GETADDRINFO_ASYNC)
+	struct zsock_addrinfo_async req;
+	struct pollfd pfd;
+	int ret;
+
+	queries_received = 0;
+
+	ret = zsock_getaddrinfo_async(QUERY_HOST, NULL, NULL, &req);
+	zassert_equal(ret, 0, "Invalid result");
+
+	/* Unlike the blocking variant, the call returns before the
+	 * queries have reached the local server, so wait for them.
+	 */
+	zassert_equal(sys_sem_take(&wait_data, WAIT_TIME), 0,
+		      "Did not receive all queries");
+	zassert_equal(sys_sem_take(&wait_data, WAIT_TIME), 0,
+		      "Did not receive all queries");
+
+	zassert_equal(queries_received, 2,
+		      "Did not receive both IPv4 and IPv6 query");
+
+	/* The local server never answers so the request is still
+	 * pending and can be canceled.
+	 */
+	pfd.fd = req.fd;
+	pfd.events = POLLIN;
+	ret = poll(&pfd, 1, 0);
+	zassert_equal(ret, 0, "Request completed unexpectedly");
+
+	zsock_getaddrinfo_async_cancel(&req);
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(net_socket_getaddrinfo, NULL, test_getaddrinfo_setup, NULL, NULL, NULL);
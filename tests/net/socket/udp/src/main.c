@@ -1294,4 +1294,51 @@ ZTEST(net_socket_udp, test_23_v6_dgram_overflow)
 			    BUF_AND_SIZE(test_str_all_tx_bufs));
 }
 
+ZTEST(net_socket_udp, test_24_so_busy_poll)
+{
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	socklen_t optlen;
+	uint32_t optval;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(server_sock,
+		  (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	optval = 50U;
+	rv = setsockopt(server_sock, SOL_SOCKET, SO_BUSY_POLL, &optval,
+			sizeof(optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	optval = 0U;
+	optlen = sizeof(optval);
+	rv = getsockopt(server_sock, SOL_SOCKET, SO_BUSY_POLL, &optval,
+			&optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optval, 50U, "invalid busy poll window");
+	zassert_equal(optlen, sizeof(optval), "invalid optlen");
+
+	/* The blocking receives below complete through either the polling
+	 * window or the condvar, depending on when the datagram arrives.
+	 */
+	comm_sendto_recvfrom(client_sock,
+			     (struct sockaddr *)&client_addr,
+			     sizeof(client_addr),
+			     server_sock,
+			     (struct sockaddr *)&server_addr,
+			     sizeof(server_addr));
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 ZTEST_SUITE(net_socket_udp, NULL, NULL, NULL, NULL, NULL);
@@ -564,9 +564,11 @@ ZTEST(posix_apis, test_posix_pthread_create_negative)
 	pthread_t pthread1;
 	pthread_attr_t attr1;
 
-	/* create pthread without attr initialized */
-	ret = pthread_create(&pthread1, NULL, create_thread1, (void *)1);
-	zassert_equal(ret, EINVAL, "create thread with NULL successful");
+	if (!IS_ENABLED(CONFIG_PTHREAD_STACK_POOL)) {
+		/* create pthread without attr initialized */
+		ret = pthread_create(&pthread1, NULL, create_thread1, (void *)1);
+		zassert_equal(ret, EINVAL, "create thread with NULL successful");
+	}
 
 	/* initialized attr without set stack to create thread */
 	ret = pthread_attr_init(&attr1);
@@ -582,6 +584,25 @@ ZTEST(posix_apis, test_posix_pthread_create_negative)
 	zassert_equal(ret, EINVAL, "create thread with 0 size");
 }
 
+ZTEST(posix_apis, test_pthread_stack_pool)
+{
+	void *unused;
+	pthread_t pthread1;
+
+	if (!IS_ENABLED(CONFIG_PTHREAD_STACK_POOL)) {
+		ztest_test_skip();
+	}
+
+	/* Stacks come from the pool, no attribute object is needed. If we
+	 * are leaking pool stacks, then this loop will never complete.
+	 */
+	for (size_t i = 0; i < CONFIG_MAX_PTHREAD_COUNT * 2; ++i) {
+		zassert_ok(pthread_create(&pthread1, NULL, create_thread1, NULL),
+			   "unable to create thread %zu", i);
+		zassert_ok(pthread_join(pthread1, &unused), "unable to join thread %zu", i);
+	}
+}
+
 ZTEST(posix_apis, test_pthread_descriptor_leak)
 {
 	void *unused;
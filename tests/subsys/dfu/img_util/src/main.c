@@ -165,4 +165,50 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK_PIPELINED
+ZTEST(img_util, test_check_flash_pipelined)
+{
+	/* Same vectors as test_check_flash */
+	uint8_t tst_vec[] = { 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+			      0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+			      0x0a, 0x66, 0x65, 0x64, 0x63, 0x62, 0x61, 0x39,
+			      0x38, 0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x31,
+			      0x30, 0x0a };
+	uint8_t tst_sha[] = { 0xc6, 0xb6, 0x7c, 0x46, 0xe7, 0x2e, 0x14, 0x17,
+			      0x49, 0xa4, 0xd2, 0xf1, 0x38, 0x58, 0xb2, 0xa7,
+			      0x54, 0xaf, 0x6d, 0x39, 0x50, 0x6b, 0xd5, 0x41,
+			      0x90, 0xf6, 0x18, 0x1a, 0xe0, 0xc2, 0x7f, 0x98 };
+
+	const struct device *crypto_dev =
+		device_get_binding(CONFIG_CRYPTO_MBEDTLS_SHIM_DRV_NAME);
+	struct flash_img_check fic = { tst_sha, sizeof(tst_vec) };
+	struct flash_img_context ctx;
+	int ret;
+
+	zassert_not_null(crypto_dev, "Crypto device missing");
+
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init 1");
+	ret = flash_area_erase(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)\n", ret);
+	ret = flash_img_buffered_write(&ctx, tst_vec, sizeof(tst_vec), true);
+	zassert_true(ret == 0, "Flash img buffered write\n");
+
+	ret = flash_img_check_pipelined(NULL, &fic, SLOT1_PARTITION_ID,
+					crypto_dev);
+	zassert_true(ret == -EINVAL, "Flash img check pipelined params\n");
+	ret = flash_img_check_pipelined(&ctx, &fic, SLOT1_PARTITION_ID, NULL);
+	zassert_true(ret == -EINVAL, "Flash img check pipelined dev\n");
+
+	ret = flash_img_check_pipelined(&ctx, &fic, SLOT1_PARTITION_ID,
+					crypto_dev);
+	zassert_true(ret == 0, "Flash img check pipelined\n");
+
+	tst_sha[0] = 0x00;
+	ret = flash_img_check_pipelined(&ctx, &fic, SLOT1_PARTITION_ID,
+					crypto_dev);
+	zassert_true(ret == -EILSEQ, "Flash img check pipelined wrong sha\n");
+}
+#endif /* CONFIG_IMG_ENABLE_IMAGE_CHECK_PIPELINED */
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
@@ -217,6 +217,55 @@ ZTEST(device_runtime_api, test_api)
 	zassert_equal(ret, 0);
 }
 
+/**
+ * @brief Test the autosuspend delay.
+ *
+ * Scenarios tested:
+ *
+ * - get + put with a delay configured (suspend is deferred)
+ * - get before the delay expires (pending suspend is cancelled)
+ * - suspend happens after the delay expires
+ */
+ZTEST(device_runtime_api, test_autosuspend_delay)
+{
+	int ret;
+	enum pm_device_state state;
+
+	ret = pm_device_runtime_autosuspend_delay_set(dev, 50);
+	zassert_equal(ret, 0);
+
+	/* usage: 0, +1, resume: yes */
+	ret = pm_device_runtime_get(dev);
+	zassert_equal(ret, 0);
+
+	/* usage: 1, -1, suspend: deferred by the delay */
+	ret = pm_device_runtime_put(dev);
+	zassert_equal(ret, 0);
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDING);
+
+	/* usage: 0, +1, resume: no (pending suspend is cancelled) */
+	ret = pm_device_runtime_get(dev);
+	zassert_equal(ret, 0);
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+
+	/* usage: 1, -1, suspend: yes (once the delay expires) */
+	ret = pm_device_runtime_put(dev);
+	zassert_equal(ret, 0);
+
+	k_sleep(K_MSEC(100));
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+
+	/* restore immediate suspend for the other tests */
+	ret = pm_device_runtime_autosuspend_delay_set(dev, 0);
+	zassert_equal(ret, 0);
+}
+
 static int pm_unsupported_init(const struct device *dev)
 {
 	return 0;
@@ -234,6 +283,7 @@ ZTEST(device_runtime_api, test_unsupported)
 	zassert_equal(pm_device_runtime_disable(dev), -ENOTSUP, "");
 	zassert_equal(pm_device_runtime_get(dev), -ENOTSUP, "");
 	zassert_equal(pm_device_runtime_put(dev), -ENOTSUP, "");
+	zassert_equal(pm_device_runtime_autosuspend_delay_set(dev, 10), -ENOTSUP, "");
 }
 
 void *device_runtime_api_setup(void)
@@ -244,6 +244,42 @@ ZTEST(policy_api, test_pm_policy_next_state_default_latency)
 	pm_policy_latency_request_remove(&req1);
 	zassert_equal(latency_cb_call_cnt, 1);
 }
+
+#ifdef CONFIG_PM_POLICY_RESIDENCY_PREDICTOR
+/**
+ * @brief Test the behavior of pm_policy_next_state() when the residency
+ * predictor is enabled (CONFIG_PM_POLICY_RESIDENCY_PREDICTOR=y).
+ */
+ZTEST(policy_api, test_pm_policy_next_state_default_residency)
+{
+	const struct pm_state_info *next;
+
+	/* without history the scheduled timeout allows the deepest state */
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1100000));
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* short observed residencies suppress the deep state, even when the
+	 * next scheduled timeout is far away
+	 */
+	for (int i = 0; i < 8; i++) {
+		pm_policy_residency_record(0U, k_us_to_ticks_floor32(200000));
+	}
+
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1100000));
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* long observed residencies allow the deep state again */
+	for (int i = 0; i < 64; i++) {
+		pm_policy_residency_record(0U, k_us_to_ticks_floor32(2200000));
+	}
+
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1100000));
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+}
+#endif /* CONFIG_PM_POLICY_RESIDENCY_PREDICTOR */
 #else
 ZTEST(policy_api, test_pm_policy_next_state_default)
 {
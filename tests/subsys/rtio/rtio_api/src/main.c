@@ -423,6 +423,99 @@ ZTEST(rtio_api, test_rtio_multiple_chains)
 
 
 
+RTIO_EXECUTOR_CONCURRENT_DEFINE(multishot_exec, 1);
+RTIO_DEFINE(r_multishot, (struct rtio_executor *)&multishot_exec, 4, 4);
+
+RTIO_IODEV_TEST_DEFINE(iodev_test_multishot, 1);
+
+/**
+ * @brief Test multishot requests
+ *
+ * Ensures that a multishot submission is re-armed by the concurrent
+ * executor, produces one completion event per completion of the iodev,
+ * and is released once cancelled.
+ */
+ZTEST(rtio_api, test_rtio_multishot)
+{
+	int res;
+	uintptr_t userdata = 42;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	struct rtio *r = &r_multishot;
+
+	rtio_iodev_test_init(&iodev_test_multishot);
+
+	sqe = rtio_spsc_acquire(r->sq);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_multishot, &userdata);
+	sqe->flags |= RTIO_SQE_MULTISHOT;
+
+	res = rtio_submit(r, 1);
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	for (int i = 0; i < 3; i++) {
+		TC_PRINT("consume multishot completion %d\n", i);
+		cqe = rtio_cqe_consume_block(r);
+		zassert_not_null(cqe, "Expected a valid cqe");
+		zassert_ok(cqe->result, "Result should be ok");
+		zassert_equal_ptr(cqe->userdata, &userdata, "Expected userdata back");
+		rtio_spsc_release(r->cq);
+	}
+
+	TC_PRINT("cancelling multishot submission\n");
+	rtio_sqe_cancel(sqe);
+
+	/* Consume the remaining completion(s) until the executor has
+	 * observed the cancellation and released the submission
+	 */
+	for (int i = 0; rtio_sqe_acquirable(r) != 4 && i < 100; i++) {
+		cqe = rtio_spsc_consume(r->cq);
+		if (cqe != NULL) {
+			zassert_ok(cqe->result, "Result should be ok");
+			rtio_spsc_release(r->cq);
+		} else {
+			k_sleep(K_MSEC(1));
+		}
+	}
+
+	zassert_equal(rtio_sqe_acquirable(r), 4,
+		      "Cancelled multishot sqe should be released");
+}
+
+RTIO_EXECUTOR_CONCURRENT_DEFINE(poll_exec, 1);
+RTIO_DEFINE(r_poll, (struct rtio_executor *)&poll_exec, 4, 4);
+
+RTIO_IODEV_TEST_POLL_DEFINE(iodev_test_poll, 1);
+
+/**
+ * @brief Test busy-polled completions
+ *
+ * Ensures that rtio_cqe_poll() drives a doorbell-less iodev to
+ * completion and consumes the resulting completion queue event without
+ * any interrupt involved.
+ */
+ZTEST(rtio_api, test_rtio_cqe_poll)
+{
+	int res;
+	uintptr_t userdata = 7;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	struct rtio *r = &r_poll;
+
+	sqe = rtio_spsc_acquire(r->sq);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_poll, &userdata);
+
+	res = rtio_submit(r, 0);
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	cqe = rtio_cqe_poll(r);
+	zassert_not_null(cqe, "Expected a valid cqe");
+	zassert_ok(cqe->result, "Result should be ok");
+	zassert_equal_ptr(cqe->userdata, &userdata, "Expected userdata back");
+	rtio_spsc_release(r->cq);
+}
+
 #ifdef CONFIG_USERSPACE
 K_APPMEM_PARTITION_DEFINE(rtio_partition);
 K_APP_BMEM(rtio_partition) uint8_t syscall_bufs[4];
@@ -90,4 +90,37 @@ static inline void rtio_iodev_test_init(const struct rtio_iodev *test)
 	static struct rtio_iodev_test_data _iodev_data_##name;                                     \
 	RTIO_IODEV_DEFINE(name, &rtio_iodev_test_api, qsize, &_iodev_data_##name)
 
+/**
+ * A doorbell-less iodev which never interrupts: a request stays pending
+ * until the poll operation is called, simulating hardware whose status
+ * register has to be checked.
+ */
+static void rtio_iodev_test_poll_submit(const struct rtio_sqe *sqe, struct rtio *r)
+{
+	struct rtio_iodev_test_data *data = sqe->iodev->data;
+
+	data->sqe = sqe;
+	data->r = r;
+}
+
+static void rtio_iodev_test_poll(const struct rtio_iodev *iodev)
+{
+	struct rtio_iodev_test_data *data = iodev->data;
+	const struct rtio_sqe *sqe = data->sqe;
+
+	if (sqe != NULL) {
+		data->sqe = NULL;
+		rtio_sqe_ok(data->r, sqe, 0);
+	}
+}
+
+static const struct rtio_iodev_api rtio_iodev_test_poll_api = {
+	.submit = rtio_iodev_test_poll_submit,
+	.poll = rtio_iodev_test_poll,
+};
+
+#define RTIO_IODEV_TEST_POLL_DEFINE(name, qsize)                                                   \
+	static struct rtio_iodev_test_data _iodev_data_##name;                                     \
+	RTIO_IODEV_DEFINE(name, &rtio_iodev_test_poll_api, qsize, &_iodev_data_##name)
+
 #endif /* RTIO_IODEV_TEST_H_ */
@@ -501,6 +501,94 @@ ZTEST(basic, test_hard_channel)
 	zassert_equal(err, -ENOMSG, "Err must be -ENOMSG, the channel message is invalid");
 }
 
+ZBUS_SUBSCRIBER_DEFINE_WITH_POLICY(batch_sub, 4, ZBUS_DELIVERY_BATCH, 3);
+
+ZBUS_SUBSCRIBER_DEFINE_WITH_POLICY(coalesce_sub, 1, ZBUS_DELIVERY_COALESCE, 0);
+
+ZBUS_SUBSCRIBER_DEFINE_WITH_POLICY(rate_sub, 4, ZBUS_DELIVERY_RATE_LIMIT, 100);
+
+ZBUS_CHAN_DEFINE(policy_chan,	    /* Name */
+		 struct action_msg, /* Message type */
+
+		 NULL,						    /* Validator */
+		 NULL,						    /* User data */
+		 ZBUS_OBSERVERS(batch_sub, coalesce_sub, rate_sub), /* observers */
+		 ZBUS_MSG_INIT(0)				    /* Initial value */
+);
+
+ZTEST(basic, test_delivery_policies)
+{
+	const struct zbus_channel *chan;
+	struct action_msg a = {.status = true};
+
+	for (int i = 0; i < 3; ++i) {
+		zassert_equal(0, zbus_chan_pub(&policy_chan, &a, K_MSEC(200)), NULL);
+	}
+
+	/* Batch-3: three publications turn into a single notification */
+	zassert_equal(0, zbus_sub_wait(&batch_sub, &chan, K_NO_WAIT), NULL);
+	zassert_equal_ptr(chan, &policy_chan, NULL);
+	zassert_equal(-ENOMSG, zbus_sub_wait(&batch_sub, &chan, K_NO_WAIT),
+		      "Only one notification must be delivered per three publications");
+
+	/* Coalesce: the queue of size one holds a single pending notification and
+	 * the publisher was never blocked by the full queue
+	 */
+	zassert_equal(0, zbus_sub_wait(&coalesce_sub, &chan, K_NO_WAIT), NULL);
+	zassert_equal_ptr(chan, &policy_chan, NULL);
+	zassert_equal(-ENOMSG, zbus_sub_wait(&coalesce_sub, &chan, K_NO_WAIT), NULL);
+
+	/* Rate-limit: only the first of the three back-to-back publications is
+	 * delivered inside the interval
+	 */
+	zassert_equal(0, zbus_sub_wait(&rate_sub, &chan, K_NO_WAIT), NULL);
+	zassert_equal(-ENOMSG, zbus_sub_wait(&rate_sub, &chan, K_NO_WAIT), NULL);
+
+	k_msleep(150);
+
+	zassert_equal(0, zbus_chan_pub(&policy_chan, &a, K_MSEC(200)), NULL);
+	zassert_equal(0, zbus_sub_wait(&rate_sub, &chan, K_NO_WAIT),
+		      "A delivery must happen again after the interval");
+}
+
+ZBUS_CHAN_DEFINE_SEQLOCK(seqlock_chan,	   /* Name */
+			 struct version_msg, /* Message type */
+
+			 NULL,			    /* Validator */
+			 NULL,			    /* User data */
+			 ZBUS_OBSERVERS(fast_lis),  /* observers */
+			 ZBUS_MSG_INIT(.major = 0, .minor = 1,
+				       .build = 2) /* Initial value */
+);
+
+ZTEST(basic, test_seqlock_channel)
+{
+	count_fast = 0;
+
+	struct version_msg v = {.major = 3, .minor = 4, .build = 5};
+
+	zassert_equal(0, zbus_chan_pub(&seqlock_chan, &v, K_NO_WAIT),
+		      "Publication must never block on a seqlock channel");
+
+	zassert_equal(count_fast, 1, "The listener must be notified");
+
+	struct version_msg current = {0};
+
+	zassert_equal(0, zbus_chan_read(&seqlock_chan, &current, K_NO_WAIT), NULL);
+
+	zassert_equal(v.major, current.major, "Major must be equal");
+	zassert_equal(v.minor, current.minor, "Minor must be equal");
+	zassert_equal(v.build, current.build, "Build must be equal");
+
+	/* Seqlock channels cannot be claimed, the publisher would not stop */
+	zassert_equal(-ENOTSUP, zbus_chan_claim(&seqlock_chan, K_NO_WAIT), NULL);
+	zassert_equal(-ENOTSUP, zbus_chan_finish(&seqlock_chan), NULL);
+
+	zassert_equal(0, zbus_chan_notify(&seqlock_chan, K_NO_WAIT), NULL);
+
+	zassert_equal(count_fast, 2, "The listener must be notified");
+}
+
 ZTEST(basic, test_specification_based__zbus_obs_set_enable)
 {
 	count_fast = 0;
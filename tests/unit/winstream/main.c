@@ -3,12 +3,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <zephyr/ztest.h>
+
+#define CONFIG_WINSTREAM_MULTIPRODUCER 1
 #include <zephyr/sys/winstream.h>
 
 /* This, uh, seems to be the standard way to unit test library code.
  * Or so I gather from tests/unit/rbtree ...
  */
 #include "../../../lib/os/winstream.c"
+#include "../../../lib/os/winstream_mp.c"
 
 #define BUFLEN 64
 
@@ -97,4 +100,56 @@ ZTEST(winstream, test_winstream)
 	}
 }
 
+ZTEST(winstream, test_winstream_mp)
+{
+	struct sys_winstream_mp mp;
+	char readback[BUFLEN + 1];
+	uint32_t seq = 0, seq0, bytes;
+
+	sys_winstream_mp_init(&mp, wsmem, BUFLEN);
+
+	/* Simple round trip */
+	sys_winstream_mp_write(&mp, "a", 1);
+	bytes = sys_winstream_read(mp.ws, &seq, readback, sizeof(readback));
+	zassert_true(bytes == 1, "");
+	zassert_true(seq == 1, "");
+	zassert_true(readback[0] == 'a', "");
+
+	/* A write behind a still-copying writer isn't published until
+	 * that writer finishes and the stream gets flushed
+	 */
+	atomic_add(&mp.claim, 1); /* fake a stalled writer */
+	sys_winstream_mp_write(&mp, "b", 1);
+	bytes = sys_winstream_read(mp.ws, &seq, readback, sizeof(readback));
+	zassert_true(bytes == 0, "");
+
+	mp.ws->data[1] = 'x'; /* the stalled writer's byte */
+	atomic_add(&mp.done, 1);
+	sys_winstream_mp_flush(&mp);
+	bytes = sys_winstream_read(mp.ws, &seq, readback, sizeof(readback));
+	zassert_true(bytes == 2, "");
+	zassert_true(readback[0] == 'x' && readback[1] == 'b', "");
+
+	/* Loop with a prime chunk size to stress the wrap edges */
+	int n = 13;
+	char msg2[13];
+
+	for (int i = 0; i < (n + 1) * (int)(mp.ws->len + 1); i++) {
+		memset(msg2, 'A' + (i % 26), n);
+		seq0 = seq;
+		memset(readback, 0, sizeof(readback));
+		sys_winstream_mp_write(&mp, msg2, n);
+		bytes = sys_winstream_read(mp.ws, &seq, readback, sizeof(readback));
+		zassert_true(bytes == n, "");
+		zassert_true(seq == seq0 + n, "");
+		zassert_true(strncmp(readback, msg2, n) == 0, "");
+	}
+
+	/* Oversized writes keep the tail of the data */
+	sys_winstream_mp_write(&mp, msg, strlen(msg));
+	bytes = sys_winstream_read(mp.ws, &seq, readback, sizeof(readback));
+	zassert_true(bytes == mp.ws->len - 1, "");
+	zassert_true(memcmp(readback, msg + strlen(msg) - bytes, bytes) == 0, "");
+}
+
 ZTEST_SUITE(winstream, NULL, NULL, NULL, NULL, NULL);